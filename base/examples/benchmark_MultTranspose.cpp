@@ -0,0 +1,127 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/algorithm/AlgorithmEvaluationTransposed.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearModifiedBasis.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+
+/**
+ * Transposed evaluation that merges the thread-private results in a critical section, i.e.,
+ * the way AlgorithmMultipleEvaluation::mult_transpose used to work. Serves as reference.
+ */
+template <class BASIS>
+void multTransposeCritical(sgpp::base::GridStorage& storage, BASIS& basis,
+                           sgpp::base::DataVector& source, sgpp::base::DataMatrix& x,
+                           sgpp::base::DataVector& result) {
+  result.setAll(0.0);
+  size_t source_size = source.getSize();
+
+#pragma omp parallel
+  {
+    sgpp::base::DataVector privateResult(result.getSize(), 0.0);
+    sgpp::base::DataVector line(x.getNcols());
+    sgpp::base::AlgorithmEvaluationTransposed<BASIS> algoEvalTrans(storage);
+
+#pragma omp for schedule(static)
+    for (size_t i = 0; i < source_size; i++) {
+      x.getRow(i, line);
+      algoEvalTrans(basis, line, source[i], privateResult);
+    }
+
+#pragma omp critical
+    { result.add(privateResult); }
+  }
+}
+
+template <class BASIS>
+void benchmark(sgpp::base::Grid& grid, BASIS& basis, size_t level, size_t numPoints,
+               size_t repetitions) {
+  grid.getGenerator().regular(level);
+  sgpp::base::GridStorage& storage = grid.getStorage();
+  const size_t dim = storage.getDimension();
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  sgpp::base::DataMatrix dataset(numPoints, dim);
+  sgpp::base::DataVector source(numPoints);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      dataset.set(i, d, distribution(generator));
+    }
+
+    source[i] = distribution(generator);
+  }
+
+  sgpp::base::DataVector resultCritical(storage.getSize());
+  sgpp::base::DataVector resultReduction(storage.getSize());
+  std::unique_ptr<sgpp::base::OperationMultipleEval> opEval(
+      sgpp::op_factory::createOperationMultipleEval(grid, dataset));
+
+  auto begin = std::chrono::high_resolution_clock::now();
+
+  for (size_t r = 0; r < repetitions; r++) {
+    multTransposeCritical(storage, basis, source, dataset, resultCritical);
+  }
+
+  auto end = std::chrono::high_resolution_clock::now();
+  double durationCritical =
+      std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() /
+      static_cast<double>(repetitions);
+
+  begin = std::chrono::high_resolution_clock::now();
+
+  for (size_t r = 0; r < repetitions; r++) {
+    opEval->multTranspose(source, resultReduction);
+  }
+
+  end = std::chrono::high_resolution_clock::now();
+  double durationReduction =
+      std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() /
+      static_cast<double>(repetitions);
+
+  double maxDiff = 0.0;
+
+  for (size_t i = 0; i < storage.getSize(); i++) {
+    maxDiff = std::max(maxDiff, std::abs(resultCritical[i] - resultReduction[i]));
+  }
+
+  std::cout << grid.getTypeAsString() << ": dim = " << dim << ", grid points = "
+            << storage.getSize() << ", data points = " << numPoints << "\n";
+  std::cout << "  critical section merge: " << durationCritical << "ms\n";
+  std::cout << "  chunked reduction:      " << durationReduction << "ms\n";
+  std::cout << "  max. difference:        " << maxDiff << "\n";
+}
+
+int main() {
+  std::cout << "multTranspose benchmarks: \n";
+
+  const size_t dim = 5;
+  const size_t level = 7;
+  const size_t numPoints = 20000;
+  const size_t repetitions = 5;
+
+  std::unique_ptr<sgpp::base::Grid> linearGrid(sgpp::base::Grid::createLinearGrid(dim));
+  sgpp::base::SLinearBase linearBasis;
+  benchmark(*linearGrid, linearBasis, level, numPoints, repetitions);
+
+  std::unique_ptr<sgpp::base::Grid> modLinearGrid(sgpp::base::Grid::createModLinearGrid(dim));
+  sgpp::base::SLinearModifiedBase modLinearBasis;
+  benchmark(*modLinearGrid, modLinearBasis, level, numPoints, repetitions);
+
+  return 0;
+}
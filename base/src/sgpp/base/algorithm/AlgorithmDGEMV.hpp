@@ -11,6 +11,7 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 
 #include <sgpp/base/algorithm/GetAffectedBasisFunctions.hpp>
+#include <sgpp/base/tools/ThreadPrivateReduction.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -48,17 +49,16 @@ class AlgorithmDGEMV {
     typedef std::vector<std::pair<size_t, double> > IndexValVector;
 
     result.setAll(0.0);
+    ThreadPrivateReduction reduction(result);
 
     #pragma omp parallel
     {
       size_t source_size = source.getSize();
-      DataVector privateResult(result);
+      DataVector privateResult(result.getSize(), 0.0);
       DataVector line(x.getNcols());
       IndexValVector vec;
       GetAffectedBasisFunctions<BASIS> ga(storage);
 
-      privateResult.setAll(0.0);
-
       #pragma omp for schedule(static)
 
       for (size_t i = 0; i < source_size; i++) {
@@ -73,10 +73,7 @@ class AlgorithmDGEMV {
         }
       }
 
-      #pragma omp critical
-      {
-        result.add(privateResult);
-      }
+      reduction.reduce(privateResult);
     }
   }
   // implementation requires OpenMP 4.0 support
@@ -7,6 +7,7 @@
 #define ALGORITHMEVALUATION_HPP
 
 #include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBoundaryBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearStretchedBoundaryBasis.hpp>
@@ -72,6 +73,57 @@ class AlgorithmEvaluation {
    * @result result result of the function evaluation
    */
   double operator()(BASIS& basis, const DataVector& point, const DataVector& alpha) {
+    double result = 0.0;
+    auto accumulate = [&alpha, &result](size_t seq, double value) {
+      result += alpha[seq] * value;
+    };
+
+    traverse(basis, point, accumulate);
+    return result;
+  }
+
+  /**
+   * Evaluates several sparse grid functions at once, whose coefficients are given by
+   * the columns of a matrix. The affected basis functions are determined only once.
+   *
+   * @param basis a sparse grid basis
+   * @param point evaluation point within the domain
+   * @param alpha matrix of coefficients (one row per grid point, one column per function)
+   * @param[out] result values of the functions (resized to the number of columns of alpha)
+   */
+  void operator()(BASIS& basis, const DataVector& point, const DataMatrix& alpha,
+                  DataVector& result) {
+    const size_t numberOfColumns = alpha.getNcols();
+    result.resize(numberOfColumns);
+    result.setAll(0.0);
+
+    const double* alphaPtr = alpha.getPointer();
+    double* resultPtr = result.getPointer();
+    auto accumulate = [alphaPtr, resultPtr, numberOfColumns](size_t seq, double value) {
+      const double* alphaRow = alphaPtr + seq * numberOfColumns;
+
+      for (size_t j = 0; j < numberOfColumns; j++) {
+        resultPtr[j] += alphaRow[j] * value;
+      }
+    };
+
+    traverse(basis, point, accumulate);
+  }
+
+ protected:
+  GridStorage& storage;
+
+  /**
+   * Calls accumulate(i, phi_i(x)) for all basis functions that are non-zero at a given
+   * evaluation point x.
+   *
+   * @param basis a sparse grid basis
+   * @param point evaluation point within the domain
+   * @param accumulate functor that is called with the sequence number and the value of the
+   *                   basis functions
+   */
+  template <class ACCUMULATE>
+  void traverse(BASIS& basis, const DataVector& point, ACCUMULATE& accumulate) {
     GridStorage::grid_iterator working(storage);
 
     const size_t bits = sizeof(index_t) * 8;  // how many levels can we store in a index_type?
@@ -83,7 +135,7 @@ class AlgorithmEvaluation {
 
     for (size_t d = 0; d < dim; d++) {
       if (!bb->isContainingPoint(d, point[d])) {
-        return 0.0;
+        return;
       }
 
       newPoint[d] = bb->transformPointToUnitCube(d, point[d]);
@@ -102,16 +154,10 @@ class AlgorithmEvaluation {
       }
     }
 
-    double result = 0.0;
-    rec(basis, newPoint, 0, 1.0, working, source, alpha, result);
+    rec(basis, newPoint, 0, 1.0, working, source, accumulate);
     delete[] source;
-
-    return result;
   }
 
- protected:
-  GridStorage& storage;
-
   /**
    * Recursive traversal of the "tree" of basis functions for evaluation, used in operator().
    * For a given evaluation point \f$x\f$, it stores tuples (std::pair) of
@@ -123,13 +169,13 @@ class AlgorithmEvaluation {
    * @param value the value of the evaluation of the current basis function up to (excluding) dimension current_dim (product of the evaluations of the one-dimensional ones)
    * @param working iterator working on the GridStorage of the basis
    * @param source array of indices for each dimension (identifying the indices of the current grid point)
-   * @param alpha the spars grid's ansatzfunctions coefficients
-   * @param result reference to a double into which the result should be stored
+   * @param accumulate functor that is called with the sequence number and the value of the
+   *                   non-zero basis functions
    */
+  template <class ACCUMULATE>
   void rec(BASIS& basis, const DataVector& point, size_t current_dim,
            double value, GridStorage::grid_iterator& working,
-           index_t* source, const DataVector& alpha,
-           double& result) {
+           index_t* source, ACCUMULATE& accumulate) {
     const unsigned int BITS_IN_BYTE = 8;
     // maximum possible level for the index type
     const level_t max_level = static_cast<level_t>(sizeof(index_t) * BITS_IN_BYTE - 1);
@@ -151,9 +197,9 @@ class AlgorithmEvaluation {
         const double new_value = basis.eval(work_level, work_index, point[current_dim]) * value;
 
         if (current_dim == storage.getDimension() - 1) {
-          result += alpha[seq] * new_value;
+          accumulate(seq, new_value);
         } else {
-          rec(basis, point, current_dim + 1, new_value, working, source, alpha, result);
+          rec(basis, point, current_dim + 1, new_value, working, source, accumulate);
         }
       }
 
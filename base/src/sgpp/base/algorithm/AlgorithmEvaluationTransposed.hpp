@@ -7,6 +7,7 @@
 #define ALGORITHMEVALUATIONTRANSPOSED_HPP
 
 #include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBoundaryBasis.hpp>
 
@@ -46,6 +47,54 @@ class AlgorithmEvaluationTransposed {
    * @param result vector that will contain the local support of the given ansatzfuction for all evaluations points
    */
   void operator()(BASIS& basis, const DataVector& point, double alpha, DataVector& result) {
+    auto accumulate = [alpha, &result](size_t seq, double value) {
+      result[seq] += alpha * value;
+    };
+
+    traverse(basis, point, accumulate);
+  }
+
+  /**
+   * Transposed evaluation for several vectors at once: adds
+   * \f$\phi_i(x) \cdot \mathbf{alpha}_j\f$ to the entries (i, j) of the result matrix
+   * for all basis functions \f$\phi_i\f$ that are non-zero at the evaluation point
+   * \f$x\f$. The affected basis functions are determined only once.
+   *
+   * @param basis a sparse grid basis
+   * @param point evaluation point within the domain
+   * @param alpha the coefficients of the evaluation point, one for every column of result
+   * @param result matrix with one row per grid point, to which the contributions are added
+   */
+  void operator()(BASIS& basis, const DataVector& point, const DataVector& alpha,
+                  DataMatrix& result) {
+    const size_t numberOfColumns = result.getNcols();
+    const double* alphaPtr = alpha.getPointer();
+    double* resultPtr = result.getPointer();
+    auto accumulate = [alphaPtr, resultPtr, numberOfColumns](size_t seq, double value) {
+      double* resultRow = resultPtr + seq * numberOfColumns;
+
+      for (size_t j = 0; j < numberOfColumns; j++) {
+        resultRow[j] += alphaPtr[j] * value;
+      }
+    };
+
+    traverse(basis, point, accumulate);
+  }
+
+ protected:
+  GridStorage& storage;
+
+  /**
+   * Calls accumulate(i, phi_i(x)) for all basis functions that are non-zero at a given
+   * evaluation point x.
+   *
+   * @param basis a sparse grid basis
+   * @param point evaluation point within the domain
+   * @param accumulate functor that is called with the sequence number and the value of the
+   *                   basis functions
+   */
+  template <class ACCUMULATE>
+  void traverse(BASIS& basis, const DataVector& point, ACCUMULATE& accumulate) {
     GridStorage::grid_iterator working(storage);
 
     const size_t bits = sizeof(index_t) * 8;  // how many levels can we store in a index_type?
@@ -76,12 +125,10 @@ class AlgorithmEvaluationTransposed {
       }
     }
 
-    rec(basis, newPoint, 0, 1.0, working, source, alpha, result);
+    rec(basis, newPoint, 0, 1.0, working, source, accumulate);
     delete[] source;
   }
 
- protected:
-  GridStorage& storage;
 
   /**
    * Recursive traversal of the "tree" of basis functions for evaluation, used in operator().
@@ -94,13 +141,13 @@ class AlgorithmEvaluationTransposed {
    * @param value the value of the evaluation of the current basis function up to (excluding) dimension current_dim (product of the evaluations of the one-dimensional ones)
    * @param working iterator working on the GridStorage of the basis
    * @param source array of indices for each dimension (identifying the indices of the current grid point)
-   * @param alpha the coefficient of current ansatzfunction
-   * @param result vector that will contain the local support of the given ansatzfuction for all evaluations points
+   * @param accumulate functor that is called with the sequence number and the value of the
+   *                   non-zero basis functions
    */
+  template <class ACCUMULATE>
   void rec(BASIS& basis, DataVector& point, size_t current_dim,
            double value, GridStorage::grid_iterator& working,
-           index_t* source, double alpha,
-           DataVector& result) {
+           index_t* source, ACCUMULATE& accumulate) {
     const unsigned int BITS_IN_BYTE = 8;
     // maximum possible level for the index type
     const level_t max_level = static_cast<level_t>(sizeof(index_t) * BITS_IN_BYTE - 1);
@@ -125,9 +172,9 @@ class AlgorithmEvaluationTransposed {
         const double new_value = basis.eval(work_level, work_index, point[current_dim]) * value;
 
         if (current_dim == storage.getDimension() - 1) {
-          result[seq] += alpha * new_value;
+          accumulate(seq, new_value);
         } else {
-          rec(basis, point, current_dim + 1, new_value, working, source, alpha, result);
+          rec(basis, point, current_dim + 1, new_value, working, source, accumulate);
           if (!hint) working.resetToLevelOne(current_dim+1);
         }
       }
@@ -12,6 +12,7 @@
 
 #include <sgpp/base/algorithm/AlgorithmEvaluation.hpp>
 #include <sgpp/base/algorithm/AlgorithmEvaluationTransposed.hpp>
+#include <sgpp/base/tools/ThreadPrivateReduction.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -48,17 +49,14 @@ class AlgorithmMultipleEvaluation {
                       DataVector& result) {
     result.setAll(0.0);
     size_t source_size = source.getSize();
+    ThreadPrivateReduction reduction(result);
 
 #pragma omp parallel
     {
-      DataVector privateResult(result.getSize());
-      privateResult.setAll(0.0);
-
+      DataVector privateResult(result.getSize(), 0.0);
       DataVector line(x.getNcols());
       AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
 
-      privateResult.setAll(0.0);
-
 #pragma omp for schedule(static)
 
       for (size_t i = 0; i < source_size; i++) {
@@ -67,8 +65,7 @@ class AlgorithmMultipleEvaluation {
         AlgoEvalTrans(basis, line, source[i], privateResult);
       }
 
-#pragma omp critical
-      { result.add(privateResult); }
+      reduction.reduce(privateResult);
     }
   }
   // implementation requires OpenMP 4.0 support
@@ -124,6 +121,77 @@ class AlgorithmMultipleEvaluation {
       }
     }
   }
+
+  /**
+   * Performs a transposed mass evaluation for several vectors at once, i.e., computes
+   * \f$B^T S\f$ for a matrix \f$S\f$ of source vectors (columns). The data set is
+   * traversed only once for all columns.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source source vectors (one row per data point, one column per vector)
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result matrix (one row per grid point, one column per vector)
+   */
+  void mult_transpose(GridStorage& storage, BASIS& basis, DataMatrix& source, DataMatrix& x,
+                      DataMatrix& result) {
+    result.resizeRowsCols(storage.getSize(), source.getNcols());
+    result.setAll(0.0);
+    size_t source_size = source.getNrows();
+    ThreadPrivateReduction reduction(result);
+
+#pragma omp parallel
+    {
+      DataMatrix privateResult(result.getNrows(), result.getNcols(), 0.0);
+      DataVector line(x.getNcols());
+      DataVector sourceRow(source.getNcols());
+      AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
+
+#pragma omp for schedule(static)
+
+      for (size_t i = 0; i < source_size; i++) {
+        x.getRow(i, line);
+        source.getRow(i, sourceRow);
+
+        AlgoEvalTrans(basis, line, sourceRow, privateResult);
+      }
+
+      reduction.reduce(privateResult);
+    }
+  }
+
+  /**
+   * Performs a mass evaluation for several coefficient vectors at once, i.e., computes
+   * \f$B A\f$ for a matrix \f$A\f$ of coefficient vectors (columns). The data set is
+   * traversed only once for all columns.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficients (one row per grid point, one column per vector)
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result matrix (one row per data point, one column per vector)
+   */
+  void mult(GridStorage& storage, BASIS& basis, DataMatrix& source, DataMatrix& x,
+            DataMatrix& result) {
+    result.resizeRowsCols(x.getNrows(), source.getNcols());
+    size_t result_size = result.getNrows();
+
+#pragma omp parallel
+    {
+      DataVector line(x.getNcols());
+      DataVector values(source.getNcols());
+      AlgorithmEvaluation<BASIS> AlgoEval(storage);
+
+#pragma omp for schedule(static)
+
+      for (size_t i = 0; i < result_size; i++) {
+        x.getRow(i, line);
+
+        AlgoEval(basis, line, source, values);
+        result.setRow(i, values);
+      }
+    }
+  }
 };
 
 }  // namespace base
@@ -0,0 +1,167 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/SubspaceSupportIndex.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <numeric>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+SubspaceSupportIndex::SubspaceSupportIndex(GridStorage& storage, double supportRadius)
+    : storage(storage),
+      supportRadius(supportRadius),
+      modificationCount(0),
+      isBuilt(false),
+      lowerIndices(storage.getDimension()),
+      upperIndices(storage.getDimension()) {}
+
+void SubspaceSupportIndex::build() {
+  const size_t n = storage.getSize();
+  const size_t d = storage.getDimension();
+  std::map<std::vector<level_t>, std::vector<size_t>> seqNrsByLevel;
+  std::vector<level_t> level(d);
+
+  for (size_t i = 0; i < n; i++) {
+    const GridPoint& gp = storage[i];
+
+    for (size_t t = 0; t < d; t++) {
+      level[t] = gp.getLevel(t);
+    }
+
+    seqNrsByLevel[level].push_back(i);
+  }
+
+  subspaces.clear();
+  subspaces.reserve(seqNrsByLevel.size());
+
+  for (auto& levelAndSeqNrs : seqNrsByLevel) {
+    std::vector<size_t>& seqNrs = levelAndSeqNrs.second;
+    std::sort(seqNrs.begin(), seqNrs.end(), [this, d](size_t i, size_t j) {
+      const GridPoint& gpI = storage[i];
+      const GridPoint& gpJ = storage[j];
+
+      for (size_t t = 0; t < d; t++) {
+        if (gpI.getIndex(t) != gpJ.getIndex(t)) {
+          return gpI.getIndex(t) < gpJ.getIndex(t);
+        }
+      }
+
+      return false;
+    });
+
+    Subspace subspace;
+    subspace.level = levelAndSeqNrs.first;
+    subspace.indices.resize(seqNrs.size() * d);
+
+    for (size_t k = 0; k < seqNrs.size(); k++) {
+      const GridPoint& gp = storage[seqNrs[k]];
+
+      for (size_t t = 0; t < d; t++) {
+        subspace.indices[k * d + t] = gp.getIndex(t);
+      }
+    }
+
+    subspace.seqNrs.swap(seqNrs);
+    subspaces.push_back(std::move(subspace));
+  }
+
+  modificationCount = storage.getModificationCount();
+  isBuilt = true;
+}
+
+void SubspaceSupportIndex::getAffectedPoints(const DataVector& point,
+                                             std::vector<size_t>& result) {
+  const size_t n = storage.getSize();
+  const size_t d = storage.getDimension();
+  result.clear();
+
+  for (size_t t = 0; t < d; t++) {
+    if ((point[t] < 0.0) || (point[t] > 1.0)) {
+      result.resize(n);
+      std::iota(result.begin(), result.end(), 0);
+      return;
+    }
+  }
+
+  if (!isBuilt || (modificationCount != storage.getModificationCount())) {
+    build();
+  }
+
+  for (const Subspace& subspace : subspaces) {
+    bool isEmpty = false;
+
+    for (size_t t = 0; t < d; t++) {
+      const level_t l = subspace.level[t];
+      const double x = std::ldexp(point[t], static_cast<int>(l));
+      const double lower = std::max(std::ceil(x - supportRadius), 0.0);
+      const double maxIndex = static_cast<double>(static_cast<index_t>(1) << l);
+      const double upper = std::min(std::floor(x + supportRadius), maxIndex);
+
+      if (lower > upper) {
+        isEmpty = true;
+        break;
+      }
+
+      lowerIndices[t] = static_cast<index_t>(lower);
+      upperIndices[t] = static_cast<index_t>(upper);
+    }
+
+    if (!isEmpty) {
+      collect(subspace, 0, 0, subspace.seqNrs.size(), result);
+    }
+  }
+
+  // ascending sequence numbers preserve the summation order of a loop over all grid points
+  std::sort(result.begin(), result.end());
+}
+
+void SubspaceSupportIndex::collect(const Subspace& subspace, size_t t, size_t begin, size_t end,
+                                   std::vector<size_t>& result) const {
+  const size_t d = lowerIndices.size();
+  const index_t* indices = subspace.indices.data();
+
+  // first point with index >= lowerIndices[t] (the points in [begin, end) are sorted by the
+  // index in dimension t)
+  size_t first = begin;
+  size_t count = end - begin;
+
+  while (count > 0) {
+    const size_t step = count / 2;
+
+    if (indices[(first + step) * d + t] < lowerIndices[t]) {
+      first += step + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+
+  while ((first < end) && (indices[first * d + t] <= upperIndices[t])) {
+    const index_t i = indices[first * d + t];
+    size_t last = first + 1;
+
+    while ((last < end) && (indices[last * d + t] == i)) {
+      last++;
+    }
+
+    if (t == d - 1) {
+      result.insert(result.end(), subspace.seqNrs.begin() + first,
+                    subspace.seqNrs.begin() + last);
+    } else {
+      collect(subspace, t + 1, first, last, result);
+    }
+
+    first = last;
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,107 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SUBSPACESUPPORTINDEX_HPP
+#define SUBSPACESUPPORTINDEX_HPP
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/grid/LevelIndexTypes.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Spatial index of the points of a sparse grid for the evaluation of basis functions with
+ * compact support.
+ *
+ * The grid points are grouped by their level vectors (subspaces). Within each subspace, the
+ * points are sorted lexicographically by their index vectors. If the one-dimensional basis
+ * function of level l and index i vanishes for |2^l x - i| > r (r being the support radius
+ * in units of the mesh width), then in every dimension only the indices between
+ * 2^l x - r and 2^l x + r can be non-zero at x. These index ranges are located per subspace
+ * by binary search, dimension by dimension, so only the grid points whose supports contain
+ * the evaluation point are visited instead of all grid points.
+ *
+ * The index is built on first use and rebuilt whenever the grid points have been modified
+ * (e.g., by refinement or coarsening), as detected by GridStorage::getModificationCount().
+ */
+class SubspaceSupportIndex {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param storage         storage of the sparse grid
+   * @param supportRadius   support radius of the 1D basis functions in units of the mesh width
+   *                        (for all levels and indices)
+   */
+  SubspaceSupportIndex(GridStorage& storage, double supportRadius);
+
+  /**
+   * Determines the grid points whose basis functions may be non-zero at a given point.
+   * For points outside the unit cube, all grid points are returned since the support of
+   * some (e.g., modified) basis functions is not bounded there.
+   *
+   * @param       point   evaluation point in the unit cube
+   * @param[out]  result  sequence numbers of the grid points, in ascending order
+   */
+  void getAffectedPoints(const DataVector& point, std::vector<size_t>& result);
+
+ protected:
+  /**
+   * Grid points of one level vector.
+   */
+  struct Subspace {
+    /// level vector
+    std::vector<level_t> level;
+    /// index vectors of the grid points (row by row), sorted lexicographically
+    std::vector<index_t> indices;
+    /// sequence numbers of the grid points
+    std::vector<size_t> seqNrs;
+  };
+
+  /**
+   * Groups the grid points by their level vectors.
+   */
+  void build();
+
+  /**
+   * Collects the grid points of a subspace whose indices lie in the ranges
+   * [lowerIndices[t], upperIndices[t]], used recursively by getAffectedPoints().
+   *
+   * @param       subspace  subspace
+   * @param       t         current dimension
+   * @param       begin     first point of the subspace whose indices in the dimensions
+   *                        0, ..., t - 1 lie in the ranges
+   * @param       end       last point of these points plus one
+   * @param[out]  result    vector to append the sequence numbers to
+   */
+  void collect(const Subspace& subspace, size_t t, size_t begin, size_t end,
+               std::vector<size_t>& result) const;
+
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// support radius in units of the mesh width
+  double supportRadius;
+  /// subspaces of the grid
+  std::vector<Subspace> subspaces;
+  /// modification count of the storage when the index was built
+  uint64_t modificationCount;
+  /// whether the index has been built
+  bool isBuilt;
+  /// lower bounds of the indices (temporary vector)
+  std::vector<index_t> lowerIndices;
+  /// upper bounds of the indices (temporary vector)
+  std::vector<index_t> upperIndices;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* SUBSPACESUPPORTINDEX_HPP */
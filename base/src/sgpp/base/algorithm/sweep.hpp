@@ -11,6 +11,10 @@
 
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <vector>
 #include <utility>
 #include <iostream>
@@ -24,6 +28,13 @@ namespace base {
  * FUNC should be a class with overwritten operator(). For an example see laplace_up_functor in laplace.hpp.
  * It must be default constructable or copyable.
  * STORAGE must provide a grid_iterator supporting left_child, step_right, up, hint and seq.
+ *
+ * The *_parallel variants distribute the independent 1D poles of a sweep over OpenMP threads.
+ * Every thread works on its own copy of FUNC, which therefore must not share mutable state
+ * between copies and must only touch grid points of the pole it is called for (this holds
+ * for all hierarchisation and up/down functors). The roots of the poles are computed once
+ * per dimension and cached in the sweep object, so the grid must not be changed while the
+ * sweep object is in use.
  */
 template<class FUNC>
 class sweep {
@@ -38,6 +49,10 @@ class sweep {
   const std::vector<size_t> algoDims;
   /// number of algorithmic dimensions
   const size_t numAlgoDims_;
+  /// cached roots of the 1D poles for each sweep dimension (without boundaries)
+  std::vector<std::vector<GridPoint>> poles;
+  /// cached roots of the 1D poles for each sweep dimension (with boundaries)
+  std::vector<std::vector<GridPoint>> polesBoundary;
 
  public:
   /**
@@ -172,6 +187,229 @@ class sweep {
                        dim_sweep);
   }
 
+  /**
+   * Same as sweep1D, but the 1D poles are processed in parallel by OpenMP threads.
+   *
+   * @param source a DataVector containing the source coefficients of the grid points
+   * @param result a DataVector containing the result coefficients of the grid points
+   * @param dim_sweep the dimension in which the functor is executed
+   */
+  void sweep1D_parallel(DataVector& source, DataVector& result, size_t dim_sweep) {
+    runParallel(source, result, getPoles(dim_sweep, false), dim_sweep);
+  }
+
+  /**
+   * Same as sweep1D, but the 1D poles are processed in parallel by OpenMP threads.
+   *
+   * @param source a DataMatrix containing the source coefficients of the grid points
+   * @param result a DataMatrix containing the result coefficients of the grid points
+   * @param dim_sweep the dimension in which the functor is executed
+   */
+  void sweep1D_parallel(DataMatrix& source, DataMatrix& result, size_t dim_sweep) {
+    runParallel(source, result, getPoles(dim_sweep, false), dim_sweep);
+  }
+
+  /**
+   * Same as sweep1D_Boundary, but the 1D poles are processed in parallel by OpenMP threads.
+   *
+   * @param source a DataVector containing the source coefficients of the grid points
+   * @param result a DataVector containing the result coefficients of the grid points
+   * @param dim_sweep the dimension in which the functor is executed
+   */
+  void sweep1D_Boundary_parallel(DataVector& source, DataVector& result, size_t dim_sweep) {
+    runParallel(source, result, getPoles(dim_sweep, true), dim_sweep);
+  }
+
+  /**
+   * Same as sweep1D_Boundary, but the 1D poles are processed in parallel by OpenMP threads.
+   *
+   * @param source a DataMatrix containing the source coefficients of the grid points
+   * @param result a DataMatrix containing the result coefficients of the grid points
+   * @param dim_sweep the dimension in which the functor is executed
+   */
+  void sweep1D_Boundary_parallel(DataMatrix& source, DataMatrix& result, size_t dim_sweep) {
+    runParallel(source, result, getPoles(dim_sweep, true), dim_sweep);
+  }
+
+ protected:
+  /**
+   * Executes a copy of the functor on every pole, the poles are distributed among the threads.
+   *
+   * @param source coefficients of the sparse grid
+   * @param result coefficients of the function computed by sweep
+   * @param roots roots of the poles in direction dim_sweep
+   * @param dim_sweep static dimension, in this dimension the functor is executed
+   */
+  template <class CONTAINER>
+  void runParallel(CONTAINER& source, CONTAINER& result, const std::vector<GridPoint>& roots,
+                   size_t dim_sweep) {
+    const int64_t numRoots = static_cast<int64_t>(roots.size());
+
+#pragma omp parallel
+    {
+      FUNC threadFunctor(functor);
+      grid_iterator index(storage);
+
+#pragma omp for schedule(dynamic, 16)
+      for (int64_t i = 0; i < numRoots; i++) {
+        index.set(roots[i]);
+        threadFunctor(source, result, index, dim_sweep);
+      }
+    }
+  }
+
+  /**
+   * Returns the roots of all 1D poles in direction dim_sweep, i.e., the grid points at which
+   * sweep1D (or sweep1D_Boundary) calls the functor. They are computed on first use.
+   *
+   * @param dim_sweep static dimension, in this dimension the functor is executed
+   * @param boundary whether the boundary variant of the sweep is used
+   * @return roots of the poles
+   */
+  const std::vector<GridPoint>& getPoles(size_t dim_sweep, bool boundary) {
+    std::vector<std::vector<GridPoint>>& cache = (boundary ? polesBoundary : poles);
+
+    if (cache.size() != storage.getDimension()) {
+      cache.assign(storage.getDimension(), std::vector<GridPoint>());
+    }
+
+    std::vector<GridPoint>& roots = cache[dim_sweep];
+
+    if (roots.empty() && (storage.getSize() > 0)) {
+      std::vector<size_t> dim_list;
+
+      for (size_t i = 0; i < storage.getDimension(); i++) {
+        if (i != dim_sweep) {
+          dim_list.push_back(i);
+        }
+      }
+
+      grid_iterator index(storage);
+
+      if (boundary) {
+        index.resetToLevelZero();
+        collectPoles_Boundary_rec(index, dim_list, storage.getDimension() - 1, roots);
+      } else {
+        collectPoles_rec(index, dim_list, storage.getDimension() - 1, roots);
+      }
+    }
+
+    return roots;
+  }
+
+  /**
+   * Copies the current position of the iterator, which need not be contained in the storage.
+   *
+   * @param index current grid position
+   * @return grid point at the current position
+   */
+  GridPoint currentPoint(const grid_iterator& index) const {
+    GridPoint point(storage.getDimension());
+
+    for (size_t d = 0; d < storage.getDimension(); d++) {
+      level_t l;
+      index_t i;
+      index.get(d, l, i);
+      point.push(d, l, i);
+    }
+
+    point.rehash();
+    return point;
+  }
+
+  /**
+   * Traverses the grid like sweep_rec and stores the grid points at which the functor
+   * would be called.
+   *
+   * @param index current grid position
+   * @param dim_list list of dimensions, that should be handled
+   * @param dim_rem number of remaining dims
+   * @param roots vector to which the roots of the poles are appended
+   */
+  void collectPoles_rec(grid_iterator& index, std::vector<size_t>& dim_list, size_t dim_rem,
+                        std::vector<GridPoint>& roots) {
+    roots.push_back(currentPoint(index));
+
+    for (size_t d = 0; d < dim_rem; d++) {
+      size_t current_dim = dim_list[d];
+
+      if (index.hint()) {
+        continue;
+      }
+
+      index.leftChild(current_dim);
+
+      if (!storage.isInvalidSequenceNumber(index.seq())) {
+        collectPoles_rec(index, dim_list, d + 1, roots);
+      }
+
+      index.stepRight(current_dim);
+
+      if (!storage.isInvalidSequenceNumber(index.seq())) {
+        collectPoles_rec(index, dim_list, d + 1, roots);
+      }
+
+      index.up(current_dim);
+    }
+  }
+
+  /**
+   * Traverses the grid like sweep_Boundary_rec and stores the grid points at which the functor
+   * would be called.
+   *
+   * @param index current grid position
+   * @param dim_list list of dimensions, that should be handled
+   * @param dim_rem number of remaining dims
+   * @param roots vector to which the roots of the poles are appended
+   */
+  void collectPoles_Boundary_rec(grid_iterator& index, std::vector<size_t>& dim_list,
+                                 size_t dim_rem, std::vector<GridPoint>& roots) {
+    if (dim_rem == 0) {
+      roots.push_back(currentPoint(index));
+    } else {
+      level_t current_level;
+      index_t current_index;
+
+      index.get(dim_list[dim_rem - 1], current_level, current_index);
+
+      // handle level greater zero
+      if (current_level > 0) {
+        collectPoles_Boundary_rec(index, dim_list, dim_rem - 1, roots);
+
+        if (!index.hint()) {
+          index.leftChild(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collectPoles_Boundary_rec(index, dim_list, dim_rem, roots);
+          }
+
+          index.stepRight(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collectPoles_Boundary_rec(index, dim_list, dim_rem, roots);
+          }
+
+          index.up(dim_list[dim_rem - 1]);
+        }
+      } else {  // handle level zero
+        collectPoles_Boundary_rec(index, dim_list, dim_rem - 1, roots);
+
+        index.resetToRightLevelZero(dim_list[dim_rem - 1]);
+        collectPoles_Boundary_rec(index, dim_list, dim_rem - 1, roots);
+
+        if (!index.hint()) {
+          index.resetToLevelOne(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collectPoles_Boundary_rec(index, dim_list, dim_rem, roots);
+          }
+        }
+
+        index.resetToLeftLevelZero(dim_list[dim_rem - 1]);
+      }
+    }
+  }
+
  protected:
   /**
    * Descends on all dimensions beside dim_sweep. Class functor for dim_sweep.
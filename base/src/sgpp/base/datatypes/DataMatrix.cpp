@@ -15,6 +15,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace sgpp {
@@ -31,6 +32,25 @@ DataMatrix::DataMatrix(size_t nrows, size_t ncols, double value) : nrows(nrows),
 DataMatrix::DataMatrix(const double* input, size_t nrows, size_t ncols)
     : std::vector<double>(input, input + nrows * ncols), nrows(nrows), ncols(ncols) {}
 
+DataMatrix::DataMatrix(DataMatrix&& other)
+    : std::vector<double>(std::move(other)), nrows(other.nrows), ncols(other.ncols) {
+  other.nrows = 0;
+  other.ncols = 0;
+}
+
+DataMatrix& DataMatrix::operator=(DataMatrix&& other) {
+  if (this != &other) {
+    std::vector<double>::operator=(std::move(other));
+    nrows = other.nrows;
+    ncols = other.ncols;
+    other.clear();
+    other.nrows = 0;
+    other.ncols = 0;
+  }
+
+  return *this;
+}
+
 DataMatrix DataMatrix::fromFile(const std::string& fileName) {
   std::ifstream f(fileName, std::ifstream::in);
   f.exceptions(std::ifstream::failbit | std::ifstream::badbit);
@@ -37,20 +37,20 @@ class DataMatrix : public std::vector<double> {
    */
   DataMatrix(const DataMatrix&) = default;
 
-  // /**
-  //  * Move constructor
-  //  */
-  // DataMatrix(DataMatrix&&) = default;
+  /**
+   * Move constructor, leaves other as an empty matrix.
+   */
+  DataMatrix(DataMatrix&& other);
 
   /**
    * Copy assignment operator
    */
   DataMatrix& operator=(const DataMatrix&) = default;
 
-  // /**
-  //  * Move assignment operator
-  //  */
-  // DataMatrix& operator=(DataMatrix&&) = default;
+  /**
+   * Move assignment operator, leaves other as an empty matrix.
+   */
+  DataMatrix& operator=(DataMatrix&& other);
 
   /**
    * Destructor
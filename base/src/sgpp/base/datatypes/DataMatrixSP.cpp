@@ -37,6 +37,15 @@ DataMatrixSP::DataMatrixSP(const DataMatrixSP& matr) :
   std::memcpy(this->data, matr.data, nrows * ncols * sizeof(float));
 }
 
+DataMatrixSP::DataMatrixSP(DataMatrixSP&& matr) :
+  data(matr.data), nrows(matr.nrows), ncols(matr.ncols), unused(matr.unused),
+  inc_rows(matr.inc_rows) {
+  matr.data = nullptr;
+  matr.nrows = 0;
+  matr.ncols = 0;
+  matr.unused = 0;
+}
+
 DataMatrixSP::DataMatrixSP(float* input, size_t nrows, size_t ncols) :
   DataMatrixSP(nrows, ncols) {
   // copy data
@@ -291,6 +300,24 @@ DataMatrixSP& DataMatrixSP::operator=(const DataMatrixSP& matr) {
   return *this;
 }
 
+DataMatrixSP& DataMatrixSP::operator=(DataMatrixSP&& matr) {
+  if (this == &matr) {
+    return *this;
+  }
+
+  delete[] data;
+  data = matr.data;
+  nrows = matr.nrows;
+  ncols = matr.ncols;
+  unused = matr.unused;
+  inc_rows = matr.inc_rows;
+  matr.data = nullptr;
+  matr.nrows = 0;
+  matr.ncols = 0;
+  matr.unused = 0;
+  return *this;
+}
+
 
 void DataMatrixSP::add(const DataMatrixSP& matr) {
   if (this->nrows != matr.nrows || this->ncols != matr.ncols) {
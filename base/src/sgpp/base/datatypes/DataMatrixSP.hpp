@@ -58,6 +58,14 @@ class DataMatrixSP {
    */
   DataMatrixSP(const DataMatrixSP& matr);
 
+  /**
+   * Create a new DataMatrixSP that takes over the data of matr,
+   * matr is left empty.
+   *
+   * @param matr Reference to another instance of DataMatrixSP
+   */
+  DataMatrixSP(DataMatrixSP&& matr);
+
   /**
    * Create a new DataMatrixSP from a float array.
    * The float array contains the entries row-wise:
@@ -179,6 +187,14 @@ class DataMatrixSP {
    */
   DataMatrixSP& operator=(const DataMatrixSP& matr);
 
+  /**
+   * Takes over the data of another DataMatrixSP, matr is left empty.
+   *
+   * @param matr the DataMatrixSP containing the data
+   * @return *this
+   */
+  DataMatrixSP& operator=(DataMatrixSP&& matr);
+
   /**
    * Returns the value of the element at position [row,col]
    *
@@ -0,0 +1,85 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataMatrixTiled.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+DataMatrixTiled::DataMatrixTiled(size_t nrows, size_t ncols, size_t tileWidth, double value)
+    : nrows(nrows), ncols(ncols), tileWidth(tileWidth) {
+  if (tileWidth == 0) {
+    throw data_exception("DataMatrixTiled: tile width must not be zero");
+  }
+
+  this->data.assign(this->getNrowsPadded() * ncols, value);
+}
+
+DataMatrixTiled::DataMatrixTiled(const DataMatrix& matrix, size_t tileWidth)
+    : DataMatrixTiled(matrix.getNrows(), matrix.getNcols(), tileWidth) {
+  for (size_t row = 0; row < this->getNrowsPadded(); row++) {
+    // padding rows are copies of the last row
+    const double* ptrRow = &matrix[std::min(row, this->nrows - 1) * this->ncols];
+    double* ptrTile = this->getTilePointer(row / tileWidth);
+
+    for (size_t col = 0; col < this->ncols; col++) {
+      ptrTile[col * tileWidth + row % tileWidth] = ptrRow[col];
+    }
+  }
+}
+
+void DataMatrixTiled::getRow(size_t row, DataVector& vec) const {
+  if (row >= this->nrows) {
+    throw data_exception("DataMatrixTiled::getRow: row out of range");
+  }
+
+  vec.resize(this->ncols);
+  const double* ptrTile = this->getTilePointer(row / this->tileWidth);
+
+  for (size_t col = 0; col < this->ncols; col++) {
+    vec[col] = ptrTile[col * this->tileWidth + row % this->tileWidth];
+  }
+}
+
+DataMatrix DataMatrixTiled::toDataMatrix() const {
+  DataMatrix matrix(this->nrows, this->ncols);
+
+  for (size_t row = 0; row < this->nrows; row++) {
+    for (size_t col = 0; col < this->ncols; col++) {
+      matrix.set(row, col, this->get(row, col));
+    }
+  }
+
+  return matrix;
+}
+
+DataMatrixTiled::Tile DataMatrixTiled::getTile(size_t tile) const {
+  const size_t firstRow = tile * this->tileWidth;
+  return Tile(this->getTilePointer(tile), firstRow,
+              std::min(this->tileWidth, this->nrows - firstRow), this->tileWidth);
+}
+
+DataMatrixTiled::RowPanel DataMatrixTiled::getRowPanel(size_t panel, size_t panelCount) const {
+  if (panel >= panelCount) {
+    throw data_exception("DataMatrixTiled::getRowPanel: panel out of range");
+  }
+
+  const size_t tileCount = this->getNtiles();
+  const size_t panelSize = tileCount / panelCount;
+  const size_t remainder = tileCount % panelCount;
+
+  // the first remainder panels get one additional tile
+  const size_t firstTile = panel * panelSize + std::min(panel, remainder);
+  const size_t endTile = firstTile + panelSize + ((panel < remainder) ? 1 : 0);
+  return RowPanel(*this, firstTile, endTile);
+}
+
+}  // namespace base
+}  // namespace sgpp
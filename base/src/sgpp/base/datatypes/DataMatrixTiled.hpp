@@ -0,0 +1,241 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Stores the rows of a matrix in tiles of tileWidth consecutive rows. Within a tile, the entries
+ * are stored column by column (array of structures of arrays), i.e., the entries of one column
+ * of all rows of a tile are contiguous. If tileWidth is a multiple of the SIMD width, a SIMD
+ * register can be loaded directly from a column of a tile, such that kernels do not need their
+ * own transposed copy of the dataset.
+ *
+ * The number of rows is padded to a multiple of tileWidth with copies of the last row, so that
+ * kernels can always process complete tiles. The padding rows can be identified with getNrows()
+ * and Tile::getRows().
+ *
+ * The tiles can be traversed with range-based for loops, either all of them or row panels, i.e.,
+ * ranges of consecutive tiles, which are used to distribute the rows between threads.
+ */
+class DataMatrixTiled {
+ public:
+  /**
+   * Read-only view of one tile.
+   */
+  class Tile {
+   public:
+    Tile(const double* data, size_t firstRow, size_t rows, size_t width)
+        : data(data), firstRow(firstRow), rows(rows), width(width) {}
+
+    /**
+     * @param col column
+     * @return pointer to the tileWidth entries of the column, including padding
+     */
+    inline const double* getColumn(size_t col) const { return data + col * width; }
+
+    /**
+     * @param row row relative to the first row of the tile
+     * @param col column
+     * @return entry of the matrix
+     */
+    inline double get(size_t row, size_t col) const { return data[col * width + row]; }
+
+    /**
+     * @return index of the first row of the tile in the matrix
+     */
+    inline size_t getFirstRow() const { return firstRow; }
+
+    /**
+     * @return number of rows of the tile that are not padding
+     */
+    inline size_t getRows() const { return rows; }
+
+   private:
+    const double* data;
+    size_t firstRow;
+    size_t rows;
+    size_t width;
+  };
+
+  /**
+   * Forward iterator over consecutive tiles.
+   */
+  class TileIterator {
+   public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef Tile value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const Tile* pointer;
+    typedef Tile reference;
+
+    TileIterator(const DataMatrixTiled& matrix, size_t tile) : matrix(&matrix), tile(tile) {}
+
+    inline Tile operator*() const { return matrix->getTile(tile); }
+
+    inline TileIterator& operator++() {
+      tile++;
+      return *this;
+    }
+
+    inline bool operator==(const TileIterator& other) const { return tile == other.tile; }
+
+    inline bool operator!=(const TileIterator& other) const { return tile != other.tile; }
+
+   private:
+    const DataMatrixTiled* matrix;
+    size_t tile;
+  };
+
+  /**
+   * Range of consecutive tiles, i.e., a block of rows.
+   */
+  class RowPanel {
+   public:
+    RowPanel(const DataMatrixTiled& matrix, size_t firstTile, size_t endTile)
+        : matrix(matrix), firstTile(firstTile), endTile(endTile) {}
+
+    inline TileIterator begin() const { return TileIterator(matrix, firstTile); }
+
+    inline TileIterator end() const { return TileIterator(matrix, endTile); }
+
+    /**
+     * @return index of the first row of the panel
+     */
+    inline size_t getFirstRow() const { return firstTile * matrix.getTileWidth(); }
+
+    /**
+     * @return index after the last row of the panel, including padding
+     */
+    inline size_t getEndRow() const { return endTile * matrix.getTileWidth(); }
+
+   private:
+    const DataMatrixTiled& matrix;
+    size_t firstTile;
+    size_t endTile;
+  };
+
+  /**
+   * Creates a tiled matrix with nrows rows and ncols columns initialized with value.
+   *
+   * @param nrows       number of rows
+   * @param ncols       number of columns
+   * @param tileWidth   number of rows per tile
+   * @param value       value of all entries, including padding
+   */
+  DataMatrixTiled(size_t nrows, size_t ncols, size_t tileWidth, double value = 0.0);
+
+  /**
+   * Creates a tiled copy of a row-major matrix.
+   *
+   * @param matrix      row-major matrix, e.g., a dataset with one data point per row
+   * @param tileWidth   number of rows per tile
+   */
+  DataMatrixTiled(const DataMatrix& matrix, size_t tileWidth);
+
+  /**
+   * @param row row
+   * @param col column
+   * @return entry of the matrix
+   */
+  inline double get(size_t row, size_t col) const { return data[getIndex(row, col)]; }
+
+  /**
+   * Sets an entry of the matrix, padding rows are not updated.
+   *
+   * @param row   row
+   * @param col   column
+   * @param value new value
+   */
+  inline void set(size_t row, size_t col, double value) { data[getIndex(row, col)] = value; }
+
+  /**
+   * Copies a row of the matrix.
+   *
+   * @param row row
+   * @param vec vector that is resized to the number of columns and receives the row
+   */
+  void getRow(size_t row, DataVector& vec) const;
+
+  /**
+   * @return row-major copy of the matrix without padding
+   */
+  DataMatrix toDataMatrix() const;
+
+  /**
+   * @param tile tile
+   * @return view of the tile
+   */
+  Tile getTile(size_t tile) const;
+
+  /**
+   * @param tile tile
+   * @return pointer to the entries of the tile, stored column by column
+   */
+  inline double* getTilePointer(size_t tile) { return data.data() + tile * tileWidth * ncols; }
+
+  /**
+   * @param tile tile
+   * @return pointer to the entries of the tile, stored column by column
+   */
+  inline const double* getTilePointer(size_t tile) const {
+    return data.data() + tile * tileWidth * ncols;
+  }
+
+  /**
+   * Splits the tiles into panelCount panels with almost equal numbers of tiles, e.g., to
+   * distribute the rows between OpenMP threads.
+   *
+   * @param panel       number of the panel
+   * @param panelCount  total number of panels
+   * @return the tiles of the panel
+   * @throw data_exception if panel is not smaller than panelCount
+   */
+  RowPanel getRowPanel(size_t panel, size_t panelCount) const;
+
+  inline TileIterator begin() const { return TileIterator(*this, 0); }
+
+  inline TileIterator end() const { return TileIterator(*this, getNtiles()); }
+
+  /**
+   * @return number of rows without padding
+   */
+  inline size_t getNrows() const { return nrows; }
+
+  /**
+   * @return number of rows including padding, a multiple of the tile width
+   */
+  inline size_t getNrowsPadded() const { return getNtiles() * tileWidth; }
+
+  inline size_t getNcols() const { return ncols; }
+
+  inline size_t getTileWidth() const { return tileWidth; }
+
+  inline size_t getNtiles() const { return (nrows + tileWidth - 1) / tileWidth; }
+
+ private:
+  size_t nrows;
+  size_t ncols;
+  size_t tileWidth;
+  std::vector<double> data;
+
+  inline size_t getIndex(size_t row, size_t col) const {
+    return (row / tileWidth) * tileWidth * ncols + col * tileWidth + row % tileWidth;
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
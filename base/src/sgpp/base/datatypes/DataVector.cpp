@@ -11,10 +11,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <string>
 #include <vector>
+#include <utility>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -23,6 +25,8 @@
 namespace sgpp {
 namespace base {
 
+const char DataVector::binaryMagic[8] = {'S', 'G', 'P', 'P', 'V', 'E', 'C', '1'};
+
 DataVector::DataVector() : DataVector(0) {}
 
 DataVector::DataVector(size_t size) : DataVector(size, 0.0) {}
@@ -31,7 +35,18 @@ DataVector::DataVector(size_t size, double value) { this->assign(size, value); }
 
 DataVector::DataVector(double* input, size_t size) : std::vector<double>(input, input + size) {}
 
-DataVector::DataVector(std::vector<double> input) : std::vector<double>(input) {}
+DataVector::DataVector(const DataVector& other) : std::vector<double>(other) {}
+
+DataVector& DataVector::operator=(const DataVector& other) {
+  if (this != &other) {
+    std::vector<double>::operator=(other);
+    correction.clear();
+  }
+
+  return *this;
+}
+
+DataVector::DataVector(std::vector<double> input) : std::vector<double>(std::move(input)) {}
 
 DataVector::DataVector(std::vector<int> input) {
   // copy data
@@ -429,5 +444,36 @@ void DataVector::toFile(const std::string& fileName) const {
   f.close();
 }
 
+DataVector DataVector::fromBinaryStream(std::istream& istream) {
+  // skip line breaks left over from preceding text, e.g., a serialized grid;
+  // the magic ensures that no binary data is consumed as whitespace
+  istream >> std::ws;
+
+  char magic[sizeof(binaryMagic)];
+  uint64_t size = 0;
+  istream.read(magic, sizeof(magic));
+  istream.read(reinterpret_cast<char*>(&size), sizeof(size));
+
+  if (!istream || (std::memcmp(magic, binaryMagic, sizeof(binaryMagic)) != 0)) {
+    throw data_exception("DataVector::fromBinaryStream : binary vector header is missing");
+  }
+
+  DataVector v(static_cast<size_t>(size));
+  istream.read(reinterpret_cast<char*>(v.data()), v.size() * sizeof(double));
+
+  if (!istream) {
+    throw data_exception("DataVector::fromBinaryStream : vector data is truncated");
+  }
+
+  return v;
+}
+
+void DataVector::toBinaryStream(std::ostream& ostream) const {
+  uint64_t size = static_cast<uint64_t>(this->size());
+  ostream.write(binaryMagic, sizeof(binaryMagic));
+  ostream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+  ostream.write(reinterpret_cast<const char*>(this->data()), this->size() * sizeof(double));
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -8,6 +8,7 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <iostream>
 #include <string>
 #include <vector>
 
@@ -30,23 +31,25 @@ class DataVector : public std::vector<double> {
 
   /**
    * Copy constructor.
+   * Copies only the entries, the corrections of accumulate() are not carried over.
    */
-  DataVector(const DataVector&) = default;
+  DataVector(const DataVector& other);
 
-  // /**
-  //  * Move constructor
-  //  */
-  // DataVector(DataVector&&) = default;
+  /**
+   * Move constructor
+   */
+  DataVector(DataVector&&) = default;
 
   /**
    * Copy assignment operator
+   * Copies only the entries, the corrections of accumulate() are reset.
    */
-  DataVector& operator=(const DataVector&) = default;
+  DataVector& operator=(const DataVector& other);
 
-  // /**
-  //  * Move assignment operator
-  //  */
-  // DataVector& operator=(DataVector&&) = default;
+  /**
+   * Move assignment operator
+   */
+  DataVector& operator=(DataVector&&) = default;
 
   /**
    * Destructor
@@ -95,6 +98,14 @@ class DataVector : public std::vector<double> {
 
   static DataVector fromString(const std::string& serializedVector);
 
+  /**
+   * Reads a DataVector that was written with toBinaryStream.
+   *
+   * @param istream stream (opened in binary mode) that contains the vector
+   * @return the DataVector
+   */
+  static DataVector fromBinaryStream(std::istream& istream);
+
   /**
    * Resizes the DataVector to size elements.
    * All new additional entries are set to zero.
@@ -392,9 +403,19 @@ class DataVector : public std::vector<double> {
 
   void toFile(const std::string& fileName) const;
 
+  /**
+   * Writes a magic, the size (uint64) and the raw entries to a stream, e.g., to append the
+   * coefficients to a grid serialized with SERIALIZATION_VERSION_BINARY.
+   *
+   * @param ostream stream (opened in binary mode) to which the vector is written
+   */
+  void toBinaryStream(std::ostream& ostream) const;
+
  private:
   using std::vector<double>::insert;
-  /// Corrections for Kahan's summation in accumulate()
+  /// magic that starts the binary representation of a DataVector
+  static const char binaryMagic[8];
+  /// Corrections for Kahan's summation in accumulate(), allocated on its first call
   std::vector<double> correction;
 };
 
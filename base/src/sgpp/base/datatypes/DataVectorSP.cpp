@@ -37,6 +37,13 @@ DataVectorSP::DataVectorSP(const DataVectorSP& vec) :
   std::memcpy(this->data, vec.data, size * sizeof(float));
 }
 
+DataVectorSP::DataVectorSP(DataVectorSP&& vec) :
+  data(vec.data), size(vec.size), unused(vec.unused), inc_elems(vec.inc_elems) {
+  vec.data = nullptr;
+  vec.size = 0;
+  vec.unused = 0;
+}
+
 DataVectorSP::DataVectorSP(float* input, size_t size) :
   DataVectorSP(size) {
   // copy data
@@ -201,6 +208,22 @@ DataVectorSP& DataVectorSP::operator=(const DataVectorSP& vec) {
   return *this;
 }
 
+DataVectorSP& DataVectorSP::operator=(DataVectorSP&& vec) {
+  if (this == &vec) {
+    return *this;
+  }
+
+  delete[] data;
+  data = vec.data;
+  size = vec.size;
+  unused = vec.unused;
+  inc_elems = vec.inc_elems;
+  vec.data = nullptr;
+  vec.size = 0;
+  vec.unused = 0;
+  return *this;
+}
+
 void DataVectorSP::add(const DataVectorSP& vec) {
   if (size != vec.size) {
     throw sgpp::base::data_exception(
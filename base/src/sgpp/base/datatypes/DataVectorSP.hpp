@@ -51,6 +51,14 @@ class DataVectorSP {
    */
   DataVectorSP(const DataVectorSP& vec);
 
+  /**
+   * Create a new DataVectorSP that takes over the data of vec,
+   * vec is left empty.
+   *
+   * @param vec Reference to another instance of DataVectorSP
+   */
+  DataVectorSP(DataVectorSP&& vec);
+
   /**
    * Create a new DataVectorSP from a float array with size elements.
    *
@@ -169,6 +177,14 @@ class DataVectorSP {
    */
   DataVectorSP& operator=(const DataVectorSP& vec);
 
+  /**
+   * Takes over the data of another DataVectorSP, vec is left empty.
+   *
+   * @param vec the DataVectorSP containing the data
+   * @return *this
+   */
+  DataVectorSP& operator=(DataVectorSP&& vec);
+
   /**
    * Returns a reference to the i-th element.
    *
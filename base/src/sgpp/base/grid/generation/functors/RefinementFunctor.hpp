@@ -42,6 +42,18 @@ class RefinementFunctor {
    */
   virtual double operator()(GridStorage& storage, size_t seq) const = 0;
 
+  /**
+   * Returns whether operator() may be called concurrently by several OpenMP threads for the
+   * same storage. Refinement strategies only evaluate the functor in parallel if this is true,
+   * so functors that modify (mutable) state in operator() or that call back into an
+   * interpreter must keep the default.
+   *
+   * @return whether operator() is thread-safe. Default value: false.
+   */
+  virtual bool isThreadSafe() const {
+    return false;
+  }
+
   /**
    * Returns the lower bound of refinement criterion (e.g., alpha or error) (lower bound).
    * The refinement value of grid points to be refined have to be larger than this value
@@ -27,6 +27,10 @@ double SurplusRefinementFunctor::operator()(GridStorage& storage,
   return val;
 }
 
+bool SurplusRefinementFunctor::isThreadSafe() const {
+  return true;
+}
+
 double SurplusRefinementFunctor::start() const {
   return 0.0;
 }
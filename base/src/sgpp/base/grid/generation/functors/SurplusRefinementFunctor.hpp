@@ -37,6 +37,8 @@ class SurplusRefinementFunctor : public RefinementFunctor {
 
   double operator()(GridStorage& storage, size_t seq) const override;
 
+  bool isThreadSafe() const override;
+
   double start() const override;
 
   size_t getRefinementsNum() const override;
@@ -27,6 +27,10 @@ double SurplusVolumeRefinementFunctor::operator()(GridStorage& storage,
                -(static_cast<int>(storage.getPoint(seq).getLevelSum())))) * fabs(alpha[seq]);
 }
 
+bool SurplusVolumeRefinementFunctor::isThreadSafe() const {
+  return true;
+}
+
 double SurplusVolumeRefinementFunctor::start() const {
   return 0.0;
 }
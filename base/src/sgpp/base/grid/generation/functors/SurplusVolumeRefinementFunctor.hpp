@@ -39,6 +39,8 @@ class SurplusVolumeRefinementFunctor : public RefinementFunctor {
 
   double operator()(GridStorage& storage, size_t seq) const override;
 
+  bool isThreadSafe() const override;
+
   double start() const override;
 
   size_t getRefinementsNum() const override;
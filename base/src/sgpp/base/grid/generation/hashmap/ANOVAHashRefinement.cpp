@@ -25,5 +25,18 @@ void ANOVAHashRefinement::refineGridpoint(GridStorage& storage, size_t refine_in
     }
   }
 }
+
+void ANOVAHashRefinement::stageGridpoint(const GridStorage& storage, GridStorage& staged,
+                                         size_t refine_index) const {
+  GridPoint point(storage[refine_index]);
+
+  for (size_t d = 0; d < storage.getDimension(); d++) {
+    // stage children only in the dimensions with level greater than 1,
+    // as in refineGridpoint()
+    if (point.getLevel(d) > 1) {
+      this->stageGridpoint1D(storage, staged, point, d);
+    }
+  }
+}
 }  // namespace base
 }  // namespace sgpp
@@ -28,6 +28,17 @@ class ANOVAHashRefinement : public HashRefinement {
      * @param refine_index The index in the hashmap of the point that should be refined
      */
   virtual void refineGridpoint(GridStorage& storage, size_t refine_index);
+
+  /**
+     * Counterpart of refineGridpoint() that stages the new points instead of inserting them,
+     * see AbstractRefinement::stageGridpoint().
+     *
+     * @param storage hashmap that stores the gridpoints
+     * @param staged hashmap that collects the points that should be inserted into storage
+     * @param refine_index The index in the hashmap of the point that should be refined
+     */
+  void stageGridpoint(const GridStorage& storage, GridStorage& staged,
+                      size_t refine_index) const override;
 };
 }  // namespace base
 }  // namespace sgpp
@@ -7,8 +7,18 @@
 #include <sgpp/base/grid/generation/refinement_strategy/RefinementDecorator.hpp>
 
 
+#include <sgpp/base/exception/generation_exception.hpp>
+
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 
 namespace sgpp {
 namespace base {
@@ -57,6 +67,108 @@ void AbstractRefinement::refineGridpoint1D(GridStorage& storage, size_t seq,
 }
 
 
+void AbstractRefinement::refineGridpoints(GridStorage& storage,
+    const std::vector<size_t>& refineIndices) {
+  size_t numThreads = 1;
+#ifdef _OPENMP
+  numThreads = static_cast<size_t>(omp_get_max_threads());
+#endif
+
+  if (numThreads > 1) {
+    refineGridpointsInBatch(storage, refineIndices);
+  } else {
+    for (size_t seq : refineIndices) {
+      refineGridpoint(storage, seq);
+    }
+  }
+}
+
+void AbstractRefinement::refineGridpointsInBatch(GridStorage& storage,
+    const std::vector<size_t>& refineIndices) {
+  size_t numThreads = 1;
+#ifdef _OPENMP
+  numThreads = static_cast<size_t>(omp_get_max_threads());
+#endif
+  std::vector<std::unique_ptr<GridStorage>> staged(numThreads);
+
+  // the static schedule assigns one contiguous block of refineIndices to each thread
+  // (in the order of the threads), so concatenating the staged points of the threads
+  // yields the same order as refining the points one after another
+#pragma omp parallel
+  {
+    size_t threadNum = 0;
+#ifdef _OPENMP
+    threadNum = static_cast<size_t>(omp_get_thread_num());
+#endif
+    staged[threadNum].reset(new GridStorage(storage.getDimension()));
+
+#pragma omp for schedule(static)
+    for (size_t i = 0; i < refineIndices.size(); i++) {
+      stageGridpoint(storage, *staged[threadNum], refineIndices[i]);
+    }
+  }
+
+  size_t numStaged = storage.getSize();
+
+  for (const std::unique_ptr<GridStorage>& threadStaged : staged) {
+    if (threadStaged != nullptr) {
+      numStaged += threadStaged->getSize();
+    }
+  }
+
+  storage.reserve(numStaged);
+
+  // Sets leaf property of the refined points to false
+  for (size_t seq : refineIndices) {
+    storage.getPoint(seq).setLeaf(false);
+  }
+
+  // points staged by several threads are inserted only once
+  for (const std::unique_ptr<GridStorage>& threadStaged : staged) {
+    if (threadStaged != nullptr) {
+      storage.insert(*threadStaged);
+    }
+  }
+}
+
+void AbstractRefinement::stageGridpoint(const GridStorage& storage,
+                                        GridStorage& staged,
+                                        size_t refine_index) const {
+  throw generation_exception("refinement does not support staging of grid points");
+}
+
+void AbstractRefinement::setStagedLeaf(const GridStorage& storage,
+                                       GridStorage& staged, GridPoint& point,
+                                       bool isLeaf) {
+  if (staged.isContaining(point)) {
+    staged.getPoint(staged.find(&point)->second).setLeaf(isLeaf);
+  } else if (!isLeaf && storage.getPoint(storage.getSequenceNumber(point)).isLeaf()) {
+    bool saveLeaf = point.isLeaf();
+    point.setLeaf(false);
+    staged.insert(point);
+    point.setLeaf(saveLeaf);
+  }
+}
+
+void AbstractRefinement::mergeCollections(
+    const std::vector<refinement_container_type>& localCollections,
+    size_t refinements_num, refinement_container_type& collection) {
+  for (const refinement_container_type& localCollection : localCollections) {
+    for (const refinement_pair_type& pair : localCollection) {
+      collection.push_back(pair);
+      std::push_heap(collection.begin(), collection.end(), compare_pairs_by_seq);
+
+      if (collection.size() > refinements_num) {
+        // remove the top (smallest) element
+        std::pop_heap(collection.begin(), collection.end(), compare_pairs_by_seq);
+        collection.pop_back();
+      }
+    }
+  }
+
+  std::sort_heap(collection.begin(), collection.end(), compare_pairs_by_seq);
+}
+
 /*void AbstractRefinement::strategy_refine(GridStorage& storage,
         RefinementStrategy& refinement_strategy)
 {
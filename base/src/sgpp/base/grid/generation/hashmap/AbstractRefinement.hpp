@@ -123,6 +123,18 @@ class AbstractRefinement {
   }
 
 
+  /**
+   * Comparison of the refinement_pair_type like compare_pairs, but ties are broken by the
+   * sequence numbers (the larger one is on top). This way the elements kept in a bounded
+   * priority queue do not depend on the order in which they are inserted
+   */
+  static bool compare_pairs_by_seq(const refinement_pair_type& lhs,
+                                   const refinement_pair_type& rhs) {
+    return (lhs.second > rhs.second) ||
+           ((lhs.second == rhs.second) && (lhs.first->getSeq() < rhs.first->getSeq()));
+  }
+
+
   /**
   * Container for the collection of the refinement atoms and the corresponding
   * value
@@ -259,6 +271,81 @@ class AbstractRefinement {
     index_t& source_index, level_t& source_level);
 
 
+  /**
+   * Refines several grid points. If several OpenMP threads are available, the points are
+   * refined by refineGridpointsInBatch(), otherwise one after another by refineGridpoint()
+   * (with a single thread, staging the new points does not pay off).
+   *
+   * @param storage hashmap that stores the gridpoints
+   * @param refineIndices indices in the hashmap of the points that should be refined
+   */
+  void refineGridpoints(GridStorage& storage, const std::vector<size_t>& refineIndices);
+
+  /**
+   * Refines several grid points at once. The children of the grid points and their missing
+   * ancestors are determined in parallel by stageGridpoint() without modifying the storage,
+   * and are then inserted into the storage in one pass. The resulting grid (including the
+   * order of the new points and their leaf properties) is the same as if refineGridpoint()
+   * was called for the grid points one after another.
+   *
+   * @param storage hashmap that stores the gridpoints
+   * @param refineIndices indices in the hashmap of the points that should be refined
+   */
+  void refineGridpointsInBatch(GridStorage& storage, const std::vector<size_t>& refineIndices);
+
+  /**
+   * Counterpart of refineGridpoint() for refineGridpointsInBatch(), which does not modify the
+   * storage. The children and missing ancestors that would be created are appended to staged
+   * instead (unless they are already contained in storage or staged), as well as copies of
+   * existing points of storage whose leaf property would be changed. The default
+   * implementation throws a generation_exception.
+   *
+   * @param storage hashmap that stores the gridpoints
+   * @param staged hashmap that collects the points that should be inserted into storage
+   * @param refine_index The index in the hashmap of the point that should be refined
+   */
+  virtual void stageGridpoint(const GridStorage& storage, GridStorage& staged,
+                              size_t refine_index) const;
+
+  /**
+   * Checks whether a grid point exists either in the storage or in the staged points.
+   *
+   * @param storage hashmap that stores the gridpoints
+   * @param staged hashmap that collects the points that should be inserted into storage
+   * @param point grid point
+   * @return whether the point is contained in storage or staged
+   */
+  static bool isStaged(const GridStorage& storage, const GridStorage& staged,
+                       GridPoint& point) {
+    return storage.isContaining(point) || staged.isContaining(point);
+  }
+
+  /**
+   * Sets the leaf property of a grid point that exists in the storage or in the staged points.
+   * Points of the storage are not modified; if they lose their leaf property, a copy is staged
+   * instead (as HashGridStorage::insert() for batches only clears leaf properties).
+   *
+   * @param storage hashmap that stores the gridpoints
+   * @param staged hashmap that collects the points that should be inserted into storage
+   * @param point grid point
+   * @param isLeaf new leaf property
+   */
+  static void setStagedLeaf(const GridStorage& storage, GridStorage& staged, GridPoint& point,
+                            bool isLeaf);
+
+  /**
+   * Merges thread-local collections of refinement atoms, each of them being a heap of at most
+   * refinements_num elements as built by collectRefinablePoints(), into one collection.
+   * The merged collection is sorted by descending values, ties by ascending sequence numbers
+   * (see compare_pairs_by_seq()), so it does not depend on the number of threads.
+   *
+   * @param localCollections the thread-local collections, in the order of the threads
+   * @param refinements_num maximum number of elements of the collection
+   * @param collection container where the merged element pairs are stored
+   */
+  static void mergeCollections(const std::vector<refinement_container_type>& localCollections,
+                               size_t refinements_num, refinement_container_type& collection);
+
   /**
    * Identifies the sparse grid refinement atoms (points or subspaces) with
    * the largest indicator values.
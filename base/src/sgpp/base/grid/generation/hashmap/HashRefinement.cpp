@@ -8,8 +8,13 @@
 
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <vector>
 #include <algorithm>
+#include <exception>
 #include <memory>
 
 
@@ -26,13 +31,13 @@ void HashRefinement::addElementToCollection(
        it != current_value_list.end(); it++) {
     collection.push_back(*it);
     std::push_heap(collection.begin(), collection.end(),
-                   AbstractRefinement::compare_pairs);
+                   AbstractRefinement::compare_pairs_by_seq);
 
 
     if (collection.size() > refinements_num) {
       // remove the top (smallest) element
       std::pop_heap(collection.begin(), collection.end(),
-                    AbstractRefinement::compare_pairs);
+                    AbstractRefinement::compare_pairs_by_seq);
       collection.pop_back();
     }
   }
@@ -46,53 +51,97 @@ void HashRefinement::collectRefinablePoints(GridStorage& storage,
 
   // max value equals min value
 
-  GridPoint point;
   GridStorage::grid_map_iterator end_iter = storage.end();
 
-  // start iterating over whole grid
+  // iterators to all grid points, such that the grid can be traversed in parallel
+  std::vector<GridStorage::grid_map_iterator> iters;
+  iters.reserve(storage.getSize());
+
   for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
        iter++) {
-    point = *(iter->first);
-
-    GridStorage::grid_map_iterator child_iter;
-
-    // check for each grid point whether it can be refined
-    // (i.e., whether not all kids exist yet)
-    // if yes, check whether it belongs to the refinements_num largest ones
-    for (size_t d = 0; d < storage.getDimension(); d++) {
-      index_t source_index;
-      level_t source_level;
-      point.get(d, source_level, source_index);
-
-      // test existence of left child
-      point.set(d, source_level + 1, 2 * source_index - 1);
-      child_iter = storage.find(&point);
+    iters.push_back(iter);
+  }
 
-      // if there no more grid points --> test if we should refine the grid
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter, functor);
-        addElementToCollection(iter, current_value_list, refinements_num,
-                               collection);
-        break;
+  size_t numThreads = 1;
+#ifdef _OPENMP
+  numThreads = static_cast<size_t>(omp_get_max_threads());
+#endif
+  // each thread collects the refinements_num largest indicators of its grid points,
+  // the thread-local collections are merged afterwards; functors that cannot be called
+  // concurrently are evaluated by a single thread
+  std::vector<AbstractRefinement::refinement_container_type> localCollections(numThreads);
+  std::exception_ptr exception;
+
+#pragma omp parallel if (functor.isThreadSafe())
+  {
+    size_t threadNum = 0;
+#ifdef _OPENMP
+    threadNum = static_cast<size_t>(omp_get_thread_num());
+#endif
+    AbstractRefinement::refinement_container_type& localCollection =
+      localCollections[threadNum];
+    GridPoint point;
+
+#pragma omp for schedule(static)
+    for (size_t k = 0; k < iters.size(); k++) {
+      const GridStorage::grid_map_iterator& iter = iters[k];
+      point = *(iter->first);
+
+      // check for each grid point whether it can be refined
+      // (i.e., whether not all kids exist yet)
+      // if yes, check whether it belongs to the refinements_num largest ones
+      bool isRefinable = false;
+
+      for (size_t d = 0; d < storage.getDimension(); d++) {
+        index_t source_index;
+        level_t source_level;
+        point.get(d, source_level, source_index);
+
+        // test existence of left child
+        point.set(d, source_level + 1, 2 * source_index - 1);
+
+        // if there no more grid points --> test if we should refine the grid
+        if (storage.find(&point) == end_iter) {
+          isRefinable = true;
+          break;
+        }
+
+        // test existence of right child
+        point.set(d, source_level + 1, 2 * source_index + 1);
+
+        if (storage.find(&point) == end_iter) {
+          isRefinable = true;
+          break;
+        }
+
+        // reset current grid point in dimension d
+        point.set(d, source_level, source_index);
       }
 
-      // test existence of right child
-      point.set(d, source_level + 1, 2 * source_index + 1);
-      child_iter = storage.find(&point);
-
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter, functor);
-        addElementToCollection(iter, current_value_list, refinements_num,
-                               collection);
-        break;
+      if (isRefinable) {
+        // exceptions must not leave the parallel region, they are rethrown below
+        try {
+          AbstractRefinement::refinement_list_type current_value_list =
+            getIndicator(storage, iter, functor);
+          addElementToCollection(iter, current_value_list, refinements_num,
+                                 localCollection);
+        } catch (...) {
+#pragma omp critical
+          {
+            if (!exception) {
+              exception = std::current_exception();
+            }
+          }
+        }
       }
-
-      // reset current grid point in dimension d
-      point.set(d, source_level, source_index);
     }
   }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+
+  mergeCollections(localCollections, refinements_num, collection);
 }
 
 AbstractRefinement::refinement_list_type HashRefinement::getIndicator(
@@ -113,12 +162,15 @@ void HashRefinement::refineGridpointsCollection(GridStorage& storage,
     AbstractRefinement::refinement_container_type& collection) {
 
   double threshold = functor.getRefinementThreshold();
+  std::vector<size_t> refineIndices;
 
   for (AbstractRefinement::refinement_pair_type& pair : collection) {
     if (pair.second >= threshold) {
-      refineGridpoint(storage, pair.first->getSeq());
+      refineIndices.push_back(pair.first->getSeq());
     }
   }
+
+  refineGridpoints(storage, refineIndices);
 }
 
 void HashRefinement::free_refine(GridStorage& storage,
@@ -247,5 +299,72 @@ void HashRefinement::createGridpoint(GridStorage& storage, GridPoint& point) {
   storage.insert(point);
 }
 
+void HashRefinement::stageGridpoint(const GridStorage& storage, GridStorage& staged,
+                                    size_t refine_index) const {
+  GridPoint point(storage[refine_index]);
+
+  for (size_t d = 0; d < storage.getDimension(); d++) {
+    stageGridpoint1D(storage, staged, point, d);
+  }
+}
+
+void HashRefinement::stageGridpoint1D(const GridStorage& storage, GridStorage& staged,
+                                      GridPoint& point, size_t d) const {
+  index_t source_index;
+  level_t source_level;
+  point.get(d, source_level, source_index);
+  // stage left child, if necessary
+  point.set(d, source_level + 1, 2 * source_index - 1);
+
+  if (!isStaged(storage, staged, point)) {
+    point.setLeaf(true);
+    stageNewGridpoint(storage, staged, point);
+  }
+
+  // stage right child, if necessary
+  point.set(d, source_level + 1, 2 * source_index + 1);
+
+  if (!isStaged(storage, staged, point)) {
+    point.setLeaf(true);
+    stageNewGridpoint(storage, staged, point);
+  }
+
+  point.set(d, source_level, source_index);
+}
+
+void HashRefinement::stageNewGridpoint(const GridStorage& storage, GridStorage& staged,
+                                       GridPoint& point) const {
+  index_t source_index;
+  level_t source_level;
+
+  for (size_t d = 0; d < storage.getDimension(); d++) {
+    point.get(d, source_level, source_index);
+
+    if (source_level > 1) {
+      // parent in dimension d
+      if (((source_index + 1) / 2) % 2 == 1) {
+        point.set(d, source_level - 1, (source_index + 1) / 2);
+      } else {
+        point.set(d, source_level - 1, (source_index - 1) / 2);
+      }
+
+      if (!isStaged(storage, staged, point)) {
+        // missing ancestors are no leaves
+        bool saveLeaf = point.isLeaf();
+        point.setLeaf(false);
+        stageNewGridpoint(storage, staged, point);
+        point.setLeaf(saveLeaf);
+      } else {
+        setStagedLeaf(storage, staged, point, false);
+      }
+
+      // restore values
+      point.set(d, source_level, source_index);
+    }
+  }
+
+  staged.insert(point);
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -80,6 +80,39 @@ class HashRefinement: public AbstractRefinement {
    */
   void createGridpoint(GridStorage& storage, GridPoint& point) override;
 
+  /**
+   * Counterpart of refineGridpoint() that stages the new points instead of inserting them,
+   * see AbstractRefinement::stageGridpoint().
+   *
+   * @param storage hashmap that stores the gridpoints
+   * @param staged hashmap that collects the points that should be inserted into storage
+   * @param refine_index The index in the hashmap of the point that should be refined
+   */
+  void stageGridpoint(const GridStorage& storage, GridStorage& staged,
+                      size_t refine_index) const override;
+
+  /**
+   * Counterpart of refineGridpoint1D() that stages the new points instead of inserting them.
+   *
+   * @param storage hashmap that stores the gridpoints
+   * @param staged hashmap that collects the points that should be inserted into storage
+   * @param point point to refine
+   * @param d direction
+   */
+  void stageGridpoint1D(const GridStorage& storage, GridStorage& staged, GridPoint& point,
+                        size_t d) const;
+
+  /**
+   * Counterpart of createGridpoint() that stages the point and its missing ancestors
+   * instead of inserting them.
+   *
+   * @param storage hashmap that stores the gridpoints
+   * @param staged hashmap that collects the points that should be inserted into storage
+   * @param point The point that should be inserted
+   */
+  void stageNewGridpoint(const GridStorage& storage, GridStorage& staged,
+                         GridPoint& point) const;
+
   /**
   * Examines the grid points and stores the indices those that can be refined
   * and have maximal indicator values.
@@ -94,7 +127,8 @@ class HashRefinement: public AbstractRefinement {
     AbstractRefinement::refinement_container_type& collection) override;
 
   /**
-   * Extends the grid adding elements defined in collection
+   * Extends the grid adding elements defined in collection. The points are refined by
+   * refineGridpoints(), in batch if several threads are available.
    *
    * @param storage hashmap that stores the grid points
    * @param functor a PredictiveRefinementIndicator specifying the refinement criteria
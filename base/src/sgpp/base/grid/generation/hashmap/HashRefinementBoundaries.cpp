@@ -8,7 +8,13 @@
 
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
 #include <cmath>
+#include <exception>
 #include <vector>
 #include <memory>
 
@@ -27,13 +33,13 @@ void HashRefinementBoundaries::addElementToCollection(
        it != current_value_list.end(); it++) {
     collection.push_back(*it);
     std::push_heap(collection.begin(), collection.end(),
-                   AbstractRefinement::compare_pairs);
+                   AbstractRefinement::compare_pairs_by_seq);
 
 
     if (collection.size() > refinements_num) {
       // remove the top (smallest) element
       std::pop_heap(collection.begin(), collection.end(),
-                    AbstractRefinement::compare_pairs);
+                    AbstractRefinement::compare_pairs_by_seq);
       collection.pop_back();
     }
   }
@@ -58,77 +64,119 @@ void HashRefinementBoundaries::collectRefinablePoints(GridStorage& storage,
     AbstractRefinement::refinement_container_type& collection) {
 
   size_t refinements_num = functor.getRefinementsNum();
-  GridPoint point;
   GridStorage::grid_map_iterator end_iter = storage.end();
 
-  // I think this may be dependent on local support
+  // iterators to all grid points, such that the grid can be traversed in parallel
+  std::vector<GridStorage::grid_map_iterator> iters;
+  iters.reserve(storage.getSize());
+
   for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
        iter++) {
-    point = *(iter->first);
-
-    GridStorage::grid_map_iterator child_iter;
-
-    for (size_t d = 0; d < storage.getDimension(); d++) {
-      index_t source_index;
-      level_t source_level;
-      point.get(d, source_level, source_index);
+    iters.push_back(iter);
+  }
 
-      if (source_level == 0) {
-        // we only have one child on level 1
-        point.set(d, 1, 1);
-        child_iter = storage.find(&point);
+  size_t numThreads = 1;
+#ifdef _OPENMP
+  numThreads = static_cast<size_t>(omp_get_max_threads());
+#endif
+  // each thread collects the refinements_num largest indicators of its grid points,
+  // the thread-local collections are merged afterwards; functors that cannot be called
+  // concurrently are evaluated by a single thread
+  std::vector<AbstractRefinement::refinement_container_type> localCollections(numThreads);
+  std::exception_ptr exception;
+
+#pragma omp parallel if (functor.isThreadSafe())
+  {
+    size_t threadNum = 0;
+#ifdef _OPENMP
+    threadNum = static_cast<size_t>(omp_get_thread_num());
+#endif
+    AbstractRefinement::refinement_container_type& localCollection =
+      localCollections[threadNum];
+    GridPoint point;
+
+    // I think this may be dependent on local support
+#pragma omp for schedule(static)
+    for (size_t k = 0; k < iters.size(); k++) {
+      const GridStorage::grid_map_iterator& iter = iters[k];
+      point = *(iter->first);
+      bool isRefinable = false;
+
+      for (size_t d = 0; d < storage.getDimension(); d++) {
+        index_t source_index;
+        level_t source_level;
+        point.get(d, source_level, source_index);
+
+        if (source_level == 0) {
+          // we only have one child on level 1
+          point.set(d, 1, 1);
+
+          // if there no more grid points --> test if we should refine the grid
+          if (storage.find(&point) == end_iter) {
+            isRefinable = true;
+            break;
+          }
+        } else {
+          // left child
+          point.set(d, source_level + 1, 2 * source_index - 1);
+
+          // if there no more grid points --> test if we should refine the grid
+          if (storage.find(&point) == end_iter) {
+            isRefinable = true;
+            break;
+          }
 
-        // if there no more grid points --> test if we should refine the grid
-        if (child_iter == end_iter) {
-          AbstractRefinement::refinement_list_type current_value_list =
-            getIndicator(storage, iter, functor);
-          addElementToCollection(iter, current_value_list, refinements_num,
-                                 collection);
-          break;
-        }
-      } else {
-        // left child
-        point.set(d, source_level + 1, 2 * source_index - 1);
-        child_iter = storage.find(&point);
+          // right child
+          point.set(d, source_level + 1, 2 * source_index + 1);
 
-        // if there no more grid points --> test if we should refine the grid
-        if (child_iter == end_iter) {
-          AbstractRefinement::refinement_list_type current_value_list =
-            getIndicator(storage, iter, functor);
-          addElementToCollection(iter, current_value_list, refinements_num,
-                                 collection);
-          break;
+          if (storage.find(&point) == end_iter) {
+            isRefinable = true;
+            break;
+          }
         }
 
-        // right child
-        point.set(d, source_level + 1, 2 * source_index + 1);
-        child_iter = storage.find(&point);
+        point.set(d, source_level, source_index);
+      }
 
-        if (child_iter == end_iter) {
+      if (isRefinable) {
+        // exceptions must not leave the parallel region, they are rethrown below
+        try {
           AbstractRefinement::refinement_list_type current_value_list =
             getIndicator(storage, iter, functor);
           addElementToCollection(iter, current_value_list, refinements_num,
-                                 collection);
-          break;
+                                 localCollection);
+        } catch (...) {
+#pragma omp critical
+          {
+            if (!exception) {
+              exception = std::current_exception();
+            }
+          }
         }
       }
-
-      point.set(d, source_level, source_index);
     }
   }
-}
 
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+
+  mergeCollections(localCollections, refinements_num, collection);
+}
 
 void HashRefinementBoundaries::refineGridpointsCollection(GridStorage& storage,
     RefinementFunctor& functor,
     AbstractRefinement::refinement_container_type& collection) {
   double threshold = functor.getRefinementThreshold();
+  std::vector<size_t> refineIndices;
 
   for (AbstractRefinement::refinement_pair_type& pair : collection) {
     if (pair.second >= threshold) {
-      refineGridpoint(storage, pair.first->getSeq());
+      refineIndices.push_back(pair.first->getSeq());
     }
   }
+
+  refineGridpoints(storage, refineIndices);
 }
 
 void HashRefinementBoundaries::free_refine(GridStorage& storage,
@@ -378,5 +426,131 @@ void HashRefinementBoundaries::createGridpointLevelZeroConsistency(
   }
 }
 
+void HashRefinementBoundaries::stageGridpoint(const GridStorage& storage,
+    GridStorage& staged, size_t refine_index) const {
+  GridPoint point(storage[refine_index]);
+
+  for (size_t d = 0; d < storage.getDimension(); d++) {
+    stageGridpoint1D(storage, staged, point, d);
+  }
+}
+
+void HashRefinementBoundaries::stageGridpoint1D(const GridStorage& storage,
+    GridStorage& staged, GridPoint& point, size_t d) const {
+  index_t source_index;
+  level_t source_level;
+  point.get(d, source_level, source_index);
+
+  if (source_level == 0) {
+    // we only have one child on level 1
+    point.set(d, 1, 1);
+
+    if (!isStaged(storage, staged, point)) {
+      point.setLeaf(true);
+      stageNewGridpoint(storage, staged, point);
+    }
+  } else {
+    // stage left child, if necessary
+    point.set(d, source_level + 1, 2 * source_index - 1);
+
+    if (!isStaged(storage, staged, point)) {
+      point.setLeaf(true);
+      stageNewGridpoint(storage, staged, point);
+    }
+
+    // stage right child, if necessary
+    point.set(d, source_level + 1, 2 * source_index + 1);
+
+    if (!isStaged(storage, staged, point)) {
+      point.setLeaf(true);
+      stageNewGridpoint(storage, staged, point);
+    }
+  }
+
+  point.set(d, source_level, source_index);
+}
+
+void HashRefinementBoundaries::stageNewGridpoint(const GridStorage& storage,
+    GridStorage& staged, GridPoint& point) const {
+  const size_t dim = storage.getDimension();
+
+  // stage the point with its missing parents and boundary points,
+  // as in createGridpointGeneral()
+  for (size_t d = 0; d < dim; d++) {
+    index_t source_index;
+    level_t source_level;
+    point.get(d, source_level, source_index);
+
+    if (source_level == 1) {
+      // boundary points are only needed on a N dim grid
+      if (dim > 1) {
+        point.set(d, 0, 0);
+        stageAncestor(storage, staged, point);
+        point.set(d, 0, 1);
+        stageAncestor(storage, staged, point);
+        point.set(d, source_level, source_index);
+      }
+    } else if (source_level > 1) {
+      if (((source_index + 1) / 2) % 2 == 1) {
+        point.set(d, source_level - 1, (source_index + 1) / 2);
+      } else {
+        point.set(d, source_level - 1, (source_index - 1) / 2);
+      }
+
+      stageAncestor(storage, staged, point);
+      point.set(d, source_level, source_index);
+    }
+  }
+
+  staged.insert(point);
+
+  // stage the missing points on level zero,
+  // as in createGridpointLevelZeroConsistency()
+  if (dim > 1) {
+    for (size_t d = 0; d < dim; d++) {
+      index_t source_index;
+      level_t source_level;
+      point.get(d, source_level, source_index);
+
+      if (source_level == 0) {
+        for (index_t boundary = 0; boundary <= 1; boundary++) {
+          // if we have already one boundary, we need the other one, too
+          point.set(d, 0, boundary);
+
+          if (isStaged(storage, staged, point)) {
+            bool Leaf = point.isLeaf();
+            point.set(d, 0, 1 - boundary);
+
+            if (!isStaged(storage, staged, point)) {
+              bool saveLeaf = point.isLeaf();
+              point.setLeaf(Leaf);
+              stageNewGridpoint(storage, staged, point);
+              point.setLeaf(saveLeaf);
+            } else {
+              setStagedLeaf(storage, staged, point, Leaf);
+            }
+          }
+        }
+
+        // restore values
+        point.set(d, source_level, source_index);
+      }
+    }
+  }
+}
+
+void HashRefinementBoundaries::stageAncestor(const GridStorage& storage,
+    GridStorage& staged, GridPoint& point) const {
+  if (!isStaged(storage, staged, point)) {
+    // missing ancestors are no leaves
+    bool saveLeaf = point.isLeaf();
+    point.setLeaf(false);
+    stageNewGridpoint(storage, staged, point);
+    point.setLeaf(saveLeaf);
+  } else {
+    setStagedLeaf(storage, staged, point, false);
+  }
+}
+
 }  // namespace base
 }  // namespace sgpp
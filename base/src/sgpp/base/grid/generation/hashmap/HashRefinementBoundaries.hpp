@@ -112,7 +112,51 @@ class HashRefinementBoundaries: public AbstractRefinement {
     AbstractRefinement::refinement_container_type& collection) override;
 
   /**
-  * Extends the grid adding elements defined in collection
+   * Counterpart of refineGridpoint() that stages the new points instead of inserting them,
+   * see AbstractRefinement::stageGridpoint().
+   *
+   * @param storage hashmap that stores the gridpoints
+   * @param staged hashmap that collects the points that should be inserted into storage
+   * @param refine_index the index in the hashmap of the point that should be refined
+   */
+  void stageGridpoint(const GridStorage& storage, GridStorage& staged,
+                      size_t refine_index) const override;
+
+  /**
+   * Counterpart of refineGridpoint1D() that stages the new points instead of inserting them.
+   *
+   * @param storage hashmap that stores the gridpoints
+   * @param staged hashmap that collects the points that should be inserted into storage
+   * @param point point to refine
+   * @param d direction
+   */
+  void stageGridpoint1D(const GridStorage& storage, GridStorage& staged, GridPoint& point,
+                        size_t d) const;
+
+  /**
+   * Counterpart of createGridpoint() that stages the point, its missing ancestors and
+   * boundary points instead of inserting them.
+   *
+   * @param storage hashmap that stores the gridpoints
+   * @param staged hashmap that collects the points that should be inserted into storage
+   * @param point the point that should be inserted
+   */
+  void stageNewGridpoint(const GridStorage& storage, GridStorage& staged,
+                         GridPoint& point) const;
+
+  /**
+   * Counterpart of createGridpointSubroutine(): stages an ancestor of a new point
+   * if it is missing, otherwise stages the loss of its leaf property.
+   *
+   * @param storage hashmap that stores the gridpoints
+   * @param staged hashmap that collects the points that should be inserted into storage
+   * @param point the ancestor
+   */
+  void stageAncestor(const GridStorage& storage, GridStorage& staged, GridPoint& point) const;
+
+  /**
+  * Extends the grid adding elements defined in collection. The points are refined by
+  * refineGridpoints(), in batch if several threads are available.
   *
   * @param storage hashmap that stores the grid points
   * @param functor a PredictiveRefinementIndicator specifying the refinement criteria
@@ -19,5 +19,17 @@ void HashRefinementInconsistent::createGridpoint(GridStorage& storage, GridPoint
   storage.insert(point);
 }
 
+void HashRefinementInconsistent::refineGridpointsCollection(GridStorage& storage,
+    RefinementFunctor& functor,
+    AbstractRefinement::refinement_container_type& collection) {
+  double threshold = functor.getRefinementThreshold();
+
+  for (AbstractRefinement::refinement_pair_type& pair : collection) {
+    if (pair.second >= threshold) {
+      refineGridpoint(storage, pair.first->getSeq());
+    }
+  }
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -29,6 +29,19 @@ class HashRefinementInconsistent: public HashRefinement {
    * @param point The point that should be inserted
    */
   void createGridpoint(GridStorage& storage, GridPoint& point) override;
+
+  /**
+   * Extends the grid adding elements defined in collection. The points are refined one after
+   * another by refineGridpoint(), as the customized grid point creation cannot be staged.
+   *
+   * @param storage hashmap that stores the grid points
+   * @param functor a RefinementFunctor specifying the refinement criteria
+   * @param collection container that contains elements to refine
+   */
+  void refineGridpointsCollection(
+    GridStorage& storage,
+    RefinementFunctor& functor,
+    AbstractRefinement::refinement_container_type& collection) override;
 };
 
 }  // namespace base
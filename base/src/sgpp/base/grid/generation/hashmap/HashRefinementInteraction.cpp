@@ -111,5 +111,18 @@ void HashRefinementInteraction::collectRefinablePoints(GridStorage& storage,
     }
   }
 }
+
+void HashRefinementInteraction::refineGridpointsCollection(GridStorage& storage,
+    RefinementFunctor& functor,
+    AbstractRefinement::refinement_container_type& collection) {
+  double threshold = functor.getRefinementThreshold();
+
+  for (AbstractRefinement::refinement_pair_type& pair : collection) {
+    if (pair.second >= threshold) {
+      refineGridpoint(storage, pair.first->getSeq());
+    }
+  }
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -43,6 +43,19 @@ class HashRefinementInteraction : public HashRefinement {
     RefinementFunctor& functor,
     AbstractRefinement::refinement_container_type& collection) override;
 
+  /**
+   * Extends the grid adding elements defined in collection. The points are refined one after
+   * another by refineGridpoint(), as the customized grid point creation cannot be staged.
+   *
+   * @param storage hashmap that stores the grid points
+   * @param functor a RefinementFunctor specifying the refinement criteria
+   * @param collection container that contains elements to refine
+   */
+  void refineGridpointsCollection(
+    GridStorage& storage,
+    RefinementFunctor& functor,
+    AbstractRefinement::refinement_container_type& collection) override;
+
  private:
   std::unordered_set<std::vector<bool>> interactions;
 };
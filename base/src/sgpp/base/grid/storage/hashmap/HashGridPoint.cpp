@@ -12,6 +12,7 @@
 #include <sstream>
 #include <string>
 #include <cmath>
+#include <cstring>
 #include <algorithm>
 #include <utility>
 #include <map>
@@ -21,23 +22,34 @@ namespace sgpp {
 namespace base {
 
 HashGridPoint::HashGridPoint(size_t dimension)
-    : dimension(dimension), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
-  level = new level_type[dimension];
-  index = new index_type[dimension];
-  hInv = new index_type[dimension];
+    : dimension(dimension),
+      level(nullptr),
+      index(nullptr),
+      hInv(nullptr),
+      hash(0),
+      hashValid(false) {
+  allocate();
   leaf = false;
 }
 
 HashGridPoint::HashGridPoint()
-    : dimension(0), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
+    : dimension(0),
+      level(nullptr),
+      index(nullptr),
+      hInv(nullptr),
+      hash(0),
+      hashValid(false) {
   leaf = false;
 }
 
 HashGridPoint::HashGridPoint(const HashGridPoint& o)
-    : dimension(o.dimension), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
-  level = new level_type[dimension];
-  index = new index_type[dimension];
-  hInv = new index_type[dimension];
+    : dimension(o.dimension),
+      level(nullptr),
+      index(nullptr),
+      hInv(nullptr),
+      hash(0),
+      hashValid(false) {
+  allocate();
   leaf = false;
 
   for (size_t d = 0; d < dimension; d++) {
@@ -50,14 +62,17 @@ HashGridPoint::HashGridPoint(const HashGridPoint& o)
 }
 
 HashGridPoint::HashGridPoint(std::istream& istream, int version)
-    : dimension(0), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
+    : dimension(0),
+      level(nullptr),
+      index(nullptr),
+      hInv(nullptr),
+      hash(0),
+      hashValid(false) {
   size_t temp_leaf;
 
   istream >> dimension;
 
-  level = new level_type[dimension];
-  index = new index_type[dimension];
-  hInv = new index_type[dimension];
+  allocate();
   leaf = false;
 
   for (size_t d = 0; d < dimension; d++) {
@@ -92,17 +107,28 @@ HashGridPoint::HashGridPoint(std::istream& istream, int version)
  * Destructor
  */
 HashGridPoint::~HashGridPoint() {
+  // index and hInv point into the same block as level
   if (level) {
     delete[] level;
   }
+}
 
-  if (index) {
-    delete[] index;
+void HashGridPoint::allocate() {
+  // levels, indices and mesh widths share one contiguous block,
+  // so each grid point needs a single allocation and fits in few cache lines
+  static_assert(sizeof(level_type) == sizeof(index_type),
+                "level and index arrays share one allocation and need equal element sizes");
+
+  if (dimension == 0) {
+    level = nullptr;
+    index = nullptr;
+    hInv = nullptr;
+    return;
   }
 
-  if (hInv) {
-    delete[] hInv;
-  }
+  level = new level_type[3 * dimension];
+  index = reinterpret_cast<index_type*>(level + dimension);
+  hInv = reinterpret_cast<index_type*>(level + 2 * dimension);
 }
 
 void HashGridPoint::serialize(std::ostream& ostream, int version) {
@@ -128,7 +154,7 @@ size_t HashGridPoint::getDimension() const { return dimension; }
 
 void HashGridPoint::setLeaf(bool isLeaf) { leaf = isLeaf; }
 
-bool HashGridPoint::isLeaf() { return leaf; }
+bool HashGridPoint::isLeaf() const { return leaf; }
 
 void HashGridPoint::getStandardCoordinates(DataVector& coordinates) const {
   coordinates.resize(dimension);
@@ -153,28 +179,22 @@ void HashGridPoint::rehash() {
 
   for (size_t d = 0; d < dimension; d++) {
     hInv[d] = static_cast<index_type>(1) << level[d];
-    hash = hInv[d] + index[d] + hash * 65599;
+    hash += getHashTerm(d);
   }
 
   this->hash = hash;
+  hashValid = true;
 }
 
 size_t HashGridPoint::getHash() const { return hash; }
 
 bool HashGridPoint::equals(const HashGridPoint& rhs) const {
-  for (size_t d = 0; d < dimension; d++) {
-    if (level[d] != rhs.level[d]) {
-      return false;
-    }
-  }
-
-  for (size_t d = 0; d < dimension; d++) {
-    if (index[d] != rhs.index[d]) {
-      return false;
-    }
+  if (dimension == 0) {
+    return true;
   }
 
-  return true;
+  // levels and indices are stored back to back, so one (vectorized) memcmp compares both
+  return std::memcmp(level, rhs.level, 2 * dimension * sizeof(level_type)) == 0;
 }
 
 HashGridPoint& HashGridPoint::assign(const HashGridPoint& rhs) { return this->operator=(rhs); }
@@ -189,19 +209,8 @@ HashGridPoint& HashGridPoint::operator=(const HashGridPoint& rhs) {
       delete[] level;
     }
 
-    if (index) {
-      delete[] index;
-    }
-
-    if (hInv) {
-      delete[] hInv;
-    }
-
     dimension = rhs.dimension;
-
-    level = new level_type[dimension];
-    index = new index_type[dimension];
-    hInv = new index_type[dimension];
+    allocate();
   }
 
   for (size_t d = 0; d < dimension; d++) {
@@ -11,6 +11,7 @@
 
 #include <sys/types.h>
 
+#include <cstdint>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -86,16 +87,25 @@ class HashGridPoint {
 
   /**
    * Sets level <i>l</i> and index <i>i</i> in dimension <i>d</i> and rehashs the HashGridPoint
-   * object
+   * object. If the hash value is up to date, only the contribution of dimension <i>d</i> is
+   * recomputed, i.e., the cost is independent of the dimensionality.
    *
    * @param d the dimension in which the ansatzfunction is set
    * @param l the level of the ansatzfunction
    * @param i the index of the ansatzfunction
    */
   inline void set(size_t d, level_type l, index_type i) {
-    level[d] = l;
-    index[d] = i;
-    rehash();
+    if (hashValid) {
+      hash -= getHashTerm(d);
+      level[d] = l;
+      index[d] = i;
+      hInv[d] = static_cast<index_type>(1) << l;
+      hash += getHashTerm(d);
+    } else {
+      level[d] = l;
+      index[d] = i;
+      rehash();
+    }
   }
 
   /**
@@ -108,10 +118,8 @@ class HashGridPoint {
    * @param isLeaf specifies if this gridpoint has any childrens in any dimension
    */
   inline void set(size_t d, level_type l, index_type i, bool isLeaf) {
-    level[d] = l;
-    index[d] = i;
+    set(d, l, i);
     leaf = isLeaf;
-    rehash();
   }
 
   /**
@@ -125,6 +133,7 @@ class HashGridPoint {
   inline void push(size_t d, level_type l, index_type i) {
     level[d] = l;
     index[d] = i;
+    hashValid = false;
   }
 
   /**
@@ -140,6 +149,7 @@ class HashGridPoint {
     level[d] = l;
     index[d] = i;
     leaf = isLeaf;
+    hashValid = false;
   }
 
   /**
@@ -182,7 +192,7 @@ class HashGridPoint {
    *
    * @return Returns true if this grid point has <b>no</b> children, otherwise false
    */
-  bool isLeaf();
+  bool isLeaf() const;
 
   /**
    * determines the coordinate in a given dimension
@@ -216,7 +226,11 @@ class HashGridPoint {
   bool isInnerPoint() const;
 
   /**
-   * rehashs the current gridpoint and sets hInv
+   * rehashs the current gridpoint and sets hInv.
+   *
+   * The hash value is the sum of the mixed 64 bit keys (level << 32 | index) of all
+   * dimensions. In contrast to a polynomial rolling hash, the summands are independent,
+   * so the loop vectorizes and set() can update the hash of a single dimension in O(1).
    */
   void rehash();
 
@@ -448,18 +462,45 @@ class HashGridPoint {
   bool isHierarchicalAncestor(HashGridPoint& gpj, size_t dim);
 
  private:
+  /**
+   * computes the contribution of dimension <i>d</i> to the hash value by packing level and
+   * index into one 64 bit key and applying the MurmurHash3 finalizer to it
+   *
+   * @param d the dimension
+   * @return hash contribution of dimension <i>d</i>
+   */
+  inline size_t getHashTerm(size_t d) const {
+    uint64_t key = ((static_cast<uint64_t>(level[d]) << 32) | static_cast<uint64_t>(index[d])) +
+                   static_cast<uint64_t>(d + 1) * 0x9E3779B97F4A7C15ULL;
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+    key *= 0xC4CEB9FE1A85EC53ULL;
+    key ^= key >> 33;
+    return static_cast<size_t>(key);
+  }
+
+  /**
+   * allocates one contiguous block of 3 * dimension entries holding levels, indices
+   * and mesh widths (in this order) and sets the level, index and hInv pointers into it
+   */
+  void allocate();
+
   /// the dimension of the gridpoint
   size_t dimension;
-  /// pointer to array that stores the ansatzfunctions' level
+  /// pointer to array that stores the ansatzfunctions' level (owns the allocated block)
   level_type* level;
-  /// pointer to array that stores the ansatzfunctions' indices
+  /// pointer to array that stores the ansatzfunctions' indices (points into level's block)
   index_type* index;
-  /// pointer to array that stores the mesh widths (1 << level[d] for each dimension)
+  /// pointer to array that stores the mesh widths (1 << level[d] for each dimension,
+  /// points into level's block)
   index_type* hInv;
   /// stores if this gridpoint is a leaf
   bool leaf;
   /// stores the hashvalue of the gridpoint
   size_t hash;
+  /// false if level or index were changed by push() since the last rehash()
+  bool hashValid;
 
   /// helper array to find the lowest significant bit efficiently for 32 bit unsigned ints
   /// -> needed for finding the grid point at the boundary of the support
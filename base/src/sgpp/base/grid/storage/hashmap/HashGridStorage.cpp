@@ -7,6 +7,7 @@
 
 #include <sgpp/base/exception/generation_exception.hpp>
 
+#include <cstring>
 #include <exception>
 #include <list>
 #include <memory>
@@ -18,6 +19,8 @@
 namespace sgpp {
 namespace base {
 
+const char HashGridStorage::binaryMagic[8] = {'S', 'G', 'P', 'P', 'B', 'I', 'N', '1'};
+
 HashGridStorage::HashGridStorage(size_t dimension)
     :  //  GridStorage(dim),
       dimension(dimension),
@@ -101,6 +104,8 @@ HashGridStorage::HashGridStorage(HashGridStorage& copyFrom)
       stretching(copyFrom.bUseStretching ? new Stretching(*copyFrom.stretching) : nullptr),
       bUseStretching(copyFrom.bUseStretching) {
   // copy gridpoints
+  reserve(copyFrom.getSize());
+
   for (size_t i = 0; i < copyFrom.getSize(); i++) {
     this->insert(copyFrom[i]);
   }
@@ -125,6 +130,8 @@ void HashGridStorage::operator=(const HashGridStorage& other) {
     boundingBox = new BoundingBox(*other.boundingBox);
   }
 
+  reserve(other.getSize());
+
   for (size_t i = 0; i < other.getSize(); i++) {
     this->insert(other[i]);
   }
@@ -153,6 +160,12 @@ void HashGridStorage::clear() {
   map.clear();
   // remove all list entries
   list.clear();
+  modificationCount++;
+}
+
+void HashGridStorage::reserve(size_t numPoints) {
+  list.reserve(numPoints);
+  map.reserve(numPoints);
 }
 
 std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoints) {
@@ -162,6 +175,7 @@ std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoint
 
   // sort list
   removePoints.sort();
+  modificationCount++;
 
   // DEBUG : print list points to delete, sorted
   // std::cout << std::endl << "List of points to delete, sorted" << std::endl;
@@ -242,12 +256,42 @@ void HashGridStorage::serialize(std::ostream& ostream, int version) const {
     stretching->serialize(ostream, version);
   }
 
+  if (version == SERIALIZATION_VERSION_BINARY) {
+    serializeBinaryPoints(ostream);
+    return;
+  }
+
   // print the coordinates of the grid points
   for (grid_list_const_iterator iter = list.begin(); iter != list.end(); iter++) {
     (*iter)->serialize(ostream, version);
   }
 }
 
+void HashGridStorage::serializeBinaryPoints(std::ostream& ostream) const {
+  const size_t numPoints = list.size();
+  std::vector<point_type::level_type> levels(numPoints * dimension);
+  std::vector<point_type::index_type> indices(numPoints * dimension);
+  std::vector<uint8_t> leaves(numPoints);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    for (size_t d = 0; d < dimension; d++) {
+      list[i]->get(d, levels[i * dimension + d], indices[i * dimension + d]);
+    }
+
+    leaves[i] = list[i]->isLeaf() ? 1 : 0;
+  }
+
+  const uint32_t byteOrderMark = 0x01020304;
+  ostream.write(binaryMagic, sizeof(binaryMagic));
+  ostream.write(reinterpret_cast<const char*>(&byteOrderMark), sizeof(byteOrderMark));
+  ostream.write(reinterpret_cast<const char*>(levels.data()),
+                levels.size() * sizeof(point_type::level_type));
+  ostream.write(reinterpret_cast<const char*>(indices.data()),
+                indices.size() * sizeof(point_type::index_type));
+  ostream.write(reinterpret_cast<const char*>(leaves.data()), leaves.size());
+  ostream << std::endl;
+}
+
 std::string HashGridStorage::toString() const {
   std::ostringstream ostream;
   this->toString(ostream);
@@ -287,6 +331,7 @@ size_t HashGridStorage::getDimension() const { return dimension; }
 
 size_t HashGridStorage::insert(const point_type& index) {
   point_pointer insert = new HashGridPoint(index);
+  modificationCount++;
   list.push_back(insert);
   return (map[insert] = list.size() - 1);
 }
@@ -322,6 +367,69 @@ void HashGridStorage::insert(point_type& index, std::vector<size_t>& insertedPoi
   }
 }
 
+size_t HashGridStorage::insert(const std::vector<point_type>& points,
+                               std::vector<size_t>* insertedPoints) {
+  // allocate once for the worst case that all points are new
+  if (list.capacity() < list.size() + points.size()) {
+    reserve(list.size() + points.size());
+  }
+
+  size_t numInserted = 0;
+
+  for (const point_type& point : points) {
+    grid_map_iterator iter = map.find(const_cast<point_pointer>(&point));
+
+    if (iter == map.end()) {
+      size_t seq = insert(point);
+      numInserted++;
+
+      if (insertedPoints != nullptr) {
+        insertedPoints->push_back(seq);
+      }
+    } else if (!point.isLeaf()) {
+      iter->first->setLeaf(false);
+    }
+  }
+
+  return numInserted;
+}
+
+size_t HashGridStorage::insert(HashGridStorage& points, std::vector<size_t>* insertedPoints) {
+  // allocate once for the worst case that all points are new
+  if (list.capacity() < list.size() + points.list.size()) {
+    reserve(list.size() + points.list.size());
+  }
+
+  size_t numInserted = 0;
+  modificationCount++;
+
+  for (point_pointer point : points.list) {
+    grid_map_iterator iter = map.find(point);
+
+    if (iter == map.end()) {
+      list.push_back(point);
+      map[point] = list.size() - 1;
+      numInserted++;
+
+      if (insertedPoints != nullptr) {
+        insertedPoints->push_back(list.size() - 1);
+      }
+    } else {
+      if (!point->isLeaf()) {
+        iter->first->setLeaf(false);
+      }
+
+      delete point;
+    }
+  }
+
+  // the points are owned by this storage now
+  points.map.clear();
+  points.list.clear();
+
+  return numInserted;
+}
+
 void HashGridStorage::update(point_type& index, size_t pos) {
   if (pos < list.size()) {
     // Remove old element at pos
@@ -330,6 +438,7 @@ void HashGridStorage::update(point_type& index, size_t pos) {
     delete del;
     // Insert update
     point_pointer insert = new HashGridPoint(index);
+    modificationCount++;
     list[pos] = insert;
     map[insert] = pos;
   }
@@ -337,6 +446,7 @@ void HashGridStorage::update(point_type& index, size_t pos) {
 
 void HashGridStorage::deleteLast() {
   point_pointer del = list.back();
+  modificationCount++;
   map.erase(del);
   list.pop_back();
   delete del;
@@ -601,7 +711,7 @@ void HashGridStorage::parseGridDescription(std::istream& istream) {
   istream >> num;
 
   // check whether grid was created with a version that is too new
-  if (version > SERIALIZATION_VERSION) {
+  if ((version > SERIALIZATION_VERSION) && (version != SERIALIZATION_VERSION_BINARY)) {
     if (version != 4) {
       std::ostringstream errstream;
       errstream << "Version of serialized grid (" << version
@@ -660,6 +770,14 @@ void HashGridStorage::parseGridDescription(std::istream& istream) {
     }
   }
 
+  reserve(num);
+  modificationCount++;
+
+  if (version == SERIALIZATION_VERSION_BINARY) {
+    parseBinaryPoints(istream, num);
+    return;
+  }
+
   for (size_t i = 0; i < num; i++) {
     point_pointer index = new HashGridPoint(istream, version);
     list.push_back(index);
@@ -672,6 +790,52 @@ void HashGridStorage::parseGridDescription(std::istream& istream) {
   }
 }
 
+void HashGridStorage::parseBinaryPoints(std::istream& istream, size_t numPoints) {
+  // skip the line break after the text header; the magic ensures that
+  // no binary data is consumed as whitespace
+  istream >> std::ws;
+
+  char magic[sizeof(binaryMagic)];
+  uint32_t byteOrderMark = 0;
+  istream.read(magic, sizeof(magic));
+  istream.read(reinterpret_cast<char*>(&byteOrderMark), sizeof(byteOrderMark));
+
+  if (!istream || (std::memcmp(magic, binaryMagic, sizeof(binaryMagic)) != 0)) {
+    throw generation_exception("Binary grid point block is missing or corrupted.");
+  }
+
+  if (byteOrderMark != 0x01020304) {
+    throw generation_exception("Binary grid was written on a platform with different byte order.");
+  }
+
+  std::vector<point_type::level_type> levels(numPoints * dimension);
+  std::vector<point_type::index_type> indices(numPoints * dimension);
+  std::vector<uint8_t> leaves(numPoints);
+
+  istream.read(reinterpret_cast<char*>(levels.data()),
+               levels.size() * sizeof(point_type::level_type));
+  istream.read(reinterpret_cast<char*>(indices.data()),
+               indices.size() * sizeof(point_type::index_type));
+  istream.read(reinterpret_cast<char*>(leaves.data()), leaves.size());
+
+  if (!istream) {
+    throw generation_exception("Binary grid point block is truncated.");
+  }
+
+  for (size_t i = 0; i < numPoints; i++) {
+    point_pointer index = new HashGridPoint(dimension);
+
+    for (size_t d = 0; d < dimension; d++) {
+      index->push(d, levels[i * dimension + d], indices[i * dimension + d]);
+    }
+
+    index->setLeaf(leaves[i] != 0);
+    index->rehash();
+    list.push_back(index);
+    map[index] = i;
+  }
+}
+
 void HashGridStorage::getCoordinates(const HashGridPoint& point, DataVector& coordinates) const {
   coordinates.resize(dimension);
 
@@ -127,6 +127,14 @@ class HashGridStorage {
    */
   void clear();
 
+  /**
+   * reserves memory for the given number of grid points, such that
+   * subsequent insertions neither reallocate the point list nor rehash the map
+   *
+   * @param numPoints number of grid points the storage should be able to hold
+   */
+  void reserve(size_t numPoints);
+
   /**
    * Remove several point from HashGridStorage. The points to removed
    * are stored in a list. This function returns a vector of remaining points
@@ -182,6 +190,15 @@ class HashGridStorage {
    */
   size_t getSize() const;
 
+  /**
+   * Returns a counter that is incremented whenever grid points are inserted, deleted or
+   * replaced, e.g., to detect that data structures derived from the grid points are outdated
+   * even if the number of grid points is unchanged.
+   *
+   * @return number of modifications of the grid points so far
+   */
+  uint64_t getModificationCount() const { return modificationCount; }
+
   /**
    * gets the number of inner grid points
    *
@@ -241,6 +258,33 @@ class HashGridStorage {
    */
   void insert(point_type& index, std::vector<size_t>& insertedPoints);
 
+  /**
+   * inserts a batch of grid points in one pass. Points that are already contained in the
+   * storage or that occur more than once in the batch are stored only once (at the position
+   * of their first occurrence); the stored point is a leaf only if all of its occurrences are
+   * leaves. Ancestors are not added, i.e., they have to be part of the batch if missing.
+   *
+   * @param points grid points that should be inserted, in the order of insertion
+   * @param insertedPoints if not null, the sequence numbers of the new points are appended
+   *
+   * @return number of new points
+   */
+  size_t insert(const std::vector<point_type>& points,
+                std::vector<size_t>* insertedPoints = nullptr);
+
+  /**
+   * inserts the grid points of another storage as a batch in one pass, like the insert()
+   * method for vectors of points, but moves the points instead of copying them. The other
+   * storage is empty afterwards.
+   *
+   * @param points storage with the grid points that should be inserted, in the order of their
+   *        sequence numbers (must not be this storage)
+   * @param insertedPoints if not null, the sequence numbers of the new points are appended
+   *
+   * @return number of new points
+   */
+  size_t insert(HashGridStorage& points, std::vector<size_t>* insertedPoints = nullptr);
+
   /**
    * updates an already stored index
    *
@@ -534,12 +578,33 @@ class HashGridStorage {
   /// Flag to check if stretching or boundingBox used
   bool bUseStretching;
 
+  /// number of modifications of the grid points, see getModificationCount()
+  uint64_t modificationCount = 0;
+
+  /// magic that starts the binary grid point block
+  static const char binaryMagic[8];
+
   /**
    * Parses the gird's information (grid points, dimensions, bounding box) from a string stream
    *
    * @param istream the string stream that contains the information
    */
   void parseGridDescription(std::istream& istream);
+
+  /**
+   * Writes the grid points as one binary block (SERIALIZATION_VERSION_BINARY)
+   *
+   * @param ostream stream (opened in binary mode) to which the grid points are written
+   */
+  void serializeBinaryPoints(std::ostream& ostream) const;
+
+  /**
+   * Reads a binary block of grid points written by serializeBinaryPoints
+   *
+   * @param istream stream (opened in binary mode) that contains the grid points
+   * @param numPoints number of grid points in the block
+   */
+  void parseBinaryPoints(std::istream& istream, size_t numPoints);
 };
 
 HashGridStorage::point_pointer inline HashGridStorage::create(point_type& index) {
@@ -550,6 +615,7 @@ HashGridStorage::point_pointer inline HashGridStorage::create(point_type& index)
 void inline HashGridStorage::destroy(point_pointer index) { delete index; }
 
 unsigned int inline HashGridStorage::store(point_pointer index) {
+  modificationCount++;
   list.push_back(index);
   return static_cast<unsigned int>(map[index] = static_cast<unsigned int>(list.size() - 1));
 }
@@ -20,7 +20,16 @@
  * Version 7: PointDistribution changed from enum to enum class
  * Version 8: Add custom boundaryLevel (>= 1) for LinearBoundaryGrid etc.
  * Version 9: Remove PointDistribution again, include Clenshaw-Curtis points in Stretching
+ * Version 10: binary variant of version 9, NOT THE DEFAULT; the header, the bounding box/
+ *        stretching and grid type specific parameters are written as text as in version 9,
+ *        but the grid points are stored as one binary block (magic "SGPPBIN1", uint32
+ *        byte order mark, then all levels, all indices (uint32, point-major) and one leaf
+ *        byte per point). Streams have to be opened in binary mode.
+ *        Grid::unserialize detects this version automatically.
  */
 #define SERIALIZATION_VERSION 9
 
+/// binary serialization version, see above
+#define SERIALIZATION_VERSION_BINARY 10
+
 #endif /* SERIALIZATIONVERSION_HPP */
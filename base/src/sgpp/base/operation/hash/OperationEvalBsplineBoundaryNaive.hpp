@@ -7,11 +7,14 @@
 #define OPERATIONEVALBSPLINEBOUNDARYNAIVE_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/SubspaceSupportIndex.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBoundaryBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace base {
 
@@ -27,7 +30,8 @@ class OperationEvalBsplineBoundaryNaive : public OperationEval {
    * @param degree    B-spline degree
    */
   OperationEvalBsplineBoundaryNaive(GridStorage& storage, size_t degree) :
-    storage(storage), base(degree), pointInUnitCube(storage.getDimension()) {
+    storage(storage), base(degree), pointInUnitCube(storage.getDimension()),
+    supportIndex(storage, base.getSupportRadius()) {
   }
 
   /**
@@ -58,6 +62,10 @@ class OperationEvalBsplineBoundaryNaive : public OperationEval {
   SBsplineBoundaryBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// index of the grid points by the supports of their basis functions
+  SubspaceSupportIndex supportIndex;
+  /// grid points whose basis functions may be non-zero at the evaluation point
+  std::vector<size_t> affectedPoints;
 };
 
 }  // namespace base
@@ -9,63 +9,113 @@
 namespace sgpp {
 namespace base {
 
-double OperationEvalBsplineNaive::eval(const DataVector& alpha,
-                                        const DataVector& point) {
-  const size_t n = storage.getSize();
-  const size_t d = storage.getDimension();
-  double result = 0.0;
-
-  pointInUnitCube = point;
-  storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
+namespace {
+
+/**
+ * @param uniformBSpline  function object evaluating the uniform B-spline
+ * @param degree          B-spline degree
+ * @param gp              grid point
+ * @param point           evaluation point in the unit cube
+ * @return                value of the basis function of the grid point at the evaluation point
+ */
+template <class UniformBSpline>
+inline double evalBasisFunction(const UniformBSpline& uniformBSpline, size_t degree,
+                                const GridPoint& gp, const DataVector& point) {
+  const size_t d = point.getSize();
+  const double offset = static_cast<double>(degree + 1) / 2.0;
+  double value = 1.0;
+
+  for (size_t t = 0; t < d; t++) {
+    const double hInv = static_cast<double>(static_cast<index_t>(1) << gp.getLevel(t));
+    const double val1d =
+        uniformBSpline(point[t] * hInv - static_cast<double>(gp.getIndex(t)) + offset);
+
+    if (val1d == 0.0) {
+      return 0.0;
+    }
 
-  for (size_t i = 0; i < n; i++) {
-    const GridPoint& gp = storage[i];
-    double curValue = 1.0;
+    value *= val1d;
+  }
 
-    for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
+  return value;
+}
 
-      if (val1d == 0.0) {
-        curValue = 0.0;
-        break;
-      }
+}  // namespace
 
-      curValue *= val1d;
-    }
+double OperationEvalBsplineNaive::eval(const DataVector& alpha,
+                                        const DataVector& point) {
+  pointInUnitCube = point;
+  storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
 
-    result += alpha[i] * curValue;
+  supportIndex.getAffectedPoints(pointInUnitCube, affectedPoints);
+
+  // dispatch on the degree once, so the inner loop is specialized for it
+  switch (base.getDegree()) {
+    case 1:
+      return evalKernel(UniformBsplineFixedDegree<1>(), alpha);
+    case 3:
+      return evalKernel(UniformBsplineFixedDegree<3>(), alpha);
+    case 5:
+      return evalKernel(UniformBsplineFixedDegree<5>(), alpha);
+    case 7:
+      return evalKernel(UniformBsplineFixedDegree<7>(), alpha);
+    default:
+      return evalKernel(UniformBsplineRuntimeDegree{base}, alpha);
   }
-
-  return result;
 }
 
 void OperationEvalBsplineNaive::eval(const DataMatrix& alpha,
                                      const DataVector& point,
                                      DataVector& value) {
-  const size_t n = storage.getSize();
-  const size_t d = storage.getDimension();
-  const size_t m = alpha.getNcols();
-
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
 
-  value.resize(m);
+  value.resize(alpha.getNcols());
   value.setAll(0.0);
 
-  for (size_t i = 0; i < n; i++) {
-    const GridPoint& gp = storage[i];
-    double curValue = 1.0;
+  supportIndex.getAffectedPoints(pointInUnitCube, affectedPoints);
+
+  switch (base.getDegree()) {
+    case 1:
+      evalKernel(UniformBsplineFixedDegree<1>(), alpha, value);
+      break;
+    case 3:
+      evalKernel(UniformBsplineFixedDegree<3>(), alpha, value);
+      break;
+    case 5:
+      evalKernel(UniformBsplineFixedDegree<5>(), alpha, value);
+      break;
+    case 7:
+      evalKernel(UniformBsplineFixedDegree<7>(), alpha, value);
+      break;
+    default:
+      evalKernel(UniformBsplineRuntimeDegree{base}, alpha, value);
+      break;
+  }
+}
+
+template <class UniformBSpline>
+double OperationEvalBsplineNaive::evalKernel(UniformBSpline uniformBSpline,
+                                             const DataVector& alpha) {
+  const size_t degree = base.getDegree();
+  double result = 0.0;
 
-    for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
+  for (size_t i : affectedPoints) {
+    result += alpha[i] * evalBasisFunction(uniformBSpline, degree, storage[i], pointInUnitCube);
+  }
 
-      if (val1d == 0.0) {
-        curValue = 0.0;
-        break;
-      }
+  return result;
+}
 
-      curValue *= val1d;
-    }
+template <class UniformBSpline>
+void OperationEvalBsplineNaive::evalKernel(UniformBSpline uniformBSpline,
+                                           const DataMatrix& alpha, DataVector& value) {
+  const size_t degree = base.getDegree();
+  const size_t m = alpha.getNcols();
+
+  for (size_t i : affectedPoints) {
+    const double curValue =
+        evalBasisFunction(uniformBSpline, degree, storage[i], pointInUnitCube);
 
     for (size_t j = 0; j < m; j++) {
       value[j] += alpha(i, j) * curValue;
@@ -7,12 +7,15 @@
 #define OPERATIONEVALBSPLINENAIVE_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/SubspaceSupportIndex.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace base {
 
@@ -28,7 +31,8 @@ class OperationEvalBsplineNaive : public OperationEval {
    * @param degree    B-spline degree
    */
   OperationEvalBsplineNaive(GridStorage& storage, size_t degree) :
-    storage(storage), base(degree), pointInUnitCube(storage.getDimension()) {
+    storage(storage), base(degree), pointInUnitCube(storage.getDimension()),
+    supportIndex(storage, base.getSupportRadius()) {
   }
 
   /**
@@ -53,12 +57,36 @@ class OperationEvalBsplineNaive : public OperationEval {
             DataVector& value) override;
 
  protected:
+  /**
+   * Kernel of eval(), instantiated once per B-spline degree.
+   *
+   * @param uniformBSpline  function object evaluating the uniform B-spline of the degree
+   * @param alpha           coefficient vector
+   * @return                value of the linear combination at pointInUnitCube
+   */
+  template <class UniformBSpline>
+  double evalKernel(UniformBSpline uniformBSpline, const DataVector& alpha);
+
+  /**
+   * Kernel of eval() for coefficient matrices, instantiated once per B-spline degree.
+   *
+   * @param      uniformBSpline  function object evaluating the uniform B-spline of the degree
+   * @param      alpha           coefficient matrix (each column is a coefficient vector)
+   * @param[out] value           values of the linear combinations at pointInUnitCube
+   */
+  template <class UniformBSpline>
+  void evalKernel(UniformBSpline uniformBSpline, const DataMatrix& alpha, DataVector& value);
+
   /// storage of the sparse grid
   GridStorage& storage;
   /// 1D B-spline basis
   SBsplineBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// index of the grid points by the supports of their basis functions
+  SubspaceSupportIndex supportIndex;
+  /// grid points whose basis functions may be non-zero at the evaluation point
+  std::vector<size_t> affectedPoints;
 };
 
 }  // namespace base
@@ -7,11 +7,14 @@
 #define OPERATIONEVALGRADIENTBSPLINE_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/SubspaceSupportIndex.hpp>
 #include <sgpp/base/operation/hash/OperationEvalGradient.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace base {
 
@@ -30,7 +33,8 @@ class OperationEvalGradientBsplineNaive : public OperationEvalGradient {
     storage(storage),
     base(degree),
     pointInUnitCube(storage.getDimension()),
-    innerDerivative(storage.getDimension()) {
+    innerDerivative(storage.getDimension()),
+    supportIndex(storage, base.getSupportRadius()) {
   }
 
   /**
@@ -69,6 +73,10 @@ class OperationEvalGradientBsplineNaive : public OperationEvalGradient {
   DataVector pointInUnitCube;
   /// inner derivative (temporary vector)
   DataVector innerDerivative;
+  /// index of the grid points by the supports of their basis functions
+  SubspaceSupportIndex supportIndex;
+  /// grid points whose basis functions may be non-zero at the evaluation point
+  std::vector<size_t> affectedPoints;
 };
 
 }  // namespace base
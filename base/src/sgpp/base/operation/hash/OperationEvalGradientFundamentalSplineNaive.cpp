@@ -12,7 +12,6 @@ namespace base {
 double OperationEvalGradientFundamentalSplineNaive::evalGradient(const DataVector& alpha,
                                                                  const DataVector& point,
                                                                  DataVector& gradient) {
-  const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   double result = 0.0;
 
@@ -28,7 +27,9 @@ double OperationEvalGradientFundamentalSplineNaive::evalGradient(const DataVecto
 
   DataVector curGradient(d);
 
-  for (size_t i = 0; i < n; i++) {
+  supportIndex.getAffectedPoints(pointInUnitCube, affectedPoints);
+
+  for (size_t i : affectedPoints) {
     const GridPoint& gp = storage[i];
     double curValue = 1.0;
     curGradient.setAll(alpha[i]);
@@ -60,7 +61,6 @@ void OperationEvalGradientFundamentalSplineNaive::evalGradient(const DataMatrix&
                                                                const DataVector& point,
                                                                DataVector& value,
                                                                DataMatrix& gradient) {
-  const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   const size_t m = alpha.getNcols();
 
@@ -79,7 +79,9 @@ void OperationEvalGradientFundamentalSplineNaive::evalGradient(const DataMatrix&
 
   DataVector curGradient(d);
 
-  for (size_t i = 0; i < n; i++) {
+  supportIndex.getAffectedPoints(pointInUnitCube, affectedPoints);
+
+  for (size_t i : affectedPoints) {
     const GridPoint& gp = storage[i];
     double curValue = 1.0;
     curGradient.setAll(1.0);
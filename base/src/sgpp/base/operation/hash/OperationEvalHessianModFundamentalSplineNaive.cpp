@@ -15,7 +15,6 @@ double OperationEvalHessianModFundamentalSplineNaive::evalHessian(const DataVect
                                                                   const DataVector& point,
                                                                   DataVector& gradient,
                                                                   DataMatrix& hessian) {
-  const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   double result = 0.0;
 
@@ -35,7 +34,9 @@ double OperationEvalHessianModFundamentalSplineNaive::evalHessian(const DataVect
   DataVector curGradient(d);
   DataMatrix curHessian(d, d);
 
-  for (size_t i = 0; i < n; i++) {
+  supportIndex.getAffectedPoints(pointInUnitCube, affectedPoints);
+
+  for (size_t i : affectedPoints) {
     const GridPoint& gp = storage[i];
     double curValue = 1.0;
     curGradient.setAll(alpha[i]);
@@ -88,7 +89,6 @@ void OperationEvalHessianModFundamentalSplineNaive::evalHessian(const DataMatrix
                                                                 DataVector& value,
                                                                 DataMatrix& gradient,
                                                                 std::vector<DataMatrix>& hessian) {
-  const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   const size_t m = alpha.getNcols();
 
@@ -117,7 +117,9 @@ void OperationEvalHessianModFundamentalSplineNaive::evalHessian(const DataMatrix
   DataVector curGradient(d);
   DataMatrix curHessian(d, d);
 
-  for (size_t i = 0; i < n; i++) {
+  supportIndex.getAffectedPoints(pointInUnitCube, affectedPoints);
+
+  for (size_t i : affectedPoints) {
     const GridPoint& gp = storage[i];
     double curValue = 1.0;
     curGradient.setAll(1.0);
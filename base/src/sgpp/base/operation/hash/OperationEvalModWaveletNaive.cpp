@@ -11,14 +11,15 @@ namespace base {
 
 double OperationEvalModWaveletNaive::eval(const DataVector& alpha,
     const DataVector& point) {
-  const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   double result = 0.0;
 
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
 
-  for (size_t i = 0; i < n; i++) {
+  supportIndex.getAffectedPoints(pointInUnitCube, affectedPoints);
+
+  for (size_t i : affectedPoints) {
     const GridPoint& gp = storage[i];
     double curValue = 1.0;
 
@@ -42,7 +43,6 @@ double OperationEvalModWaveletNaive::eval(const DataVector& alpha,
 void OperationEvalModWaveletNaive::eval(const DataMatrix& alpha,
                                         const DataVector& point,
                                         DataVector& value) {
-  const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   const size_t m = alpha.getNcols();
 
@@ -52,7 +52,9 @@ void OperationEvalModWaveletNaive::eval(const DataMatrix& alpha,
   value.resize(m);
   value.setAll(0.0);
 
-  for (size_t i = 0; i < n; i++) {
+  supportIndex.getAffectedPoints(pointInUnitCube, affectedPoints);
+
+  for (size_t i : affectedPoints) {
     const GridPoint& gp = storage[i];
     double curValue = 1.0;
 
@@ -7,11 +7,14 @@
 #define OPERATIONEVALMODWAVELETNAIVE_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/SubspaceSupportIndex.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/WaveletModifiedBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace base {
 
@@ -26,7 +29,8 @@ class OperationEvalModWaveletNaive : public OperationEval {
    * @param storage   storage of the sparse grid
    */
   explicit OperationEvalModWaveletNaive(GridStorage& storage) :
-    storage(storage), pointInUnitCube(storage.getDimension()) {
+    storage(storage), pointInUnitCube(storage.getDimension()),
+    supportIndex(storage, base.getSupportRadius()) {
   }
 
   /**
@@ -57,6 +61,10 @@ class OperationEvalModWaveletNaive : public OperationEval {
   SWaveletModifiedBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// index of the grid points by the supports of their basis functions
+  SubspaceSupportIndex supportIndex;
+  /// grid points whose basis functions may be non-zero at the evaluation point
+  std::vector<size_t> affectedPoints;
 };
 
 }  // namespace base
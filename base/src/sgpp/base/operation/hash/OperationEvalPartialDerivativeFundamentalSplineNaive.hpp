@@ -7,11 +7,14 @@
 #define OPERATIONEVALPARTIALDERIVATIVEFUNDAMENTALSPLINE_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/SubspaceSupportIndex.hpp>
 #include <sgpp/base/operation/hash/OperationEvalPartialDerivative.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/FundamentalSplineBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace base {
 
@@ -31,7 +34,8 @@ class OperationEvalPartialDerivativeFundamentalSplineNaive :
   OperationEvalPartialDerivativeFundamentalSplineNaive(GridStorage& storage, size_t degree) :
     storage(storage),
     base(degree),
-    pointInUnitCube(storage.getDimension()) {
+    pointInUnitCube(storage.getDimension()),
+    supportIndex(storage, base.getSupportRadius()) {
   }
 
   /**
@@ -75,6 +79,10 @@ class OperationEvalPartialDerivativeFundamentalSplineNaive :
   SFundamentalSplineBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// index of the grid points by the supports of their basis functions
+  SubspaceSupportIndex supportIndex;
+  /// grid points whose basis functions may be non-zero at the evaluation point
+  std::vector<size_t> affectedPoints;
 };
 
 }  // namespace base
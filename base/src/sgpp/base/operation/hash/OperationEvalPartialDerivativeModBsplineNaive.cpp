@@ -14,7 +14,6 @@ double OperationEvalPartialDerivativeModBsplineNaive::evalPartialDerivative(
     const DataVector& point,
     size_t derivDim,
     double& partialDerivative) {
-  const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   double result = 0.0;
 
@@ -24,7 +23,9 @@ double OperationEvalPartialDerivativeModBsplineNaive::evalPartialDerivative(
 
   const double innerDerivative = 1.0 / storage.getBoundingBox()->getIntervalWidth(derivDim);
 
-  for (size_t i = 0; i < n; i++) {
+  supportIndex.getAffectedPoints(pointInUnitCube, affectedPoints);
+
+  for (size_t i : affectedPoints) {
     const GridPoint& gp = storage[i];
     double curValue = 1.0;
     double curPartialDerivative = 1.0;
@@ -58,7 +59,6 @@ void OperationEvalPartialDerivativeModBsplineNaive::evalPartialDerivative(
     size_t derivDim,
     DataVector& value,
     DataVector& partialDerivative) {
-  const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   const size_t m = alpha.getNcols();
 
@@ -72,7 +72,9 @@ void OperationEvalPartialDerivativeModBsplineNaive::evalPartialDerivative(
   partialDerivative.resize(m);
   partialDerivative.setAll(0.0);
 
-  for (size_t i = 0; i < n; i++) {
+  supportIndex.getAffectedPoints(pointInUnitCube, affectedPoints);
+
+  for (size_t i : affectedPoints) {
     const GridPoint& gp = storage[i];
     double curValue = 1.0;
     double curPartialDerivative = 1.0;
@@ -9,14 +9,15 @@ namespace sgpp {
 namespace base {
 
 double OperationEvalPolyBoundaryNaive::eval(const DataVector& alpha, const DataVector& point) {
-  const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   double result = 0.0;
 
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
 
-  for (size_t i = 0; i < n; i++) {
+  supportIndex.getAffectedPoints(pointInUnitCube, affectedPoints);
+
+  for (size_t i : affectedPoints) {
     const GridPoint& gp = storage[i];
     double curValue = 1.0;
 
@@ -39,7 +40,6 @@ double OperationEvalPolyBoundaryNaive::eval(const DataVector& alpha, const DataV
 
 void OperationEvalPolyBoundaryNaive::eval(const DataMatrix& alpha, const DataVector& point,
                                           DataVector& value) {
-  const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   const size_t m = alpha.getNcols();
 
@@ -49,7 +49,9 @@ void OperationEvalPolyBoundaryNaive::eval(const DataMatrix& alpha, const DataVec
   value.resize(m);
   value.setAll(0.0);
 
-  for (size_t i = 0; i < n; i++) {
+  supportIndex.getAffectedPoints(pointInUnitCube, affectedPoints);
+
+  for (size_t i : affectedPoints) {
     const GridPoint& gp = storage[i];
     double curValue = 1.0;
 
@@ -29,7 +29,7 @@ void OperationHierarchisationModLinear::doHierarchisation(
 
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
-    s.sweep1D(node_values, node_values, i);
+    s.sweep1D_parallel(node_values, node_values, i);
   }
 }
 
@@ -45,7 +45,7 @@ void OperationHierarchisationModLinear::doDehierarchisation(DataVector& alpha) {
 
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
-    s.sweep1D(alpha, alpha, i);
+    s.sweep1D_parallel(alpha, alpha, i);
   }
 }
 
@@ -6,6 +6,7 @@
 #ifndef OPERATIONMATRIX_HPP
 #define OPERATIONMATRIX_HPP
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -38,6 +39,37 @@ class OperationMatrix {
    * @param result DataVector into which the result of the Laplace operation is stored
    */
   virtual void mult(DataVector& alpha, DataVector& result) = 0;
+
+  /**
+   * Multiplication with several vectors at once, e.g., for systems with multiple
+   * right-hand sides.
+   * The default implementation multiplies the columns one after another;
+   * operations that can treat all columns in one pass (e.g., stream over a data set only
+   * once) should override it.
+   *
+   * @param alpha DataMatrix whose columns are the vectors to be multiplied
+   * @param result DataMatrix into which the results are stored column-wise (resized)
+   */
+  virtual void mult(DataMatrix& alpha, DataMatrix& result) {
+    const size_t numberOfColumns = alpha.getNcols();
+    DataVector alphaColumn(alpha.getNrows());
+    DataVector resultColumn(alpha.getNrows());
+
+    for (size_t j = 0; j < numberOfColumns; j++) {
+      alpha.getColumn(j, alphaColumn);
+      this->mult(alphaColumn, resultColumn);
+
+      if (j == 0) {
+        result.resizeRowsCols(resultColumn.getSize(), numberOfColumns);
+      }
+
+      result.setColumn(j, resultColumn);
+    }
+
+    if (numberOfColumns == 0) {
+      result.resizeRowsCols(alpha.getNrows(), 0);
+    }
+  }
 };
 
 }  // namespace base
@@ -101,6 +101,48 @@ class OperationMultipleEval {
     throw sgpp::base::not_implemented_exception();
   }
 
+  /**
+   * Multiplication of @f$B^T@f$ with several vectors at once, i.e., with the columns of
+   * a matrix.
+   * The default implementation multiplies the columns one after another; kernels that can
+   * evaluate all columns in one pass over the data set should override it.
+   *
+   * @param alpha matrix with one row per grid point, whose columns @f$B@f$ is applied to
+   * @param result matrix with one row per data point and one column per column of alpha
+   */
+  virtual void mult(DataMatrix& alpha, DataMatrix& result) {
+    DataVector alphaColumn(alpha.getNrows());
+    DataVector resultColumn(dataset.getNrows());
+    result.resizeRowsCols(dataset.getNrows(), alpha.getNcols());
+
+    for (size_t j = 0; j < alpha.getNcols(); j++) {
+      alpha.getColumn(j, alphaColumn);
+      this->mult(alphaColumn, resultColumn);
+      result.setColumn(j, resultColumn);
+    }
+  }
+
+  /**
+   * Multiplication of @f$B@f$ with several vectors at once, i.e., with the columns of
+   * a matrix.
+   * The default implementation multiplies the columns one after another; kernels that can
+   * evaluate all columns in one pass over the data set should override it.
+   *
+   * @param source matrix with one row per data point, whose columns @f$B^T@f$ is applied to
+   * @param result matrix with one row per grid point and one column per column of source
+   */
+  virtual void multTranspose(DataMatrix& source, DataMatrix& result) {
+    DataVector sourceColumn(source.getNrows());
+    DataVector resultColumn(grid.getSize());
+    result.resizeRowsCols(grid.getSize(), source.getNcols());
+
+    for (size_t j = 0; j < source.getNcols(); j++) {
+      source.getColumn(j, sourceColumn);
+      this->multTranspose(sourceColumn, resultColumn);
+      result.setColumn(j, resultColumn);
+    }
+  }
+
   /**
    * Evaluate multiple datapoints with the specified grid
    *
@@ -10,70 +10,146 @@
 namespace sgpp {
 namespace base {
 
-void OperationMultipleEvalBsplineNaive::mult(DataVector& alpha, DataVector& result) {
-  const size_t n = storage.getSize();
-  const size_t d = storage.getDimension();
-  const size_t m = dataset.getNrows();
-
-  result.setAll(0.0);
-
-  pointsInUnitCube = dataset;
-  storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
+namespace {
+
+/**
+ * @param uniformBSpline  function object evaluating the uniform B-spline
+ * @param levelFactors    2^level of the grid point
+ * @param shiftedIndices  index - (degree + 1) / 2 of the grid point
+ * @param point           evaluation point in the unit cube
+ * @param d               dimension
+ * @return                value of the basis function of the grid point at the evaluation point
+ */
+template <class UniformBSpline>
+inline double evalBasisFunction(const UniformBSpline& uniformBSpline, const double* levelFactors,
+                                const double* shiftedIndices, const double* point, size_t d) {
+  double value = 1.0;
+
+  for (size_t t = 0; t < d; t++) {
+    const double val1d = uniformBSpline(point[t] * levelFactors[t] - shiftedIndices[t]);
+
+    if (val1d == 0.0) {
+      return 0.0;
+    }
 
-  for (size_t j = 0; j < m; j++) {
-    for (size_t i = 0; i < n; i++) {
-      const GridPoint& gp = storage[i];
-      double curValue = 1.0;
+    value *= val1d;
+  }
 
-      for (size_t t = 0; t < d; t++) {
-        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
+  return value;
+}
 
-        if (val1d == 0.0) {
-          curValue = 0.0;
-          break;
-        }
+}  // namespace
 
-        curValue *= val1d;
-      }
+void OperationMultipleEvalBsplineNaive::mult(DataVector& alpha, DataVector& result) {
+  prepare();
+
+  // dispatch on the degree once, so the inner loops are specialized for it
+  switch (base.getDegree()) {
+    case 1:
+      multKernel(UniformBsplineFixedDegree<1>(), alpha, result);
+      break;
+    case 3:
+      multKernel(UniformBsplineFixedDegree<3>(), alpha, result);
+      break;
+    case 5:
+      multKernel(UniformBsplineFixedDegree<5>(), alpha, result);
+      break;
+    case 7:
+      multKernel(UniformBsplineFixedDegree<7>(), alpha, result);
+      break;
+    default:
+      multKernel(UniformBsplineRuntimeDegree{base}, alpha, result);
+      break;
+  }
+}
 
-      result[j] += alpha[i] * curValue;
-    }
+void OperationMultipleEvalBsplineNaive::multTranspose(DataVector& source, DataVector& result) {
+  prepare();
+
+  switch (base.getDegree()) {
+    case 1:
+      multTransposeKernel(UniformBsplineFixedDegree<1>(), source, result);
+      break;
+    case 3:
+      multTransposeKernel(UniformBsplineFixedDegree<3>(), source, result);
+      break;
+    case 5:
+      multTransposeKernel(UniformBsplineFixedDegree<5>(), source, result);
+      break;
+    case 7:
+      multTransposeKernel(UniformBsplineFixedDegree<7>(), source, result);
+      break;
+    default:
+      multTransposeKernel(UniformBsplineRuntimeDegree{base}, source, result);
+      break;
   }
 }
 
-void OperationMultipleEvalBsplineNaive::multTranspose(DataVector& alpha, DataVector& result) {
+double OperationMultipleEvalBsplineNaive::getDuration() { return 0.0; }
+
+void OperationMultipleEvalBsplineNaive::prepare() {
   const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
-  const size_t m = dataset.getNrows();
-
-  result.setAll(0.0);
+  const double offset = static_cast<double>(base.getDegree() + 1) / 2.0;
 
   pointsInUnitCube = dataset;
   storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
 
+  levelFactors.resize(n * d);
+  shiftedIndices.resize(n * d);
+
   for (size_t i = 0; i < n; i++) {
     const GridPoint& gp = storage[i];
 
-    for (size_t j = 0; j < m; j++) {
-      double curValue = 1.0;
-
-      for (size_t t = 0; t < d; t++) {
-        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
+    for (size_t t = 0; t < d; t++) {
+      levelFactors[i * d + t] = static_cast<double>(static_cast<index_t>(1) << gp.getLevel(t));
+      shiftedIndices[i * d + t] = static_cast<double>(gp.getIndex(t)) - offset;
+    }
+  }
+}
 
-        if (val1d == 0.0) {
-          curValue = 0.0;
-          break;
-        }
+template <class UniformBSpline>
+void OperationMultipleEvalBsplineNaive::multKernel(UniformBSpline uniformBSpline,
+                                                   const DataVector& alpha, DataVector& result) {
+  const size_t n = storage.getSize();
+  const size_t d = storage.getDimension();
+  const size_t m = pointsInUnitCube.getNrows();
+  const double* points = pointsInUnitCube.getPointer();
 
-        curValue *= val1d;
-      }
+#pragma omp parallel for schedule(static)
+  for (size_t j = 0; j < m; j++) {
+    double value = 0.0;
 
-      result[i] += alpha[j] * curValue;
+    for (size_t i = 0; i < n; i++) {
+      value += alpha[i] * evalBasisFunction(uniformBSpline, &levelFactors[i * d],
+                                            &shiftedIndices[i * d], &points[j * d], d);
     }
+
+    result[j] = value;
   }
 }
 
-double OperationMultipleEvalBsplineNaive::getDuration() { return 0.0; }
+template <class UniformBSpline>
+void OperationMultipleEvalBsplineNaive::multTransposeKernel(UniformBSpline uniformBSpline,
+                                                            const DataVector& source,
+                                                            DataVector& result) {
+  const size_t n = storage.getSize();
+  const size_t d = storage.getDimension();
+  const size_t m = pointsInUnitCube.getNrows();
+  const double* points = pointsInUnitCube.getPointer();
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < n; i++) {
+    double value = 0.0;
+
+    for (size_t j = 0; j < m; j++) {
+      value += source[j] * evalBasisFunction(uniformBSpline, &levelFactors[i * d],
+                                             &shiftedIndices[i * d], &points[j * d], d);
+    }
+
+    result[i] = value;
+  }
+}
 
 }  // namespace base
 }  // namespace sgpp
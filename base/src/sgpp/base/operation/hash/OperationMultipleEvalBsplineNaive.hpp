@@ -12,6 +12,8 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace base {
 
@@ -28,12 +30,43 @@ class OperationMultipleEvalBsplineNaive : public OperationMultipleEval {
   double getDuration() override;
 
  protected:
+  /**
+   * Transforms the data points to the unit cube and precomputes the level factors and the
+   * shifted indices of the grid points.
+   */
+  void prepare();
+
+  /**
+   * Kernel of mult(), instantiated once per B-spline degree.
+   *
+   * @param      uniformBSpline  function object evaluating the uniform B-spline of the degree
+   * @param      alpha           coefficient vector
+   * @param[out] result          values of the linear combination at the data points
+   */
+  template <class UniformBSpline>
+  void multKernel(UniformBSpline uniformBSpline, const DataVector& alpha, DataVector& result);
+
+  /**
+   * Kernel of multTranspose(), instantiated once per B-spline degree.
+   *
+   * @param      uniformBSpline  function object evaluating the uniform B-spline of the degree
+   * @param      source          vector with one entry per data point
+   * @param[out] result          vector with one entry per grid point
+   */
+  template <class UniformBSpline>
+  void multTransposeKernel(UniformBSpline uniformBSpline, const DataVector& source,
+                           DataVector& result);
+
   /// storage of the sparse grid
   GridStorage& storage;
   /// 1D B-spline basis
   SBsplineBase base;
   /// untransformed evaluation point (temporary vector)
   DataMatrix pointsInUnitCube;
+  /// 2^level of the grid points, row by row (temporary vector)
+  std::vector<double> levelFactors;
+  /// index - (degree + 1) / 2 of the grid points, row by row (temporary vector)
+  std::vector<double> shiftedIndices;
 };
 
 }  // namespace base
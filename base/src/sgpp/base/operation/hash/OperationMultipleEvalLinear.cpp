@@ -26,6 +26,20 @@ void OperationMultipleEvalLinear::multTranspose(DataVector& alpha, DataVector& r
   op.mult_transpose(storage, base, alpha, this->dataset, result);
 }
 
+void OperationMultipleEvalLinear::mult(DataMatrix& alpha, DataMatrix& result) {
+  AlgorithmMultipleEvaluation<SLinearBase> op;
+  LinearBasis<unsigned int, unsigned int> base;
+
+  op.mult(storage, base, alpha, this->dataset, result);
+}
+
+void OperationMultipleEvalLinear::multTranspose(DataMatrix& source, DataMatrix& result) {
+  AlgorithmMultipleEvaluation<SLinearBase> op;
+  LinearBasis<unsigned int, unsigned int> base;
+
+  op.mult_transpose(storage, base, source, this->dataset, result);
+}
+
 double OperationMultipleEvalLinear::getDuration() { return 0.0; }
 
 }  // namespace base
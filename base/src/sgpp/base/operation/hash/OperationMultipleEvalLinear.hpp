@@ -36,6 +36,22 @@ class OperationMultipleEvalLinear : public OperationMultipleEval {
   void mult(DataVector& alpha, DataVector& result) override;
   void multTranspose(DataVector& source, DataVector& result) override;
 
+  /**
+   * Evaluates all columns in one pass over the data set.
+   *
+   * @param alpha matrix with one row per grid point, whose columns @f$B@f$ is applied to
+   * @param result matrix with one row per data point and one column per column of alpha
+   */
+  void mult(DataMatrix& alpha, DataMatrix& result) override;
+
+  /**
+   * Evaluates all columns in one pass over the data set.
+   *
+   * @param source matrix with one row per data point, whose columns @f$B^T@f$ is applied to
+   * @param result matrix with one row per grid point and one column per column of source
+   */
+  void multTranspose(DataMatrix& source, DataMatrix& result) override;
+
   double getDuration() override;
 
  protected:
@@ -10,70 +10,138 @@
 namespace sgpp {
 namespace base {
 
-void OperationMultipleEvalPolyNaive::mult(DataVector& alpha, DataVector& result) {
-  const size_t n = storage.getSize();
-  const size_t d = storage.getDimension();
-  const size_t m = dataset.getNrows();
-
-  result.setAll(0.0);
-
-  pointsInUnitCube = dataset;
-  storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
+namespace {
+
+/**
+ * @tparam P        number of factors with a specialized loop, see PolyBasisFactors::eval
+ * @param  factors  1D basis functions of the grid points
+ * @param  entry    entry of the first dimension of the grid point
+ * @param  point    evaluation point in the unit cube
+ * @param  d        dimension
+ * @return          value of the basis function of the grid point at the evaluation point
+ */
+template <size_t P>
+inline double evalBasisFunction(const PolyBasisFactors& factors, size_t entry,
+                                const double* point, size_t d) {
+  double value = 1.0;
+
+  for (size_t t = 0; t < d; t++) {
+    const double val1d = factors.eval<P>(entry + t, point[t]);
+
+    if (val1d == 0.0) {
+      return 0.0;
+    }
 
-  for (size_t j = 0; j < m; j++) {
-    for (size_t i = 0; i < n; i++) {
-      const GridPoint& gp = storage[i];
-      double curValue = 1.0;
+    value *= val1d;
+  }
 
-      for (size_t t = 0; t < d; t++) {
-        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
+  return value;
+}
 
-        if (val1d == 0.0) {
-          curValue = 0.0;
-          break;
-        }
+}  // namespace
 
-        curValue *= val1d;
-      }
+void OperationMultipleEvalPolyNaive::mult(DataVector& alpha, DataVector& result) {
+  prepare();
+
+  // dispatch on the degree once, so the inner loops are specialized for it
+  switch (base.getDegree()) {
+    case 2:
+      multKernel<2>(alpha, result);
+      break;
+    case 3:
+      multKernel<3>(alpha, result);
+      break;
+    case 4:
+      multKernel<4>(alpha, result);
+      break;
+    case 5:
+      multKernel<5>(alpha, result);
+      break;
+    default:
+      multKernel<0>(alpha, result);
+      break;
+  }
+}
 
-      result[j] += alpha[i] * curValue;
-    }
+void OperationMultipleEvalPolyNaive::multTranspose(DataVector& source, DataVector& result) {
+  prepare();
+
+  switch (base.getDegree()) {
+    case 2:
+      multTransposeKernel<2>(source, result);
+      break;
+    case 3:
+      multTransposeKernel<3>(source, result);
+      break;
+    case 4:
+      multTransposeKernel<4>(source, result);
+      break;
+    case 5:
+      multTransposeKernel<5>(source, result);
+      break;
+    default:
+      multTransposeKernel<0>(source, result);
+      break;
   }
 }
 
-void OperationMultipleEvalPolyNaive::multTranspose(DataVector& alpha, DataVector& result) {
+double OperationMultipleEvalPolyNaive::getDuration() { return 0.0; }
+
+void OperationMultipleEvalPolyNaive::prepare() {
   const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
-  const size_t m = dataset.getNrows();
-
-  result.setAll(0.0);
 
   pointsInUnitCube = dataset;
   storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
 
+  factors.resize(n * d, base.getDegree());
+
   for (size_t i = 0; i < n; i++) {
     const GridPoint& gp = storage[i];
 
-    for (size_t j = 0; j < m; j++) {
-      double curValue = 1.0;
-
-      for (size_t t = 0; t < d; t++) {
-        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
+    for (size_t t = 0; t < d; t++) {
+      factors.setInterior(i * d + t, base, gp.getLevel(t), gp.getIndex(t));
+    }
+  }
+}
 
-        if (val1d == 0.0) {
-          curValue = 0.0;
-          break;
-        }
+template <size_t P>
+void OperationMultipleEvalPolyNaive::multKernel(const DataVector& alpha, DataVector& result) {
+  const size_t n = storage.getSize();
+  const size_t d = storage.getDimension();
+  const size_t m = pointsInUnitCube.getNrows();
+  const double* points = pointsInUnitCube.getPointer();
 
-        curValue *= val1d;
-      }
+#pragma omp parallel for schedule(static)
+  for (size_t j = 0; j < m; j++) {
+    double value = 0.0;
 
-      result[i] += alpha[j] * curValue;
+    for (size_t i = 0; i < n; i++) {
+      value += alpha[i] * evalBasisFunction<P>(factors, i * d, &points[j * d], d);
     }
+
+    result[j] = value;
   }
 }
 
-double OperationMultipleEvalPolyNaive::getDuration() { return 0.0; }
+template <size_t P>
+void OperationMultipleEvalPolyNaive::multTransposeKernel(const DataVector& source, DataVector& result) {
+  const size_t n = storage.getSize();
+  const size_t d = storage.getDimension();
+  const size_t m = pointsInUnitCube.getNrows();
+  const double* points = pointsInUnitCube.getPointer();
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < n; i++) {
+    double value = 0.0;
+
+    for (size_t j = 0; j < m; j++) {
+      value += source[j] * evalBasisFunction<P>(factors, i * d, &points[j * d], d);
+    }
+
+    result[i] = value;
+  }
+}
 
 }  // namespace base
 }  // namespace sgpp
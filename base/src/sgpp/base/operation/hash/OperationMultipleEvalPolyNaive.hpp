@@ -27,12 +27,40 @@ class OperationMultipleEvalPolyNaive : public OperationMultipleEval {
   double getDuration() override;
 
  protected:
+  /**
+   * Transforms the data points to the unit cube and precomputes the 1D basis functions of the
+   * grid points.
+   */
+  void prepare();
+
+  /**
+   * Kernel of mult(), instantiated for the degrees with specialized loops.
+   *
+   * @tparam     P       number of factors with a specialized loop, see PolyBasisFactors::eval
+   * @param      alpha   coefficient vector
+   * @param[out] result  values of the linear combination at the data points
+   */
+  template <size_t P>
+  void multKernel(const DataVector& alpha, DataVector& result);
+
+  /**
+   * Kernel of multTranspose(), instantiated for the degrees with specialized loops.
+   *
+   * @tparam     P       number of factors with a specialized loop, see PolyBasisFactors::eval
+   * @param      source  vector with one entry per data point
+   * @param[out] result  vector with one entry per grid point
+   */
+  template <size_t P>
+  void multTransposeKernel(const DataVector& source, DataVector& result);
+
   /// storage of the sparse grid
   GridStorage& storage;
   /// 1D B-spline basis
   SPolyBase base;
   /// untransformed evaluation point (temporary vector)
   DataMatrix pointsInUnitCube;
+  /// 1D basis functions of the grid points, row by row (temporary)
+  PolyBasisFactors factors;
 };
 
 }  // namespace base
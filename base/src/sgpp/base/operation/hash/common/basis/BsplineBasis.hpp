@@ -18,6 +18,77 @@
 namespace sgpp {
 namespace base {
 
+/**
+ * Polynomial pieces of the uniform B-spline of degree P with knots \f$\{0, 1, ..., P+1\}\f$,
+ * specialized for the odd degrees up to 7.
+ * getCoefficients(k) returns the coefficients of the piece on \f$[k, k+1)\f$ in the local
+ * variable \f$x - k\f$, highest power first (for Horner's scheme).
+ */
+template <size_t P>
+struct UniformBsplinePieces;
+
+template <>
+struct UniformBsplinePieces<1> {
+  static inline const double* getCoefficients(size_t k) {
+    static constexpr double coefficients[2][2] = {
+        {1.0, 0.0},
+        {-1.0, 1.0},
+    };
+    return coefficients[k];
+  }
+};
+
+template <>
+struct UniformBsplinePieces<3> {
+  static inline const double* getCoefficients(size_t k) {
+    static constexpr double coefficients[4][4] = {
+        {1.0 / 6.0, 0.0, 0.0, 0.0},
+        {-1.0 / 2.0, 1.0 / 2.0, 1.0 / 2.0, 1.0 / 6.0},
+        {1.0 / 2.0, -1.0, 0.0, 2.0 / 3.0},
+        {-1.0 / 6.0, 1.0 / 2.0, -1.0 / 2.0, 1.0 / 6.0},
+    };
+    return coefficients[k];
+  }
+};
+
+template <>
+struct UniformBsplinePieces<5> {
+  static inline const double* getCoefficients(size_t k) {
+    static constexpr double coefficients[6][6] = {
+        {1.0 / 120.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+        {-1.0 / 24.0, 1.0 / 24.0, 1.0 / 12.0, 1.0 / 12.0, 1.0 / 24.0, 1.0 / 120.0},
+        {1.0 / 12.0, -1.0 / 6.0, -1.0 / 6.0, 1.0 / 6.0, 5.0 / 12.0, 13.0 / 60.0},
+        {-1.0 / 12.0, 1.0 / 4.0, 0.0, -1.0 / 2.0, 0.0, 11.0 / 20.0},
+        {1.0 / 24.0, -1.0 / 6.0, 1.0 / 6.0, 1.0 / 6.0, -5.0 / 12.0, 13.0 / 60.0},
+        {-1.0 / 120.0, 1.0 / 24.0, -1.0 / 12.0, 1.0 / 12.0, -1.0 / 24.0, 1.0 / 120.0},
+    };
+    return coefficients[k];
+  }
+};
+
+template <>
+struct UniformBsplinePieces<7> {
+  static inline const double* getCoefficients(size_t k) {
+    static constexpr double coefficients[8][8] = {
+        {1.0 / 5040.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+        {-1.0 / 720.0, 1.0 / 720.0, 1.0 / 240.0, 1.0 / 144.0, 1.0 / 144.0, 1.0 / 240.0, 1.0 / 720.0,
+         1.0 / 5040.0},
+        {1.0 / 240.0, -1.0 / 120.0, -1.0 / 60.0, 0.0, 1.0 / 18.0, 1.0 / 10.0, 7.0 / 90.0,
+         1.0 / 42.0},
+        {-1.0 / 144.0, 1.0 / 48.0, 1.0 / 48.0, -1.0 / 16.0, -19.0 / 144.0, 1.0 / 16.0, 49.0 / 144.0,
+         397.0 / 1680.0},
+        {1.0 / 144.0, -1.0 / 36.0, 0.0, 1.0 / 9.0, 0.0, -1.0 / 3.0, 0.0, 151.0 / 315.0},
+        {-1.0 / 240.0, 1.0 / 48.0, -1.0 / 48.0, -1.0 / 16.0, 19.0 / 144.0, 1.0 / 16.0,
+         -49.0 / 144.0, 397.0 / 1680.0},
+        {1.0 / 720.0, -1.0 / 120.0, 1.0 / 60.0, 0.0, -1.0 / 18.0, 1.0 / 10.0, -7.0 / 90.0,
+         1.0 / 42.0},
+        {-1.0 / 5040.0, 1.0 / 720.0, -1.0 / 240.0, 1.0 / 144.0, -1.0 / 144.0, 1.0 / 240.0,
+         -1.0 / 720.0, 1.0 / 5040.0},
+    };
+    return coefficients[k];
+  }
+};
+
 /**
  * B-spline basis on Noboundary grids.
  */
@@ -639,6 +710,35 @@ class BsplineBasis : public Basis<LT, IT> {
     }
   }
 
+  /**
+   * Same as uniformBSpline(x, P) for a degree known at compile time (P = 1, 3, 5, 7).
+   * The piece containing x is evaluated by Horner's scheme with the coefficients of
+   * UniformBsplinePieces<P>, which avoids the switch over the degree and the if-chain over the
+   * pieces. Operations evaluating many basis functions should dispatch on the degree once and
+   * then call this in their inner loops.
+   *
+   * @param x     evaluation point
+   * @return      value of uniform B-spline
+   *              (with knots \f$\{0, 1, ..., P+1\}\f$)
+   */
+  template <size_t P>
+  static inline double uniformBSpline(double x) {
+    if ((x < 0.0) || (x >= static_cast<double>(P + 1))) {
+      return 0.0;
+    }
+
+    const size_t k = static_cast<size_t>(x);
+    const double s = x - static_cast<double>(k);
+    const double* coefficients = UniformBsplinePieces<P>::getCoefficients(k);
+    double result = coefficients[0];
+
+    for (size_t j = 1; j <= P; j++) {
+      result = result * s + coefficients[j];
+    }
+
+    return result;
+  }
+
   /**
    * @param x     evaluation point
    * @param p     B-spline degree
@@ -1594,7 +1694,7 @@ class BsplineBasis : public Basis<LT, IT> {
    * @param x     evaluation point
    * @return      value of B-spline basis function
    */
-  inline double eval(LT l, IT i, double x) override {
+  inline double eval(LT l, IT i, double x) final {
     const double hInv = static_cast<double>(static_cast<IT>(1) << l);
 
     return uniformBSpline(
@@ -1635,6 +1735,12 @@ class BsplineBasis : public Basis<LT, IT> {
    */
   inline size_t getDegree() const override { return degree; }
 
+  /**
+   * @return      support radius in units of the mesh width, i.e., the basis function of
+   *              level l and index i vanishes for all x in [0, 1] with |2^l x - i| > radius
+   */
+  inline double getSupportRadius() const { return static_cast<double>(degree + 1) / 2.0; }
+
   /**
    * @param level     level of basis function
    * @param index     index of basis function
@@ -1728,6 +1834,28 @@ class BsplineBasis : public Basis<LT, IT> {
 // default type-def (unsigned int for level and index)
 typedef BsplineBasis<unsigned int, unsigned int> SBsplineBase;
 
+/**
+ * Function object evaluating the uniform B-spline of the compile-time degree P.
+ * Evaluation kernels templated on the 1D B-spline are instantiated with this for the degrees
+ * 1, 3, 5, 7 and with UniformBsplineRuntimeDegree for all others.
+ */
+template <size_t P>
+struct UniformBsplineFixedDegree {
+  inline double operator()(double x) const { return SBsplineBase::uniformBSpline<P>(x); }
+};
+
+/**
+ * Function object evaluating the uniform B-spline of the degree of a B-spline basis.
+ */
+struct UniformBsplineRuntimeDegree {
+  /// B-spline basis
+  const SBsplineBase& basis;
+
+  inline double operator()(double x) const {
+    return basis.uniformBSpline(x, basis.getDegree());
+  }
+};
+
 }  // namespace base
 }  // namespace sgpp
 
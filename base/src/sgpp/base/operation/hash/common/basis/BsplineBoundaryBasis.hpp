@@ -46,7 +46,7 @@ class BsplineBoundaryBasis : public Basis<LT, IT> {
    * @param x     evaluation point
    * @return      value of boundary B-spline basis function
    */
-  inline double eval(LT l, IT i, double x) override {
+  inline double eval(LT l, IT i, double x) final {
     const double hInv = static_cast<double>(static_cast<IT>(1) << l);
 
     return bsplineBasis.uniformBSpline(
@@ -90,6 +90,12 @@ class BsplineBoundaryBasis : public Basis<LT, IT> {
    * @return      B-spline degree
    */
   inline size_t getDegree() const override { return bsplineBasis.getDegree(); }
+
+  /**
+   * @return      support radius in units of the mesh width, i.e., the basis function of
+   *              level l and index i vanishes for all x in [0, 1] with |2^l x - i| > radius
+   */
+  inline double getSupportRadius() const { return bsplineBasis.getSupportRadius(); }
   inline double getIntegral(LT l, IT i) override { return bsplineBasis.getIntegral(l, i); }
 
  protected:
@@ -1146,7 +1146,7 @@ class BsplineModifiedBasis : public Basis<LT, IT> {
    * @param x     evaluation point
    * @return      value of modified B-spline basis function
    */
-  inline double eval(LT l, IT i, double x) override {
+  inline double eval(LT l, IT i, double x) final {
     if (l == 1) {
       return 1.0;
     }
@@ -1245,6 +1245,12 @@ class BsplineModifiedBasis : public Basis<LT, IT> {
    */
   inline size_t getDegree() const override { return bsplineBasis.getDegree(); }
 
+  /**
+   * @return      support radius in units of the mesh width, i.e., the basis function of
+   *              level l and index i vanishes for all x in [0, 1] with |2^l x - i| > radius
+   */
+  inline double getSupportRadius() const { return bsplineBasis.getSupportRadius(); }
+
   /**
    * @param l     level of basis function
    * @param i     index of basis function
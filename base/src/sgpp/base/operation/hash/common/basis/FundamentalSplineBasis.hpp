@@ -382,6 +382,15 @@ class FundamentalSplineBasis : public Basis<LT, IT> {
    */
   inline size_t getDegree() const override { return bsplineBasis.getDegree(); }
 
+  /**
+   * @return      support radius in units of the mesh width, i.e., the basis function of
+   *              level l and index i vanishes for all x in [0, 1] with |2^l x - i| > radius
+   */
+  inline double getSupportRadius() const {
+    // linear combination of B-splines shifted by up to coefficients.size() - 1 mesh widths
+    return static_cast<double>(coefficients.size() - 1) + bsplineBasis.getSupportRadius();
+  }
+
   /**
    * @param l     level of basis function
    * @param i     index of basis function
@@ -439,6 +439,16 @@ class FundamentalSplineModifiedBasis : public Basis<LT, IT> {
    */
   inline size_t getDegree() const override { return bsplineBasis.getDegree(); }
 
+  /**
+   * @return      support radius in units of the mesh width, i.e., the basis function of
+   *              level l and index i vanishes for all x in [0, 1] with |2^l x - i| > radius
+   */
+  inline double getSupportRadius() const {
+    // the modified basis function of index 1 vanishes for 2^l x >= coefficients.size()
+    return std::max(fundamentalSplineBasis.getSupportRadius(),
+                    static_cast<double>(coefficients.size() - 1));
+  }
+
   /**
    * @param l     level of basis function
    * @param i     index of basis function
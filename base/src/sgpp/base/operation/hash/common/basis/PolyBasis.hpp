@@ -85,7 +85,13 @@ class PolyBasis : public Basis<LT, IT> {
 
   size_t getDegree() const override { return degree; }
 
-  double eval(LT level, IT index, double p) override {
+  /**
+   * @return      support radius in units of the mesh width, i.e., the basis function of
+   *              level l and index i vanishes for all x in [0, 1] with |2^l x - i| > radius
+   */
+  inline double getSupportRadius() const { return 1.0; }
+
+  double eval(LT level, IT index, double p) final {
     // spacing on current level
     double h = 1.0f / static_cast<double>(1 << level);
 
@@ -189,6 +195,33 @@ class PolyBasis : public Basis<LT, IT> {
     return eval;
   }
 
+  /**
+   * Computes the roots of the Lagrange polynomial of a basis function in units of the mesh
+   * width, in the order in which evalBasis() multiplies the factors (p - root) / (index - root).
+   *
+   * @param      level  level of the basis function
+   * @param      index  index of the basis function
+   * @param[out] roots  roots, at least getDegree() entries
+   * @return            number of roots, i.e., min(degree, level + 1)
+   */
+  size_t getRoots(LT level, IT index, double* roots) const {
+    size_t deg = std::min<size_t>(degree, level + 1);
+    size_t root = index;
+    size_t id = root;
+    size_t k = 0;
+    root++;
+    roots[k++] = static_cast<double>(root);
+    root -= 2;
+
+    for (size_t j = 2; j < static_cast<size_t>(1 << deg); j *= 2) {
+      roots[k++] = static_cast<double>(root);
+      root += idxtable[id & 3] * j;
+      id >>= 1;
+    }
+
+    return k;
+  }
+
   double getIntegral(LT level, IT index) override {
     // grid spacing
     double h = 1.0f / static_cast<double>(1 << level);
@@ -239,5 +272,117 @@ class PolyBasis : public Basis<LT, IT> {
 // default type-def (unsigned int for level and index)
 typedef PolyBasis<unsigned int, unsigned int> SPolyBase;
 
+/**
+ * One dimensional polynomial basis functions of the grid points of an evaluation, precomputed in
+ * product form. In scaled coordinates x = 2^level p, each entry is the product of its Lagrange
+ * factors (x - root) / (index - root) for x in [lowerBound, upperBound] and vanishes elsewhere.
+ * The values equal the ones of PolyBasis::eval and PolyBoundaryBasis::eval bit for bit, but the
+ * roots and the support are computed once per entry instead of once per evaluation.
+ */
+class PolyBasisFactors {
+ public:
+  /**
+   * @param numberOfEntries  number of basis functions, e.g., grid points times dimension
+   * @param degree           degree of the polynomial basis
+   */
+  void resize(size_t numberOfEntries, size_t degree) {
+    this->degree = degree;
+    levelFactors.resize(numberOfEntries);
+    lowerBounds.resize(numberOfEntries);
+    upperBounds.resize(numberOfEntries);
+    numbersOfFactors.resize(numberOfEntries);
+    roots.resize(numberOfEntries * degree);
+    denominators.resize(numberOfEntries * degree);
+  }
+
+  /**
+   * Sets an entry to an interior basis function (level >= 1), which vanishes outside of the
+   * open interval (index - 1, index + 1) in scaled coordinates.
+   *
+   * @param entry  entry
+   * @param basis  polynomial basis of the same degree
+   * @param level  level of the basis function
+   * @param index  index of the basis function
+   */
+  void setInterior(size_t entry, const SPolyBase& basis, unsigned int level, unsigned int index) {
+    levelFactors[entry] = static_cast<double>(1 << level);
+    lowerBounds[entry] = std::nextafter(static_cast<double>(index - 1), INFINITY);
+    upperBounds[entry] = std::nextafter(static_cast<double>(index + 1), -INFINITY);
+    numbersOfFactors[entry] = basis.getRoots(level, index, &roots[entry * degree]);
+
+    for (size_t k = 0; k < numbersOfFactors[entry]; k++) {
+      denominators[entry * degree + k] =
+          static_cast<double>(index) - roots[entry * degree + k];
+    }
+  }
+
+  /**
+   * Sets an entry to a boundary basis function of PolyBoundaryBasis (level 0), i.e., 1 - p for
+   * index 0 and p for index 1 on the closed interval [0, 1].
+   *
+   * @param entry  entry
+   * @param index  index of the basis function (0 or 1)
+   */
+  void setBoundary(size_t entry, unsigned int index) {
+    levelFactors[entry] = 1.0;
+    lowerBounds[entry] = 0.0;
+    upperBounds[entry] = 1.0;
+    numbersOfFactors[entry] = 1;
+    // (p - 1) / (-1) equals 1 - p exactly
+    roots[entry * degree] = (index == 0) ? 1.0 : 0.0;
+    denominators[entry * degree] = (index == 0) ? -1.0 : 1.0;
+  }
+
+  /**
+   * Evaluates an entry.
+   *
+   * @tparam P      number of factors for which the loop is specialized (0 for none),
+   *                entries with a different number of factors are evaluated by a generic loop
+   * @param  entry  entry
+   * @param  p      evaluation point in [0, 1]
+   * @return        value of the basis function at p
+   */
+  template <size_t P>
+  inline double eval(size_t entry, double p) const {
+    const double x = p * levelFactors[entry];
+
+    if ((x < lowerBounds[entry]) || (x > upperBounds[entry])) {
+      return 0.0;
+    }
+
+    const double* entryRoots = &roots[entry * degree];
+    const double* entryDenominators = &denominators[entry * degree];
+    double value = 1.0;
+
+    if ((P > 0) && (numbersOfFactors[entry] == P)) {
+      for (size_t k = 0; k < P; k++) {
+        value *= (x - entryRoots[k]) / entryDenominators[k];
+      }
+    } else {
+      for (size_t k = 0; k < numbersOfFactors[entry]; k++) {
+        value *= (x - entryRoots[k]) / entryDenominators[k];
+      }
+    }
+
+    return value;
+  }
+
+ protected:
+  /// degree of the basis, maximal number of factors per entry
+  size_t degree = 0;
+  /// 2^level of the entries
+  std::vector<double> levelFactors;
+  /// smallest scaled coordinate at which the entries do not vanish
+  std::vector<double> lowerBounds;
+  /// largest scaled coordinate at which the entries do not vanish
+  std::vector<double> upperBounds;
+  /// number of factors of the entries
+  std::vector<size_t> numbersOfFactors;
+  /// roots of the factors, degree values per entry
+  std::vector<double> roots;
+  /// denominators of the factors, degree values per entry
+  std::vector<double> denominators;
+};
+
 }  // namespace base
 }  // namespace sgpp
@@ -71,7 +71,13 @@ class PolyBoundaryBasis : public Basis<LT, IT> {
 
   size_t getDegree() const override { return polyBasis.getDegree(); }
 
-  double eval(LT level, IT index, double p) override {
+  /**
+   * @return      support radius in units of the mesh width, i.e., the basis function of
+   *              level l and index i vanishes for all x in [0, 1] with |2^l x - i| > radius
+   */
+  inline double getSupportRadius() const { return polyBasis.getSupportRadius(); }
+
+  double eval(LT level, IT index, double p) final {
     // make sure that the point is inside the unit interval
     if (p < 0.0 || p > 1.0) {
       return 0.0;
@@ -45,7 +45,7 @@ class PolyModifiedBasis : public Basis<LT, IT> {
    */
   ~PolyModifiedBasis() override {}
 
-  double eval(LT level, IT index, double p) override {
+  double eval(LT level, IT index, double p) final {
     // spacing on current level
     double h = 1.0f / static_cast<double>(1 << level);
 
@@ -127,6 +127,12 @@ class PolyModifiedBasis : public Basis<LT, IT> {
 
   size_t getDegree() const override { return polyBasis.getDegree(); }
 
+  /**
+   * @return      support radius in units of the mesh width, i.e., the basis function of
+   *              level l and index i vanishes for all x in [0, 1] with |2^l x - i| > radius
+   */
+  inline double getSupportRadius() const { return polyBasis.getSupportRadius(); }
+
  private:
   /**
    * Evaluate a basis function.
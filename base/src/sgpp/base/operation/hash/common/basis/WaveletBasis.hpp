@@ -86,6 +86,12 @@ class WaveletBasis : public Basis<LT, IT> {
   inline double getIntegral(LT level, IT index) override { return -1.0; }
 
   inline size_t getDegree() const override { return 0; }
+
+  /**
+   * @return      support radius in units of the mesh width, i.e., the basis function of
+   *              level l and index i vanishes for all x in [0, 1] with |2^l x - i| > radius
+   */
+  inline double getSupportRadius() const { return 2.0; }
 };
 
 // default type-def (unsigned int for level and index)
@@ -0,0 +1,126 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef THREADPRIVATEREDUCTION_HPP
+#define THREADPRIVATEREDUCTION_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Sums up thread-private result vectors of an OpenMP parallel region into a shared result
+ * vector. Instead of merging the private vectors one after another in a critical section,
+ * the index range of the result is split into chunks of whole cache lines and every thread
+ * sums up the private vectors of all threads for its chunks.
+ *
+ * The object has to be created before the parallel region (and after the result has been
+ * resized), reduce() has to be called by all threads of the region.
+ */
+class ThreadPrivateReduction {
+ public:
+  /// number of entries that are summed up as one work item (multiple of a 64 byte cache line)
+  static const size_t CHUNK_SIZE = 1024;
+
+  /**
+   * Constructor.
+   *
+   * @param result vector to which the private vectors are added
+   */
+  explicit ThreadPrivateReduction(DataVector& result)
+      : result(result.getPointer()),
+        size(result.getSize()),
+        privateResults(getMaxThreads(), nullptr) {}
+
+  /**
+   * Constructor.
+   *
+   * @param result matrix to which the private matrices are added
+   */
+  explicit ThreadPrivateReduction(DataMatrix& result)
+      : result(result.getPointer()),
+        size(result.getSize()),
+        privateResults(getMaxThreads(), nullptr) {}
+
+  /**
+   * Adds the private vectors of all threads to the result vector. Has to be called by all
+   * threads of the parallel region; the private vectors must have the size of the result.
+   * When the call returns, all private vectors have been consumed and may be destroyed.
+   *
+   * @param privateResult private result of the calling thread
+   */
+  void reduce(const DataVector& privateResult) { reduce(privateResult.getPointer()); }
+
+  /**
+   * Adds the private matrices of all threads to the result matrix, see above.
+   *
+   * @param privateResult private result of the calling thread
+   */
+  void reduce(const DataMatrix& privateResult) { reduce(privateResult.getPointer()); }
+
+ private:
+  void reduce(const double* privateResult) {
+    privateResults[getThreadNum()] = privateResult;
+
+#pragma omp barrier
+
+    const int64_t numChunks = static_cast<int64_t>((size + CHUNK_SIZE - 1) / CHUNK_SIZE);
+
+#pragma omp for schedule(static)
+    for (int64_t c = 0; c < numChunks; c++) {
+      const size_t begin = static_cast<size_t>(c) * CHUNK_SIZE;
+      const size_t end = std::min(begin + CHUNK_SIZE, size);
+
+      for (const double* vec : privateResults) {
+        if (vec == nullptr) {
+          continue;
+        }
+
+        for (size_t i = begin; i < end; i++) {
+          result[i] += vec[i];
+        }
+      }
+    }
+  }
+
+  static size_t getMaxThreads() {
+#ifdef _OPENMP
+    return static_cast<size_t>(omp_get_max_threads());
+#else
+    return 1;
+#endif
+  }
+
+  static size_t getThreadNum() {
+#ifdef _OPENMP
+    return static_cast<size_t>(omp_get_thread_num());
+#else
+    return 0;
+#endif
+  }
+
+  /// entries of the shared result vector
+  double* result;
+  /// number of entries of the result vector
+  size_t size;
+  /// pointers to the entries of the private vectors of the threads
+  std::vector<const double*> privateResults;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* THREADPRIVATEREDUCTION_HPP */
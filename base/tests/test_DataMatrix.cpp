@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <utility>
 
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
@@ -421,4 +422,28 @@ BOOST_AUTO_TEST_CASE(resizeToSubMatrixTests) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testMove) {
+  DataMatrix d(d_rand);
+  const double* data = d.getPointer();
+
+  DataMatrix d2(std::move(d));
+  BOOST_CHECK_EQUAL(d2.getPointer(), data);
+  BOOST_CHECK_EQUAL(d2.getNrows(), nrows);
+  BOOST_CHECK_EQUAL(d2.getNcols(), ncols);
+  BOOST_CHECK_EQUAL(d.getNrows(), 0);
+  BOOST_CHECK_EQUAL(d.getSize(), 0);
+
+  DataMatrix d3;
+  d3 = std::move(d2);
+  BOOST_CHECK_EQUAL(d3.getPointer(), data);
+  BOOST_CHECK_EQUAL(d2.getNrows(), 0);
+  BOOST_CHECK_EQUAL(d2.getSize(), 0);
+
+  for (int i = 0; i < nrows; ++i) {
+    for (int j = 0; j < ncols; ++j) {
+      BOOST_CHECK_EQUAL(d3.get(i, j), l_rand[i][j]);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,105 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrixTiled.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataMatrixTiled;
+using sgpp::base::DataVector;
+
+struct FixtureDataMatrixTiled {
+  FixtureDataMatrixTiled() : nrows(11), ncols(3), tileWidth(4), matrix(nrows, ncols) {
+    for (size_t i = 0; i < nrows; i++) {
+      for (size_t j = 0; j < ncols; j++) {
+        matrix.set(i, j, static_cast<double>(i) + 0.1 * static_cast<double>(j));
+      }
+    }
+  }
+
+  size_t nrows, ncols, tileWidth;
+  DataMatrix matrix;
+};
+
+BOOST_FIXTURE_TEST_SUITE(testDataMatrixTiled, FixtureDataMatrixTiled)
+
+BOOST_AUTO_TEST_CASE(testLayout) {
+  DataMatrixTiled tiled(matrix, tileWidth);
+
+  BOOST_CHECK_EQUAL(tiled.getNrows(), nrows);
+  BOOST_CHECK_EQUAL(tiled.getNcols(), ncols);
+  BOOST_CHECK_EQUAL(tiled.getNtiles(), 3);
+  BOOST_CHECK_EQUAL(tiled.getNrowsPadded(), 12);
+
+  for (size_t i = 0; i < nrows; i++) {
+    for (size_t j = 0; j < ncols; j++) {
+      BOOST_CHECK_EQUAL(tiled.get(i, j), matrix.get(i, j));
+    }
+  }
+
+  // columns of a tile are contiguous
+  const double* ptrTile = tiled.getTilePointer(1);
+
+  for (size_t r = 0; r < tileWidth; r++) {
+    BOOST_CHECK_EQUAL(ptrTile[2 * tileWidth + r], matrix.get(tileWidth + r, 2));
+  }
+
+  // the padding row is a copy of the last row
+  BOOST_CHECK_EQUAL(tiled.getTile(2).get(3, 1), matrix.get(nrows - 1, 1));
+  BOOST_CHECK_EQUAL(tiled.getTile(2).getRows(), 3);
+
+  DataVector row;
+  tiled.getRow(5, row);
+  BOOST_CHECK_EQUAL(row.getSize(), ncols);
+  BOOST_CHECK_EQUAL(row[1], matrix.get(5, 1));
+  BOOST_CHECK_THROW(tiled.getRow(nrows, row), sgpp::base::data_exception);
+
+  tiled.set(7, 0, -1.0);
+  DataMatrix copy = tiled.toDataMatrix();
+  BOOST_CHECK_EQUAL(copy.getNrows(), nrows);
+  BOOST_CHECK_EQUAL(copy.get(7, 0), -1.0);
+  BOOST_CHECK_EQUAL(copy.get(10, 2), matrix.get(10, 2));
+
+  BOOST_CHECK_THROW(DataMatrixTiled(matrix, 0), sgpp::base::data_exception);
+}
+
+BOOST_AUTO_TEST_CASE(testIteration) {
+  DataMatrixTiled tiled(matrix, tileWidth);
+
+  size_t tileCount = 0;
+  size_t rowCount = 0;
+
+  for (const DataMatrixTiled::Tile& tile : tiled) {
+    BOOST_CHECK_EQUAL(tile.getFirstRow(), tileCount * tileWidth);
+    BOOST_CHECK_EQUAL(tile.getColumn(1)[0], matrix.get(tile.getFirstRow(), 1));
+    rowCount += tile.getRows();
+    tileCount++;
+  }
+
+  BOOST_CHECK_EQUAL(tileCount, tiled.getNtiles());
+  BOOST_CHECK_EQUAL(rowCount, nrows);
+
+  // two panels cover all tiles without overlap, the first one gets the additional tile
+  DataMatrixTiled::RowPanel first = tiled.getRowPanel(0, 2);
+  DataMatrixTiled::RowPanel second = tiled.getRowPanel(1, 2);
+  BOOST_CHECK_EQUAL(first.getFirstRow(), 0);
+  BOOST_CHECK_EQUAL(first.getEndRow(), 8);
+  BOOST_CHECK_EQUAL(second.getFirstRow(), 8);
+  BOOST_CHECK_EQUAL(second.getEndRow(), tiled.getNrowsPadded());
+
+  // more panels than tiles result in empty panels
+  DataMatrixTiled::RowPanel empty = tiled.getRowPanel(4, 5);
+  BOOST_CHECK(empty.begin() == empty.end());
+
+  BOOST_CHECK_THROW(tiled.getRowPanel(0, 0), sgpp::base::data_exception);
+  BOOST_CHECK_THROW(tiled.getRowPanel(2, 2), sgpp::base::data_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
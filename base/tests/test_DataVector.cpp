@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <utility>
 
 using sgpp::base::DataVector;
 
@@ -245,4 +246,21 @@ BOOST_AUTO_TEST_CASE(testDotProduct) {
   BOOST_CHECK_EQUAL(d.dotProduct(d), x);
 }
 
+BOOST_AUTO_TEST_CASE(testMove) {
+  DataVector d(d_rand);
+  const double* data = d.getPointer();
+
+  DataVector d2(std::move(d));
+  BOOST_CHECK_EQUAL(d2.getPointer(), data);
+  BOOST_CHECK_EQUAL(d2.getSize(), N);
+
+  DataVector d3;
+  d3 = std::move(d2);
+  BOOST_CHECK_EQUAL(d3.getPointer(), data);
+
+  for (int i = 0; i < N; ++i) {
+    BOOST_CHECK_EQUAL(d3[i], d_rand[i]);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
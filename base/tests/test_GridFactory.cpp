@@ -11,6 +11,7 @@
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 
 #include <algorithm>
+#include <sstream>
 #include <vector>
 #include <string>
 
@@ -119,6 +120,50 @@ BOOST_AUTO_TEST_CASE(testSerializationPrewavelet) {
   BOOST_CHECK(factory->getSize() == newfac->getSize());
 }
 
+BOOST_AUTO_TEST_CASE(testSerializationBinary) {
+  std::unique_ptr<Grid> factory(Grid::createPolyBoundaryGrid(3, 3));
+  factory->getGenerator().regular(3);
+
+  {
+    BoundingBox& boundingBox = factory->getBoundingBox();
+    BoundingBox1D tempBound = boundingBox.getBoundary(1);
+    tempBound.leftBoundary = -1.0;
+    tempBound.rightBoundary = 2.0;
+    boundingBox.setBoundary(1, tempBound);
+  }
+
+  DataVector alpha(factory->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = static_cast<double>(i) / 3.0;
+  }
+
+  std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+  factory->serialize(stream, SERIALIZATION_VERSION_BINARY);
+  alpha.toBinaryStream(stream);
+
+  std::unique_ptr<Grid> newfac(Grid::unserialize(stream));
+  DataVector newAlpha = DataVector::fromBinaryStream(stream);
+
+  BOOST_CHECK(newfac->getType() == factory->getType());
+  BOOST_CHECK_EQUAL(newfac->getSize(), factory->getSize());
+  BOOST_CHECK_EQUAL(newfac->getBoundingBox().getBoundary(1).leftBoundary, -1.0);
+  BOOST_CHECK_EQUAL(newfac->getBoundingBox().getBoundary(1).rightBoundary, 2.0);
+
+  GridStorage& storage = factory->getStorage();
+  GridStorage& newStorage = newfac->getStorage();
+
+  for (size_t i = 0; i < storage.getSize(); i++) {
+    BOOST_CHECK(storage[i].equals(newStorage[i]));
+    BOOST_CHECK_EQUAL(storage[i].isLeaf(), newStorage[i].isLeaf());
+    BOOST_CHECK_EQUAL(newStorage.getSequenceNumber(storage[i]), i);
+    BOOST_CHECK_EQUAL(alpha[i], newAlpha[i]);
+  }
+
+  // the text serialization of both grids has to be identical
+  BOOST_CHECK_EQUAL(factory->serialize(), newfac->serialize());
+}
+
 BOOST_AUTO_TEST_CASE(testSerializationLinearBoundingBox) {
   // Uses Linear grid for tests
 
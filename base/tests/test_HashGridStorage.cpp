@@ -13,15 +13,25 @@
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashRefinement.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashRefinementBoundaries.hpp>
+#include <sgpp/base/grid/generation/hashmap/ANOVAHashRefinement.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
 #include <string>
+#include <vector>
 
+using sgpp::base::AbstractRefinement;
+using sgpp::base::ANOVAHashRefinement;
 using sgpp::base::DataVector;
 using sgpp::base::HashGenerator;
 using sgpp::base::HashGridPoint;
 using sgpp::base::HashGridStorage;
 using sgpp::base::HashRefinement;
 using sgpp::base::HashRefinementBoundaries;
+using sgpp::base::RefinementFunctor;
 using sgpp::base::SurplusRefinementFunctor;
 
 BOOST_AUTO_TEST_SUITE(TestHashGridStorage)
@@ -99,6 +109,66 @@ BOOST_AUTO_TEST_CASE(testInsert) {
   BOOST_CHECK_EQUAL(s.getSize(), 1U);
 }
 
+BOOST_AUTO_TEST_CASE(testInsertBatch) {
+  HashGridStorage s(1);
+  HashGridPoint i(1);
+
+  i.set(0, 1, 1);
+  i.setLeaf(true);
+  s.insert(i);
+
+  std::vector<HashGridPoint> points(4, HashGridPoint(1));
+  points[0].set(0, 2, 1);
+  points[0].setLeaf(true);
+  // existing point, loses its leaf property
+  points[1].set(0, 1, 1);
+  points[1].setLeaf(false);
+  points[2].set(0, 2, 3);
+  points[2].setLeaf(true);
+  // duplicate in the batch
+  points[3].set(0, 2, 1);
+  points[3].setLeaf(false);
+
+  std::vector<size_t> insertedPoints;
+  BOOST_CHECK_EQUAL(s.insert(points, &insertedPoints), 2U);
+
+  BOOST_CHECK_EQUAL(s.getSize(), 3U);
+  BOOST_REQUIRE_EQUAL(insertedPoints.size(), 2U);
+  BOOST_CHECK_EQUAL(insertedPoints[0], 1U);
+  BOOST_CHECK_EQUAL(insertedPoints[1], 2U);
+  BOOST_CHECK_EQUAL(s.getSequenceNumber(points[0]), 1U);
+  BOOST_CHECK_EQUAL(s.getSequenceNumber(points[2]), 2U);
+  BOOST_CHECK(!s[0].isLeaf());
+  BOOST_CHECK(!s[1].isLeaf());
+  BOOST_CHECK(s[2].isLeaf());
+}
+
+BOOST_AUTO_TEST_CASE(testInsertBatchFromStorage) {
+  HashGridStorage s(1);
+  HashGridStorage staged(1);
+  HashGridPoint i(1);
+
+  i.set(0, 1, 1);
+  i.setLeaf(true);
+  s.insert(i);
+  i.setLeaf(false);
+  staged.insert(i);
+  i.set(0, 2, 3);
+  i.setLeaf(true);
+  staged.insert(i);
+
+  std::vector<size_t> insertedPoints;
+  BOOST_CHECK_EQUAL(s.insert(staged, &insertedPoints), 1U);
+
+  BOOST_CHECK_EQUAL(s.getSize(), 2U);
+  BOOST_CHECK_EQUAL(staged.getSize(), 0U);
+  BOOST_REQUIRE_EQUAL(insertedPoints.size(), 1U);
+  BOOST_CHECK_EQUAL(insertedPoints[0], 1U);
+  BOOST_CHECK_EQUAL(s.getSequenceNumber(i), 1U);
+  BOOST_CHECK(!s[0].isLeaf());
+  BOOST_CHECK(s[1].isLeaf());
+}
+
 BOOST_AUTO_TEST_CASE(testChilds) {
   HashGridStorage s(1);
   HashGenerator g;
@@ -630,6 +700,189 @@ BOOST_AUTO_TEST_CASE(testFreeRefineTruncatedBoundaries2) {
   BOOST_CHECK_EQUAL(s.getSize(), 21U);
 }
 
+/**
+ * Gives access to the refinement of a collection in batch and one point after another.
+ */
+template <class Refinement>
+class BatchRefinementTester : public Refinement {
+ public:
+  /**
+   * Refines storage in batch and referenceStorage (a copy of storage) one point after another,
+   * using the same collection of points to refine.
+   */
+  void refine(HashGridStorage& storage, HashGridStorage& referenceStorage,
+              RefinementFunctor& functor) {
+    AbstractRefinement::refinement_container_type collection;
+    this->collectRefinablePoints(storage, functor, collection);
+    std::vector<size_t> refineIndices;
+
+    for (AbstractRefinement::refinement_pair_type& pair : collection) {
+      if (pair.second >= functor.getRefinementThreshold()) {
+        refineIndices.push_back(pair.first->getSeq());
+      }
+    }
+
+    this->refineGridpointsInBatch(storage, refineIndices);
+
+    for (size_t seq : refineIndices) {
+      this->refineGridpoint(referenceStorage, seq);
+    }
+  }
+};
+
+/**
+ * Refines a grid repeatedly, checking that the batch refinement results in the same grid
+ * points in the same order with the same leaf properties as refining one point after another.
+ */
+template <class Refinement>
+void checkBatchRefinement(HashGridStorage& storage) {
+  HashGridStorage referenceStorage(storage);
+  BatchRefinementTester<Refinement> refinement;
+
+  for (size_t k = 0; k < 5; k++) {
+    // distinct pseudo-random surpluses
+    DataVector alpha(storage.getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = static_cast<double>((i * 7919 + k * 104729) % 10007);
+    }
+
+    SurplusRefinementFunctor functor(alpha, 10);
+    size_t sizeBeforeRefine = storage.getSize();
+    refinement.refine(storage, referenceStorage, functor);
+
+    BOOST_CHECK_GT(storage.getSize(), sizeBeforeRefine);
+    BOOST_REQUIRE_EQUAL(storage.getSize(), referenceStorage.getSize());
+
+    for (size_t i = 0; i < storage.getSize(); i++) {
+      BOOST_CHECK(storage[i].equals(referenceStorage[i]));
+      BOOST_CHECK_EQUAL(storage[i].isLeaf(), referenceStorage[i].isLeaf());
+    }
+
+    // continue with identical grids
+    referenceStorage = storage;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testBatchRefinement) {
+  HashGridStorage s(3);
+  HashGenerator g;
+
+  g.regular(s, 3);
+  checkBatchRefinement<HashRefinement>(s);
+}
+
+BOOST_AUTO_TEST_CASE(testBatchRefinementANOVA) {
+  HashGridStorage s(3);
+  HashGenerator g;
+
+  g.regular(s, 3);
+  checkBatchRefinement<ANOVAHashRefinement>(s);
+}
+
+BOOST_AUTO_TEST_CASE(testBatchRefinementBoundaries) {
+  HashGridStorage s(3);
+  HashGenerator g;
+
+  g.regularWithBoundaries(s, 2);
+  checkBatchRefinement<HashRefinementBoundaries>(s);
+}
+
+/**
+ * Gives access to the collection of the points to refine.
+ */
+template <class Refinement>
+class CollectionTester : public Refinement {
+ public:
+  /**
+   * Collects the points to refine with a given number of OpenMP threads.
+   *
+   * @return sequence numbers of the collected points, in the order of the collection
+   */
+  std::vector<size_t> collect(HashGridStorage& storage, RefinementFunctor& functor,
+                              int numThreads) {
+#ifdef _OPENMP
+    int maxThreads = omp_get_max_threads();
+    omp_set_num_threads(numThreads);
+#endif
+    AbstractRefinement::refinement_container_type collection;
+    this->collectRefinablePoints(storage, functor, collection);
+#ifdef _OPENMP
+    omp_set_num_threads(maxThreads);
+#endif
+    std::vector<size_t> seqs;
+
+    for (AbstractRefinement::refinement_pair_type& pair : collection) {
+      seqs.push_back(pair.first->getSeq());
+    }
+
+    return seqs;
+  }
+};
+
+/**
+ * Surplus functor that is not thread-safe and records whether it was called in parallel.
+ */
+class SerialSurplusRefinementFunctor : public SurplusRefinementFunctor {
+ public:
+  SerialSurplusRefinementFunctor(DataVector& alpha, size_t refinements_num)
+      : SurplusRefinementFunctor(alpha, refinements_num), calledInParallel(false) {}
+
+  double operator()(HashGridStorage& storage, size_t seq) const override {
+#ifdef _OPENMP
+    calledInParallel = calledInParallel || omp_in_parallel();
+#endif
+    return SurplusRefinementFunctor::operator()(storage, seq);
+  }
+
+  bool isThreadSafe() const override { return false; }
+
+  mutable bool calledInParallel;
+};
+
+/**
+ * Collects the points to refine of a grid with identical surpluses, checking that ties are
+ * broken by the sequence numbers independently of the number of threads.
+ */
+template <class Refinement>
+void checkCollectionTies(HashGridStorage& storage) {
+  CollectionTester<Refinement> refinement;
+  DataVector alpha(storage.getSize(), 1.0);
+  SurplusRefinementFunctor functor(alpha, 5);
+  std::vector<size_t> seqs = refinement.collect(storage, functor, 1);
+
+  BOOST_REQUIRE_EQUAL(seqs.size(), 5U);
+  BOOST_CHECK(std::is_sorted(seqs.begin(), seqs.end()));
+
+  for (int numThreads = 2; numThreads <= 4; numThreads++) {
+    std::vector<size_t> parallelSeqs = refinement.collect(storage, functor, numThreads);
+    BOOST_CHECK_EQUAL_COLLECTIONS(parallelSeqs.begin(), parallelSeqs.end(), seqs.begin(),
+                                  seqs.end());
+  }
+
+  // functors that are not thread-safe are only called by a single thread
+  SerialSurplusRefinementFunctor serialFunctor(alpha, 5);
+  std::vector<size_t> serialSeqs = refinement.collect(storage, serialFunctor, 4);
+  BOOST_CHECK(!serialFunctor.calledInParallel);
+  BOOST_CHECK_EQUAL_COLLECTIONS(serialSeqs.begin(), serialSeqs.end(), seqs.begin(), seqs.end());
+}
+
+BOOST_AUTO_TEST_CASE(testCollectionTies) {
+  HashGridStorage s(3);
+  HashGenerator g;
+
+  g.regular(s, 3);
+  checkCollectionTies<HashRefinement>(s);
+}
+
+BOOST_AUTO_TEST_CASE(testCollectionTiesBoundaries) {
+  HashGridStorage s(3);
+  HashGenerator g;
+
+  g.regularWithBoundaries(s, 2);
+  checkCollectionTies<HashRefinementBoundaries>(s);
+}
+
 BOOST_AUTO_TEST_CASE(testSurplusFunctor) {
   HashGridStorage s(2);
   DataVector d(1);
@@ -18,8 +18,10 @@
 #include <sgpp/base/operation/hash/common/basis/PolyClenshawCurtisBasis.hpp>
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
+#include <list>
 #include <vector>
 #include <random>
 
@@ -32,6 +34,7 @@ using sgpp::base::DataVector;
 using sgpp::base::Grid;
 using sgpp::base::GridGenerator;
 using sgpp::base::GridPoint;
+using sgpp::base::GridStorage;
 using sgpp::base::GridType;
 using sgpp::base::OperationEval;
 using sgpp::base::OperationEvalGradient;
@@ -42,6 +45,7 @@ using sgpp::base::SPolyBase;
 using sgpp::base::SPolyBoundaryBase;
 using sgpp::base::SPolyModifiedBase;
 using sgpp::base::SPolyClenshawCurtisBoundaryBase;
+using sgpp::base::SurplusRefinementFunctor;
 
 double basisEval(SBasis& basis, GridPoint::level_type l, GridPoint::index_type i, double x) {
   return basis.eval(l, i, x);
@@ -425,3 +429,151 @@ BOOST_AUTO_TEST_CASE(TestOperationEvalNaive) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestOperationEvalNaiveSupportIndex) {
+  // finer grids than above such that most basis functions vanish at the evaluation points
+  const size_t d = 3;
+  const size_t l = 6;
+  const size_t p = 3;
+  const size_t N = 20;
+
+  std::mt19937 generator;
+  generator.seed(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+  std::normal_distribution<double> normalDistribution(0.0, 1.0);
+
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineBoundaryGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModBsplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createFundamentalSplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModFundamentalSplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createWaveletGrid(d)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createWaveletBoundaryGrid(d)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModWaveletGrid(d)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createPolyGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createPolyBoundaryGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModPolyGrid(d, p)));
+
+  std::vector<std::unique_ptr<SBasis>> bases;
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SBsplineBase(p)));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SBsplineBoundaryBase(p)));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SBsplineModifiedBase(p)));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SFundamentalSplineBase(p)));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SFundamentalSplineModifiedBase(p)));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SWaveletBase()));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SWaveletBoundaryBase()));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SWaveletModifiedBase()));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SPolyBase(p)));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SPolyBoundaryBase(p)));
+  bases.push_back(std::unique_ptr<SBasis>(new sgpp::base::SPolyModifiedBase(p)));
+
+  for (size_t k = 0; k < grids.size(); k++) {
+    Grid& grid = *grids[k];
+    SBasis& basis = *bases[k];
+    const bool hasGradients = (grid.getType() != GridType::Poly) &&
+                              (grid.getType() != GridType::PolyBoundary) &&
+                              (grid.getType() != GridType::ModPoly);
+
+    grid.getGenerator().regular(l);
+
+    // create the operations before refining to check that the index follows the grid
+    std::unique_ptr<OperationEval> opEval(sgpp::op_factory::createOperationEvalNaive(grid));
+    std::unique_ptr<OperationEvalGradient> opEvalGradient(nullptr);
+
+    if (hasGradients) {
+      opEvalGradient.reset(sgpp::op_factory::createOperationEvalGradientNaive(grid));
+    }
+
+    for (size_t modification = 0; modification < 3; modification++) {
+      const size_t n = grid.getSize();
+      DataVector alpha(n);
+
+      for (size_t i = 0; i < n; i++) {
+        alpha[i] = normalDistribution(generator);
+      }
+
+      DataVector x(d);
+
+      for (size_t r = 0; r < N; r++) {
+        // random points, points on the boundary of the unit cube and at grid points
+        for (size_t t = 0; t < d; t++) {
+          x[t] = uniformDistribution(generator);
+        }
+
+        if (r == 0) {
+          x.setAll(0.0);
+        } else if (r == 1) {
+          x.setAll(1.0);
+        } else if (r == 2) {
+          grid.getStorage().getPoint(n / 2).getStandardCoordinates(x);
+        }
+
+        double fx = 0.0;
+        DataVector fxGradient(d, 0.0);
+
+        for (size_t i = 0; i < n; i++) {
+          GridPoint& gp = grid.getStorage().getPoint(i);
+          double val = alpha[i];
+
+          for (size_t t = 0; t < d; t++) {
+            val *= basisEval(basis, gp.getLevel(t), gp.getIndex(t), x[t]);
+          }
+
+          fx += val;
+
+          if (!hasGradients) {
+            continue;
+          }
+
+          for (size_t j = 0; j < d; j++) {
+            val = alpha[i];
+
+            for (size_t t = 0; t < d; t++) {
+              if (t == j) {
+                val *= basisEvalDx(basis, gp.getLevel(t), gp.getIndex(t), x[t]);
+              } else {
+                val *= basisEval(basis, gp.getLevel(t), gp.getIndex(t), x[t]);
+              }
+            }
+
+            fxGradient[j] += val;
+          }
+        }
+
+        checkClose(fx, opEval->eval(alpha, x));
+
+        if (hasGradients) {
+          DataVector fxGradient2(d);
+          checkClose(fx, opEvalGradient->evalGradient(alpha, x, fxGradient2));
+          checkClose(fxGradient, fxGradient2);
+        }
+      }
+
+      if (modification == 0) {
+        // refine the grid and evaluate again
+        SurplusRefinementFunctor functor(alpha, 10);
+        grid.getGenerator().refine(functor);
+      } else {
+        // replace the last grid point by one of its children, which keeps the number of grid
+        // points, and evaluate again
+        GridStorage& storage = grid.getStorage();
+        GridPoint child(storage.getPoint(n - 1));
+        size_t tMax = 0;
+
+        for (size_t t = 1; t < d; t++) {
+          if (child.getLevel(t) > child.getLevel(tMax)) {
+            tMax = t;
+          }
+        }
+
+        child.set(tMax, child.getLevel(tMax) + 1, 2 * child.getIndex(tMax) + 1);
+        BOOST_REQUIRE(!storage.isContaining(child));
+        std::list<size_t> removedPoints{n - 1};
+        storage.deletePoints(removedPoints);
+        storage.insert(child);
+        BOOST_CHECK_EQUAL(grid.getSize(), n);
+      }
+    }
+  }
+}
@@ -7,9 +7,12 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/algorithm/sweep.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/common/algorithm_sweep/HierarchisationLinear.hpp>
+#include <sgpp/base/operation/hash/common/algorithm_sweep/HierarchisationLinearBoundary.hpp>
 
 #include <vector>
 
@@ -19,6 +22,8 @@ using sgpp::base::Grid;
 using sgpp::base::GridGenerator;
 using sgpp::base::GridStorage;
 using sgpp::base::OperationEval;
+using sgpp::base::HierarchisationLinear;
+using sgpp::base::HierarchisationLinearBoundary;
 using sgpp::base::OperationHierarchisation;
 using sgpp::base::Stretching;
 using sgpp::base::Stretching1D;
@@ -89,8 +94,53 @@ double parabolaBoundary(DataVector& input) {
   return result;
 }
 
+template <class FUNC>
+void testSweepParallelEqualsSerial(sgpp::base::Grid& grid, size_t level, bool boundary) {
+  grid.getGenerator().regular(level);
+  GridStorage& gridStore = grid.getStorage();
+  size_t dim = gridStore.getDimension();
+
+  DataVector node_values = DataVector(gridStore.getSize());
+  DataVector coords = DataVector(dim);
+
+  for (size_t n = 0; n < gridStore.getSize(); n++) {
+    gridStore.getCoordinates(gridStore[n], coords);
+    node_values[n] = parabolaBoundary(coords);
+  }
+
+  DataVector serial = DataVector(node_values);
+  DataVector parallel = DataVector(node_values);
+  FUNC func(gridStore);
+  sgpp::base::sweep<FUNC> s(func, gridStore);
+
+  for (size_t d = 0; d < dim; d++) {
+    if (boundary) {
+      s.sweep1D_Boundary(serial, serial, d);
+      s.sweep1D_Boundary_parallel(parallel, parallel, d);
+    } else {
+      s.sweep1D(serial, serial, d);
+      s.sweep1D_parallel(parallel, parallel, d);
+    }
+  }
+
+  for (size_t n = 0; n < gridStore.getSize(); n++) {
+    BOOST_CHECK_EQUAL(parallel[n], serial[n]);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE(testHierarchization)
 
+BOOST_AUTO_TEST_CASE(testSweepParallel) {
+  int level = 5;
+
+  for (int dim = 2; dim < 5; dim++) {
+    std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+    testSweepParallelEqualsSerial<HierarchisationLinear>(*grid, level, false);
+    std::unique_ptr<Grid> boundaryGrid(Grid::createLinearBoundaryGrid(dim));
+    testSweepParallelEqualsSerial<HierarchisationLinearBoundary>(*boundaryGrid, level, true);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(testHierarchisationLinear) {
   int level = 5;
 
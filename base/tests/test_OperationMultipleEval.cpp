@@ -11,13 +11,24 @@
 #include <sgpp/base/grid/Grid.hpp>
 // #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/PolyBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/PolyBoundaryBasis.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
 
 using sgpp::base::BoundingBox1D;
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::base::Grid;
 using sgpp::base::GridStorage;
+using sgpp::base::GridPoint;
 using sgpp::base::OperationMultipleEval;
+using sgpp::base::SBsplineBase;
+using sgpp::base::SPolyBase;
+using sgpp::base::SPolyBoundaryBase;
 
 BOOST_AUTO_TEST_SUITE(TestOperationMultipleEval)
 
@@ -78,4 +89,210 @@ BOOST_AUTO_TEST_CASE(testOperationMultipleEval) {
   BOOST_CHECK_CLOSE(result[2], result_ref[2], 1e-7);
 }
 
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalMultipleVectors) {
+  const size_t dim = 3;
+  const size_t numberColumns = 4;
+  const size_t numberDataPoints = 50;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+  const size_t N = grid->getSize();
+
+  DataMatrix dataset(numberDataPoints, dim);
+  DataMatrix alpha(N, numberColumns);
+  DataMatrix source(numberDataPoints, numberColumns);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset(i, t) = std::abs(std::sin(static_cast<double>(i * dim + t + 1)));
+    }
+
+    for (size_t j = 0; j < numberColumns; j++) {
+      source(i, j) = std::cos(static_cast<double>(i + 7 * j));
+    }
+  }
+
+  for (size_t i = 0; i < N; i++) {
+    for (size_t j = 0; j < numberColumns; j++) {
+      alpha(i, j) = std::sin(static_cast<double>(3 * i + j));
+    }
+  }
+
+  std::unique_ptr<OperationMultipleEval> op(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+  DataMatrix result;
+  DataMatrix resultTranspose;
+  op->mult(alpha, result);
+  op->multTranspose(source, resultTranspose);
+
+  BOOST_CHECK_EQUAL(result.getNrows(), numberDataPoints);
+  BOOST_CHECK_EQUAL(result.getNcols(), numberColumns);
+  BOOST_CHECK_EQUAL(resultTranspose.getNrows(), N);
+  BOOST_CHECK_EQUAL(resultTranspose.getNcols(), numberColumns);
+
+  // compare with the column-wise evaluation
+  for (size_t j = 0; j < numberColumns; j++) {
+    DataVector alphaColumn(N);
+    DataVector sourceColumn(numberDataPoints);
+    DataVector resultColumn(numberDataPoints);
+    DataVector resultTransposeColumn(N);
+    alpha.getColumn(j, alphaColumn);
+    source.getColumn(j, sourceColumn);
+    op->mult(alphaColumn, resultColumn);
+    op->multTranspose(sourceColumn, resultTransposeColumn);
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      BOOST_CHECK_SMALL(result(i, j) - resultColumn[i], 1e-12);
+    }
+
+    for (size_t i = 0; i < N; i++) {
+      BOOST_CHECK_SMALL(resultTranspose(i, j) - resultTransposeColumn[i], 1e-12);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalBsplineNaive) {
+  // degrees with specialized kernels and one with the generic fallback
+  const size_t dim = 3;
+  const size_t numberDataPoints = 40;
+  const std::vector<size_t> degrees = {1, 3, 5, 7, 9};
+
+  DataMatrix dataset(numberDataPoints, dim);
+  DataVector source(numberDataPoints);
+
+  for (size_t j = 0; j < numberDataPoints; j++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset(j, t) = -1.0 + 3.0 * std::abs(std::sin(static_cast<double>(j * dim + t + 1)));
+    }
+
+    source[j] = std::cos(static_cast<double>(j));
+  }
+
+  for (size_t degree : degrees) {
+    std::unique_ptr<Grid> grid(Grid::createBsplineGrid(dim, degree));
+    grid->getGenerator().regular(3);
+
+    for (size_t t = 0; t < dim; t++) {
+      grid->getBoundingBox().setBoundary(t, BoundingBox1D(-1.0, 2.0));
+    }
+
+    GridStorage& gS = grid->getStorage();
+    const size_t N = gS.getSize();
+    DataVector alpha(N);
+
+    for (size_t i = 0; i < N; i++) {
+      alpha[i] = std::sin(static_cast<double>(3 * i + 1));
+    }
+
+    std::unique_ptr<OperationMultipleEval> op(
+        sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset));
+    DataVector result(numberDataPoints);
+    DataVector resultTranspose(N);
+    op->mult(alpha, result);
+    op->multTranspose(source, resultTranspose);
+
+    // reference: basis matrix assembled with the runtime-degree evaluation of the basis
+    SBsplineBase basis(degree);
+    DataVector resultRef(numberDataPoints, 0.0);
+    DataVector resultTransposeRef(N, 0.0);
+
+    for (size_t j = 0; j < numberDataPoints; j++) {
+      for (size_t i = 0; i < N; i++) {
+        const GridPoint& gp = gS[i];
+        double value = 1.0;
+
+        for (size_t t = 0; t < dim; t++) {
+          value *= basis.eval(gp.getLevel(t), gp.getIndex(t), (dataset(j, t) + 1.0) / 3.0);
+        }
+
+        resultRef[j] += alpha[i] * value;
+        resultTransposeRef[i] += source[j] * value;
+      }
+    }
+
+    for (size_t j = 0; j < numberDataPoints; j++) {
+      BOOST_CHECK_SMALL(result[j] - resultRef[j], 1e-10);
+    }
+
+    for (size_t i = 0; i < N; i++) {
+      BOOST_CHECK_SMALL(resultTranspose[i] - resultTransposeRef[i], 1e-10);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalPolyNaive) {
+  // the precomputed basis functions have to reproduce the basis evaluation exactly, for the
+  // degrees with specialized kernels and one with the generic fallback
+  const size_t dim = 3;
+  const size_t numberDataPoints = 40;
+  const std::vector<size_t> degrees = {2, 3, 4, 5, 7};
+
+  DataMatrix dataset(numberDataPoints, dim);
+  DataVector source(numberDataPoints);
+
+  for (size_t j = 0; j < numberDataPoints; j++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset(j, t) = -0.2 + 1.4 * std::abs(std::sin(static_cast<double>(j * dim + t + 1)));
+    }
+
+    source[j] = std::cos(static_cast<double>(j));
+  }
+
+  // points on the boundary and on grid points of the finest level
+  dataset(0, 0) = 0.0;
+  dataset(1, 1) = 1.0;
+  dataset(2, 2) = 0.5;
+  dataset(3, 0) = 0.375;
+
+  for (size_t degree : degrees) {
+    for (bool boundary : {false, true}) {
+      std::unique_ptr<Grid> grid(boundary ? Grid::createPolyBoundaryGrid(dim, degree)
+                                          : Grid::createPolyGrid(dim, degree));
+      grid->getGenerator().regular(3);
+
+      GridStorage& gS = grid->getStorage();
+      const size_t N = gS.getSize();
+      DataVector alpha(N);
+
+      for (size_t i = 0; i < N; i++) {
+        alpha[i] = std::sin(static_cast<double>(3 * i + 1));
+      }
+
+      std::unique_ptr<OperationMultipleEval> op(
+          sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset));
+      DataVector result(numberDataPoints);
+      DataVector resultTranspose(N);
+      op->mult(alpha, result);
+      op->multTranspose(source, resultTranspose);
+
+      SPolyBase basis(degree);
+      SPolyBoundaryBase boundaryBasis(degree);
+      DataVector resultRef(numberDataPoints, 0.0);
+      DataVector resultTransposeRef(N, 0.0);
+
+      for (size_t j = 0; j < numberDataPoints; j++) {
+        for (size_t i = 0; i < N; i++) {
+          const GridPoint& gp = gS[i];
+          double value = 1.0;
+
+          for (size_t t = 0; t < dim; t++) {
+            value *= boundary ? boundaryBasis.eval(gp.getLevel(t), gp.getIndex(t), dataset(j, t))
+                              : basis.eval(gp.getLevel(t), gp.getIndex(t), dataset(j, t));
+          }
+
+          resultRef[j] += alpha[i] * value;
+          resultTransposeRef[i] += source[j] * value;
+        }
+      }
+
+      for (size_t j = 0; j < numberDataPoints; j++) {
+        BOOST_CHECK_EQUAL(result[j], resultRef[j]);
+      }
+
+      for (size_t i = 0; i < N; i++) {
+        BOOST_CHECK_EQUAL(resultTranspose[i], resultTransposeRef[i]);
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
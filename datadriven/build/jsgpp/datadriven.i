@@ -39,6 +39,7 @@
 %include "datadriven/src/sgpp/datadriven/scalapack/DataMatrixDistributed.hpp"
 %include "datadriven/src/sgpp/datadriven/scalapack/DataVectorDistributed.hpp"
 
+%include "datadriven/src/sgpp/datadriven/algorithm/DBMatMatrixView.hpp"
 %include "datadriven/src/sgpp/datadriven/algorithm/DBMatDecompMatrixSolver.hpp"
 %include "datadriven/src/sgpp/datadriven/algorithm/DBMatDMSChol.hpp"
 %include "datadriven/src/sgpp/datadriven/algorithm/DBMatDMSDenseIChol.hpp"
@@ -192,6 +193,7 @@
 %include "datadriven/src/sgpp/datadriven/datamining/configuration/GridTypeParser.hpp"
 %include "datadriven/src/sgpp/datadriven/datamining/configuration/MatrixDecompositionTypeParser.hpp"
 %include "datadriven/src/sgpp/datadriven/datamining/configuration/RegularizationTypeParser.hpp"
+%include "datadriven/src/sgpp/datadriven/datamining/configuration/SLEPreconditionerTypeParser.hpp"
 %include "datadriven/src/sgpp/datadriven/datamining/configuration/SLESolverTypeParser.hpp"
 
 %include "datadriven/src/sgpp/datadriven/datamining/builder/DataSourceBuilder.hpp"
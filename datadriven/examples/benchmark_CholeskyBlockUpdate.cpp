@@ -0,0 +1,167 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDMSChol.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
+#include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
+#include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
+#include <sgpp/datadriven/algorithm/GridFactory.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+
+double maxDifference(const DataMatrix& a, const DataMatrix& b) {
+  double diff = 0.0;
+  for (size_t i = 0; i < a.getSize(); i++) {
+    diff = std::max(diff, std::abs(a[i] - b[i]));
+  }
+  return diff;
+}
+
+/**
+ * Exposes the original per-point routine DBMatOfflineChol::choleskyAddPoint as baseline for the
+ * blocked DBMatDMSChol::choleskyBlockAddPoints
+ */
+class PerPointCholesky : public sgpp::datadriven::DBMatOfflineChol {
+ public:
+  explicit PerPointCholesky(const sgpp::datadriven::DBMatOfflineChol& offline)
+      : sgpp::datadriven::DBMatOfflineChol(offline) {}
+
+  using sgpp::datadriven::DBMatOfflineChol::choleskyAddPoint;
+};
+
+int main() {
+  std::cout << "cholesky per-point vs. blocked modification benchmarks: \n";
+
+  // config
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = 4;
+  gridConfig.level_ = 6;
+
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  regularizationConfig.lambda_ = 0.0001;
+  regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::Chol;
+
+  size_t number_points = 200;
+
+  std::cout << "dim = " << gridConfig.dim_ << "\n";
+  std::cout << "lvl = " << gridConfig.level_ << "\n";
+  std::cout << "lambda = " << regularizationConfig.lambda_ << "\n";
+  std::cout << "points per modification = " << number_points << "\n\n";
+
+  sgpp::datadriven::GridFactory gridFactory;
+  std::unique_ptr<sgpp::base::Grid> grid = std::unique_ptr<sgpp::base::Grid>{
+    gridFactory.createGrid(gridConfig, std::vector<std::vector <size_t>>())
+  };
+
+  // offline phase
+  sgpp::datadriven::DBMatOfflineChol offline;
+  offline.buildMatrix(grid.get(), regularizationConfig);
+  DataMatrix systemMatrix(offline.getLhsMatrix_ONLY_FOR_TESTING());
+  offline.decomposeMatrix(regularizationConfig, densityEstimationConfig);
+  const DataMatrix& factor = offline.getDecomposedMatrix();
+  size_t size = factor.getNrows();
+  std::cout << "matrix size = " << size << "\n";
+
+  sgpp::datadriven::DBMatDMSChol cholsolver;
+
+  // random update vectors
+  DataMatrix updates(size, number_points);
+  for (size_t i = 0; i < updates.getSize(); i++) {
+    updates[i] = 0.01 * (static_cast<double>(rand()) / (RAND_MAX));  // values in [0, 0.01]
+  }
+
+  // rank k update
+  DataMatrix perPoint(factor);
+  DataVector column(size);
+  std::cout << "\nper-point update took ";
+  auto begin = std::chrono::high_resolution_clock::now();
+  for (size_t j = 0; j < number_points; j++) {
+    updates.getColumn(j, column);
+    cholsolver.choleskyUpdate(perPoint, column);
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+  std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << "ms"
+            << std::endl;
+
+  DataMatrix blocked(factor);
+  std::cout << "blocked update took ";
+  begin = std::chrono::high_resolution_clock::now();
+  cholsolver.choleskyBlockUpdate(blocked, updates);
+  end = std::chrono::high_resolution_clock::now();
+  std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << "ms"
+            << std::endl;
+  std::cout << "max difference = " << maxDifference(perPoint, blocked) << std::endl;
+
+  // rank k downdate back to the initial factor
+  std::cout << "\nper-point downdate took ";
+  begin = std::chrono::high_resolution_clock::now();
+  for (size_t j = 0; j < number_points; j++) {
+    updates.getColumn(j, column);
+    cholsolver.choleskyDowndate(perPoint, column);
+  }
+  end = std::chrono::high_resolution_clock::now();
+  std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << "ms"
+            << std::endl;
+
+  std::cout << "blocked downdate took ";
+  begin = std::chrono::high_resolution_clock::now();
+  cholsolver.choleskyBlockDowndate(blocked, updates);
+  end = std::chrono::high_resolution_clock::now();
+  std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << "ms"
+            << std::endl;
+  std::cout << "max difference = " << maxDifference(perPoint, blocked)
+            << ", to initial factor = " << maxDifference(blocked, factor) << std::endl;
+
+  // adding the last points of the grid to the factor of the leading block
+  size_t leading = size - number_points;
+  DataMatrix leadingFactor(factor);
+  leadingFactor.resizeQuadratic(leading);
+  leadingFactor.resizeQuadratic(size);
+
+  PerPointCholesky perPointOffline(offline);
+  perPointOffline.getDecomposedMatrix() = leadingFactor;
+  std::cout << "\nadding points one by one took ";
+  begin = std::chrono::high_resolution_clock::now();
+  for (size_t j = leading; j < size; j++) {
+    DataVector newColumn(j + 1);
+    for (size_t i = 0; i <= j; i++) {
+      newColumn.set(i, systemMatrix.get(i, j));
+    }
+    perPointOffline.choleskyAddPoint(newColumn, j);
+  }
+  end = std::chrono::high_resolution_clock::now();
+  std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << "ms"
+            << std::endl;
+  perPoint = perPointOffline.getDecomposedMatrix();
+
+  blocked = leadingFactor;
+  std::cout << "adding points blocked took ";
+  begin = std::chrono::high_resolution_clock::now();
+  DataMatrix newColumns(size, number_points);
+  for (size_t i = 0; i < size; i++) {
+    for (size_t j = 0; j < number_points; j++) {
+      newColumns.set(i, j, systemMatrix.get(i, leading + j));
+    }
+  }
+  cholsolver.choleskyBlockAddPoints(blocked, newColumns, leading);
+  end = std::chrono::high_resolution_clock::now();
+  std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << "ms"
+            << std::endl;
+  std::cout << "max difference = " << maxDifference(perPoint, blocked)
+            << ", to full factor = " << maxDifference(blocked, factor) << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,44 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/**
+ * \page example_convertToColumnar_cpp Converting datasets to the columnar format
+ *
+ * Converts a CSV or ARFF file into a binary columnar dataset file. Data sources read such files
+ * (file type "columnar", e.g. a file name ending in .columnar) by memory mapping them, so repeated
+ * experiments and cross validation folds skip parsing the text file entirely.
+ */
+
+#include <sgpp/datadriven/tools/ColumnarDatasetFile.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[]) {
+  if (argc < 3 || argc > 5) {
+    std::cout << "Usage:" << std::endl
+              << "convertToColumnar <input.csv|input.arff> <output.columnar> "
+              << "[hasTargets (default 1)] [rowsPerChunk]" << std::endl;
+    return -1;
+  }
+  std::string inputFile = argv[1];
+  std::string outputFile = argv[2];
+  bool hasTargets = argc < 4 || std::atoi(argv[3]) != 0;
+  size_t chunkRows = argc < 5 ? sgpp::datadriven::ColumnarDatasetFile::DEFAULT_CHUNK_ROWS
+                              : static_cast<size_t>(std::atol(argv[4]));
+
+  auto begin = std::chrono::high_resolution_clock::now();
+  sgpp::datadriven::ColumnarDatasetFile::convert(inputFile, outputFile, hasTargets, chunkRows);
+  auto end = std::chrono::high_resolution_clock::now();
+
+  sgpp::datadriven::ColumnarDatasetFile file(outputFile);
+  std::cout << "converted " << file.getNumberRows() << " samples of dimension "
+            << file.getDimension() << " in " << file.getNumberChunks() << " chunks ("
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << "ms)"
+            << std::endl;
+  return 0;
+}
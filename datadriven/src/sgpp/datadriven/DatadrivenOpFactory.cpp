@@ -7,6 +7,7 @@
 
 #include <sgpp/base/exception/factory_exception.hpp>
 
+#include <sgpp/base/grid/type/BsplineGrid.hpp>
 #include <sgpp/base/grid/type/ModBsplineGrid.hpp>
 #include <sgpp/base/grid/type/ModPolyGrid.hpp>
 #include <sgpp/base/grid/type/PolyGrid.hpp>
@@ -86,8 +87,11 @@
 #include <sgpp/datadriven/operation/hash/simple/OperationTestPoly.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationTestPrewavelet.hpp>
 
+#include <sgpp/datadriven/application/MultipleEvalAutoTuner.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalModMaskStreaming/OperationMultiEvalModMaskStreaming.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingBSpline/OperationMultiEvalStreamingBSpline.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingPoly/OperationMultiEvalStreamingPoly.hpp>
 
 #ifdef __AVX__
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/combined/OperationMultipleEvalSubspaceCombined.hpp>
@@ -129,10 +133,30 @@
 #include <sgpp/globaldef.hpp>
 
 #include <cstring>
+#include <memory>
 
 namespace sgpp {
 namespace op_factory {
 
+namespace {
+
+/**
+ * @param configuration configuration of a CPU streaming kernel
+ * @return number of grid points the kernel processes at once, i.e., the parameter
+ *         "KERNEL_GRID_BLOCK_SIZE" if the configuration has one, 12 otherwise
+ */
+size_t getStreamingGridBlockSize(datadriven::OperationMultipleEvalConfiguration& configuration) {
+  std::shared_ptr<base::OperationConfiguration> parameters = configuration.getParameters();
+
+  if (parameters && parameters->contains("KERNEL_GRID_BLOCK_SIZE")) {
+    return (*parameters)["KERNEL_GRID_BLOCK_SIZE"].getUInt();
+  }
+
+  return 12;
+}
+
+}  // namespace
+
 datadriven::OperationTest* createOperationTest(base::Grid& grid) {
   if (grid.getType() == base::GridType::Linear) {
     return new datadriven::OperationTestLinear(&grid.getStorage());
@@ -409,6 +433,11 @@ datadriven::OperationDensityConditionalKDE* createOperationDensityConditionalKDE
 base::OperationMultipleEval* createOperationMultipleEval(
     base::Grid& grid, base::DataMatrix& dataset,
     sgpp::datadriven::OperationMultipleEvalConfiguration& configuration) {
+  if (configuration.isAutoTuned()) {
+    datadriven::MultipleEvalAutoTuner tuner(configuration.getTuningFileName());
+    return tuner.createOperationMultipleEval(grid, dataset);
+  }
+
   if (configuration.getMPIType() == sgpp::datadriven::OperationMultipleEvalMPIType::MASTERSLAVE) {
 #ifdef USE_MPI
     if (grid.getType() == base::GridType::Linear) {
@@ -440,7 +469,8 @@ base::OperationMultipleEval* createOperationMultipleEval(
     if (configuration.getType() == datadriven::OperationMultipleEvalType::DEFAULT ||
         configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
-        return new datadriven::OperationMultiEvalStreaming(grid, dataset);
+        return new datadriven::OperationMultiEvalStreaming(
+            grid, dataset, getStreamingGridBlockSize(configuration));
       }
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::OCLMP) {
 #ifdef USE_OCL
@@ -517,6 +547,11 @@ base::OperationMultipleEval* createOperationMultipleEval(
     }
   } else if (grid.getType() == base::GridType::Bspline) {
     if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
+      if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+        return new datadriven::OperationMultiEvalStreamingBSpline(
+            grid, dynamic_cast<base::BsplineGrid*>(&grid)->getDegree(), dataset,
+            getStreamingGridBlockSize(configuration));
+      }
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::OCL) {
 #ifdef USE_OCL
         return datadriven::createStreamingBSplineOCLConfigured(grid, dataset, configuration);
@@ -526,8 +561,21 @@ base::OperationMultipleEval* createOperationMultipleEval(
 #endif
       }
     }
+  } else if (grid.getType() == base::GridType::ModBspline) {
+    if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING &&
+        configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+      return new datadriven::OperationMultiEvalStreamingBSpline(
+          grid, dynamic_cast<base::ModBsplineGrid*>(&grid)->getDegree(), dataset,
+          getStreamingGridBlockSize(configuration));
+    }
   } else if (grid.getType() == base::GridType::Poly) {
-    if (configuration.getType() == datadriven::OperationMultipleEvalType::DEFAULT) {
+    if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
+      if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+        return new datadriven::OperationMultiEvalStreamingPoly(
+            grid, dynamic_cast<base::PolyGrid*>(&grid)->getDegree(), dataset,
+            getStreamingGridBlockSize(configuration));
+      }
+    } else if (configuration.getType() == datadriven::OperationMultipleEvalType::DEFAULT) {
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::CUDA) {
 #ifdef USE_CUDA
         return new datadriven::OperationMultiEvalCuda(grid, dataset, grid.getDegree(), false);
@@ -546,6 +594,13 @@ base::OperationMultipleEval* createOperationMultipleEval(
 #endif
       }
     }
+  } else if (grid.getType() == base::GridType::ModPoly) {
+    if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING &&
+        configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+      return new datadriven::OperationMultiEvalStreamingPoly(
+          grid, dynamic_cast<base::ModPolyGrid*>(&grid)->getDegree(), dataset,
+          getStreamingGridBlockSize(configuration));
+    }
   }
 
   throw base::factory_exception("OperationMultiEval is not implemented for this grid type.");
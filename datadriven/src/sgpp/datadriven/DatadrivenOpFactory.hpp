@@ -184,7 +184,8 @@ datadriven::OperationDensityConditionalKDE* createOperationDensityConditionalKDE
  *
  * @param grid Grid which is to be used for the operation
  * @param dataset dataset to be evaluated
- * @param configuration configuration to be used (evalType and evalSubType)
+ * @param configuration configuration to be used (evalType and evalSubType), if autotuning is
+ * enabled in the configuration, the fastest kernel is selected by a MultipleEvalAutoTuner
  * @return Pointer to new OperationMultipleEval for the Grid grid
  */
 base::OperationMultipleEval* createOperationMultipleEval(
@@ -17,7 +17,7 @@ DBMatDMSBackSub::DBMatDMSBackSub() {}
 
 DBMatDMSBackSub::~DBMatDMSBackSub() {}
 
-void DBMatDMSBackSub::solve(sgpp::base::DataMatrix& DecompMatrix,
+void DBMatDMSBackSub::solve(const DBMatMatrixView& DecompMatrix,
                             sgpp::base::DataVector& alpha,
                             sgpp::base::DataVector& b) {
   size_t resultSize = alpha.getSize();
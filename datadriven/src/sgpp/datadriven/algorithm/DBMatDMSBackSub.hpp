@@ -9,6 +9,7 @@
 #define DBMatDMSBackSub_HPP_
 
 #include <sgpp/datadriven/algorithm/DBMatDecompMatrixSolver.hpp>
+#include <sgpp/datadriven/algorithm/DBMatMatrixView.hpp>
 
 namespace sgpp {
 namespace datadriven {
@@ -32,11 +33,11 @@ class DBMatDMSBackSub : public DBMatDecompMatrixSolver {
   /**
    * Solves a system of equations
    *
-   * @param DecompMatrix the LU decomposed left hand side
+   * @param DecompMatrix view of the LU decomposed left hand side
    * @param alpha the vector of unknowns (the result is stored there)
    * @param b the right hand vector of the equation system
    */
-  void solve(sgpp::base::DataMatrix& DecompMatrix,
+  void solve(const DBMatMatrixView& DecompMatrix,
              sgpp::base::DataVector& alpha, sgpp::base::DataVector& b);
 };
 
@@ -17,6 +17,7 @@
 #endif /* USE_GSL */
 
 #include <math.h>
+#include <algorithm>
 #include <ctime>
 #include <iostream>
 
@@ -26,7 +27,6 @@ namespace datadriven {
 void DBMatDMSChol::solve(sgpp::base::DataMatrix& decompMatrix, sgpp::base::DataVector& alpha,
                          const sgpp::base::DataVector& b, double lambda_old,
                          double lambda_new) const {
-  size_t size = decompMatrix.getNcols();
   // Performe Update based on Cholesky - afterwards perform n (GridPoints) many
   // rank-One-updates
 
@@ -39,15 +39,19 @@ void DBMatDMSChol::solve(sgpp::base::DataMatrix& decompMatrix, sgpp::base::DataV
 
   // Solve (R + lambda * I)alpha = b to obtain density declaring coefficents
   // alpha.
+  solve(DBMatMatrixView(decompMatrix), alpha, b);
+
+  // std::cout << alpha.toString() << std::endl;
+}
 
+void DBMatDMSChol::solve(const DBMatMatrixView& decompMatrix, sgpp::base::DataVector& alpha,
+                         const sgpp::base::DataVector& b) const {
   // Forward Substitution:
-  sgpp::base::DataVector y(size);
+  sgpp::base::DataVector y(decompMatrix.getNcols());
   choleskyForwardSolve(decompMatrix, b, y);
 
   // Backward Substitution:
   choleskyBackwardSolve(decompMatrix, y, alpha);
-
-  // std::cout << alpha.toString() << std::endl;
 }
 
 void DBMatDMSChol::solveParallel(DataMatrixDistributed& decompMatrix, DataVectorDistributed& x,
@@ -267,6 +271,219 @@ void DBMatDMSChol::choleskyDowndate(sgpp::base::DataMatrix& decompMatrix,
 #endif /* USE_GSL */
 }
 
+void DBMatDMSChol::choleskyBlockUpdate(sgpp::base::DataMatrix& decompMatrix,
+                                       const sgpp::base::DataMatrix& updates) const {
+  choleskyBlockModification(decompMatrix, updates, false);
+}
+
+void DBMatDMSChol::choleskyBlockDowndate(sgpp::base::DataMatrix& decompMatrix,
+                                         const sgpp::base::DataMatrix& downdates) const {
+  choleskyBlockModification(decompMatrix, downdates, true);
+}
+
+void DBMatDMSChol::choleskyBlockModification(sgpp::base::DataMatrix& decompMatrix,
+                                             const sgpp::base::DataMatrix& vectors,
+                                             bool downdate) const {
+#ifdef USE_GSL
+  size_t size = decompMatrix.getNrows();
+  size_t k = vectors.getNcols();
+
+  if (vectors.getNrows() != size) {
+    throw sgpp::base::data_exception(
+        "choleskyBlockModification::Size of DecomposedMatrix and update vectors don´t match...");
+  }
+  if (k == 0 || size == 0) {
+    return;
+  }
+
+  // Row-major working copy of the update vectors (rows 0..size-1, columns 0..k-1)
+  sgpp::base::DataMatrix work(vectors);
+  double* L = decompMatrix.getPointer();
+  double* W = work.getPointer();
+
+  // The panel width balances the rotation work inside the panel against the size of the
+  // accumulated transformation that is applied to the trailing rows
+  const size_t panelSize = std::max<size_t>(16, std::min<size_t>(k, 256));
+
+  for (size_t j0 = 0; j0 < size; j0 += panelSize) {
+    size_t nb = std::min(panelSize, size - j0);
+    size_t m = nb + k;
+    // Panel rows j0..j0+nb-1 of [L(:, j0:j0+nb) W], and the accumulated transformation G
+    sgpp::base::DataMatrix panel(nb, m);
+    sgpp::base::DataMatrix G(m, m, 0.0);
+    for (size_t i = 0; i < nb; i++) {
+      std::copy(L + (j0 + i) * size + j0, L + (j0 + i) * size + j0 + nb,
+                panel.getPointer() + i * m);
+      std::copy(W + (j0 + i) * k, W + (j0 + i + 1) * k, panel.getPointer() + i * m + nb);
+    }
+    for (size_t i = 0; i < m; i++) {
+      G.set(i, i, 1.0);
+    }
+    double* P = panel.getPointer();
+    double* g = G.getPointer();
+
+    // Eliminate the update vectors' entries in each panel column, one vector at a time. This is
+    // the same sequence of rotations as k successive rank one modifications.
+    for (size_t jj = 0; jj < nb; jj++) {
+      for (size_t v = 0; v < k; v++) {
+        double a = P[jj * m + jj];
+        double b = P[jj * m + nb + v];
+        if (b == 0.0) {
+          continue;
+        }
+        // [l' w'] = [l w] * [[c11 c12], [c21 c22]]
+        double c11, c12, c21, c22;
+        if (downdate) {
+          double r2 = (a - b) * (a + b);
+          if (a <= 0.0 || r2 <= 0.0) {
+            throw sgpp::base::data_exception(
+                "choleskyBlockDowndate::Matrix not numerical positive definite");
+          }
+          double r = sqrt(r2);
+          c11 = a / r;
+          c12 = -b / r;
+          c21 = -b / r;
+          c22 = a / r;
+        } else {
+          double r = hypot(a, b);
+          if (r == 0.0) {
+            throw sgpp::base::data_exception(
+                "choleskyBlockUpdate::Matrix not numerical positive definite");
+          }
+          c11 = a / r;
+          c12 = -b / r;
+          c21 = b / r;
+          c22 = a / r;
+        }
+        for (size_t i = jj; i < nb; i++) {
+          double x = P[i * m + jj];
+          double y = P[i * m + nb + v];
+          P[i * m + jj] = c11 * x + c21 * y;
+          P[i * m + nb + v] = c12 * x + c22 * y;
+        }
+        P[jj * m + nb + v] = 0.0;
+        for (size_t i = 0; i < m; i++) {
+          double x = g[i * m + jj];
+          double y = g[i * m + nb + v];
+          g[i * m + jj] = c11 * x + c21 * y;
+          g[i * m + nb + v] = c12 * x + c22 * y;
+        }
+      }
+    }
+
+    // Write back the panel
+    for (size_t i = 0; i < nb; i++) {
+      std::copy(P + i * m, P + i * m + nb, L + (j0 + i) * size + j0);
+      std::copy(P + i * m + nb, P + (i + 1) * m, W + (j0 + i) * k);
+    }
+
+    // Apply the accumulated transformation to the trailing rows: [L21 W2] <- [L21 W2] * G
+    size_t rows = size - j0 - nb;
+    if (rows == 0) {
+      continue;
+    }
+    sgpp::base::DataMatrix trailing(rows, m);
+    double* T = trailing.getPointer();
+    for (size_t i = 0; i < rows; i++) {
+      size_t row = j0 + nb + i;
+      std::copy(L + row * size + j0, L + row * size + j0 + nb, T + i * m);
+      std::copy(W + row * k, W + (row + 1) * k, T + i * m + nb);
+    }
+    sgpp::base::DataMatrix result(rows, m);
+    gsl_matrix_view trailingView = gsl_matrix_view_array(T, rows, m);
+    gsl_matrix_view gView = gsl_matrix_view_array(g, m, m);
+    gsl_matrix_view resultView = gsl_matrix_view_array(result.getPointer(), rows, m);
+    gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, &trailingView.matrix, &gView.matrix, 0.0,
+                   &resultView.matrix);
+    const double* R = result.getPointer();
+    for (size_t i = 0; i < rows; i++) {
+      size_t row = j0 + nb + i;
+      std::copy(R + i * m, R + i * m + nb, L + row * size + j0);
+      std::copy(R + i * m + nb, R + (i + 1) * m, W + row * k);
+    }
+  }
+#else
+  throw base::not_implemented_exception("built withot GSL");
+#endif /* USE_GSL */
+}
+
+void DBMatDMSChol::choleskyBlockAddPoints(sgpp::base::DataMatrix& decompMatrix,
+                                          const sgpp::base::DataMatrix& newColumns,
+                                          size_t size) const {
+#ifdef USE_GSL
+  size_t k = newColumns.getNcols();
+  size_t sizeFull = decompMatrix.getNrows();
+
+  if (newColumns.getNrows() != size + k || sizeFull < size + k) {
+    throw sgpp::base::data_exception(
+        "choleskyBlockAddPoints::Size of DecomposedMatrix and new columns don´t match...");
+  }
+  if (k == 0) {
+    return;
+  }
+
+  // X = L^-1 A12 for all new columns at once (one BLAS-3 triangular solve)
+  sgpp::base::DataMatrix X(size, k);
+  std::copy(newColumns.getPointer(), newColumns.getPointer() + size * k, X.getPointer());
+  if (size > 0) {
+    gsl_matrix_view m_full = gsl_matrix_view_array(decompMatrix.getPointer(), sizeFull, sizeFull);
+    gsl_matrix_view m = gsl_matrix_submatrix(&m_full.matrix, 0, 0, size, size);
+    gsl_matrix_view xView = gsl_matrix_view_array(X.getPointer(), size, k);
+    gsl_blas_dtrsm(CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit, 1.0, &m.matrix,
+                   &xView.matrix);
+  }
+
+  // Schur complement S = A22 - X'X
+  sgpp::base::DataMatrix S(k, k);
+  std::copy(newColumns.getPointer() + size * k, newColumns.getPointer() + (size + k) * k,
+            S.getPointer());
+  if (size > 0) {
+    gsl_matrix_view xView = gsl_matrix_view_array(X.getPointer(), size, k);
+    gsl_matrix_view sView = gsl_matrix_view_array(S.getPointer(), k, k);
+    gsl_blas_dsyrk(CblasLower, CblasTrans, -1.0, &xView.matrix, 1.0, &sView.matrix);
+  }
+
+  // Cholesky factorization of the (lower triangle of the) Schur complement
+  for (size_t j = 0; j < k; j++) {
+    double d = S.get(j, j);
+    for (size_t l = 0; l < j; l++) {
+      d -= S.get(j, l) * S.get(j, l);
+    }
+    if (d <= 0.0) {
+      throw sgpp::base::data_exception(
+          "choleskyBlockAddPoints::Resulting matrix is at least not numerical positive definite");
+    }
+    d = sqrt(d);
+    S.set(j, j, d);
+    for (size_t i = j + 1; i < k; i++) {
+      double e = S.get(i, j);
+      for (size_t l = 0; l < j; l++) {
+        e -= S.get(i, l) * S.get(j, l);
+      }
+      S.set(i, j, e / d);
+    }
+  }
+
+  // New rows of the factor: [X' chol(S)], everything right of the diagonal is zero
+  double* L = decompMatrix.getPointer();
+  for (size_t i = 0; i < k; i++) {
+    double* row = L + (size + i) * sizeFull;
+    for (size_t j = 0; j < size; j++) {
+      row[j] = X.get(j, i);
+    }
+    for (size_t j = 0; j <= i; j++) {
+      row[size + j] = S.get(i, j);
+    }
+    std::fill(row + size + i + 1, row + sizeFull, 0.0);
+  }
+  for (size_t i = 0; i < size; i++) {
+    std::fill(L + i * sizeFull + size, L + i * sizeFull + size + k, 0.0);
+  }
+#else
+  throw base::not_implemented_exception("built withot GSL");
+#endif /* USE_GSL */
+}
+
 void DBMatDMSChol::choleskyUpdateLambda(sgpp::base::DataMatrix& decompMatrix,
                                         double lambda_up) const {
   size_t size = decompMatrix.getNcols();
@@ -289,7 +506,7 @@ void DBMatDMSChol::choleskyUpdateLambda(sgpp::base::DataMatrix& decompMatrix,
   }
 }
 
-void DBMatDMSChol::choleskyBackwardSolve(const sgpp::base::DataMatrix& decompMatrix,
+void DBMatDMSChol::choleskyBackwardSolve(const DBMatMatrixView& decompMatrix,
                                          const sgpp::base::DataVector& y,
                                          sgpp::base::DataVector& alpha) const {
   size_t size = decompMatrix.getNcols();
@@ -302,7 +519,7 @@ void DBMatDMSChol::choleskyBackwardSolve(const sgpp::base::DataMatrix& decompMat
   }
 }
 
-void DBMatDMSChol::choleskyForwardSolve(const sgpp::base::DataMatrix& decompMatrix,
+void DBMatDMSChol::choleskyForwardSolve(const DBMatMatrixView& decompMatrix,
                                         const sgpp::base::DataVector& b,
                                         sgpp::base::DataVector& y) const {
   size_t size = decompMatrix.getNcols();
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <sgpp/datadriven/algorithm/DBMatDecompMatrixSolver.hpp>
+#include <sgpp/datadriven/algorithm/DBMatMatrixView.hpp>
 #include <sgpp/datadriven/scalapack/DataMatrixDistributed.hpp>
 #include <sgpp/datadriven/scalapack/DataVectorDistributed.hpp>
 
@@ -36,6 +37,17 @@ class DBMatDMSChol : public DBMatDecompMatrixSolver {
   virtual void solve(sgpp::base::DataMatrix& decompMatrix, sgpp::base::DataVector& alpha,
                      const sgpp::base::DataVector& b, double lambda_old, double lambda_new) const;
 
+  /**
+   * Solves a system of equations with an unmodified (read-only) factor, e.g. one that lives in a
+   * mapped decomposition file
+   *
+   * @param decompMatrix view of the LL' lower triangular cholesky factor
+   * @param alpha the vector of unknowns (the result is stored there)
+   * @param b the right hand vector of the equation system
+   */
+  void solve(const DBMatMatrixView& decompMatrix, sgpp::base::DataVector& alpha,
+             const sgpp::base::DataVector& b) const;
+
   /**
    * Parallel (distributed) version of solve.
    * @param decompMatrix the LL' lower triangular cholesky factor
@@ -70,6 +82,40 @@ class DBMatDMSChol : public DBMatDecompMatrixSolver {
   void choleskyDowndate(sgpp::base::DataMatrix& decompMatrix,
                         const sgpp::base::DataVector& downdate, bool do_cv = false) const;
 
+  /**
+   * Performs a blocked rank k cholesky update LL' + VV', which is equivalent to k rank one
+   * updates with the columns of V but applies the Givens rotations of a panel of columns to the
+   * rows below the panel with a single matrix-matrix product.
+   *
+   * @param decompMatrix the LL' lower triangular cholesky factor
+   * @param updates the n x k matrix V whose columns are the update vectors
+   */
+  void choleskyBlockUpdate(sgpp::base::DataMatrix& decompMatrix,
+                           const sgpp::base::DataMatrix& updates) const;
+
+  /**
+   * Performs a blocked rank k cholesky downdate LL' - VV' with hyperbolic rotations, see
+   * choleskyBlockUpdate.
+   *
+   * @param decompMatrix the LL' lower triangular cholesky factor
+   * @param downdates the n x k matrix V whose columns are the downdate vectors
+   */
+  void choleskyBlockDowndate(sgpp::base::DataMatrix& decompMatrix,
+                             const sgpp::base::DataMatrix& downdates) const;
+
+  /**
+   * Extends the cholesky factor by k rows and columns at once (e.g. when k grid points are
+   * refined). The new off-diagonal block is computed with one triangular solve for all k
+   * columns and the new diagonal block by factorizing its Schur complement.
+   *
+   * @param decompMatrix the cholesky factor, already resized to (size + k) x (size + k) with the
+   * current factor in the leading size x size block
+   * @param newColumns (size + k) x k matrix holding the new columns of the system matrix
+   * @param size rows/columns of the current cholesky factor
+   */
+  void choleskyBlockAddPoints(sgpp::base::DataMatrix& decompMatrix,
+                              const sgpp::base::DataMatrix& newColumns, size_t size) const;
+
  protected:
   /**
    * Update the decomposition if the regularization parameter changes. This may be more expensive
@@ -80,13 +126,22 @@ class DBMatDMSChol : public DBMatDecompMatrixSolver {
   virtual void choleskyUpdateLambda(sgpp::base::DataMatrix& decompMatrix,
                                     double lambdaUpdate) const;
 
+  /**
+   * Shared implementation of choleskyBlockUpdate and choleskyBlockDowndate
+   * @param decompMatrix the LL' lower triangular cholesky factor
+   * @param vectors the n x k matrix of update or downdate vectors
+   * @param downdate whether to compute LL' - VV' instead of LL' + VV'
+   */
+  void choleskyBlockModification(sgpp::base::DataMatrix& decompMatrix,
+                                 const sgpp::base::DataMatrix& vectors, bool downdate) const;
+
   /**
    * Perform Backward substitution solving the triangular system $A alpha = y$
    * @param decompMatrix Triangular matrix
    * @param y right hand side obtained by forward substitution
    * @param alpha the vector of unknowns we solve for
    */
-  virtual void choleskyBackwardSolve(const sgpp::base::DataMatrix& decompMatrix,
+  virtual void choleskyBackwardSolve(const DBMatMatrixView& decompMatrix,
                                      const sgpp::base::DataVector& y,
                                      sgpp::base::DataVector& alpha) const;
 
@@ -96,7 +151,7 @@ class DBMatDMSChol : public DBMatDecompMatrixSolver {
    * @param b right hand side of our initial system matrix we solve for
    * @param y the vector of unknowns we solve for
    */
-  virtual void choleskyForwardSolve(const sgpp::base::DataMatrix& decompMatrix,
+  virtual void choleskyForwardSolve(const DBMatMatrixView& decompMatrix,
                                     const sgpp::base::DataVector& b,
                                     sgpp::base::DataVector& y) const;
 };
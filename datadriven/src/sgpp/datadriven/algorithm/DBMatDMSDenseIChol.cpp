@@ -44,7 +44,7 @@ void DBMatDMSDenseIChol::choleskyUpdateLambda(sgpp::base::DataMatrix& decompMatr
                                 densityEstimationConfig.iCholSweepsUpdateLambda_);
 }
 
-void DBMatDMSDenseIChol::choleskyBackwardSolve(const sgpp::base::DataMatrix& decompMatrix,
+void DBMatDMSDenseIChol::choleskyBackwardSolve(const DBMatMatrixView& decompMatrix,
                                                const sgpp::base::DataVector& y,
                                                sgpp::base::DataVector& alpha) const {
   // cache efficient version of jaccobi based backward substitution
@@ -71,7 +71,7 @@ void DBMatDMSDenseIChol::choleskyBackwardSolve(const sgpp::base::DataMatrix& dec
   }
 }
 
-void DBMatDMSDenseIChol::choleskyForwardSolve(const sgpp::base::DataMatrix& decompMatrix,
+void DBMatDMSDenseIChol::choleskyForwardSolve(const DBMatMatrixView& decompMatrix,
                                               const sgpp::base::DataVector& b,
                                               sgpp::base::DataVector& y) const {
   // initial guess for y
@@ -49,7 +49,7 @@ class DBMatDMSDenseIChol : public DBMatDMSChol {
    * @param y right hand side obtained by forward substitution
    * @param alpha the vector of unknowns we solve for
    */
-  void choleskyBackwardSolve(const DataMatrix& decompMatrix, const DataVector& y,
+  void choleskyBackwardSolve(const DBMatMatrixView& decompMatrix, const DataVector& y,
                              DataVector& alpha) const override;
 
   /**
@@ -59,7 +59,7 @@ class DBMatDMSDenseIChol : public DBMatDMSChol {
    * @param b right hand side of our initial system matrix we solve for
    * @param y the vector of unknowns we solve for
    */
-  void choleskyForwardSolve(const DataMatrix& decompMatrix, const DataVector& b,
+  void choleskyForwardSolve(const DBMatMatrixView& decompMatrix, const DataVector& b,
                             DataVector& y) const override;
 
  private:
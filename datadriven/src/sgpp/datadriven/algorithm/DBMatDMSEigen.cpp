@@ -19,13 +19,14 @@ DBMatDMSEigen::DBMatDMSEigen() {}
 
 DBMatDMSEigen::~DBMatDMSEigen() {}
 
-void DBMatDMSEigen::solve(sgpp::base::DataMatrix& eigenVectors,
+void DBMatDMSEigen::solve(const DBMatMatrixView& eigenVectors,
                           sgpp::base::DataVector& eigenValues,
                           sgpp::base::DataVector& alpha,
                           sgpp::base::DataVector& rhs, double lambda) {
   size_t n = eigenVectors.getNcols();
   // Create a matrix view for the eigenvectors
-  gsl_matrix_view q = gsl_matrix_view_array(eigenVectors.getPointer(), n, n);
+  gsl_matrix_const_view q = gsl_matrix_const_view_array_with_tda(eigenVectors.getPointer(), n, n,
+                                                                 eigenVectors.getStride());
   // Create a vector view for the right hand side
   gsl_vector_view b = gsl_vector_view_array(rhs.getPointer(), n);
   // Create a vector view for the eigenvalues
@@ -9,6 +9,7 @@
 #define DBMATDMSEigen_HPP_
 
 #include <sgpp/datadriven/algorithm/DBMatDecompMatrixSolver.hpp>
+#include <sgpp/datadriven/algorithm/DBMatMatrixView.hpp>
 
 namespace sgpp {
 namespace datadriven {
@@ -31,13 +32,13 @@ class DBMatDMSEigen : public DBMatDecompMatrixSolver {
   /**
    * Solves a system of equations
    *
-   * @param eigenVectors the eigendecomposed left hand side
+   * @param eigenVectors view of the eigendecomposed left hand side
    *        (the matrix contains the eigenvectors (rows 0...n) and eigenvalues
    * (row n+1))
    * @param alpha the vector of unknowns (the result is stored there)
    * @param b the right hand vector of the equation system
    */
-  void solve(sgpp::base::DataMatrix& eigenVectors,
+  void solve(const DBMatMatrixView& eigenVectors,
              sgpp::base::DataVector& eigenValues, sgpp::base::DataVector& alpha,
              sgpp::base::DataVector& rhs, double lambda);
 };
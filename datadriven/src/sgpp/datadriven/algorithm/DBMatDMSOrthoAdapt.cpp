@@ -20,7 +20,7 @@
 namespace sgpp {
 namespace datadriven {
 
-void DBMatDMSOrthoAdapt::solve(sgpp::base::DataMatrix& T_inv, sgpp::base::DataMatrix& Q,
+void DBMatDMSOrthoAdapt::solve(const DBMatMatrixView& T_inv, const DBMatMatrixView& Q,
                                sgpp::base::DataMatrix& B, sgpp::base::DataVector& b,
                                sgpp::base::DataVector& alpha) {
 #ifdef USE_GSL
@@ -45,9 +45,10 @@ void DBMatDMSOrthoAdapt::solve(sgpp::base::DataMatrix& T_inv, sgpp::base::DataMa
    */
 
   // creating gsl_matrix_views to be able to use BLAS operations
-  gsl_matrix_view q_view = gsl_matrix_view_array(Q.getPointer(), Q.getNrows(), Q.getNcols());
-  gsl_matrix_view t_inv_view =
-      gsl_matrix_view_array(T_inv.getPointer(), T_inv.getNrows(), T_inv.getNcols());
+  gsl_matrix_const_view q_view = gsl_matrix_const_view_array_with_tda(
+      Q.getPointer(), Q.getNrows(), Q.getNcols(), Q.getStride());
+  gsl_matrix_const_view t_inv_view = gsl_matrix_const_view_array_with_tda(
+      T_inv.getPointer(), T_inv.getNrows(), T_inv.getNcols(), T_inv.getStride());
   gsl_matrix_view b_matrix_view = gsl_matrix_view_array(B.getPointer(), B.getNrows(), B.getNcols());
 
   gsl_vector_view b_vector_view_cut = gsl_vector_view_array(b.getPointer(), Q.getNrows());
@@ -7,6 +7,7 @@
 
 #include <sgpp/base/exception/operation_exception.hpp>
 #include <sgpp/datadriven/algorithm/DBMatDecompMatrixSolver.hpp>
+#include <sgpp/datadriven/algorithm/DBMatMatrixView.hpp>
 #include <sgpp/datadriven/configuration/ParallelConfiguration.hpp>
 #include <sgpp/datadriven/scalapack/DataMatrixDistributed.hpp>
 #include <sgpp/datadriven/scalapack/DataVectorDistributed.hpp>
@@ -31,13 +32,13 @@ class DBMatDMSOrthoAdapt : public DBMatDecompMatrixSolver {
    * done with decomposing and adaptivity, resp.
    * The computation done: alpha = Q*T_inv*Q^t*b + B*b
    *
-   * @param T_inv Inverse of a tridiagonal matrix
-   * @param Q     Orthogonal matrix, part of hessenberg_decomp of the lhs matrix
+   * @param T_inv View of the inverse of a tridiagonal matrix
+   * @param Q     View of the orthogonal matrix, part of hessenberg_decomp of the lhs matrix
    * @param B     Storage of the online objects refined/coarsened points
    * @param b     The right side of the system
    * @param alpha The solution vector of the system, computed values go there
    */
-  void solve(sgpp::base::DataMatrix& T_inv, sgpp::base::DataMatrix& Q, sgpp::base::DataMatrix& B,
+  void solve(const DBMatMatrixView& T_inv, const DBMatMatrixView& Q, sgpp::base::DataMatrix& B,
              sgpp::base::DataVector& b, sgpp::base::DataVector& alpha);
 
   /**
@@ -14,7 +14,11 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
 
 #include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <sstream>
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -29,9 +33,10 @@ const std::string keyGridLevel = "level";
 const std::string keyRegularizationStrength = "lambda";
 const std::string keyDecompositionType = "decomposition";
 const std::string keyFilepath = "filepath";
+const std::string keyHash = "hash";
 
-DBMatDatabase::DBMatDatabase(const std::string& filepath) {
-  databaseFilepath = filepath;
+DBMatDatabase::DBMatDatabase(const std::string& filepath)
+    : databaseFilepath(filepath), database(nullptr), databaseRoot(), entryIndex() {
   databaseRoot = std::make_unique<json::JSON>(filepath);
   // Get the root node of the database (list)
   if (databaseRoot->contains("database")) {
@@ -39,6 +44,15 @@ DBMatDatabase::DBMatDatabase(const std::string& filepath) {
   } else {
     std::cout << "DBMatDatabase: json database is ill formated (does not contain key \"database\")!"
         << std::endl;
+    return;
+  }
+  // Index all valid entries by their configuration key. The first entry of a configuration wins.
+  for (size_t i = 0; i < database->size(); i++) {
+    json::DictNode* entry = (json::DictNode*)(&((*database)[i]));
+    std::string key;
+    if (entryKey(entry, i, key)) {
+      entryIndex.emplace(key, i);
+    }
   }
 }
 
@@ -86,19 +100,31 @@ void DBMatDatabase::putDataMatrix(sgpp::base::GeneralGridConfiguration& gridConf
     gridConfigEntry.addTextAttr(keyGridType, sgpp::datadriven::GeneralGridTypeParser::toString(
         gridConfig.generalType_));
     gridConfigEntry.addIDAttr(keyGridDimension, (uint64_t)gridConfig.dim_);
-    gridConfigEntry.addIDAttr(keyGridLevel, (int64_t)gridConfig.level_);
-    // Add a regularization configuration entry
+    if (gridConfig.generalType_ == sgpp::base::GeneralGridType::ComponentGrid) {
+      json::ListNode& levelList = (json::ListNode&)(gridConfigEntry.addListAttr(keyGridLevel));
+      for (int level : ((sgpp::base::CombiGridConfiguration&)gridConfig).levels) {
+        levelList.addIdValue((int64_t)level);
+      }
+    } else {
+      gridConfigEntry.addIDAttr(keyGridLevel, (int64_t)gridConfig.level_);
+    }
+    // Add a regularization configuration entry (with all digits, so the lookup is exact)
     json::DictNode& regularizationConfigEntry = (json::DictNode&)(entry.addDictAttr(
         keyRegularizationConfiguration));
-    regularizationConfigEntry.addIDAttr(keyRegularizationStrength, regularizationConfig.lambda_);
+    regularizationConfigEntry.addIDAttr(keyRegularizationStrength,
+        formatExact(regularizationConfig.lambda_));
     // Add a density estimation configuration entry
     json::DictNode& densityEstimationConfigEntry = (json::DictNode&)(entry.addDictAttr(
         keyDensityEstimationConfiguration));
     densityEstimationConfigEntry.addTextAttr(keyDecompositionType,
         sgpp::datadriven::MatrixDecompositionTypeParser::toString(
             densityEstimationConfig.decomposition_));
-    // Add the filepath
+    // Add the content hash and the filepath
+    entry.addTextAttr(keyHash, configurationHash(gridConfig, regularizationConfig,
+        densityEstimationConfig));
     entry.addTextAttr(keyFilepath, filepath);
+    entryIndex.emplace(configurationKey(gridConfig, regularizationConfig, densityEstimationConfig),
+        database->size() - 1);
     // Serialize the entire database
     databaseRoot->serialize(databaseFilepath);
     std::cout << "Successfully added new matrix decomposition at \"" << filepath <<
@@ -117,107 +143,129 @@ void DBMatDatabase::putDataMatrix(sgpp::base::GeneralGridConfiguration& gridConf
   }
 }
 
-bool DBMatDatabase::gridConfigurationMatches(json::DictNode *node,
-      sgpp::base::GeneralGridConfiguration& gridConfig, size_t entry_num) {
-  // Check if grid general type matches
-  sgpp::base::GeneralGridType gridType;
-  if (node->contains(keyGridType)) {
-    // Parse the grid general type
-    std::string strGridType = (*node)[keyGridType].get();
-    gridType = sgpp::datadriven::GeneralGridTypeParser::parse(
-        strGridType);
-    // Check if the general grid type matches
-    if (gridConfig.generalType_ != gridType) return false;
-  } else {
-    std::cout << "DBMatDatabase: database entry # " << entry_num <<
-        ": \"" << keyGridConfiguration << "\" node does not contain \"" << keyGridType <<
-        "\" key and therefore is ignored!"<< std::endl;
-    return false;
-  }
-  // Check if grid dimensionality matches
-  if (node->contains(keyGridDimension)) {
-    uint64_t gridDimension = (*node)[keyGridDimension].getUInt();
-    if (gridConfig.dim_ != gridDimension) return false;
-  } else {
-    std::cout << "DBMatDatabase: database entry # " << entry_num <<
-        ": \"" << keyGridConfiguration << "\" node does not contain \"" << keyGridDimension <<
-        "\" key and therefore is " << "ignored!" << std::endl;
-    return false;
+std::string DBMatDatabase::configurationHash(sgpp::base::GeneralGridConfiguration& gridConfig,
+    sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+    sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig) {
+  // 64 bit FNV-1a, which (unlike std::hash) is stable across platforms and runs
+  std::string key = configurationKey(gridConfig, regularizationConfig, densityEstimationConfig);
+  uint64_t hash = 14695981039346656037ULL;
+  for (char c : key) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
   }
-  // Check if the grid level matches
-  if (node->contains(keyGridLevel)) {
+  std::ostringstream stream;
+  stream << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return stream.str();
+}
+
+std::string DBMatDatabase::configurationKey(sgpp::base::GeneralGridConfiguration& gridConfig,
+    sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+    sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig) {
+  std::vector<int64_t> levels;
+  if (gridConfig.generalType_ == sgpp::base::GeneralGridType::ComponentGrid) {
     // Combi grids contain a level vector of size d
-    if (gridType == sgpp::base::GeneralGridType::ComponentGrid) {
-      json::ListNode* entryLevelVector = (json::ListNode*)(&(*node)[keyGridLevel]);
-      if (entryLevelVector->size() != gridConfig.dim_) {
-        std::cout << "DBMatDatabase: database entry # " << entry_num <<
-            ": \"" << keyGridLevel << "\" size does not match \"" << keyGridDimension <<
-            "\" key and therefore is ignored!" << std::endl;
-        return false;
-      }
-      // Compare configuration level vector with json level vector
-      sgpp::base::CombiGridConfiguration& combiGridConfig =
-          (sgpp::base::CombiGridConfiguration&) gridConfig;
-      if (combiGridConfig.levels.size() != gridConfig.dim_) {
-        std::string what = "Invalid combi grid config: Level vector size " +
-            std::to_string(combiGridConfig.levels.size()) + " does not match dimensionality of grid"
-                + " configuration" + std::to_string(gridConfig.dim_);
-        throw sgpp::base::data_exception(what.c_str());
-      }
-      for (size_t i = 0; i < gridConfig.dim_; i++) {
-        json::Node* indexLevelNode = (json::Node*)(&((*entryLevelVector)[i]));
-        if (indexLevelNode->getInt() != combiGridConfig.levels.at(i)) {
-          return false;
-        }
-      }
-    } else {
-      // Other grid types only contain a single level value
-      int64_t gridLevel = (*node)[keyGridLevel].getInt();
-      if (gridConfig.level_ != gridLevel) return false;
+    sgpp::base::CombiGridConfiguration& combiGridConfig =
+        (sgpp::base::CombiGridConfiguration&) gridConfig;
+    if (combiGridConfig.levels.size() != gridConfig.dim_) {
+      std::string what = "Invalid combi grid config: Level vector size " +
+          std::to_string(combiGridConfig.levels.size()) + " does not match dimensionality of grid"
+              + " configuration" + std::to_string(gridConfig.dim_);
+      throw sgpp::base::data_exception(what.c_str());
     }
-
+    levels.assign(combiGridConfig.levels.begin(), combiGridConfig.levels.end());
   } else {
-    std::cout << "DBMatDatabase: database entry # " << entry_num <<
-        ": \"" << keyGridConfiguration << "\" node does not contain \"" << keyGridLevel <<
-        "\" key and therefore is ignored!" << std::endl;
-    return false;
+    levels.push_back(gridConfig.level_);
   }
-  // All relevant attributes of the general grid configuration match
-  return true;
+  return composeKey(sgpp::datadriven::GeneralGridTypeParser::toString(gridConfig.generalType_),
+      gridConfig.dim_, levels, regularizationConfig.lambda_,
+      sgpp::datadriven::MatrixDecompositionTypeParser::toString(
+          densityEstimationConfig.decomposition_));
 }
 
-bool DBMatDatabase::regularizationConfigurationMatches(json::DictNode *node,
-      sgpp::datadriven::RegularizationConfiguration& regularizationConfig, size_t entry_num) {
-  // Check if the reguluarization strength matches
-  if (node->contains(keyRegularizationStrength)) {
-    double lambda = (*node)[keyRegularizationStrength].getDouble();
-    if (regularizationConfig.lambda_ != lambda) return false;
-  } else {
-    std::cout << "DBMatDatabase: database entry # " << entry_num <<
-        ": \"" << keyRegularizationConfiguration << "\" node does not contain \""
-        << keyRegularizationStrength << "\" key and therefore is " << "ignored!" << std::endl;
-    return false;
+std::string DBMatDatabase::composeKey(const std::string& gridType, size_t dimension,
+    const std::vector<int64_t>& levels, double lambda, const std::string& decompositionType) {
+  std::ostringstream stream;
+  stream << gridType << "|" << dimension << "|";
+  for (size_t i = 0; i < levels.size(); i++) {
+    stream << (i > 0 ? "," : "") << levels[i];
   }
-  // Regularization configuration matches
-  return true;
+  stream << "|" << formatExact(lambda) << "|" << decompositionType;
+  return stream.str();
 }
 
-bool DBMatDatabase::densityEstimationConfigurationMatches(json::DictNode *node,
-      sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig, size_t entry_num) {
-  // Check if the decomposition type matches
-  if (node->contains(keyDecompositionType)) {
-    // Parse decomposition type
-    std::string strDecompType = (*node)[keyDecompositionType].get();
-    sgpp::datadriven::MatrixDecompositionType decompositionType =
-        sgpp::datadriven::MatrixDecompositionTypeParser::parse(strDecompType);
-    if (densityEstimationConfig.decomposition_ != decompositionType) return false;
-  } else {
-    std::cout << "DBMatDatabase: database entry # " << entry_num <<
-        ": \"" << keyDensityEstimationConfiguration << "\" node does not contain \""
-        << keyDecompositionType << "\" key and " << "therefore is ignored!" << std::endl;
+std::string DBMatDatabase::formatExact(double value) {
+  std::ostringstream stream;
+  stream << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+  return stream.str();
+}
+
+bool DBMatDatabase::entryKey(json::DictNode* entry, size_t entry_num, std::string& key) {
+  // Check if the entry contains all three configurations and a filepath
+  for (const std::string* attr : {&keyGridConfiguration, &keyRegularizationConfiguration,
+                                  &keyDensityEstimationConfiguration}) {
+    if (!entry->contains(*attr)) {
+      std::cout << "DBMatDatabase: database entry # " << entry_num << " does not contain a " <<
+          "\"" << *attr << "\" key and therefore is ignored!" << std::endl;
+      return false;
+    }
+  }
+  if (!entry->contains(keyFilepath)) {
+    std::cout << "DBMatDatabase: database entry # " << entry_num << " does not contain a " <<
+        "\"" << keyFilepath << "\" key and therefore is ignored!" << std::endl;
     return false;
   }
-  // Density estimation configuration matches
+  json::DictNode* gridConfigNode = (json::DictNode*)(&(*entry)[keyGridConfiguration]);
+  json::DictNode* regularizationConfigNode =
+      (json::DictNode*)(&(*entry)[keyRegularizationConfiguration]);
+  json::DictNode* densityEstimationConfigNode =
+      (json::DictNode*)(&(*entry)[keyDensityEstimationConfiguration]);
+
+  // Grid configuration: type, dimension and level(s)
+  const std::pair<json::DictNode*, const std::string*> required[] = {
+      {gridConfigNode, &keyGridType},
+      {gridConfigNode, &keyGridDimension},
+      {gridConfigNode, &keyGridLevel},
+      {regularizationConfigNode, &keyRegularizationStrength},
+      {densityEstimationConfigNode, &keyDecompositionType}};
+  for (auto& attr : required) {
+    if (!attr.first->contains(*attr.second)) {
+      const std::string& parent = attr.first == gridConfigNode ? keyGridConfiguration
+          : attr.first == regularizationConfigNode ? keyRegularizationConfiguration
+          : keyDensityEstimationConfiguration;
+      std::cout << "DBMatDatabase: database entry # " << entry_num <<
+          ": \"" << parent << "\" node does not contain \"" << *attr.second <<
+          "\" key and therefore is ignored!" << std::endl;
+      return false;
+    }
+  }
+  std::string strGridType = (*gridConfigNode)[keyGridType].get();
+  sgpp::base::GeneralGridType gridType =
+      sgpp::datadriven::GeneralGridTypeParser::parse(strGridType);
+  uint64_t gridDimension = (*gridConfigNode)[keyGridDimension].getUInt();
+  std::vector<int64_t> levels;
+  if (gridType == sgpp::base::GeneralGridType::ComponentGrid) {
+    json::ListNode* entryLevelVector = (json::ListNode*)(&(*gridConfigNode)[keyGridLevel]);
+    if (entryLevelVector->size() != gridDimension) {
+      std::cout << "DBMatDatabase: database entry # " << entry_num <<
+          ": \"" << keyGridLevel << "\" size does not match \"" << keyGridDimension <<
+          "\" key and therefore is ignored!" << std::endl;
+      return false;
+    }
+    for (size_t i = 0; i < gridDimension; i++) {
+      levels.push_back(((json::Node*)(&((*entryLevelVector)[i])))->getInt());
+    }
+  } else {
+    levels.push_back((*gridConfigNode)[keyGridLevel].getInt());
+  }
+
+  // Regularization and density estimation configuration
+  double lambda = (*regularizationConfigNode)[keyRegularizationStrength].getDouble();
+  std::string strDecompType = (*densityEstimationConfigNode)[keyDecompositionType].get();
+  sgpp::datadriven::MatrixDecompositionType decompositionType =
+      sgpp::datadriven::MatrixDecompositionTypeParser::parse(strDecompType);
+
+  key = composeKey(sgpp::datadriven::GeneralGridTypeParser::toString(gridType), gridDimension,
+      levels, lambda, sgpp::datadriven::MatrixDecompositionTypeParser::toString(decompositionType));
   return true;
 }
 
@@ -226,56 +274,12 @@ int DBMatDatabase::entryIndexByConfiguration(
     sgpp::base::AdaptivityConfiguration& adaptivityConfig,
     sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
     sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig) {
-  // Scan the entire database
-  for (size_t i = 0; i < database->size(); i++) {
-    json::DictNode* entry = (json::DictNode*)(&((*database)[i]));
-    // Check if the entry matches the grid configuration
-    if (entry->contains(keyGridConfiguration)) {
-      json::DictNode *gridConfigNode = (json::DictNode*)(&(*entry)[keyGridConfiguration]);
-      if (!gridConfigurationMatches(gridConfigNode, gridConfig, i)) continue;
-    } else {
-      std::cout << "DBMatDatabase: database entry # " << i << " does not contain a " <<
-          "\"" << keyGridConfiguration << "\" key and therefore is ignored!" << std::endl;
-      continue;
-    }
-    // Check if the entry matches the regularization configuration
-    if (entry->contains(keyRegularizationConfiguration)) {
-      json::DictNode *regularizationConfigNode =
-          (json::DictNode*)(&(*entry)[keyRegularizationConfiguration]);
-      if (!regularizationConfigurationMatches(regularizationConfigNode, regularizationConfig, i))
-        continue;
-    } else {
-      std::cout << "DBMatDatabase: database entry # " << i << " does not contain a " <<
-          "\"" << keyRegularizationConfiguration << "\" key and therefore is ignored!" << std::endl;
-      continue;
-    }
-    // Check if the entry matches the density estimation configuration
-    if (entry->contains(keyDensityEstimationConfiguration)) {
-      json::DictNode *densityEstimationConfiNode =
-          (json::DictNode*)(&(*entry)[keyDensityEstimationConfiguration]);
-      if (!densityEstimationConfigurationMatches(densityEstimationConfiNode,
-          densityEstimationConfig, i))
-        continue;
-    } else {
-      std::cout << "DBMatDatabase: database entry # " << i << " does not contain a " <<
-          "\"" << keyDensityEstimationConfiguration << "\" key and therefore is ignored!" <<
-          std::endl;
-      continue;
-    }
-    // All three configurations match -> return this entry
-    if (entry->contains(keyFilepath)) {
-      std::cout << "config match" << std::endl;
-      return (static_cast<int>(i));
-    } else {
-      std::cout << "DBMatDatabase: database entry # " << i << " matches but does not contain a " <<
-          "\"" << keyFilepath << "\" key and therefore is ignored!" << std::endl;
-    }
+  auto entry = entryIndex.find(
+      configurationKey(gridConfig, regularizationConfig, densityEstimationConfig));
+  if (entry == entryIndex.end()) {
+    return -1;
   }
-  return -1;
+  return static_cast<int>(entry->second);
 }
 } /* namespace datadriven */
 } /* namespace sgpp */
-
-
-
-
@@ -10,14 +10,19 @@
 #include <sgpp/datadriven/algorithm/DBMatOffline.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
 
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
 
 /**
  * A database class to store and retrieve online matrix decompositions for the sparse grid
- * density estimation. The class works on a json file.
+ * density estimation. The class works on a json file. When loading, all entries are indexed by a
+ * canonical key of their grid, regularization and density estimation configuration, so lookups
+ * take constant time independent of the size of the database.
  */
 class DBMatDatabase{
  public:
@@ -29,7 +34,7 @@ class DBMatDatabase{
   virtual ~DBMatDatabase() = default;
 
   /**
-   * Scans the entire database and checks weather any entry matches the configuration.
+   * Checks weather any entry of the database matches the configuration.
    * @param gridConfig the grid configuration the matrix must match
    * @param adaptivityConfig the adaptivity configuration the matrix must match
    * @param regularizationConfig the regularization configuration the matrix must match
@@ -42,7 +47,7 @@ class DBMatDatabase{
       sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig);
 
   /**
-   * Scans the entire database and finds the first entry that matches the configurations.
+   * Finds the first entry of the database that matches the configurations.
    * @param gridConfig the grid configuration the matrix must match
    * @param adaptivityConfig the adaptivity configuration the matrix must match
    * @param regularizationConfig the regularization configuration the matrix must match
@@ -73,6 +78,19 @@ class DBMatDatabase{
       sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
       std::string filepath, bool overwriteEntry = false);
 
+  /**
+   * Computes a stable 64 bit hash (16 hex digits) of the configuration a matrix decomposition
+   * depends on. It is stored with each new entry and can be used to derive content addressed
+   * file names for the decompositions.
+   * @param gridConfig the grid configuration
+   * @param regularizationConfig the regularization configuration
+   * @param densityEstimationConfig the density estimation configuration
+   * @return the hash as hexadecimal string
+   */
+  static std::string configurationHash(sgpp::base::GeneralGridConfiguration& gridConfig,
+      sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+      sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig);
+
 
  private:
   /**
@@ -92,8 +110,13 @@ class DBMatDatabase{
   std::unique_ptr<json::JSON> databaseRoot;
 
   /**
-   * Scans the entire database and finds the first entry that matches the configurations. Returns
-   * the index of the entry in the database ListNode or -1 if no entry matches.
+   * Index of the valid database entries by their configuration key
+   */
+  std::unordered_map<std::string, size_t> entryIndex;
+
+  /**
+   * Looks up the entry that matches the configurations. Returns the index of the entry in the
+   * database ListNode or -1 if no entry matches.
    * @param gridConfig the grid configuration the matrix matches
    * @param adaptivityConfig the adaptivity configuration the matrix matches
    * @param regularizationConfig the regularization configuration the matrix matches
@@ -106,40 +129,43 @@ class DBMatDatabase{
       sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig);
 
   /**
-   * Checks weather the grid configuration of a json dict node representing a database entry root
-   * matches the grid configuration passed to the database.
-   * @param node the root node of the grid configuration
-   * @param gridConfig the configuration to check
-   * @param entry_num the index of the entry the root node belongs to
-   * @return if the passed grid configuration matches the grid configuration of the node
+   * Computes the canonical key of a configuration
+   * @param gridConfig the grid configuration
+   * @param regularizationConfig the regularization configuration
+   * @param densityEstimationConfig the density estimation configuration
+   * @return the key
    */
-  bool gridConfigurationMatches(json::DictNode *node,
-      sgpp::base::GeneralGridConfiguration& gridConfig, size_t entry_num);
+  static std::string configurationKey(sgpp::base::GeneralGridConfiguration& gridConfig,
+      sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+      sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig);
 
   /**
-   * Checks weather the regularization configuration of a json dict node representing a
-   * database entry root matches the regularization configuration passed to the database.
-   * @param node the root node of the regularization configuration
-   * @param regularizationConfig the configuration to check
-   * @param entry_num the index of the entry the root node belongs to
-   * @return if the passed regularization configuration matches the regularization configuration
-   * of the node
+   * Composes the canonical key from the attributes that identify a matrix decomposition
+   * @param gridType the general grid type as string
+   * @param dimension the dimensionality of the grid
+   * @param levels the level (or level vector of combi grids) of the grid
+   * @param lambda the regularization strength
+   * @param decompositionType the matrix decomposition type as string
+   * @return the key
    */
-  bool regularizationConfigurationMatches(json::DictNode *node,
-      sgpp::datadriven::RegularizationConfiguration& regularizationConfig, size_t entry_num);
+  static std::string composeKey(const std::string& gridType, size_t dimension,
+      const std::vector<int64_t>& levels, double lambda, const std::string& decompositionType);
 
   /**
-   * Checks weather the regularization configuration of a json dict node representing a
-   * database entry root matches the regularization configuration passed to the database.
-   * @param node the root node of the density estimation configuration
-   * @param densityEstimationConfig the configuration to check
-   * @param entry_num the index of the entry the root node belongs to
-   * @return if the passed density estimation configuration matches the density estimation
-   * configuration of the node
+   * Formats a double with as many digits as needed to read back the identical value
+   * @param value the value to format
+   * @return the formatted value
    */
-  bool densityEstimationConfigurationMatches(json::DictNode *node,
-      sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
-      size_t entry_num);
+  static std::string formatExact(double value);
+
+  /**
+   * Computes the canonical key of a json dict node representing a database entry root.
+   * @param entry the root node of the entry
+   * @param entry_num the index of the entry in the database
+   * @param key the key of the entry
+   * @return false if the entry is incomplete and therefore ignored
+   */
+  bool entryKey(json::DictNode* entry, size_t entry_num, std::string& key);
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -0,0 +1,312 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/algorithm/DBMatDecompositionFile.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::data_exception;
+
+namespace {
+const char magicNumber[8] = {'S', 'G', 'P', 'P', 'D', 'B', 'M', 'T'};
+const uint32_t byteOrderMark = 0x01020304;
+
+size_t alignOffset(size_t offset) {
+  const size_t a = DBMatDecompositionFile::ALIGNMENT;
+  return (offset + a - 1) / a * a;
+}
+
+/**
+ * Creates a new empty file in the directory of fileName, whose name is unique among all
+ * threads and processes (process id plus a counter, created exclusively).
+ * @param fileName path of the target file
+ * @return path of the created file
+ */
+std::string createTempFile(const std::string& fileName) {
+  static std::atomic<unsigned long> counter(0);
+#ifdef _WIN32
+  const std::string prefix = fileName + ".tmp." + std::to_string(_getpid()) + ".";
+#else
+  const std::string prefix = fileName + ".tmp." + std::to_string(getpid()) + ".";
+#endif
+  while (true) {
+    const std::string tempFileName = prefix + std::to_string(counter++);
+    // "x" fails if the file exists already
+    FILE* file = std::fopen(tempFileName.c_str(), "wbx");
+    if (file != nullptr) {
+      std::fclose(file);
+      return tempFileName;
+    }
+    if (errno != EEXIST) {
+      throw data_exception("DBMatDecompositionFile: cannot open file for writing");
+    }
+  }
+}
+}  // namespace
+
+struct DBMatDecompositionFile::FileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrder;
+  uint32_t decompositionType;
+  uint32_t reserved;
+  uint64_t numSections;
+  // number of uint64 values of the flattened interactions (count, then size and terms each)
+  uint64_t interactionsLength;
+};
+
+struct DBMatDecompositionFile::SectionHeader {
+  uint64_t rows;
+  uint64_t cols;
+  uint64_t elementSize;
+  uint64_t offset;
+};
+
+DBMatDecompositionFile::DBMatDecompositionFile(const std::string& fileName)
+    : contents(nullptr), contentSize(0), mapped(false), buffer() {
+#ifndef _WIN32
+  int fd = open(fileName.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw data_exception("DBMatDecompositionFile: cannot open file");
+  }
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0) {
+    close(fd);
+    throw data_exception("DBMatDecompositionFile: cannot stat file");
+  }
+  contentSize = static_cast<size_t>(fileStat.st_size);
+  if (contentSize > 0) {
+    void* mapping = mmap(nullptr, contentSize, PROT_READ, MAP_SHARED, fd, 0);
+    if (mapping != MAP_FAILED) {
+      contents = static_cast<const char*>(mapping);
+      mapped = true;
+    }
+  }
+  close(fd);
+#endif
+  if (!mapped) {
+    std::ifstream file(fileName, std::ios::in | std::ios::binary);
+    if (!file) {
+      throw data_exception("DBMatDecompositionFile: cannot open file");
+    }
+    buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    contents = buffer.data();
+    contentSize = buffer.size();
+  }
+
+  // validate header and section table
+  if (contentSize < sizeof(FileHeader) ||
+      std::memcmp(header().magic, magicNumber, sizeof(magicNumber)) != 0) {
+    unmap();
+    throw data_exception("DBMatDecompositionFile: not a decomposition file");
+  }
+  if (header().version != VERSION || header().byteOrder != byteOrderMark) {
+    unmap();
+    throw data_exception("DBMatDecompositionFile: unsupported version or byte order");
+  }
+  size_t tableEnd = sizeof(FileHeader) + header().numSections * sizeof(SectionHeader) +
+                    header().interactionsLength * sizeof(uint64_t);
+  bool valid = tableEnd <= contentSize;
+  for (size_t i = 0; valid && i < header().numSections; i++) {
+    const SectionHeader& s = sectionHeader(i);
+    valid = s.offset % ALIGNMENT == 0 && s.offset >= tableEnd &&
+            s.offset + s.rows * s.cols * s.elementSize <= contentSize;
+  }
+  if (!valid) {
+    unmap();
+    throw data_exception("DBMatDecompositionFile: file is truncated or corrupt");
+  }
+}
+
+DBMatDecompositionFile::~DBMatDecompositionFile() { unmap(); }
+
+void DBMatDecompositionFile::unmap() {
+#ifndef _WIN32
+  if (mapped) {
+    munmap(const_cast<char*>(contents), contentSize);
+    mapped = false;
+  }
+#endif
+  contents = nullptr;
+}
+
+bool DBMatDecompositionFile::isDecompositionFile(const std::string& fileName) {
+  std::ifstream file(fileName, std::ios::in | std::ios::binary);
+  char magic[sizeof(magicNumber)];
+  if (!file.read(magic, sizeof(magic))) {
+    return false;
+  }
+  return std::memcmp(magic, magicNumber, sizeof(magicNumber)) == 0;
+}
+
+void DBMatDecompositionFile::write(const std::string& fileName, MatrixDecompositionType type,
+                                   const std::vector<std::vector<size_t>>& interactions,
+                                   const std::vector<Section>& sections) {
+  std::vector<uint64_t> flatInteractions;
+  flatInteractions.push_back(interactions.size());
+  for (const std::vector<size_t>& term : interactions) {
+    flatInteractions.push_back(term.size());
+    flatInteractions.insert(flatInteractions.end(), term.begin(), term.end());
+  }
+
+  FileHeader fileHeader;
+  std::memset(&fileHeader, 0, sizeof(fileHeader));
+  std::memcpy(fileHeader.magic, magicNumber, sizeof(magicNumber));
+  fileHeader.version = VERSION;
+  fileHeader.byteOrder = byteOrderMark;
+  fileHeader.decompositionType = static_cast<uint32_t>(type);
+  fileHeader.numSections = sections.size();
+  fileHeader.interactionsLength = flatInteractions.size();
+
+  std::vector<SectionHeader> table(sections.size());
+  size_t offset = alignOffset(sizeof(FileHeader) + table.size() * sizeof(SectionHeader) +
+                              flatInteractions.size() * sizeof(uint64_t));
+  for (size_t i = 0; i < sections.size(); i++) {
+    table[i].rows = sections[i].rows;
+    table[i].cols = sections[i].cols;
+    table[i].elementSize = sections[i].elementSize;
+    table[i].offset = offset;
+    offset = alignOffset(offset + sections[i].rows * sections[i].cols * sections[i].elementSize);
+  }
+
+  // never truncate the target in place, other objects or processes may have it mapped; the
+  // temporary file is unique, so processes writing the same target do not interfere
+  const std::string tempFileName = createTempFile(fileName);
+  std::ofstream file(tempFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!file) {
+    std::remove(tempFileName.c_str());
+    throw data_exception("DBMatDecompositionFile: cannot open file for writing");
+  }
+  file.write(reinterpret_cast<const char*>(&fileHeader), sizeof(fileHeader));
+  file.write(reinterpret_cast<const char*>(table.data()), table.size() * sizeof(SectionHeader));
+  file.write(reinterpret_cast<const char*>(flatInteractions.data()),
+             flatInteractions.size() * sizeof(uint64_t));
+  const char padding[ALIGNMENT] = {};
+  for (size_t i = 0; i < sections.size(); i++) {
+    file.write(padding, table[i].offset - static_cast<size_t>(file.tellp()));
+    file.write(static_cast<const char*>(sections[i].data),
+               sections[i].rows * sections[i].cols * sections[i].elementSize);
+  }
+  file.close();
+  if (!file) {
+    std::remove(tempFileName.c_str());
+    throw data_exception("DBMatDecompositionFile: writing file failed");
+  }
+#ifdef _WIN32
+  // rename does not replace existing files on Windows
+  std::remove(fileName.c_str());
+#endif
+  if (std::rename(tempFileName.c_str(), fileName.c_str()) != 0) {
+    std::remove(tempFileName.c_str());
+    throw data_exception("DBMatDecompositionFile: writing file failed");
+  }
+}
+
+MatrixDecompositionType DBMatDecompositionFile::getDecompositionType() const {
+  return static_cast<MatrixDecompositionType>(header().decompositionType);
+}
+
+std::vector<std::vector<size_t>> DBMatDecompositionFile::getInteractions() const {
+  const uint64_t* flat = reinterpret_cast<const uint64_t*>(
+      contents + sizeof(FileHeader) + header().numSections * sizeof(SectionHeader));
+  const uint64_t* end = flat + header().interactionsLength;
+  std::vector<std::vector<size_t>> interactions;
+  if (flat == end) {
+    return interactions;
+  }
+  size_t numTerms = *flat++;
+  for (size_t i = 0; i < numTerms; i++) {
+    if (flat == end || flat + 1 + *flat > end) {
+      throw data_exception("DBMatDecompositionFile: corrupt interaction terms");
+    }
+    size_t termSize = *flat++;
+    interactions.emplace_back(flat, flat + termSize);
+    flat += termSize;
+  }
+  return interactions;
+}
+
+size_t DBMatDecompositionFile::getNumberOfSections() const { return header().numSections; }
+
+size_t DBMatDecompositionFile::getRows(size_t section) const {
+  return sectionHeader(section).rows;
+}
+
+size_t DBMatDecompositionFile::getCols(size_t section) const {
+  return sectionHeader(section).cols;
+}
+
+const double* DBMatDecompositionFile::getMatrixData(size_t section) const {
+  return reinterpret_cast<const double*>(sectionData(section, sizeof(double)));
+}
+
+DBMatMatrixView DBMatDecompositionFile::getMatrixView(size_t section) const {
+  const SectionHeader& s = sectionHeader(section);
+  return DBMatMatrixView(getMatrixData(section), s.rows, s.cols, s.cols);
+}
+
+void DBMatDecompositionFile::copyMatrix(size_t section, sgpp::base::DataMatrix& matrix) const {
+  const SectionHeader& s = sectionHeader(section);
+  matrix.resizeRowsCols(s.rows, s.cols);
+  std::memcpy(matrix.getPointer(), getMatrixData(section), s.rows * s.cols * sizeof(double));
+}
+
+void DBMatDecompositionFile::copyIndices(size_t section, size_t* indices) const {
+  const SectionHeader& s = sectionHeader(section);
+  size_t n = s.rows * s.cols;
+  if (s.elementSize == sizeof(uint64_t)) {
+    const uint64_t* data = reinterpret_cast<const uint64_t*>(contents + s.offset);
+    for (size_t i = 0; i < n; i++) indices[i] = static_cast<size_t>(data[i]);
+  } else if (s.elementSize == sizeof(uint32_t)) {
+    const uint32_t* data = reinterpret_cast<const uint32_t*>(contents + s.offset);
+    for (size_t i = 0; i < n; i++) indices[i] = static_cast<size_t>(data[i]);
+  } else {
+    throw data_exception("DBMatDecompositionFile: section has an unexpected element type");
+  }
+}
+
+const DBMatDecompositionFile::FileHeader& DBMatDecompositionFile::header() const {
+  return *reinterpret_cast<const FileHeader*>(contents);
+}
+
+const DBMatDecompositionFile::SectionHeader& DBMatDecompositionFile::sectionHeader(
+    size_t section) const {
+  if (section >= header().numSections) {
+    throw data_exception("DBMatDecompositionFile: section index out of range");
+  }
+  return reinterpret_cast<const SectionHeader*>(contents + sizeof(FileHeader))[section];
+}
+
+const char* DBMatDecompositionFile::sectionData(size_t section, size_t elementSize) const {
+  const SectionHeader& s = sectionHeader(section);
+  if (s.elementSize != elementSize) {
+    throw data_exception("DBMatDecompositionFile: section has an unexpected element type");
+  }
+  return contents + s.offset;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,178 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/datadriven/algorithm/DBMatMatrixView.hpp>
+#include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Self-describing binary container for serialized matrix decompositions (DBMatOffline objects).
+ *
+ * The file starts with a fixed header (magic number, format version, byte order mark,
+ * decomposition type, number of sections), followed by a section table, the flattened
+ * interaction terms and finally the raw section payloads. Every payload starts at an offset that
+ * is a multiple of ALIGNMENT bytes, so the file can be memory mapped and each section used in
+ * place without any parsing.
+ *
+ * Files are opened read-only and, on POSIX systems, mapped with MAP_SHARED. Several processes
+ * loading the same decomposition therefore share the physical pages through the page cache
+ * instead of each reading (and parsing) the whole file. On other systems the file is read into
+ * memory once. Files are written to a uniquely named temporary file that then replaces the
+ * target, so existing mappings of an older version of the file stay valid and concurrent writers
+ * of the same file do not interfere.
+ */
+class DBMatDecompositionFile {
+ public:
+  /**
+   * Description of a section to be written: a row-major rows x cols array of elements of
+   * elementSize bytes each.
+   */
+  struct Section {
+    const void* data;
+    size_t rows;
+    size_t cols;
+    size_t elementSize;
+  };
+
+  /**
+   * Alignment of every section payload in bytes
+   */
+  static const size_t ALIGNMENT = 64;
+
+  /**
+   * Current version of the file format
+   */
+  static const uint32_t VERSION = 1;
+
+  /**
+   * Opens and maps a decomposition file. Throws a data_exception if the file cannot be opened or
+   * is not a valid decomposition file.
+   * @param fileName path of the file
+   */
+  explicit DBMatDecompositionFile(const std::string& fileName);
+
+  /**
+   * Unmaps the file
+   */
+  ~DBMatDecompositionFile();
+
+  DBMatDecompositionFile(const DBMatDecompositionFile&) = delete;
+  DBMatDecompositionFile& operator=(const DBMatDecompositionFile&) = delete;
+
+  /**
+   * Checks whether a file starts with the magic number of the binary format. Returns false for
+   * files in the legacy text header + GSL format.
+   * @param fileName path of the file
+   * @return whether the file is a binary decomposition file
+   */
+  static bool isDecompositionFile(const std::string& fileName);
+
+  /**
+   * Writes a decomposition file.
+   * @param fileName path of the file, existing files are overwritten
+   * @param type the decomposition type stored in the header
+   * @param interactions the interaction terms of the grid (empty for regular grids)
+   * @param sections the sections to write, in order
+   */
+  static void write(const std::string& fileName, MatrixDecompositionType type,
+                    const std::vector<std::vector<size_t>>& interactions,
+                    const std::vector<Section>& sections);
+
+  /**
+   * @return the decomposition type stored in the header
+   */
+  MatrixDecompositionType getDecompositionType() const;
+
+  /**
+   * @return the interaction terms stored in the file
+   */
+  std::vector<std::vector<size_t>> getInteractions() const;
+
+  /**
+   * @return the number of sections in the file
+   */
+  size_t getNumberOfSections() const;
+
+  /**
+   * @param section index of the section
+   * @return the number of rows of the section
+   */
+  size_t getRows(size_t section) const;
+
+  /**
+   * @param section index of the section
+   * @return the number of columns of the section
+   */
+  size_t getCols(size_t section) const;
+
+  /**
+   * Read-only pointer to the payload of a section of doubles inside the mapping. The pointer is
+   * valid as long as this object lives.
+   * @param section index of the section
+   * @return pointer to the first element
+   */
+  const double* getMatrixData(size_t section) const;
+
+  /**
+   * Read-only view of a section of doubles inside the mapping. The view is valid as long as this
+   * object lives.
+   * @param section index of the section
+   * @return view of the rows x cols matrix stored in the section
+   */
+  DBMatMatrixView getMatrixView(size_t section) const;
+
+  /**
+   * Copies a section of doubles into a matrix, which is resized accordingly.
+   * @param section index of the section
+   * @param matrix the matrix to fill
+   */
+  void copyMatrix(size_t section, sgpp::base::DataMatrix& matrix) const;
+
+  /**
+   * Copies a section of 32 or 64 bit unsigned integers (e.g. a permutation) into an array.
+   * @param section index of the section
+   * @param indices destination with room for rows * cols entries
+   */
+  void copyIndices(size_t section, size_t* indices) const;
+
+ private:
+  struct FileHeader;
+  struct SectionHeader;
+
+  const FileHeader& header() const;
+  const SectionHeader& sectionHeader(size_t section) const;
+  const char* sectionData(size_t section, size_t elementSize) const;
+  void unmap();
+
+  /**
+   * Start of the file contents (mapping or buffer)
+   */
+  const char* contents;
+  /**
+   * Size of the file in bytes
+   */
+  size_t contentSize;
+  /**
+   * Whether contents is a memory mapping (otherwise it is owned by buffer)
+   */
+  bool mapped;
+  /**
+   * Fallback storage if the file could not be mapped
+   */
+  std::vector<char> buffer;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
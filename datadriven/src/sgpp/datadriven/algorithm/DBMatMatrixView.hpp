@@ -0,0 +1,95 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <cstddef>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Read-only, non-owning view of a row-major matrix, e.g. of a decomposition that lives in a
+ * memory mapped DBMatDecompositionFile. Consecutive rows are stride elements apart. The view does
+ * not keep the underlying memory alive, so it must not outlive the matrix or mapping it refers to.
+ */
+class DBMatMatrixView {
+ public:
+  /**
+   * Creates an empty view
+   */
+  DBMatMatrixView() : data(nullptr), nrows(0), ncols(0), stride(0) {}
+
+  /**
+   * @param data pointer to the first element
+   * @param nrows number of rows
+   * @param ncols number of columns
+   * @param stride distance between the first elements of consecutive rows (in elements)
+   */
+  DBMatMatrixView(const double* data, size_t nrows, size_t ncols, size_t stride)
+      : data(data), nrows(nrows), ncols(ncols), stride(stride) {}
+
+  /**
+   * View of a DataMatrix, which is valid until the matrix is resized or destroyed. Implicit, so
+   * DataMatrix objects can be passed wherever a read-only view is expected.
+   * @param matrix the matrix
+   */
+  DBMatMatrixView(const sgpp::base::DataMatrix& matrix)  // NOLINT(runtime/explicit)
+      : data(matrix.data()),
+        nrows(matrix.getNrows()),
+        ncols(matrix.getNcols()),
+        stride(matrix.getNcols()) {}
+
+  /**
+   * @param row row index
+   * @param col column index
+   * @return the element (row, col)
+   */
+  double get(size_t row, size_t col) const { return data[row * stride + col]; }
+
+  /**
+   * Copies a row into a vector, which is resized accordingly
+   * @param row row index
+   * @param vec the vector to fill
+   */
+  void getRow(size_t row, sgpp::base::DataVector& vec) const {
+    vec.resize(ncols);
+    for (size_t col = 0; col < ncols; col++) {
+      vec[col] = get(row, col);
+    }
+  }
+
+  /**
+   * @return pointer to the first element
+   */
+  const double* getPointer() const { return data; }
+
+  /**
+   * @return number of rows
+   */
+  size_t getNrows() const { return nrows; }
+
+  /**
+   * @return number of columns
+   */
+  size_t getNcols() const { return ncols; }
+
+  /**
+   * @return distance between the first elements of consecutive rows (in elements)
+   */
+  size_t getStride() const { return stride; }
+
+ private:
+  const double* data;
+  size_t nrows;
+  size_t ncols;
+  size_t stride;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -13,14 +13,11 @@
 #include <sgpp/base/grid/type/ModLinearGrid.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDecompositionFile.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOffline.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 
-#ifdef USE_GSL
-#include <gsl/gsl_matrix_double.h>
-#endif /* USE_GSL */
-
 #include <math.h>
 #include <stdio.h>
 #include <algorithm>
@@ -53,6 +50,7 @@ DBMatOffline::DBMatOffline(const DBMatOffline& rhs)
     : lhsMatrix(rhs.lhsMatrix),
       isConstructed(rhs.isConstructed),
       isDecomposed(rhs.isDecomposed),
+      decompositionFile(rhs.decompositionFile),
       interactions(rhs.interactions) {}
 
 DBMatOffline& sgpp::datadriven::DBMatOffline::operator=(const DBMatOffline& rhs) {
@@ -62,26 +60,50 @@ DBMatOffline& sgpp::datadriven::DBMatOffline::operator=(const DBMatOffline& rhs)
   lhsMatrix = rhs.lhsMatrix;
   isConstructed = rhs.isConstructed;
   isDecomposed = rhs.isDecomposed;
+  decompositionFile = rhs.decompositionFile;
   interactions = rhs.interactions;
   return *this;
 }
 
 DBMatOffline::DBMatOffline(const std::string& filepath)
     : lhsMatrix(), isConstructed(true), isDecomposed(true) {
-  // Parse the interactions
-  parseInter(filepath, interactions);
-
-  // Parsing of lhsMatrix will be done in subclass implementations
+  if (DBMatDecompositionFile::isDecompositionFile(filepath)) {
+    // Binary format: the file is mapped once and the matrices are used in place, subclasses read
+    // their additional sections from the same mapping
+    decompositionFile = std::make_shared<const DBMatDecompositionFile>(filepath);
+    interactions = decompositionFile->getInteractions();
+  } else {
+    // Legacy format: parse the interactions, parsing of lhsMatrix will be done in subclass
+    // implementations
+    parseInter(filepath, interactions);
+  }
 }
 
 DataMatrix& DBMatOffline::getDecomposedMatrix() {
   if (isDecomposed) {
+    detachFromFile();
     return lhsMatrix;
   } else {
     throw data_exception("Matrix was not decomposed yet");
   }
 }
 
+DBMatMatrixView DBMatOffline::getDecomposedMatrixView() const {
+  if (!isDecomposed) {
+    throw data_exception("Matrix was not decomposed yet");
+  }
+  return decompositionFile ? decompositionFile->getMatrixView(0) : DBMatMatrixView(lhsMatrix);
+}
+
+void DBMatOffline::detachFromFile() {
+  if (decompositionFile) {
+    copyMappedSections();
+    decompositionFile.reset();
+  }
+}
+
+void DBMatOffline::copyMappedSections() { decompositionFile->copyMatrix(0, lhsMatrix); }
+
 DataMatrixDistributed& DBMatOffline::getDecomposedMatrixDistributed() {
 #ifdef USE_SCALAPACK
   if (isDecomposed) {
@@ -98,8 +120,9 @@ void DBMatOffline::syncDistributedDecomposition(std::shared_ptr<BlacsProcessGrid
                                                 const ParallelConfiguration& parallelConfig) {
 #ifdef USE_SCALAPACK
   if (isDecomposed) {
+    DBMatMatrixView lhsView = getDecomposedMatrixView();
     lhsDistributed = DataMatrixDistributed::fromSharedData(
-        lhsMatrix.data(), processGrid, lhsMatrix.getNrows(), lhsMatrix.getNcols(),
+        lhsView.getPointer(), processGrid, lhsView.getNrows(), lhsView.getNcols(),
         parallelConfig.rowBlockSize_, parallelConfig.columnBlockSize_);
   } else {
     throw data_exception("Matrix was not decomposed yet");
@@ -128,53 +151,32 @@ void DBMatOffline::buildMatrix(Grid* grid, RegularizationConfiguration& regulari
 }
 
 void DBMatOffline::store(const std::string& fileName) {
-#ifdef USE_GSL
   if (!isDecomposed) {
     throw algorithm_exception("Matrix not decomposed yet");
-    return;
   }
 
-  // Write configuration
-  std::ofstream outputFile(fileName, std::ofstream::out);
+  DBMatMatrixView lhsView = getDecomposedMatrixView();
+  std::vector<DBMatDecompositionFile::Section> sections;
+  sections.push_back(
+      {lhsView.getPointer(), lhsView.getNrows(), lhsView.getNcols(), sizeof(double)});
+  appendStoredSections(sections);
+  DBMatDecompositionFile::write(fileName, getDecompositionType(), interactions, sections);
 
-  if (!outputFile) {
-    throw algorithm_exception{"cannot open file for writing"};
-  }
-
-  std::string inter = "," + std::to_string(interactions.size());
-  for (std::vector<size_t> i : interactions) {
-    inter.append("," + std::to_string(i.size()));
-    for (size_t j : i) {
-      inter.append("," + std::to_string(j));
-    }
-  }
-
-  outputFile << lhsMatrix.getNrows() << "," << lhsMatrix.getNcols() << ","
-             << static_cast<int>(getDecompositionType()) << inter << "\n";
-  outputFile.close();
-
-  // write matrix
-  // switch to c FILE API for GSL
-  FILE* outputCFile = fopen(fileName.c_str(), "ab");
-  if (!outputCFile) {
-    throw algorithm_exception{"cannot open file for writing"};
-  }
-  gsl_matrix_view matrixView =
-      gsl_matrix_view_array(lhsMatrix.getPointer(), lhsMatrix.getNrows(), lhsMatrix.getNcols());
-  gsl_matrix_fwrite(outputCFile, &matrixView.matrix);
-
-  fclose(outputCFile);
-  std::cout << "Stored " << lhsMatrix.getNrows() << "x" << lhsMatrix.getNcols() << " matrix"
+  std::cout << "Stored " << lhsView.getNrows() << "x" << lhsView.getNcols() << " matrix"
             << std::endl;
-#else
-  throw base::not_implemented_exception("built withot GSL");
-#endif /* USE_GSL */
 }
 
+void DBMatOffline::appendStoredSections(std::vector<DBMatDecompositionFile::Section>& sections) {}
+
 void DBMatOffline::printMatrix() {
   if (isDecomposed) {
-    std::cout << "Size: " << lhsMatrix.getNrows() << " , " << lhsMatrix.getNcols() << "\n"
-              << lhsMatrix.toString();
+    DataMatrix printedMatrix;
+    if (decompositionFile) {
+      decompositionFile->copyMatrix(0, printedMatrix);
+    }
+    const DataMatrix& matrix = decompositionFile ? printedMatrix : lhsMatrix;
+    std::cout << "Size: " << matrix.getNrows() << " , " << matrix.getNcols() << "\n"
+              << matrix.toString();
   } else {
     throw data_exception("Matrix was not decomposed yet");
   }
@@ -221,9 +223,14 @@ void sgpp::datadriven::DBMatOffline::parseInter(
   std::cout << interactions.size() << std::endl;
 }
 
-size_t DBMatOffline::getGridSize() { return lhsMatrix.getNrows(); }
+size_t DBMatOffline::getGridSize() {
+  return decompositionFile ? decompositionFile->getRows(0) : lhsMatrix.getNrows();
+}
 
-sgpp::base::DataMatrix& DBMatOffline::getLhsMatrix_ONLY_FOR_TESTING() { return this->lhsMatrix; }
+sgpp::base::DataMatrix& DBMatOffline::getLhsMatrix_ONLY_FOR_TESTING() {
+  detachFromFile();
+  return this->lhsMatrix;
+}
 
 }  // namespace datadriven
 } // namespace sgpp
@@ -6,6 +6,8 @@
 #pragma once
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDecompositionFile.hpp>
+#include <sgpp/datadriven/algorithm/DBMatMatrixView.hpp>
 #include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
 #include <sgpp/datadriven/configuration/ParallelConfiguration.hpp>
 #include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
@@ -39,7 +41,10 @@ class DBMatOffline {
  public:
   /**
    * Constructor
-   * Create offline object from serialized offline object
+   * Create offline object from serialized offline object. Files in the binary
+   * DBMatDecompositionFile format are mapped once and the decomposition is used in place: it is
+   * only copied into private memory when it is modified (e.g. refined) for the first time. Copies
+   * and clones of the object share the mapping.
    *
    * @param fileName path to the file that stores serialized offline object
    */
@@ -87,11 +92,22 @@ class DBMatOffline {
 
   /**
    * Get a reference to the decomposed matrix. Throws if matrix has not yet been decomposed.
+   * As the reference allows modifications, a mapped decomposition is copied into private memory
+   * first; use getDecomposedMatrixView() for read-only access.
    *
    * @return decomposed matrix
    */
   DataMatrix& getDecomposedMatrix();
 
+  /**
+   * Get a read-only view of the decomposed matrix, which refers to the mapped decomposition file
+   * if the object was loaded from one. Throws if matrix has not yet been decomposed. The view is
+   * valid until the decomposition is modified or this object is destroyed.
+   *
+   * @return view of the decomposed matrix
+   */
+  DBMatMatrixView getDecomposedMatrixView() const;
+
   /**
    * Get a reference to the distributed decomposed matrix. Throws if matrix has not yet been
    * decomposed. In order to return valid data, syncDistributedDecomposition() has to be called if
@@ -144,7 +160,9 @@ class DBMatOffline {
   void compute_L2_refine_vectors(DataMatrix* mat_refine, Grid* grid, size_t newPoints);
 
   /**
-   * Serialize the DBMatOffline Object
+   * Serialize the DBMatOffline Object into the binary DBMatDecompositionFile format, which can
+   * be memory mapped by the processes loading it. Subclasses add further matrices through
+   * appendStoredSections.
    * @param fileName path where to store the file.
    */
   virtual void store(const std::string& fileName);
@@ -170,18 +188,44 @@ class DBMatOffline {
   // distributed lhs, only initialized in ScaLAPACK version
   DataMatrixDistributed lhsDistributed;
 
+  // mapping of the decomposition file this object was loaded from, shared by all copies. While it
+  // is set, the decomposition is read from the mapping and lhsMatrix (as well as the matrices of
+  // subclasses stored in further sections) is empty.
+  std::shared_ptr<const DBMatDecompositionFile> decompositionFile;
+
  public:
   // vector of interactions (if size() == 0: a regular SG is created)
   std::vector<std::vector<size_t>> interactions;
 
  protected:
   /**
-   * Read the Interactionsterms from a serialized DBMatOfflibe object.
+   * Read the Interactionsterms from a DBMatOffline object serialized in the legacy text format.
    * @param fileName path of the serialized DBMatOffline object
    * @param interactions the interactions to populate
    */
   void parseInter(const std::string& fileName,
                   std::vector<std::vector<size_t>>& interactions) const;
+
+  /**
+   * Adds the decomposition specific data following the lhsMatrix (which is always section 0) to
+   * the sections written by store. The subclass constructor that loads from file reads them back
+   * in the same order.
+   * @param sections the sections to append to
+   */
+  virtual void appendStoredSections(std::vector<DBMatDecompositionFile::Section>& sections);
+
+  /**
+   * Copies the mapped decomposition into private memory and releases this object's reference to
+   * the mapping. Has to be called before the decomposition is modified, does nothing if the
+   * object does not use a mapping.
+   */
+  void detachFromFile();
+
+  /**
+   * Copies the sections of decompositionFile into the members, in the order written by store.
+   * Subclasses that store further sections extend this.
+   */
+  virtual void copyMappedSections();
 };
 
 }  // namespace datadriven
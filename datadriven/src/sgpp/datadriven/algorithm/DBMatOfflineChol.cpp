@@ -86,6 +86,8 @@ void DBMatOfflineChol::choleskyModification(Grid& grid, datadriven::DensityEstim
                                             size_t newPoints, std::list<size_t> deletedPoints,
                                             double lambda) {
 #ifdef USE_GSL
+  // the factor is modified in place, so a mapped factor has to be copied first
+  detachFromFile();
 
   // Start coarsening
   // If list 'deletedPoints' is not empty, grid points got removed
@@ -142,15 +144,11 @@ void DBMatOfflineChol::choleskyModification(Grid& grid, datadriven::DensityEstim
       // for necessary rank one updates
       lhsMatrix.resizeToSubMatrix(coarseCount_1 + 1, coarseCount_1 + 1, lhsMatrix.getNrows(),
                                   lhsMatrix.getNrows());
-      DataVector temp_col(update_matrix.getNrows());
 
-      // 'coarseCount_1' many rank one updates based on the columns of
-      // 'update_matrix' are performed
+      // One blocked rank 'coarseCount_1' update based on the columns of
+      // 'update_matrix' is performed
       DBMatDMSChol cholsolver;
-      for (size_t i = 0; i < coarseCount_1; i++) {
-        update_matrix.getColumn(i, temp_col);
-        cholsolver.choleskyUpdate(lhsMatrix, temp_col, false);
-      }
+      cholsolver.choleskyBlockUpdate(lhsMatrix, update_matrix);
     } else {
       // If no indices have been less than 'c'
       lhsMatrix.resizeQuadratic(old_size - coarseCount_2);
@@ -174,19 +172,12 @@ void DBMatOfflineChol::choleskyModification(Grid& grid, datadriven::DensityEstim
 
     // std::cout << "mat_refine:\n" << mat_refine.toString() << "\n\n";
 
-    // Resize Cholesky factor to new 'gridSize' before 'choleskyAddPoint' is
-    // applied
-    // in order to save runtime
+    // Resize Cholesky factor to new 'gridSize' before the new points are added
     this->lhsMatrix.resizeQuadratic(gridSize);
 
-    // Now its time to call 'choleskyAddPoint''countNewGridPoints' often
-    DataVector temp_col = DataVector(gridSize);
-    for (size_t j = gridSize - newPoints; j < gridSize; j++) {
-      temp_col.resizeZero(gridSize);
-      mat_refine.getColumn(j - gridSize + newPoints, temp_col);
-      temp_col.resizeZero(j + 1);
-      choleskyAddPoint(temp_col, j);
-    }
+    // Add all 'newPoints' rows/columns at once
+    DBMatDMSChol cholsolver;
+    cholsolver.choleskyBlockAddPoints(lhsMatrix, mat_refine, gridSize - newPoints);
   }
 #else
   throw algorithm_exception("built without GSL");
@@ -199,6 +190,7 @@ void DBMatOfflineChol::choleskyAddPoint(DataVector& newCol, size_t size) {
     throw algorithm_exception("Matrix was not decomposed, yet!");
   }
 
+  detachFromFile();
   DataMatrix& mat = lhsMatrix;
   // Size of provided memory for Cholesky factor,
   // because the allocations take place in 'choleskyModifications'
@@ -264,6 +256,7 @@ void DBMatOfflineChol::choleskyPermutation(size_t k, size_t l, size_t job) {
     throw algorithm_exception("Matrix was not decomposed, yet!");
   }
 
+  detachFromFile();
   DataMatrix& mat = lhsMatrix;
   size_t size = mat.getNrows();
 
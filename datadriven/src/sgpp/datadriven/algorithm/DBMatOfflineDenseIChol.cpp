@@ -65,6 +65,9 @@ void DBMatOfflineDenseIChol::choleskyModification(Grid& grid,
     datadriven::DensityEstimationConfiguration& densityEstimationConfig, size_t newPoints,
     std::list<size_t> deletedPoints, double lambda) {
   if (newPoints > 0) {
+    // the factor is modified in place, so a mapped factor has to be copied first
+    detachFromFile();
+
     //    auto begin = std::chrono::high_resolution_clock::now();
 
     size_t gridSize = grid.getSize();
@@ -40,6 +40,11 @@ DBMatOfflineEigen::DBMatOfflineEigen() {}
 
 sgpp::datadriven::DBMatOfflineEigen::DBMatOfflineEigen(const std::string& fileName)
     : DBMatOffline{fileName} {
+  // Binary decomposition files are completely loaded by the DBMatOffline constructor
+  if (decompositionFile) {
+    return;
+  }
+
   // Read grid size from header (number of rows in lhsMatrix)
   std::ifstream filestream(fileName, std::istream::in);
   // Read configuration
@@ -12,6 +12,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
 
 #include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDecompositionFile.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineDenseIChol.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineEigen.hpp>
@@ -80,27 +81,28 @@ DBMatOffline* DBMatOfflineFactory::buildOfflineObject(
 
 DBMatOffline* DBMatOfflineFactory::buildFromFile(const std::string& fileName) {
 #ifdef USE_GSL
-  std::ifstream file(fileName, std::istream::in);
-
-  if (!file) {
-    throw factory_exception("Failed to open File");
+  MatrixDecompositionType type;
+  if (DBMatDecompositionFile::isDecompositionFile(fileName)) {
+    type = DBMatDecompositionFile(fileName).getDecompositionType();
+  } else {
+    // Legacy format: the type is the third token of the text header
+    std::ifstream file(fileName, std::istream::in);
+    if (!file) {
+      throw factory_exception("Failed to open File");
+    }
+
+    std::string str;
+    std::getline(file, str);
+    file.close();
+
+    std::vector<std::string> tokens;
+    StringTokenizer::tokenize(str, ",", tokens);
+    if (tokens.size() < 3) {
+      throw factory_exception("Invalid header of serialized offline object");
+    }
+    type = static_cast<MatrixDecompositionType>(std::stoi(tokens[2]));
   }
 
-  std::string str;
-  std::getline(file, str);
-  file.close();
-
-  std::cout << str;
-  std::vector<std::string> tokens;
-  StringTokenizer::tokenize(str, ",", tokens);
-  std::cout << "tokens: ";
-  for (auto& item : tokens) {
-    std::cout << item << ",";
-  }
-  std::cout << std::endl;
-
-  MatrixDecompositionType type = static_cast<MatrixDecompositionType>(std::stoi(tokens[2]));
-
   std::cout << "type: " << static_cast<int>(type) << std::endl;
 
   switch (type) {
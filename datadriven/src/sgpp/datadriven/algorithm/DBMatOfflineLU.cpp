@@ -36,14 +36,14 @@ DBMatOfflineLU::DBMatOfflineLU() : DBMatOfflineGE{}, permutation{nullptr} {}
 
 DBMatOfflineLU::DBMatOfflineLU(const DBMatOfflineLU& rhs)
     : DBMatOfflineGE(rhs), permutation(nullptr) {
-  size_t gridSize = rhs.lhsMatrix.getNrows();
+  size_t gridSize = rhs.permutation->size;
   permutation =
       std::unique_ptr<gsl_permutation>{gsl_permutation_alloc(gridSize)};
   gsl_permutation_memcpy(permutation.get(), rhs.permutation.get());
 }
 
 DBMatOfflineLU& DBMatOfflineLU::operator=(const DBMatOfflineLU& rhs) {
-  size_t gridSize = rhs.lhsMatrix.getNrows();
+  size_t gridSize = rhs.permutation->size;
   DBMatOffline::operator=(rhs);
   permutation =
       std::unique_ptr<gsl_permutation>{gsl_permutation_alloc(gridSize)};
@@ -80,53 +80,34 @@ void DBMatOfflineLU::decomposeMatrix(RegularizationConfiguration& regularization
 }
 
 DBMatOfflineLU::DBMatOfflineLU(const std::string& fileName)
-    : DBMatOfflineGE(), permutation{nullptr} {
-  isConstructed = true;
-  isDecomposed = true;
-
-  // Read grid size from header (number of rows in lhsMatrix)
-  std::ifstream filestream(fileName, std::istream::in);
-  // Read configuration
-  if (!filestream) {
-    throw algorithm_exception("Failed to open File");
-  }
-  std::string str;
-  std::getline(filestream, str);
-  filestream.close();
-
-  std::vector<std::string> tokens;
-  StringTokenizer::tokenize(str, ",", tokens);
+    : DBMatOfflineGE{fileName}, permutation{nullptr} {
+  // lhsMatrix was already read by the super constructors, only the permutation is left
+  size_t size = getGridSize();
+  permutation = std::unique_ptr<gsl_permutation>{gsl_permutation_alloc(size)};
 
-  auto size = std::stoi(tokens[0]);
+  if (decompositionFile) {
+    decompositionFile->copyIndices(1, permutation->data);
+    return;
+  }
 
   FILE* file = fopen(fileName.c_str(), "rb");
   if (!file) {
     throw algorithm_exception{"Failed to open File"};
   }
 
-  // seek end of first line
+  // seek end of first line and skip the matrix
   char c = 0;
   while (c != '\n') {
     c = static_cast<char>(fgetc(file));
   }
-
-  // TODO(lettrich) : test if we can do this without copying.
-  // Read matrix
-  gsl_matrix* matrix;
-  matrix = gsl_matrix_alloc(size, size);
-  gsl_matrix_fread(file, matrix);
+  fseek(file, static_cast<long>(size * size * sizeof(double)), SEEK_CUR);  // NOLINT(runtime/int)
 
   // read permutation
-  permutation = std::unique_ptr<gsl_permutation>{gsl_permutation_alloc(size)};
   gsl_permutation_fread(file, permutation.get());
 
   fclose(file);
-
-  lhsMatrix = DataMatrix(matrix->data, matrix->size1, matrix->size2);
-  gsl_matrix_free(matrix);
 }
 
-
 void DBMatOfflineLU::permuteVector(DataVector& b) {
   if (isDecomposed) {
     gsl_permute(permutation->data, b.getPointer(), 1, b.getSize());
@@ -135,17 +116,9 @@ void DBMatOfflineLU::permuteVector(DataVector& b) {
   }
 }
 
-void DBMatOfflineLU::store(const std::string& fileName) {
-  // first store header and matrix
-  DBMatOffline::store(fileName);
-  // then store permutation.
-  // c file API needed for GSL
-  FILE* outputCFile = fopen(fileName.c_str(), "ab");
-  if (!outputCFile) {
-    throw algorithm_exception{"cannot open file for writing"};
-  }
-  gsl_permutation_fwrite(outputCFile, permutation.get());
-  fclose(outputCFile);
+void DBMatOfflineLU::appendStoredSections(
+    std::vector<DBMatDecompositionFile::Section>& sections) {
+  sections.push_back({permutation->data, permutation->size, 1, sizeof(size_t)});
 }
 
 sgpp::datadriven::MatrixDecompositionType DBMatOfflineLU::getDecompositionType() {
@@ -17,6 +17,7 @@
 #include <gsl/gsl_permutation.h>
 
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -71,7 +72,12 @@ class DBMatOfflineLU : public DBMatOfflineGE {
    */
   void permuteVector(DataVector& b);
 
-  void store(const std::string& fname) override;
+ protected:
+  /**
+   * Stores the permutation after the LU factors
+   * @param sections the sections to append to
+   */
+  void appendStoredSections(std::vector<DBMatDecompositionFile::Section>& sections) override;
 
  private:
   /**
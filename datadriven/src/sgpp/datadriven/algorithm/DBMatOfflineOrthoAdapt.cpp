@@ -27,6 +27,11 @@ DBMatOfflineOrthoAdapt::DBMatOfflineOrthoAdapt() : DBMatOffline() {
 
 DBMatOfflineOrthoAdapt::DBMatOfflineOrthoAdapt(const std::string& fileName)
     : DBMatOffline(fileName) {
+  if (decompositionFile) {
+    // Q and T_inv are used in place from the mapping of the super constructor
+    return;
+  }
+
   // Read grid size from header (number of rows in lhsMatrix)
   std::ifstream filestream(fileName, std::istream::in);
   // Read configuration
@@ -85,6 +90,7 @@ bool DBMatOfflineOrthoAdapt::isRefineable() { return true; }
 
 void DBMatOfflineOrthoAdapt::buildMatrix(Grid* grid,
                                          RegularizationConfiguration& regularizationConfig) {
+  detachFromFile();
   DBMatOffline::buildMatrix(grid, regularizationConfig);
   size_t dim_a = grid->getStorage().getSize();
 
@@ -96,6 +102,7 @@ void DBMatOfflineOrthoAdapt::decomposeMatrix(
     RegularizationConfiguration& regularizationConfig,
     DensityEstimationConfiguration& densityEstimationConfig) {
 #ifdef USE_GSL
+  detachFromFile();
   size_t dim_a = lhsMatrix.getNrows();
   // allocating subdiagonal and diagonal vectors of T
   sgpp::base::DataVector diag(dim_a);
@@ -163,40 +170,33 @@ void DBMatOfflineOrthoAdapt::invert_symmetric_tridiag(sgpp::base::DataVector& di
 #endif /* USE_GSL */
 }
 
-void DBMatOfflineOrthoAdapt::store(const std::string& fileName) {
-#ifdef USE_GSL
-  DBMatOffline::store(fileName);
-
-  FILE* outCFile = fopen(fileName.c_str(), "ab");
-  if (!outCFile) {
-    throw sgpp::base::algorithm_exception{"cannot open file for writing"};
-  }
-
-  auto dim_a = getGridSize();
-  // store q_ortho_matrix_
-  gsl_matrix_view q_view = gsl_matrix_view_array(this->q_ortho_matrix_.getPointer(), dim_a, dim_a);
-  gsl_matrix_fwrite(outCFile, &q_view.matrix);
-
-  // store t_inv_tridiag_
-  gsl_matrix_view t_inv_view =
-      gsl_matrix_view_array(this->t_tridiag_inv_matrix_.getPointer(), dim_a, dim_a);
-  gsl_matrix_fwrite(outCFile, &t_inv_view.matrix);
+void DBMatOfflineOrthoAdapt::appendStoredSections(
+    std::vector<DBMatDecompositionFile::Section>& sections) {
+  DBMatMatrixView qView = getQView();
+  DBMatMatrixView tInvView = getTinvView();
+  sections.push_back({qView.getPointer(), qView.getNrows(), qView.getNcols(), sizeof(double)});
+  sections.push_back(
+      {tInvView.getPointer(), tInvView.getNrows(), tInvView.getNcols(), sizeof(double)});
+}
 
-  fclose(outCFile);
-#endif /* USE_GSL */
+void DBMatOfflineOrthoAdapt::copyMappedSections() {
+  DBMatOffline::copyMappedSections();
+  decompositionFile->copyMatrix(1, this->q_ortho_matrix_);
+  decompositionFile->copyMatrix(2, this->t_tridiag_inv_matrix_);
 }
 
 void DBMatOfflineOrthoAdapt::syncDistributedDecomposition(
     std::shared_ptr<BlacsProcessGrid> processGrid, const ParallelConfiguration& parallelConfig) {
 #ifdef USE_SCALAPACK
+  DBMatMatrixView qView = getQView();
   q_ortho_matrix_distributed_ = DataMatrixDistributed::fromSharedData(
-      q_ortho_matrix_.data(), processGrid, q_ortho_matrix_.getNrows(), q_ortho_matrix_.getNcols(),
+      qView.getPointer(), processGrid, qView.getNrows(), qView.getNcols(),
       parallelConfig.rowBlockSize_, parallelConfig.columnBlockSize_);
 
+  DBMatMatrixView tInvView = getTinvView();
   t_tridiag_inv_matrix_distributed_ = DataMatrixDistributed::fromSharedData(
-      t_tridiag_inv_matrix_.data(), processGrid, t_tridiag_inv_matrix_.getNrows(),
-      t_tridiag_inv_matrix_.getNcols(), parallelConfig.rowBlockSize_,
-      parallelConfig.columnBlockSize_);
+      tInvView.getPointer(), processGrid, tInvView.getNrows(), tInvView.getNcols(),
+      parallelConfig.rowBlockSize_, parallelConfig.columnBlockSize_);
 #endif
   // no action needed without scalapack
 }
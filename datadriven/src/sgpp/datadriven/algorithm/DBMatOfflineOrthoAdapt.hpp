@@ -9,6 +9,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOffline.hpp>
 
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -77,32 +78,64 @@ class DBMatOfflineOrthoAdapt : public DBMatOffline {
    */
   void invert_symmetric_tridiag(sgpp::base::DataVector& diag, sgpp::base::DataVector& subdiag);
 
-  /**
-   * Serializes the DBMatOfflineOrthoAdapt object
-   *
-   * q_ortho_matrix_ and t_inv_tridiag_ are stored into the specified file,
-   * which is the explicit representation of the decomposition needed for the
-   * online phase
-   *
-   * @param fileName path where to store the file
-   */
-  void store(const std::string& fileName);
-
   /**
    * Override to sync Q and Tinv
    */
   void syncDistributedDecomposition(std::shared_ptr<BlacsProcessGrid> processGrid,
                                     const ParallelConfiguration& parallelConfig) override;
 
-  sgpp::base::DataMatrix& getQ() { return this->q_ortho_matrix_; }
+  /**
+   * @return modifiable Q, a mapped decomposition is copied into private memory first
+   */
+  sgpp::base::DataMatrix& getQ() {
+    detachFromFile();
+    return this->q_ortho_matrix_;
+  }
+
+  /**
+   * @return modifiable T_inv, a mapped decomposition is copied into private memory first
+   */
+  sgpp::base::DataMatrix& getTinv() {
+    detachFromFile();
+    return this->t_tridiag_inv_matrix_;
+  }
+
+  /**
+   * @return read-only view of Q, which refers to the mapped decomposition file if the object was
+   * loaded from one
+   */
+  DBMatMatrixView getQView() const {
+    return decompositionFile ? decompositionFile->getMatrixView(1)
+                             : DBMatMatrixView(this->q_ortho_matrix_);
+  }
 
-  sgpp::base::DataMatrix& getTinv() { return this->t_tridiag_inv_matrix_; }
+  /**
+   * @return read-only view of T_inv, which refers to the mapped decomposition file if the object
+   * was loaded from one
+   */
+  DBMatMatrixView getTinvView() const {
+    return decompositionFile ? decompositionFile->getMatrixView(2)
+                             : DBMatMatrixView(this->t_tridiag_inv_matrix_);
+  }
 
   DataMatrixDistributed& getQDistributed() { return this->q_ortho_matrix_distributed_; }
 
   DataMatrixDistributed& getTinvDistributed() { return this->t_tridiag_inv_matrix_distributed_; }
 
  protected:
+  /**
+   * q_ortho_matrix_ and t_inv_tridiag_ are stored after the lhsMatrix, which is the explicit
+   * representation of the decomposition needed for the online phase
+   *
+   * @param sections the sections to append to
+   */
+  void appendStoredSections(std::vector<DBMatDecompositionFile::Section>& sections) override;
+
+  /**
+   * Copies Q and T_inv from the mapping in addition to the lhsMatrix
+   */
+  void copyMappedSections() override;
+
   sgpp::base::DataMatrix q_ortho_matrix_;        // orthogonal matrix of decomposition
   sgpp::base::DataMatrix t_tridiag_inv_matrix_;  // inverse of the tridiag matrix of decomposition
 
@@ -54,8 +54,21 @@ void DBMatOnlineDE::updateRhs(size_t gridSize, std::list<size_t>* deletedPoints)
     if (deletedPoints != nullptr && deletedPoints->size() > 0) {
       std::vector<size_t> idxToDelete{std::begin(*deletedPoints), std::end(*deletedPoints)};
       if (localVectorsInitialized) {
-        bSave.remove(idxToDelete);
-        bTotalPoints.remove(idxToDelete);
+        // Compact both vectors in place with one shared mask instead of rebuilding them
+        std::vector<bool> willBeRemoved(bSave.size(), false);
+        for (size_t idx : idxToDelete) {
+          willBeRemoved[idx] = true;
+        }
+        size_t kept = 0;
+        for (size_t i = 0; i < bSave.size(); i++) {
+          if (!willBeRemoved[i]) {
+            bSave[kept] = bSave[i];
+            bTotalPoints[kept] = bTotalPoints[i];
+            kept++;
+          }
+        }
+        bSave.resizeZero(kept);
+        bTotalPoints.resizeZero(kept);
       }
 
       if (distributedVectorsInitialized) {
@@ -114,14 +127,14 @@ void DBMatOnlineDE::computeDensityFunction(DataVector& alpha, DataMatrix& m, Gri
 
   if (!localVectorsInitialized) {
     // init bsave and bTotalPoints only here, as they are not needed in the parallel version
-    bSave = DataVector(offlineObject.getDecomposedMatrix().getNcols(), 0.0);
-    bTotalPoints = DataVector(offlineObject.getDecomposedMatrix().getNcols(), 0.0);
+    bSave = DataVector(offlineObject.getDecomposedMatrixView().getNcols(), 0.0);
+    bTotalPoints = DataVector(offlineObject.getDecomposedMatrixView().getNcols(), 0.0);
 
     localVectorsInitialized = true;
   }
 
   if (m.getNrows() > 0) {
-    DataMatrix& lhsMatrix = offlineObject.getDecomposedMatrix();
+    DBMatMatrixView lhsMatrix = offlineObject.getDecomposedMatrixView();
 
     // in case OrthoAdapt, the current size is not lhs size, but B size
     bool use_B_size = false;
@@ -228,15 +241,17 @@ void DBMatOnlineDE::computeDensityFunctionParallel(
     // init bSaveDistributed and bTotalPointsDistributed only here, as they are not needed in the
     // local version
     bSaveDistributed = std::make_unique<DataVectorDistributed>(
-        processGrid, offlineObject.getDecomposedMatrix().getNcols(), parallelConfig.rowBlockSize_);
+        processGrid, offlineObject.getDecomposedMatrixView().getNcols(),
+        parallelConfig.rowBlockSize_);
     bTotalPointsDistributed = std::make_unique<DataVectorDistributed>(
-        processGrid, offlineObject.getDecomposedMatrix().getNcols(), parallelConfig.rowBlockSize_);
+        processGrid, offlineObject.getDecomposedMatrixView().getNcols(),
+        parallelConfig.rowBlockSize_);
 
     distributedVectorsInitialized = true;
   }
 
   if (m.getNrows() > 0) {
-    DataMatrix& lhsMatrix = offlineObject.getDecomposedMatrix();
+    DBMatMatrixView lhsMatrix = offlineObject.getDecomposedMatrixView();
 
     // in case OrthoAdapt, the current size is not lhs size, but B size
     bool use_B_size = false;
@@ -30,7 +30,7 @@ DBMatOnlineDEChol::DBMatOnlineDEChol(DBMatOffline& offline, Grid& grid, double l
 void DBMatOnlineDEChol::solveSLE(DataVector& alpha, DataVector& b, Grid& grid,
                                  DensityEstimationConfiguration& densityEstimationConfig,
                                  bool do_cv) {
-  DataMatrix& lhsMatrix = offlineObject.getDecomposedMatrix();
+  DBMatMatrixView lhsMatrix = offlineObject.getDecomposedMatrixView();
   alpha.resizeZero(lhsMatrix.getNcols());
 
   auto cholsolver = std::unique_ptr<DBMatDMSChol>{
@@ -38,7 +38,7 @@ void DBMatOnlineDEChol::solveSLE(DataVector& alpha, DataVector& b, Grid& grid,
 
   // Solve for density declaring coefficients alpha
   // std::cout << "lambda: " << lambda << std::endl;
-  cholsolver->solve(lhsMatrix, alpha, b, lambda, lambda);
+  cholsolver->solve(lhsMatrix, alpha, b);
 
   //  DBMatDMSChol myCholSolver;
   //  DataVector myAlpha{alpha.getSize()};
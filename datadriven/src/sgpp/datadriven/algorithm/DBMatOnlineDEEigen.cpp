@@ -23,7 +23,7 @@ DBMatOnlineDEEigen::DBMatOnlineDEEigen(DBMatOffline& offline, Grid& grid, double
 
 void DBMatOnlineDEEigen::solveSLE(DataVector& alpha, DataVector& b, Grid& grid,
     DensityEstimationConfiguration& densityEstimationConfig, bool do_cv) {
-  DataMatrix& lhsMatrix = offlineObject.getDecomposedMatrix();
+  DBMatMatrixView lhsMatrix = offlineObject.getDecomposedMatrixView();
 
   // Solve the system:
   alpha.resizeZero(lhsMatrix.getNcols());
@@ -26,7 +26,7 @@ sgpp::datadriven::DBMatOnlineDELU::DBMatOnlineDELU(DBMatOffline& offline, Grid&
 
 void sgpp::datadriven::DBMatOnlineDELU::solveSLE(DataVector& alpha, DataVector& b, Grid& grid,
     DensityEstimationConfiguration& densityEstimationConfig, bool do_cv) {
-  DataMatrix& lhsMatrix = offlineObject.getDecomposedMatrix();
+  DBMatMatrixView lhsMatrix = offlineObject.getDecomposedMatrixView();
 
   // Solve the system:
   alpha = DataVector(lhsMatrix.getNcols());
@@ -90,7 +90,7 @@ void DBMatOnlineDEOrthoAdapt::solveSLE(DataVector& alpha, DataVector& b, Grid& g
   sgpp::datadriven::DBMatDMSOrthoAdapt* solver = new sgpp::datadriven::DBMatDMSOrthoAdapt();
   // solve the created system
   alpha.resizeZero(b.getSize());
-  solver->solve(offline->getTinv(), offline->getQ(), this->getB(), b, alpha);
+  solver->solve(offline->getTinvView(), offline->getQView(), this->getB(), b, alpha);
 
   free(solver);
 }
@@ -181,11 +181,14 @@ void DBMatOnlineDEOrthoAdapt::sherman_morrison_adapt(size_t newPoints, bool refi
     size_t unit_index = refine ? current_size - 1 : coarsenIndices[k];
 
     // view of T^{-1} of the offline object
-    gsl_matrix_view t_inv_view =
-        gsl_matrix_view_array(offlinePtr->getTinv().getPointer(), dima, dima);
+    DBMatMatrixView t_inv = offlinePtr->getTinvView();
+    gsl_matrix_const_view t_inv_view =
+        gsl_matrix_const_view_array_with_tda(t_inv.getPointer(), dima, dima, t_inv.getStride());
 
     // view of Q of the offline object
-    gsl_matrix_view q_view = gsl_matrix_view_array(offlinePtr->getQ().getPointer(), dima, dima);
+    DBMatMatrixView q = offlinePtr->getQView();
+    gsl_matrix_const_view q_view =
+        gsl_matrix_const_view_array_with_tda(q.getPointer(), dima, dima, q.getStride());
 
     // view of B of the online object, which holds all information of refinement/coarsening
     gsl_matrix_view b_adapt_view =
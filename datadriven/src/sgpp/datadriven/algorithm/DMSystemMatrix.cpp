@@ -7,6 +7,8 @@
 #include <sgpp/base/exception/operation_exception.hpp>
 // #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationDiagonal.hpp>
+#include <sgpp/base/operation/hash/OperationIdentity.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -73,6 +75,21 @@ void DMSystemMatrix::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector&
   result.axpy(static_cast<double>(M) * this->lambda_, temptwo);
 }
 
+void DMSystemMatrix::mult(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result) {
+  size_t M = this->dataset_.getNrows();
+
+  std::unique_ptr<base::OperationMultipleEval> op(
+      sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
+  sgpp::base::DataMatrix temp(M, alpha.getNcols());
+  op->mult(alpha, temp);
+  op->multTranspose(temp, result);
+
+  sgpp::base::DataMatrix temptwo(alpha.getNrows(), alpha.getNcols());
+  this->C->mult(alpha, temptwo);
+  temptwo.mult(static_cast<double>(M) * this->lambda_);
+  result.add(temptwo);
+}
+
 void DMSystemMatrix::generateb(sgpp::base::DataVector& classes, sgpp::base::DataVector& b) {
   // this->B->multTranspose((*this->dataset_), classes, b);
   // this->B->multTranspose(classes, b);
@@ -82,5 +99,28 @@ void DMSystemMatrix::generateb(sgpp::base::DataVector& classes, sgpp::base::Data
   op->multTranspose(classes, b);
 }
 
+void DMSystemMatrix::generateb(sgpp::base::DataMatrix& targets, sgpp::base::DataMatrix& b) {
+  std::unique_ptr<base::OperationMultipleEval> op(
+      sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
+  op->multTranspose(targets, b);
+}
+
+void DMSystemMatrix::getDiagonal(sgpp::base::DataVector& diagonal) {
+  if ((dynamic_cast<base::OperationIdentity*>(C.get()) == nullptr) &&
+      (dynamic_cast<base::OperationDiagonal*>(C.get()) == nullptr)) {
+    throw base::operation_exception(
+        "DMSystemMatrix::getDiagonal: regularization operator has to be diagonal");
+  }
+
+  size_t M = this->dataset_.getNrows();
+  computeDataDiagonal(grid, M, diagonal);
+
+  // the regularization operator is diagonal, so applying it to ones yields its diagonal
+  sgpp::base::DataVector ones(diagonal.getSize(), 1.0);
+  sgpp::base::DataVector regularizationDiagonal(diagonal.getSize());
+  this->C->mult(ones, regularizationDiagonal);
+  diagonal.axpy(static_cast<double>(M) * this->lambda_, regularizationDiagonal);
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
@@ -52,6 +52,15 @@ class DMSystemMatrix : public DMSystemMatrixBase {
 
   virtual void mult(base::DataVector& alpha, base::DataVector& result);
 
+  /**
+   * Multiplication with several coefficient vectors at once, which traverses the data set
+   * only once for all columns.
+   *
+   * @param alpha matrix whose columns are the coefficient vectors
+   * @param result matrix into which the results are stored column-wise
+   */
+  void mult(base::DataMatrix& alpha, base::DataMatrix& result) override;
+
   /**
    * Generates the right hand side of the classification equation
    *
@@ -60,6 +69,24 @@ class DMSystemMatrix : public DMSystemMatrixBase {
    *   multiplication on the rhs
    */
   virtual void generateb(base::DataVector& classes, base::DataVector& b);
+
+  /**
+   * Generates the right hand sides for several target vectors at once
+   * (e.g., for multi-output regression)
+   *
+   * @param targets matrix with one row per data point and one column per target vector
+   * @param b matrix with one row per grid point that will contain the right hand sides
+   */
+  void generateb(base::DataMatrix& targets, base::DataMatrix& b);
+
+  /**
+   * Computes the diagonal of \f$B^T B + M \lambda C\f$.
+   * Only supported if the regularization operator \f$C\f$ is diagonal, i.e.,
+   * sgpp::base::OperationIdentity or sgpp::base::OperationDiagonal.
+   *
+   * @param diagonal vector that will contain the diagonal of the system matrix
+   */
+  void getDiagonal(base::DataVector& diagonal) override;
 };
 
 }  // namespace datadriven
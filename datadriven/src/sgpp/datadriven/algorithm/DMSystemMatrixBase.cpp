@@ -4,6 +4,7 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/datadriven/algorithm/DMSystemMatrixBase.hpp>
+#include <sgpp/base/exception/not_implemented_exception.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -39,5 +40,37 @@ void DMSystemMatrixBase::getTimers(double& timeMult, double& computeMult, double
   computeMultTrans = computeTimeMultTrans_;
 }
 
+void DMSystemMatrixBase::getDiagonal(base::DataVector& diagonal) {
+  throw base::not_implemented_exception(
+      "DMSystemMatrixBase::getDiagonal: system matrix does not provide its diagonal");
+}
+
+void DMSystemMatrixBase::computeDataDiagonal(base::Grid& grid, size_t instances,
+                                             base::DataVector& diagonal) const {
+  base::GridStorage& storage = grid.getStorage();
+  base::SBasis& basis = grid.getBasis();
+  const size_t gridSize = storage.getSize();
+  const size_t dim = storage.getDimension();
+  diagonal.resize(gridSize);
+
+  // the basis is not thread-safe for all grid types (some use internal buffers)
+  for (size_t i = 0; i < gridSize; i++) {
+    const base::GridPoint& point = storage.getPoint(i);
+    double sum = 0.0;
+
+    for (size_t j = 0; j < instances; j++) {
+      double value = 1.0;
+
+      for (size_t t = 0; (t < dim) && (value != 0.0); t++) {
+        value *= basis.eval(point.getLevel(t), point.getIndex(t), dataset_.get(j, t));
+      }
+
+      sum += value * value;
+    }
+
+    diagonal[i] = sum;
+  }
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
@@ -7,6 +7,7 @@
 
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/tools/SGppStopwatch.hpp>
 
@@ -85,6 +86,26 @@ class DMSystemMatrixBase : public base::OperationMatrix {
    */
   virtual void getTimers(double& timeMult, double& computeMult, double& timeMultTrans,
                          double& computeMultTrans);
+
+  /**
+   * Computes the diagonal of the system matrix, e.g., for a Jacobi preconditioner.
+   * Throws if the system matrix does not provide its diagonal.
+   *
+   * @param diagonal vector that will contain the diagonal of the system matrix
+   */
+  virtual void getDiagonal(base::DataVector& diagonal);
+
+ protected:
+  /**
+   * Computes the diagonal of \f$B^T B\f$, i.e., \f$\sum_j \varphi_i(x_j)^2\f$ for every
+   * grid point \f$i\f$. As every basis function is evaluated at every data point, this is
+   * about as expensive as one multiplication with \f$B\f$.
+   *
+   * @param grid      the sparse grid
+   * @param instances number of rows of the dataset to use (i.e., without padding)
+   * @param diagonal  vector that will contain the diagonal
+   */
+  void computeDataDiagonal(base::Grid& grid, size_t instances, base::DataVector& diagonal) const;
 };
 
 }  // namespace datadriven
@@ -57,6 +57,14 @@ void SystemMatrixLeastSquaresIdentity::generateb(base::DataVector& classes, base
 
 void SystemMatrixLeastSquaresIdentity::prepareGrid() { this->B->prepare(); }
 
+void SystemMatrixLeastSquaresIdentity::getDiagonal(base::DataVector& diagonal) {
+  computeDataDiagonal(this->grid, this->instances, diagonal);
+
+  for (size_t i = 0; i < diagonal.getSize(); i++) {
+    diagonal[i] += static_cast<double>(this->instances) * this->lambda_;
+  }
+}
+
 void SystemMatrixLeastSquaresIdentity::setImplementation(
     datadriven::OperationMultipleEvalConfiguration operationConfiguration) {
   this->implementationConfiguration = operationConfiguration;
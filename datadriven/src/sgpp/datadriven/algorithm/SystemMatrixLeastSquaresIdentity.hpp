@@ -70,6 +70,13 @@ class SystemMatrixLeastSquaresIdentity : public datadriven::DMSystemMatrixBase {
 
   virtual void prepareGrid();
 
+  /**
+   * Computes the diagonal of \f$B^T B + M \lambda I\f$.
+   *
+   * @param diagonal vector that will contain the diagonal of the system matrix
+   */
+  void getDiagonal(base::DataVector& diagonal) override;
+
   void setImplementation(datadriven::OperationMultipleEvalConfiguration operationConfiguration);
 };
 
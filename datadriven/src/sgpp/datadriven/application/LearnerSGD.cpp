@@ -5,6 +5,7 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <sgpp/base/algorithm/GetAffectedBasisFunctions.hpp>
 #include <sgpp/base/exception/application_exception.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/grid/generation/functors/ImpurityRefinementIndicator.hpp>
@@ -14,6 +15,8 @@
 #include <sgpp/base/grid/generation/refinement_strategy/PredictiveRefinement.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearModifiedBasis.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitor.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorConvergence.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorPeriodic.hpp>
@@ -22,6 +25,8 @@
 #include <cmath>
 #include <string>
 #include <algorithm>
+#include <utility>
+#include <vector>
 
 using sgpp::base::GridStorage;
 using sgpp::base::HashRefinement;
@@ -33,6 +38,30 @@ using sgpp::base::ImpurityRefinementIndicator;
 namespace sgpp {
 namespace datadriven {
 
+namespace {
+
+/**
+ * Determines the non-zero basis functions at the rows start to end - 1 of data, in parallel.
+ */
+template <class BASIS>
+void getAffectedBasisFunctions(base::GridStorage& storage, base::DataMatrix& data, size_t start,
+                               size_t end,
+                               std::vector<std::vector<std::pair<size_t, double>>>& result) {
+#pragma omp parallel if (end - start > 1)
+  {
+    BASIS basis;
+    base::GetAffectedBasisFunctions<BASIS> getAffected(storage);
+    base::DataVector x(data.getNcols());
+#pragma omp for schedule(static)
+    for (size_t i = start; i < end; i++) {
+      data.getRow(i, x);
+      getAffected(basis, x, result[i - start]);
+    }
+  }
+}
+
+}  // namespace
+
 LearnerSGD::LearnerSGD(base::RegularGridConfiguration& gridConfig,
                        base::AdaptivityConfiguration& adaptivityConfig,
                        base::DataMatrix& pTrainData,
@@ -42,10 +71,14 @@ LearnerSGD::LearnerSGD(base::RegularGridConfiguration& gridConfig,
                        base::DataMatrix* pValData,
                        base::DataVector* pValLabels,
                        double lambda, double gamma,
-                       size_t batchSize, bool useValidData)
+                       size_t batchSize, bool useValidData,
+                       size_t miniBatchSize)
     : grid(nullptr),
       alpha(base::DataVector(0)),
       alphaAvg(base::DataVector(0)),
+      alphaDivisor(1.0),
+      alphaAvgDivisor(1.0),
+      alphaFraction(0.0),
       trainData(pTrainData),
       trainLabels(pTrainLabels),
       testData(pTestData),
@@ -59,7 +92,13 @@ LearnerSGD::LearnerSGD(base::RegularGridConfiguration& gridConfig,
       gamma(gamma),
       currentGamma(gamma),
       batchSize(batchSize),
-      useValidData(useValidData) {
+      useValidData(useValidData),
+      miniBatchSize(miniBatchSize),
+      residuals(base::DataVector(0)) {
+  if (miniBatchSize == 0) {
+    throw base::application_exception(
+        "LearnerSGD::LearnerSGD : mini-batch size has to be positive");
+  }
 
   // if no validation data is provided -> create buffer
   // which contains already processed data points
@@ -89,6 +128,9 @@ void LearnerSGD::initialize() {
   alpha.resize(grid->getSize(), 0.0);
   // vector for averaged surpluses
   alphaAvg.resize(grid->getSize(), 0.0);
+  alphaDivisor = 1.0;
+  alphaAvgDivisor = 1.0;
+  alphaFraction = 0.0;
 }
 
 std::unique_ptr<base::Grid> LearnerSGD::createRegularGrid() {
@@ -138,73 +180,39 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
   double acc = getAccuracy(testData, testLabels, 0.0);
   avgErrors.append(1.0 - acc);
 
-  // parameters for ADAM
-  /*sgpp::base::DataVector m(alpha.getSize(), 0.0);
-  sgpp::base::DataVector v(alpha.getSize(), 0.0);
-  double beta_1 = 0.25;
-  double beta_2 = 0.95;
-  double epsilon = 1e-8;*/
+  // buffers for the current mini-batch
+  affectedBasisFunctions.resize(miniBatchSize);
+  residuals.resize(miniBatchSize);
 
   // counts total number of processed data points
   size_t processedPoints = 0;
   // main loop which performs the learning process
   while (cntDataPasses < maxDataPasses) {
-    for (size_t currIt = 0; currIt < trainData.getNrows(); currIt++) {
-      // get next training sample x and its label y
-      sgpp::base::DataVector x(dim);
-      trainData.getRow(currIt, x);
-      double y = trainLabels.get(currIt);
+    for (size_t start = 0; start < trainData.getNrows(); start += miniBatchSize) {
+      size_t end = std::min(start + miniBatchSize, trainData.getNrows());
+      size_t numSamples = end - start;
 
-      // store data point in batch dataset used for checking
+      // store data points in batch dataset used for checking
       // predictive refinement criterion
       // if validation set is used -> not needed
       if (!useValidData) {
-        pushToBatch(x, y);
+        sgpp::base::DataVector x(dim);
+        for (size_t i = start; i < end; i++) {
+          trainData.getRow(i, x);
+          pushToBatch(x, trainLabels.get(i));
+        }
       }
 
-      sgpp::base::DataVector delta(alpha.getSize());
-
-      sgpp::base::DataVector singleAlpha(1);
-      singleAlpha[0] = 1.0;
-
-      // perform SGD step
-      sgpp::base::DataMatrix dm(x.getPointer(), 1, x.getSize());
-      std::unique_ptr<base::OperationMultipleEval> multEval(
-          op_factory::createOperationMultipleEval(*grid, dm));
-      multEval->multTranspose(singleAlpha, delta);
-
-      double residual = delta.dotProduct(alpha) - y;
-
-      // ADAM
-      // gradient
-      /*delta.mult(residual);
-      delta.axpy(lambda, alpha);
-      sgpp::base::DataVector grad_1(delta);
-      sgpp::base::DataVector grad_2(delta);
-      //update biased first and second moment estimates
-      grad_1.mult(1.0-beta_1);
-      m.mult(beta_1);
-      m.add(grad_1);
-      grad_2.sqr();
-      grad_2.mult(1.0-beta_2);
-      v.mult(beta_2);
-      v.add(grad_2);
-      //update bias-corrected first and second moment estimates
-      //m.mult(1.0/(1.0-std::pow(beta_1,currIt+1)));
-      //v.mult(1.0/(1.0-std::pow(beta_2,currIt+1)));
-      m.mult(1.0/(1.0-std::pow(beta_1,processedPoints+1)));
-      v.mult(1.0/(1.0-std::pow(beta_2,processedPoints+1)));
-      //update alpha
-      v.sqrt();
-      sgpp::base::DataVector eps_vec(alpha.getSize(), epsilon);
-      v.add(eps_vec);
-      m.componentwise_div(v);
-      m.mult(currentGamma);
-      alpha.sub(m);*/
-
-      // SGD
-      alpha.mult(1 - currentGamma * lambda);
-      alpha.axpy(-currentGamma * residual, delta);
+      // smoothing according to L. Bottou
+      size_t t1 = (processedPoints > dim + 1) ? processedPoints - dim : 1;
+      size_t t2 = (processedPoints > trainData.getNrows() + 1)
+                      ? processedPoints - trainData.getNrows()
+                      : 1;
+      double mu = (t1 > t2) ? static_cast<double>(t1) : static_cast<double>(t2);
+      mu = 1.0 / mu;
+
+      // perform (averaged) SGD step
+      sgdStep(start, end, mu);
 
       // learning rate according to L. Bottou
       /*currentGamma =
@@ -215,27 +223,16 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
       currentGamma =
           gamma *
           std::pow(
-              (1 + gamma * lambda * (static_cast<double>(processedPoints) + 1)),
+              (1 + gamma * lambda *
+                       (static_cast<double>(processedPoints + numSamples))),
               -0.75);
 
-      // smoothing according to L. Bottou
-      size_t t1 = (processedPoints > dim + 1) ? processedPoints - dim : 1;
-      size_t t2 = (processedPoints > trainData.getNrows() + 1)
-                      ? processedPoints - trainData.getNrows()
-                      : 1;
-      double mu = (t1 > t2) ? static_cast<double>(t1) : static_cast<double>(t2);
-      mu = 1.0 / mu;
-
-      // average SGD / ADAM
-      alphaAvg.mult(1 - mu);
-      alphaAvg.axpy(mu, alpha);
-
       size_t refinementsNecessary = 0;
       if (refCnt < refNum && processedPoints > 0 && monitor) {
         // check if refinement should be performed
         currentBatchError = getError(*batchData, *batchLabels, "MSE");
         currentTrainError = getError(trainData, trainLabels, "MSE");
-        monitor->pushToBuffer(1, currentBatchError, currentTrainError);
+        monitor->pushToBuffer(numSamples, currentBatchError, currentTrainError);
         refinementsNecessary = monitor->refinementsNecessary();
       }
 
@@ -248,6 +245,7 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
         base::GridStorage& gridStorage = grid->getStorage();
 
         HashRefinement refinement;
+        normalizeCoefficients();
 
         if (refType == "predictive") {
           // predictive refinement based on error contributions
@@ -269,10 +267,6 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
         alpha.resizeZero(grid->getSize());
         alphaAvg.resizeZero(grid->getSize());
 
-        // required for ADAM
-        // m.resizeZero(grid->getSize());
-        // v.resizeZero(grid->getSize());
-
         std::cout << "refinement step: " << refCnt + 1 << std::endl;
         std::cout << "new grid size: " << grid->getSize() << std::endl;
 
@@ -280,16 +274,17 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
         refinementsNecessary--;
       }
 
-      // save current error
-      if ((processedPoints + 1) % 10 == 0) {
+      // save current error after every 10 data points
+      if ((processedPoints + numSamples) / 10 > processedPoints / 10) {
         acc = getAccuracy(testData, testLabels, 0.0);
         avgErrors.append(1.0 - acc);
       }
 
-      processedPoints++;
+      processedPoints += numSamples;
     }
     cntDataPasses++;
   }
+  normalizeCoefficients();
   std::cout << "# Training finished" << std::endl;
   std::cout << "final grid size: " << grid->getSize() << std::endl;
   // double mse = getError(testData, testLabels, "MSE");
@@ -298,6 +293,91 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
   error = 1.0 - getAccuracy(testData, testLabels, 0.0);
 }
 
+void LearnerSGD::sgdStep(size_t start, size_t end, double mu) {
+  size_t numSamples = end - start;
+
+  // residuals of the current coefficients
+  computeAffectedBasisFunctions(start, end);
+#pragma omp parallel for schedule(static) if (numSamples > 1)
+  for (size_t k = 0; k < numSamples; k++) {
+    double value = 0.0;
+    for (const std::pair<size_t, double>& basisFunction : affectedBasisFunctions[k]) {
+      value += alpha[basisFunction.first] * basisFunction.second;
+    }
+    residuals[k] = value / alphaDivisor - trainLabels.get(start + k);
+  }
+
+  // regularization term, the decay of all coefficients is absorbed by the divisor
+  double decay = 1 - currentGamma * lambda;
+  if (decay > 0.0) {
+    alphaDivisor /= decay;
+  } else {
+    normalizeCoefficients();
+    alpha.mult(decay);
+  }
+
+  // loss term, only the coefficients of the non-zero basis functions change; the averaged
+  // coefficients are compensated such that they do not change by this update
+  double* alphaData = alpha.getPointer();
+  double* alphaAvgData = alphaAvg.getPointer();
+  double stepWidth = -currentGamma / static_cast<double>(numSamples) * alphaDivisor;
+  bool compensate = (mu < 1.0 && alphaFraction != 0.0);
+#pragma omp parallel for schedule(static) if (numSamples > 1)
+  for (size_t k = 0; k < numSamples; k++) {
+    double factor = stepWidth * residuals[k];
+    for (const std::pair<size_t, double>& basisFunction : affectedBasisFunctions[k]) {
+      double update = factor * basisFunction.second;
+#pragma omp atomic
+      alphaData[basisFunction.first] += update;
+      if (compensate) {
+#pragma omp atomic
+        alphaAvgData[basisFunction.first] -= alphaFraction * update;
+      }
+    }
+  }
+
+  // average SGD
+  if (mu >= 1.0) {
+    alphaAvg.setAll(0.0);
+    alphaAvgDivisor = alphaDivisor;
+    alphaFraction = 1.0;
+  } else if (mu > 0.0) {
+    alphaAvgDivisor /= (1 - mu);
+    alphaFraction += mu * alphaAvgDivisor / alphaDivisor;
+  }
+
+  // avoid over- and underflow of the scaled coefficients
+  if (alphaDivisor > 1e5 || alphaAvgDivisor > 1e5) {
+    normalizeCoefficients();
+  }
+}
+
+void LearnerSGD::computeAffectedBasisFunctions(size_t start, size_t end) {
+  base::GridStorage& storage = grid->getStorage();
+  if (grid->getType() == base::GridType::Linear) {
+    getAffectedBasisFunctions<base::LinearBasis<unsigned int, unsigned int>>(
+        storage, trainData, start, end, affectedBasisFunctions);
+  } else if (grid->getType() == base::GridType::ModLinear) {
+    getAffectedBasisFunctions<base::LinearModifiedBasis<unsigned int, unsigned int>>(
+        storage, trainData, start, end, affectedBasisFunctions);
+  } else {
+    throw base::application_exception(
+        "LearnerSGD::computeAffectedBasisFunctions : grid type is not supported");
+  }
+}
+
+void LearnerSGD::normalizeCoefficients() {
+  if (alphaDivisor == 1.0 && alphaAvgDivisor == 1.0 && alphaFraction == 0.0) {
+    return;
+  }
+  alphaAvg.axpy(alphaFraction, alpha);
+  alphaAvg.mult(1.0 / alphaAvgDivisor);
+  alpha.mult(1.0 / alphaDivisor);
+  alphaDivisor = 1.0;
+  alphaAvgDivisor = 1.0;
+  alphaFraction = 0.0;
+}
+
 void LearnerSGD::storeResults(base::DataMatrix& testDataset) {
   base::DataVector predictedLabels(testDataset.getNrows());
   predict(testDataset, predictedLabels);
@@ -374,6 +454,7 @@ double LearnerSGD::getError(sgpp::base::DataMatrix& data,
   sgpp::base::DataVector result(numData);
   sgpp::base::DataVector error(numData);
   error.setAll(0.0);
+  normalizeCoefficients();
 
   std::unique_ptr<base::OperationMultipleEval> opEval(
       op_factory::createOperationMultipleEval(*grid, data));
@@ -409,6 +490,7 @@ void LearnerSGD::getBatchError(sgpp::base::DataMatrix& data,
                                const sgpp::base::DataVector& labels) {
   size_t numData = data.getNrows();
   sgpp::base::DataVector result(numData);
+  normalizeCoefficients();
 
   std::unique_ptr<base::OperationMultipleEval> opEval(
       op_factory::createOperationMultipleEval(*grid, data));
@@ -456,6 +538,7 @@ void LearnerSGD::predict(base::DataMatrix& testData,
                          base::DataVector& predictedLabels) {
   predictedLabels.resize(testData.getNrows());
   sgpp::base::DataVector result(testData.getNrows());
+  normalizeCoefficients();
 
   std::unique_ptr<base::OperationMultipleEval> opEval(
       op_factory::createOperationMultipleEval(*grid, testData));
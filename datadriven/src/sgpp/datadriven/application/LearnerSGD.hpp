@@ -12,6 +12,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace sgpp {
@@ -19,6 +20,14 @@ namespace datadriven {
 
 /**
  * LearnerSGD learns the data using stochastic gradient descent.
+ *
+ * Each step only touches the coefficients of the basis functions that are non-zero at the
+ * processed samples. The weight decay of the L2 regularization and the averaging of the
+ * coefficients are applied lazily by keeping both coefficient vectors in a scaled representation
+ * (see L. Bottou, Stochastic Gradient Descent Tricks), which is resolved whenever the
+ * coefficients are used as a whole. Samples can be processed in mini-batches, whose gradient
+ * contributions are computed and added to the coefficients by all threads in parallel without
+ * locking (Hogwild-style).
  */
 
 class LearnerSGD {
@@ -40,6 +49,8 @@ class LearnerSGD {
    *        to compute the error contributions for predictive refinement
    * @param useValidData Specifies if validation data should be used
    *        for all error computations
+   * @param miniBatchSize The number of training samples per SGD step, the gradient is
+   *        averaged over the samples of a mini-batch
    */
   LearnerSGD(base::RegularGridConfiguration& gridConfig,
              base::AdaptivityConfiguration& adaptivityConfig,
@@ -50,7 +61,8 @@ class LearnerSGD {
              base::DataMatrix* pValData,
              base::DataVector* pValLabels,
              double lambda, double gamma,
-             size_t batchSize, bool useValidData);
+             size_t batchSize, bool useValidData,
+             size_t miniBatchSize = 1);
 
   /**
    * Destructor.
@@ -167,9 +179,37 @@ class LearnerSGD {
    */
   void pushToBatch(sgpp::base::DataVector& x, double y);
 
+  /**
+   * Performs one SGD step on a mini-batch of the training data.
+   *
+   * @param start The index of the first sample of the mini-batch
+   * @param end The index after the last sample of the mini-batch
+   * @param mu The weight of the new coefficients in the average
+   */
+  void sgdStep(size_t start, size_t end, double mu);
+
+  /**
+   * Determines the basis functions which are non-zero at the samples of a mini-batch.
+   *
+   * @param start The index of the first sample of the mini-batch
+   * @param end The index after the last sample of the mini-batch
+   */
+  void computeAffectedBasisFunctions(size_t start, size_t end);
+
+  /**
+   * Resolves the scaled representation of the coefficients, afterwards alpha and alphaAvg
+   * contain the actual (averaged) coefficients.
+   */
+  void normalizeCoefficients();
+
   std::unique_ptr<base::Grid> grid;
+  // coefficients, divided by alphaDivisor
   base::DataVector alpha;
+  // averaged coefficients, given by (alphaAvg + alphaFraction * alpha) / alphaAvgDivisor
   base::DataVector alphaAvg;
+  double alphaDivisor;
+  double alphaAvgDivisor;
+  double alphaFraction;
   base::DataMatrix& trainData;
   base::DataVector& trainLabels;
   base::DataMatrix& testData;
@@ -188,6 +228,12 @@ class LearnerSGD {
   size_t batchSize;
 
   bool useValidData;
+
+  size_t miniBatchSize;
+  // non-zero basis functions (sequence number, value) of the samples of the current mini-batch
+  std::vector<std::vector<std::pair<size_t, double>>> affectedBasisFunctions;
+  // residuals of the samples of the current mini-batch
+  base::DataVector residuals;
 };
 
 }  // namespace datadriven
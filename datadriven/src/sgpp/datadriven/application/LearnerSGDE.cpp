@@ -26,7 +26,9 @@
 #include <sgpp/datadriven/operation/hash/simple/OperationCovariance.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 #include <sgpp/solver/TypesSolver.hpp>
+#include <sgpp/solver/sle/BiCGStab.hpp>
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
 
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationDensityMargTo1D.hpp>
@@ -39,6 +41,7 @@
 #include <ctime>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -46,6 +49,31 @@
 namespace sgpp {
 namespace datadriven {
 
+namespace {
+
+/**
+ * @param solverConfig configuration of the solver
+ * @return solver of the configured type for the density system
+ */
+std::unique_ptr<solver::SLESolver> createSolver(
+    const solver::SLESolverConfiguration& solverConfig) {
+  switch (solverConfig.type_) {
+    case solver::SLESolverType::CG:
+      return std::make_unique<solver::ConjugateGradients>(solverConfig.maxIterations_,
+                                                          solverConfig.eps_);
+    case solver::SLESolverType::BiCGSTAB:
+      return std::make_unique<solver::BiCGStab>(solverConfig.maxIterations_, solverConfig.eps_);
+    case solver::SLESolverType::PipelinedCG:
+      return std::make_unique<solver::PipelinedConjugateGradients>(solverConfig.maxIterations_,
+                                                                   solverConfig.eps_);
+    default:
+      throw base::application_exception(
+          "LearnerSGDE: unsupported SLE solver type, use CG, BiCGSTAB or PipelinedCG");
+  }
+}
+
+}  // namespace
+
 // --------------------------------------------------------------------------------------------
 LearnerSGDEConfiguration::LearnerSGDEConfiguration() : json::JSON() { initConfig(); }
 
@@ -216,10 +244,12 @@ sgpp::datadriven::RegularizationType LearnerSGDEConfiguration::stringToRegulariz
 }
 
 sgpp::solver::SLESolverType LearnerSGDEConfiguration::stringToSolverType(std::string& solverType) {
-  if (solverType.compare("CG")) {
+  if (solverType.compare("CG") == 0) {
     return sgpp::solver::SLESolverType::CG;
-  } else if (solverType.compare("BiCGSTAB")) {
+  } else if (solverType.compare("BiCGSTAB") == 0) {
     return sgpp::solver::SLESolverType::BiCGSTAB;
+  } else if (solverType.compare("PipelinedCG") == 0) {
+    return sgpp::solver::SLESolverType::PipelinedCG;
   } else {
     throw sgpp::base::application_exception("solver type is unknown");
   }
@@ -478,10 +508,10 @@ void LearnerSGDE::train(base::Grid& grid, base::DataVector& alpha, base::DataMat
       std::cout << "# LearnerSGDE: Solving " << std::endl;
     }
 
-    solver::ConjugateGradients myCG(solverConfig.maxIterations_, solverConfig.eps_);
-    myCG.solve(SMatrix, alpha, rhs, false, false, solverConfig.threshold_);
+    std::unique_ptr<solver::SLESolver> myCG = createSolver(solverConfig);
+    myCG->solve(SMatrix, alpha, rhs, false, false, solverConfig.threshold_);
 
-    if (myCG.getResiduum() > solverConfig.threshold_) {
+    if (myCG->getResiduum() > solverConfig.threshold_) {
       throw base::operation_exception("LearnerSGDE - train: conjugate gradients is not converged");
     }
 
@@ -605,10 +635,10 @@ void LearnerSGDE::trainOnline(base::DataVector& labels, base::DataMatrix& testDa
       auto C = computeRegularizationMatrix(*grid);
       datadriven::DensitySystemMatrix SMatrix(*grid, dataSample, C, lambdaReg);
       SMatrix.generateb(rhs);
-      solver::ConjugateGradients myCG(solverConfig.maxIterations_, solverConfig.eps_);
-      myCG.solve(SMatrix, newAlpha, rhs, false, false, solverConfig.threshold_);
+      std::unique_ptr<solver::SLESolver> myCG = createSolver(solverConfig);
+      myCG->solve(SMatrix, newAlpha, rhs, false, false, solverConfig.threshold_);
 
-      /*if (myCG.getResiduum() > solverConfig.threshold_) {
+      /*if (myCG->getResiduum() > solverConfig.threshold_) {
         throw base::operation_exception(
           "LearnerSGDE - train: conjugate gradients is not converged");
       }*/
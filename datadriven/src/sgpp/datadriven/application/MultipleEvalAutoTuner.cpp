@@ -0,0 +1,299 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/tools/OperationConfiguration.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/application/MultipleEvalAutoTuner.hpp>
+#include <sgpp/datadriven/operation/hash/simd/SimdDouble.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+std::string typeToString(OperationMultipleEvalType type) {
+  switch (type) {
+    case OperationMultipleEvalType::DEFAULT:
+      return "DEFAULT";
+    case OperationMultipleEvalType::STREAMING:
+      return "STREAMING";
+    case OperationMultipleEvalType::SUBSPACELINEAR:
+      return "SUBSPACELINEAR";
+    case OperationMultipleEvalType::ADAPTIVE:
+      return "ADAPTIVE";
+    case OperationMultipleEvalType::MORTONORDER:
+      return "MORTONORDER";
+    case OperationMultipleEvalType::SCALAPACK:
+      return "SCALAPACK";
+  }
+  return "UNKNOWN";
+}
+
+std::string subTypeToString(OperationMultipleEvalSubType subType) {
+  switch (subType) {
+    case OperationMultipleEvalSubType::DEFAULT:
+      return "DEFAULT";
+    case OperationMultipleEvalSubType::SIMPLE:
+      return "SIMPLE";
+    case OperationMultipleEvalSubType::COMBINED:
+      return "COMBINED";
+    case OperationMultipleEvalSubType::OCL:
+      return "OCL";
+    case OperationMultipleEvalSubType::OCLFASTMP:
+      return "OCLFASTMP";
+    case OperationMultipleEvalSubType::OCLMP:
+      return "OCLMP";
+    case OperationMultipleEvalSubType::OCLMASKMP:
+      return "OCLMASKMP";
+    case OperationMultipleEvalSubType::OCLOPT:
+      return "OCLOPT";
+    case OperationMultipleEvalSubType::OCLUNIFIED:
+      return "OCLUNIFIED";
+    case OperationMultipleEvalSubType::CUDA:
+      return "CUDA";
+  }
+  return "UNKNOWN";
+}
+
+/**
+ * @return binary logarithm of n rounded down, zero for n = 0
+ */
+size_t log2Bucket(size_t n) {
+  size_t bucket = 0;
+
+  while (n > 1) {
+    n >>= 1;
+    bucket++;
+  }
+
+  return bucket;
+}
+
+}  // namespace
+
+MultipleEvalAutoTuner::MultipleEvalAutoTuner(const std::string& tuningFileName, bool verbose,
+                                             size_t repetitions)
+    : tuningFileName(tuningFileName), verbose(verbose), repetitions(repetitions) {
+  if (repetitions == 0) {
+    throw base::application_exception("MultipleEvalAutoTuner: repetitions must not be zero");
+  }
+
+  std::ifstream file(tuningFileName);
+
+  if (file) {
+    std::stringstream content;
+    content << file.rdbuf();
+    this->tuningDatabase.deserializeFromString(content.str());
+  }
+}
+
+void MultipleEvalAutoTuner::addCandidate(const OperationMultipleEvalConfiguration& configuration) {
+  this->candidates.push_back(configuration);
+}
+
+std::vector<OperationMultipleEvalConfiguration> MultipleEvalAutoTuner::getCandidates(
+    base::Grid& grid) {
+  if (!this->candidates.empty()) {
+    return this->candidates;
+  }
+
+  // kernels that run on the CPU, the factory rejects the ones that do not support the grid type
+  // or that the library was not compiled for
+  std::vector<OperationMultipleEvalConfiguration> defaultCandidates;
+  defaultCandidates.emplace_back(OperationMultipleEvalType::DEFAULT,
+                                 OperationMultipleEvalSubType::DEFAULT,
+                                 OperationMultipleEvalMPIType::NONE, "DEFAULT_DEFAULT");
+  defaultCandidates.emplace_back(OperationMultipleEvalType::STREAMING,
+                                 OperationMultipleEvalSubType::DEFAULT,
+                                 OperationMultipleEvalMPIType::NONE, "STREAMING_DEFAULT");
+
+  // the linear, B-spline and polynomial streaming kernels block the grid points, the default
+  // block size of 12 is the candidate above
+  base::GridType gridType = grid.getType();
+
+  if ((gridType == base::GridType::Linear) || (gridType == base::GridType::Bspline) ||
+      (gridType == base::GridType::ModBspline) || (gridType == base::GridType::Poly) ||
+      (gridType == base::GridType::ModPoly)) {
+    for (uint64_t gridBlockSize : {UINT64_C(4), UINT64_C(48)}) {
+      base::OperationConfiguration parameters;
+      parameters.addIDAttr("KERNEL_GRID_BLOCK_SIZE", gridBlockSize);
+      defaultCandidates.emplace_back(OperationMultipleEvalType::STREAMING,
+                                     OperationMultipleEvalSubType::DEFAULT, parameters,
+                                     "STREAMING_DEFAULT_GRID_BLOCK_" +
+                                         std::to_string(gridBlockSize));
+    }
+  }
+
+  defaultCandidates.emplace_back(OperationMultipleEvalType::SUBSPACELINEAR,
+                                 OperationMultipleEvalSubType::COMBINED,
+                                 OperationMultipleEvalMPIType::NONE, "SUBSPACELINEAR_COMBINED");
+  defaultCandidates.emplace_back(OperationMultipleEvalType::SUBSPACELINEAR,
+                                 OperationMultipleEvalSubType::SIMPLE,
+                                 OperationMultipleEvalMPIType::NONE, "SUBSPACELINEAR_SIMPLE");
+  return defaultCandidates;
+}
+
+std::string MultipleEvalAutoTuner::getCPUModel() {
+  std::ifstream cpuInfo("/proc/cpuinfo");
+  std::string line;
+
+  while (std::getline(cpuInfo, line)) {
+    if (line.compare(0, 10, "model name") == 0) {
+      size_t start = line.find(':');
+
+      if (start != std::string::npos) {
+        start = line.find_first_not_of(" \t", start + 1);
+        return (start == std::string::npos) ? "unknown" : line.substr(start);
+      }
+    }
+  }
+
+  return "unknown";
+}
+
+std::string MultipleEvalAutoTuner::getTuningKey(base::Grid& grid, base::DataMatrix& dataset) {
+  std::stringstream key;
+  key << grid.getTypeAsString() << ";dim=" << grid.getDimension()
+      << ";gridSize=2^" << log2Bucket(grid.getSize())
+      << ";dataSize=2^" << log2Bucket(dataset.getNrows()) << ";cpu=" << getCPUModel()
+      << ";isa=" << simd::SimdDouble::getInstructionSet()
+      << ";threads=" << omp_get_max_threads();
+  return key.str();
+}
+
+bool MultipleEvalAutoTuner::isTuned(base::Grid& grid, base::DataMatrix& dataset) {
+  return this->tuningDatabase.contains(this->getTuningKey(grid, dataset));
+}
+
+OperationMultipleEvalConfiguration MultipleEvalAutoTuner::getConfiguration(
+    base::Grid& grid, base::DataMatrix& dataset) {
+  std::vector<OperationMultipleEvalConfiguration> currentCandidates = this->getCandidates(grid);
+  std::string key = this->getTuningKey(grid, dataset);
+
+  if (this->tuningDatabase.contains(key)) {
+    json::Node& entry = this->tuningDatabase[key];
+
+    for (OperationMultipleEvalConfiguration& candidate : currentCandidates) {
+      if (typeToString(candidate.getType()) == entry["type"].get() &&
+          subTypeToString(candidate.getSubType()) == entry["subType"].get() &&
+          candidate.getName() == entry["name"].get()) {
+        return candidate;
+      }
+    }
+
+    // the stored winner is not among the current candidates, therefore tune again
+  }
+
+  return currentCandidates[this->tune(grid, dataset, key, currentCandidates)];
+}
+
+base::OperationMultipleEval* MultipleEvalAutoTuner::createOperationMultipleEval(
+    base::Grid& grid, base::DataMatrix& dataset) {
+  OperationMultipleEvalConfiguration configuration = this->getConfiguration(grid, dataset);
+  return op_factory::createOperationMultipleEval(grid, dataset, configuration);
+}
+
+size_t MultipleEvalAutoTuner::tune(
+    base::Grid& grid, base::DataMatrix& dataset, const std::string& key,
+    std::vector<OperationMultipleEvalConfiguration>& currentCandidates) {
+  base::DataVector alpha(grid.getSize(), 1.0);
+  base::DataVector dataValues(dataset.getNrows(), 1.0);
+  base::DataVector evalResult(dataset.getNrows());
+  base::DataVector transposedResult(grid.getSize());
+
+  std::vector<double> durations(currentCandidates.size(), -1.0);
+  std::vector<double> repetitionDurations(this->repetitions);
+  size_t bestCandidate = currentCandidates.size();
+  double bestDuration = std::numeric_limits<double>::infinity();
+  base::SGppStopwatch stopwatch;
+
+  for (size_t i = 0; i < currentCandidates.size(); i++) {
+    std::unique_ptr<base::OperationMultipleEval> op;
+
+    try {
+      op.reset(op_factory::createOperationMultipleEval(grid, dataset, currentCandidates[i]));
+    } catch (base::factory_exception& e) {
+      continue;
+    } catch (base::operation_exception& e) {
+      continue;
+    }
+
+    // the first run includes first-touch page faults and one-time setup of the kernel
+    op->mult(alpha, evalResult);
+    op->multTranspose(dataValues, transposedResult);
+
+    for (size_t r = 0; r < this->repetitions; r++) {
+      stopwatch.start();
+      op->mult(alpha, evalResult);
+      op->multTranspose(dataValues, transposedResult);
+      repetitionDurations[r] = stopwatch.stop();
+    }
+
+    // the median is robust against single runs disturbed by other processes
+    std::nth_element(repetitionDurations.begin(),
+                     repetitionDurations.begin() + this->repetitions / 2,
+                     repetitionDurations.end());
+    durations[i] = repetitionDurations[this->repetitions / 2];
+
+    if (this->verbose) {
+      std::cout << "autotuner: " << currentCandidates[i].getName() << ": " << durations[i]
+                << "s" << std::endl;
+    }
+
+    if (durations[i] < bestDuration) {
+      bestDuration = durations[i];
+      bestCandidate = i;
+    }
+  }
+
+  if (bestCandidate == currentCandidates.size()) {
+    throw base::application_exception(
+        "MultipleEvalAutoTuner: no candidate supports the grid type");
+  }
+
+  json::Node& entry = this->tuningDatabase.replaceDictAttr(key);
+  entry.addTextAttr("type", typeToString(currentCandidates[bestCandidate].getType()));
+  entry.addTextAttr("subType", subTypeToString(currentCandidates[bestCandidate].getSubType()));
+  entry.addTextAttr("name", currentCandidates[bestCandidate].getName());
+  entry.addIDAttr("duration", bestDuration);
+
+  json::Node& durationsNode = entry.addDictAttr("durations");
+
+  for (size_t i = 0; i < currentCandidates.size(); i++) {
+    if (durations[i] >= 0.0) {
+      durationsNode.addIDAttr(currentCandidates[i].getName(), durations[i]);
+    }
+  }
+
+  this->tuningDatabase.serialize(this->tuningFileName);
+
+  if (this->verbose) {
+    std::cout << "autotuner: selected " << currentCandidates[bestCandidate].getName() << " for "
+              << key << std::endl;
+  }
+
+  return bestCandidate;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
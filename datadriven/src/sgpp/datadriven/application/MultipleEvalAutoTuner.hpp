@@ -0,0 +1,122 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/json/JSON.hpp>
+#include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Selects the fastest multiple evaluation kernel at runtime. On the first request for a given
+ * problem class, i.e., grid type, dimension, grid size bucket, data size bucket and CPU, all
+ * candidate configurations are timed on the actual grid and data. Each candidate runs one
+ * untimed mult() and multTranspose() to warm up, then the median of several timed repetitions
+ * is taken. The winner is stored in a JSON tuning file and reused for all later requests of the
+ * same problem class, also in later runs.
+ *
+ * Sizes are bucketed by their binary logarithm, so that refining the grid by a few points does
+ * not trigger a new tuning run.
+ *
+ * The tuner is also used by op_factory::createOperationMultipleEval if autotuning is enabled in
+ * the OperationMultipleEvalConfiguration.
+ */
+class MultipleEvalAutoTuner {
+ public:
+  /**
+   * Constructor, reads the tuning file if it exists.
+   *
+   * @param tuningFileName  JSON file to read the stored tuning results from and to write new
+   *                        results to
+   * @param verbose         print the measured durations
+   * @param repetitions     number of timed runs per candidate, the median is used
+   */
+  explicit MultipleEvalAutoTuner(const std::string& tuningFileName, bool verbose = false,
+                                 size_t repetitions = 5);
+
+  /**
+   * Adds a configuration to the candidates, e.g., to tune the parameters of a kernel. The name
+   * of the configuration is used to recognize it in the tuning file and therefore has to be
+   * unique among candidates of the same type and subtype. If no candidates are added, all
+   * kernels available on the CPU are used, the streaming kernels with several grid block sizes.
+   *
+   * @param configuration   candidate configuration
+   */
+  void addCandidate(const OperationMultipleEvalConfiguration& configuration);
+
+  /**
+   * Returns the best configuration for the problem class of the grid and the dataset. If the
+   * tuning file does not contain an entry for the problem class, the candidates are timed and
+   * the tuning file is updated.
+   *
+   * @param grid        grid the operation is created for
+   * @param dataset     data points, one per row
+   * @return            fastest configuration
+   */
+  OperationMultipleEvalConfiguration getConfiguration(base::Grid& grid,
+                                                      base::DataMatrix& dataset);
+
+  /**
+   * Creates the fastest multiple evaluation operation, tuning it first if necessary.
+   *
+   * @param grid        grid the operation is created for
+   * @param dataset     data points, one per row
+   * @return            new operation, the caller takes ownership
+   */
+  base::OperationMultipleEval* createOperationMultipleEval(base::Grid& grid,
+                                                           base::DataMatrix& dataset);
+
+  /**
+   * @param grid        grid the operation is created for
+   * @param dataset     data points, one per row
+   * @return            whether the tuning file already contains an entry for the problem class
+   */
+  bool isTuned(base::Grid& grid, base::DataMatrix& dataset);
+
+  /**
+   * @param grid        grid the operation is created for
+   * @param dataset     data points, one per row
+   * @return            key of the problem class in the tuning file
+   */
+  std::string getTuningKey(base::Grid& grid, base::DataMatrix& dataset);
+
+  /**
+   * @return model name of the CPU as reported by the operating system, "unknown" otherwise
+   */
+  static std::string getCPUModel();
+
+ private:
+  std::string tuningFileName;
+  bool verbose;
+  size_t repetitions;
+  json::JSON tuningDatabase;
+  std::vector<OperationMultipleEvalConfiguration> candidates;
+
+  /**
+   * @param grid        grid the operation is created for
+   * @return            the candidates added by the user or the default candidates for the grid
+   */
+  std::vector<OperationMultipleEvalConfiguration> getCandidates(base::Grid& grid);
+
+  /**
+   * Times the candidates and stores the result in the tuning file.
+   *
+   * @return index of the fastest candidate
+   */
+  size_t tune(base::Grid& grid, base::DataMatrix& dataset, const std::string& key,
+              std::vector<OperationMultipleEvalConfiguration>& currentCandidates);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -16,11 +16,15 @@
 
 #include <sgpp/solver/sle/BiCGStab.hpp>
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
 #include <sgpp/solver/sle/fista/ElasticNetFunction.hpp>
 #include <sgpp/solver/sle/fista/Fista.hpp>
 #include <sgpp/solver/sle/fista/GroupLassoFunction.hpp>
 #include <sgpp/solver/sle/fista/LassoFunction.hpp>
 #include <sgpp/solver/sle/fista/RidgeFunction.hpp>
+#include <sgpp/solver/sle/preconditioner/JacobiPreconditioner.hpp>
+#include <sgpp/solver/sle/preconditioner/LevelScalingPreconditioner.hpp>
 
 #include <cassert>
 #include <limits>
@@ -101,6 +105,10 @@ double RegressionLearner::getMSE(base::DataMatrix& data, const base::DataVector&
 void RegressionLearner::fit(Solver& solver, base::DataVector& classes) {
   switch (solver.type) {
     case Solver::solverCategory::cg: {
+      // the preconditioner depends on the grid, which changes with every refinement
+      auto newPreconditioner = createPreconditioner();
+      solver.setPreconditioner(newPreconditioner.get());
+      preconditioner = std::move(newPreconditioner);
       auto b = base::DataVector(weights.getSize());
       systemMatrix->generateb(classes, b);
       solver.solveCG(*systemMatrix, weights, b, true, false, solverConfig.threshold_);
@@ -215,14 +223,31 @@ std::unique_ptr<datadriven::DMSystemMatrixBase> RegressionLearner::createDMSyste
 }
 
 RegressionLearner::Solver RegressionLearner::createSolver(size_t n_rows) {
+  using solver::SLEPreconditionerType;
   using solver::SLESolverType;
+  // the solver is shared by the refinement steps and the final step
+  const bool preconditioned = (solverConfig.preconditioner_ != SLEPreconditionerType::None) ||
+                              (finalSolverConfig.preconditioner_ != SLEPreconditionerType::None);
+  if (preconditioned && (solverConfig.type_ != SLESolverType::CG) &&
+      (solverConfig.type_ != SLESolverType::PipelinedCG)) {
+    throw base::application_exception(
+        "RegressionLearner::createSolver: Preconditioning is only supported by the CG and "
+        "PipelinedCG solvers!");
+  }
   switch (solverConfig.type_) {
     case SLESolverType::CG:
+      if (preconditioned) {
+        return Solver(std::move(std::make_unique<solver::PreconditionedConjugateGradients>(
+            solverConfig.maxIterations_, solverConfig.eps_)));
+      }
       return Solver(std::move(std::make_unique<solver::ConjugateGradients>(
           solverConfig.maxIterations_, solverConfig.eps_)));
     case SLESolverType::BiCGSTAB:
       return Solver(std::move(
           std::make_unique<solver::BiCGStab>(solverConfig.maxIterations_, solverConfig.eps_)));
+    case SLESolverType::PipelinedCG:
+      return Solver(std::move(std::make_unique<solver::PipelinedConjugateGradients>(
+          solverConfig.maxIterations_, solverConfig.eps_)));
     case SLESolverType::FISTA:
       return createSolverFista(n_rows);
     default:
@@ -231,6 +256,24 @@ RegressionLearner::Solver RegressionLearner::createSolver(size_t n_rows) {
   }
 }
 
+std::unique_ptr<solver::Preconditioner> RegressionLearner::createPreconditioner() {
+  using solver::SLEPreconditionerType;
+  switch (solverConfig.preconditioner_) {
+    case SLEPreconditionerType::None:
+      return nullptr;
+    case SLEPreconditionerType::Jacobi: {
+      auto diagonal = base::DataVector(grid->getSize());
+      systemMatrix->getDiagonal(diagonal);
+      return std::make_unique<solver::JacobiPreconditioner>(diagonal);
+    }
+    case SLEPreconditionerType::LevelScaling:
+      return std::make_unique<solver::LevelScalingPreconditioner>(grid->getStorage());
+    default:
+      throw base::application_exception(
+          "RegressionLearner::createPreconditioner: An unsupported preconditioner was chosen!");
+  }
+}
+
 RegressionLearner::Solver RegressionLearner::createSolverFista(size_t n_rows) {
   // The FISTA-solver solves loss + lambda * regularization_penalty.
   // We adjust it to align to function like the CG solver, by solving
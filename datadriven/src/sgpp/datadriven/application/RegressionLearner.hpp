@@ -15,7 +15,9 @@
 #include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
 #include <sgpp/solver/SLESolver.hpp>
 #include <sgpp/solver/TypesSolver.hpp>
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
 #include <sgpp/solver/sle/fista/FistaBase.hpp>
+#include <sgpp/solver/sle/preconditioner/Preconditioner.hpp>
 
 #include <algorithm>
 #include <memory>
@@ -61,6 +63,17 @@ class RegressionLearner {
       }
       solverFista->solve(op, weights, classes, maxIt, treshold, L);
     }
+    void setPreconditioner(sgpp::base::OperationMatrix* preconditioner) {
+      auto solverPCG = (type == solverCategory::cg)
+                           ? dynamic_cast<sgpp::solver::PreconditionedConjugateGradients*>(
+                                 solverCG.get())
+                           : nullptr;
+      if (solverPCG != nullptr) {
+        solverPCG->setPreconditioner(preconditioner);
+      } else if (preconditioner != nullptr) {
+        throw sgpp::base::application_exception("Solver doesn't support preconditioning!");
+      }
+    }
     double getL() {
       if (type != solverCategory::fista) {
         throw sgpp::base::application_exception("Solver doesn't support L!");
@@ -197,6 +210,8 @@ class RegressionLearner {
   std::vector<std::vector<size_t>> terms;
   std::unique_ptr<sgpp::base::OperationMultipleEval> op;
   std::unique_ptr<datadriven::DMSystemMatrixBase> systemMatrix;
+  /// preconditioner of the conjugate gradient solvers (rebuilt for every fit)
+  std::unique_ptr<sgpp::solver::Preconditioner> preconditioner;
 
   /// sparse grid object
   std::unique_ptr<sgpp::base::Grid> grid;
@@ -208,6 +223,7 @@ class RegressionLearner {
       sgpp::base::DataMatrix& trainDataset);
   Solver createSolver(size_t n_rows);
   Solver createSolverFista(size_t n_rows);
+  std::unique_ptr<sgpp::solver::Preconditioner> createPreconditioner();
 
   void fit(Solver& solver, sgpp::base::DataVector& classes);
   void refine(sgpp::base::DataMatrix& data, sgpp::base::DataVector& classes);
@@ -14,7 +14,9 @@
 #include <sgpp/base/operation/hash/OperationFirstMoment.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/solver/sle/BiCGStab.hpp>
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
 #include <sgpp/datadriven/algorithm/DensitySystemMatrix.hpp>
 #include <sgpp/solver/TypesSolver.hpp>
 #include <sgpp/base/tools/json/json_exception.hpp>
@@ -32,12 +34,38 @@
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
+#include <memory>
 #include <vector>
 #include <string>
 
 namespace sgpp {
 namespace datadriven {
 
+namespace {
+
+/**
+ * @param solverConfig configuration of the solver
+ * @return solver of the configured type for the density system
+ */
+std::unique_ptr<solver::SLESolver> createSolver(
+    const solver::SLESolverConfiguration& solverConfig) {
+  switch (solverConfig.type_) {
+    case solver::SLESolverType::CG:
+      return std::make_unique<solver::ConjugateGradients>(solverConfig.maxIterations_,
+                                                          solverConfig.eps_);
+    case solver::SLESolverType::BiCGSTAB:
+      return std::make_unique<solver::BiCGStab>(solverConfig.maxIterations_, solverConfig.eps_);
+    case solver::SLESolverType::PipelinedCG:
+      return std::make_unique<solver::PipelinedConjugateGradients>(solverConfig.maxIterations_,
+                                                                   solverConfig.eps_);
+    default:
+      throw base::application_exception(
+          "SparseGridDensityEstimator: unsupported SLE solver type, use CG, BiCGSTAB or PipelinedCG");
+  }
+}
+
+}  // namespace
+
 // --------------------------------------------------------------------------------------------
 SparseGridDensityEstimatorConfiguration::SparseGridDensityEstimatorConfiguration() : json::JSON() {
   initConfig();
@@ -220,10 +248,12 @@ SparseGridDensityEstimatorConfiguration::stringToRegularizationType(
 
 sgpp::solver::SLESolverType SparseGridDensityEstimatorConfiguration::stringToSolverType(
     std::string& solverType) {
-  if (solverType.compare("CG")) {
+  if (solverType.compare("CG") == 0) {
     return sgpp::solver::SLESolverType::CG;
-  } else if (solverType.compare("BiCGSTAB")) {
+  } else if (solverType.compare("BiCGSTAB") == 0) {
     return sgpp::solver::SLESolverType::BiCGSTAB;
+  } else if (solverType.compare("PipelinedCG") == 0) {
+    return sgpp::solver::SLESolverType::PipelinedCG;
   } else {
     throw sgpp::base::application_exception("solver type is unknown");
   }
@@ -489,10 +519,10 @@ void SparseGridDensityEstimator::train(base::Grid& grid, base::DataVector& alpha
       std::cout << "# LearnerSGDE: Solving " << std::endl;
     }
 
-    solver::ConjugateGradients myCG(solverConfig.maxIterations_, solverConfig.eps_);
-    myCG.solve(*sMatrix, alpha, rhs, false, solverConfig.verbose_, solverConfig.threshold_);
+    std::unique_ptr<solver::SLESolver> myCG = createSolver(solverConfig);
+    myCG->solve(*sMatrix, alpha, rhs, false, solverConfig.verbose_, solverConfig.threshold_);
 
-    if (myCG.getResiduum() > solverConfig.threshold_) {
+    if (myCG->getResiduum() > solverConfig.threshold_) {
       throw base::operation_exception("LearnerSGDE - train: conjugate gradients is not converged");
     }
 
@@ -16,6 +16,7 @@
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/ColumnarFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceFileTypeParser.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
@@ -47,6 +48,11 @@ DataSourceBuilder& DataSourceBuilder::withBatchSize(size_t batchSize) {
   return *this;
 }
 
+DataSourceBuilder& DataSourceBuilder::withPrefetchDepth(size_t prefetchDepth) {
+  config.prefetchDepth = prefetchDepth;
+  return *this;
+}
+
 DataSourceBuilder& DataSourceBuilder::withCompression(bool isCompressed) {
   config.isCompressed = isCompressed;
 
@@ -60,6 +66,11 @@ DataSourceBuilder& DataSourceBuilder::withCompression(bool isCompressed) {
   return *this;
 }
 
+DataSourceBuilder& DataSourceBuilder::withStreaming(bool readinStreaming) {
+  config.readinStreaming = readinStreaming;
+  return *this;
+}
+
 DataSourceBuilder& DataSourceBuilder::withPath(const std::string& filePath) {
   config.filePath = filePath;
   if (config.fileType == DataSourceFileType::NONE) {
@@ -69,6 +80,17 @@ DataSourceBuilder& DataSourceBuilder::withPath(const std::string& filePath) {
 }
 
 DataSourceSplitting* DataSourceBuilder::splittingAssemble() const {
+  // streamed samples come in file order and their number is unknown up front
+  if (config.readinStreaming && config.validationPortion > 0.0) {
+    throw data_exception(
+        "Streaming the dataset (readinStreaming) requires a validation portion of 0, since the "
+        "number of samples is not known in advance.");
+  }
+  if (config.readinStreaming && config.shuffling != DataSourceShufflingType::sequential) {
+    throw data_exception(
+        "Streaming the dataset (readinStreaming) cannot be combined with random shuffling.");
+  }
+
   // Create a shuffling functor
   DataShufflingFunctorFactory shufflingFunctorFactory;
   DataShufflingFunctor *shuffling = shufflingFunctorFactory.buildDataShufflingFunctor(config);
@@ -79,6 +101,8 @@ DataSourceSplitting* DataSourceBuilder::splittingAssemble() const {
     sampleProvider = new ArffFileSampleProvider(shuffling);
   } else if (config.fileType == DataSourceFileType::CSV) {
     sampleProvider = new CSVFileSampleProvider(shuffling);
+  } else if (config.fileType == DataSourceFileType::COLUMNAR) {
+    sampleProvider = new ColumnarFileSampleProvider(shuffling);
   } else {
     data_exception("Unknown file type");
   }
@@ -105,6 +129,12 @@ DataSourceSplitting* DataSourceBuilder::splittingFromConfig(const DataSourceConf
 }
 
 DataSourceCrossValidation* DataSourceBuilder::crossValidationAssemble() const {
+  if (config.readinStreaming) {
+    throw data_exception(
+        "Streaming the dataset (readinStreaming) cannot be combined with cross validation, since "
+        "the number of samples is not known in advance.");
+  }
+
   // Create a shuffling functor
   DataShufflingFunctorFactory shufflingFunctorFactory;
   DataShufflingFunctor *shuffling = shufflingFunctorFactory.buildDataShufflingFunctor(config);
@@ -117,6 +147,8 @@ DataSourceCrossValidation* DataSourceBuilder::crossValidationAssemble() const {
     sampleProvider = new ArffFileSampleProvider(crossValidationShuffling);
   } else if (config.fileType == DataSourceFileType::CSV) {
     sampleProvider = new CSVFileSampleProvider(crossValidationShuffling);
+  } else if (config.fileType == DataSourceFileType::COLUMNAR) {
+    sampleProvider = new ColumnarFileSampleProvider(crossValidationShuffling);
   } else {
     data_exception("Unknown file type");
   }
@@ -48,6 +48,15 @@ class DataSourceBuilder {
    */
   DataSourceBuilder& withCompression(bool isCompressed);
 
+  /**
+   * Optionally specify if the file should be parsed batch by batch while iterating instead of
+   * being read entirely up front. False by default. Streaming requires a validation portion of 0
+   * and sequential shuffling and cannot be combined with cross validation.
+   * @param readinStreaming true if the file should be streamed, false otherwise.
+   * @return Reference to this object, used for chaining.
+   */
+  DataSourceBuilder& withStreaming(bool readinStreaming);
+
   /**
    * Optionally Specify the file type if files are used. If data source does not use any files,
    * this is set to none by default.
@@ -72,10 +81,20 @@ class DataSourceBuilder {
    */
   DataSourceBuilder& withBatchSize(size_t batchSize);
 
+  /**
+   * Optionally specify how many batches are prepared by a background thread ahead of their
+   * request. If not specified, batches are prepared synchronously (depth 0).
+   * @param prefetchDepth maximal number of batches prepared in advance.
+   * @return Reference to this object, used for chaining.
+   */
+  DataSourceBuilder& withPrefetchDepth(size_t prefetchDepth);
+
   /**
    * Based on the currently specified configuration, build and configure an instance of a data
    * source object.
    * @return Fully configured instance of #sgpp::datadriven::DataSourceSplitting object.
+   * @throw sgpp::base::data_exception if streaming is combined with a validation portion or
+   *        random shuffling
    */
   DataSourceSplitting* splittingAssemble() const;
 
@@ -91,6 +110,7 @@ class DataSourceBuilder {
    * Based on the currently specified configuration, build and configure an instance of a data
    * source object that is able to perform cross validation.
    * @return Fully configured instance of #sgpp::datadriven::DataSourceCrossValidation object.
+   * @throw sgpp::base::data_exception if streaming is enabled
    */
   DataSourceCrossValidation* crossValidationAssemble() const;
 
@@ -26,6 +26,7 @@
 #include <sgpp/datadriven/datamining/configuration/MatrixDecompositionTypeParser.hpp>
 #include <sgpp/datadriven/datamining/configuration/RefinementFunctorTypeParser.hpp>
 #include <sgpp/datadriven/datamining/configuration/RegularizationTypeParser.hpp>
+#include <sgpp/datadriven/datamining/configuration/SLEPreconditionerTypeParser.hpp>
 #include <sgpp/datadriven/datamining/configuration/SLESolverTypeParser.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceFileTypeParser.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataTransformationTypeParser.hpp>
@@ -104,6 +105,8 @@ bool DataMiningConfigParser::getDataSourceConfig(DataSourceConfig &config,
     config.filePath = parseString(*dataSourceConfig, "filePath", defaults.filePath, "dataSource");
     config.isCompressed =
         parseBool(*dataSourceConfig, "compression", defaults.isCompressed, "dataSource");
+    config.readinStreaming =
+        parseBool(*dataSourceConfig, "readinStreaming", defaults.readinStreaming, "dataSource");
     config.numBatches =
         parseUInt(*dataSourceConfig, "numBatches", defaults.numBatches, "dataSource");
     config.batchSize = parseUInt(*dataSourceConfig, "batchSize", defaults.batchSize, "dataSource");
@@ -156,6 +159,8 @@ bool DataMiningConfigParser::getDataSourceConfig(DataSourceConfig &config,
     config.randomSeed =
         parseUInt(*dataSourceConfig, "randomSeed", defaults.randomSeed, "dataSource");
     config.epochs = parseUInt(*dataSourceConfig, "epochs", defaults.epochs, "dataSource");
+    config.prefetchDepth =
+        parseUInt(*dataSourceConfig, "prefetchDepth", defaults.prefetchDepth, "dataSource");
   } else {
     std::cout << "# Could not find specification of dataSource. Falling Back to default values."
               << std::endl;
@@ -655,6 +660,16 @@ void DataMiningConfigParser::parseSLESolverConfig(DictNode &dict, SLESolverConfi
               << SLESolverTypeParser::toString(defaults.type_) << "." << std::endl;
     config.type_ = defaults.type_;
   }
+
+  // parse preconditioner of the CG solvers
+  if (dict.contains("preconditioner")) {
+    config.preconditioner_ = SLEPreconditionerTypeParser::parse(dict["preconditioner"].get());
+  } else {
+    std::cout << "# Did not find " << parentNode << "[preconditioner]. Setting default value "
+              << SLEPreconditionerTypeParser::toString(defaults.preconditioner_) << "."
+              << std::endl;
+    config.preconditioner_ = defaults.preconditioner_;
+  }
 }
 
 void DataMiningConfigParser::getHyperparameters(std::map<std::string, ContinuousParameter> &conpar,
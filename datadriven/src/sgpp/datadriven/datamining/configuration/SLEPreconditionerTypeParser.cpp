@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * SLEPreconditionerTypeParser.cpp
+ */
+
+#include "SLEPreconditionerTypeParser.hpp"
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <algorithm>
+#include <string>
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::solver::SLEPreconditionerType;
+
+SLEPreconditionerType SLEPreconditionerTypeParser::parse(const std::string &input) {
+  auto inputLower = input;
+  std::transform(inputLower.begin(), inputLower.end(), inputLower.begin(), ::tolower);
+
+  if (inputLower.compare("none") == 0) {
+    return sgpp::solver::SLEPreconditionerType::None;
+  } else if (inputLower.compare("jacobi") == 0) {
+    return sgpp::solver::SLEPreconditionerType::Jacobi;
+  } else if (inputLower.compare("levelscaling") == 0) {
+    return sgpp::solver::SLEPreconditionerType::LevelScaling;
+  } else {
+    std::string errorMsg =
+        "Failed to convert string \"" + input + "\" to any known SLEPreconditionerType";
+    throw base::data_exception(errorMsg.c_str());
+  }
+}
+
+const std::string &SLEPreconditionerTypeParser::toString(SLEPreconditionerType type) {
+  return slePreconditionerTypeMap.at(type);
+}
+
+const SLEPreconditionerTypeParser::SLEPreconditionerTypeMap_t
+    SLEPreconditionerTypeParser::slePreconditionerTypeMap = []() {
+      return SLEPreconditionerTypeParser::SLEPreconditionerTypeMap_t{
+          std::make_pair(SLEPreconditionerType::None, "None"),
+          std::make_pair(SLEPreconditionerType::Jacobi, "Jacobi"),
+          std::make_pair(SLEPreconditionerType::LevelScaling, "LevelScaling")};
+    }();
+} /* namespace datadriven */
+} /* namespace sgpp */
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * SLEPreconditionerTypeParser.hpp
+ */
+
+#pragma once
+
+#include <sgpp/solver/TypesSolver.hpp>
+
+#include <map>
+#include <string>
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::solver::SLEPreconditionerType;
+
+/**
+ * Convenience class to convert strings to #sgpp::solver::SLEPreconditionerType and generate
+ * string representations for values of #sgpp::solver::SLEPreconditionerType.
+ */
+class SLEPreconditionerTypeParser {
+ public:
+  /**
+   * Convert strings to values #sgpp::solver::SLEPreconditionerType. Throws if there is no valid
+   * representation
+   * @param input case insensitive string representation of a
+   * #sgpp::solver::SLEPreconditionerType.
+   * @return the corresponding #sgpp::solver::SLEPreconditionerType.
+   */
+  static SLEPreconditionerType parse(const std::string &input);
+
+  /**
+   * generate string representations for values of #sgpp::solver::SLEPreconditionerType.
+   * @param type enum value.
+   * @return string representation of a #sgpp::solver::SLEPreconditionerType.
+   */
+  static const std::string &toString(SLEPreconditionerType type);
+
+ private:
+  typedef std::map<SLEPreconditionerType, std::string> SLEPreconditionerTypeMap_t;
+
+  /**
+   * Map containing all values of #sgpp::solver::SLEPreconditionerType and the corresponding
+   * string representation.
+   */
+  static const SLEPreconditionerTypeMap_t slePreconditionerTypeMap;
+};
+} /* namespace datadriven */
+} /* namespace sgpp */
@@ -17,6 +17,7 @@
 #include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/datadriven/tools/ARFFTools.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -25,14 +26,16 @@ namespace sgpp {
 namespace datadriven {
 
 ArffFileSampleProvider::ArffFileSampleProvider(DataShufflingFunctor *shuffling)
-    : shuffling{shuffling}, dataset(Dataset{}), counter(0) {}
+    : shuffling{shuffling}, dataset(Dataset{}), counter(0), reader(nullptr) {}
 
 SampleProvider* ArffFileSampleProvider::clone() const {
   return dynamic_cast<SampleProvider*>(new ArffFileSampleProvider{*this});
 }
 
 size_t ArffFileSampleProvider::getDim() const {
-  if (dataset.getDimension() != 0) {
+  if (reader) {
+    return reader->getDimension();
+  } else if (dataset.getDimension() != 0) {
     return dataset.getDimension();
   } else {
     throw base::file_exception{"No dataset loaded."};
@@ -40,7 +43,9 @@ size_t ArffFileSampleProvider::getDim() const {
 }
 
 size_t ArffFileSampleProvider::getNumSamples() const {
-  if (dataset.getDimension() != 0) {
+  if (reader) {
+    throw base::data_exception{"Number of samples is not known while streaming."};
+  } else if (dataset.getDimension() != 0) {
     return dataset.getNumberInstances();
   } else {
     throw base::file_exception{"No dataset loaded."};
@@ -52,6 +57,7 @@ void ArffFileSampleProvider::readFile(const std::string& fileName,
                                       size_t readinCutoff,
                                       std::vector<size_t> readinColumns,
                                       std::vector<double> readinClasses) {
+  reader.reset();
   try {
     dataset = ARFFTools::readARFFFromFile(fileName, hasTargets, readinCutoff,
         readinColumns, readinClasses);
@@ -63,7 +69,9 @@ void ArffFileSampleProvider::readFile(const std::string& fileName,
 }
 
 Dataset* ArffFileSampleProvider::getNextSamples(size_t howMany) {
-  if (dataset.getDimension() != 0) {
+  if (reader) {
+    return new Dataset{reader->readSamples(howMany)};
+  } else if (dataset.getDimension() != 0) {
     return splitDataset(howMany);
   } else {
     throw base::file_exception("No dataset loaded.");
@@ -71,7 +79,9 @@ Dataset* ArffFileSampleProvider::getNextSamples(size_t howMany) {
 }
 
 Dataset* ArffFileSampleProvider::getAllSamples() {
-  if (dataset.getDimension() != 0) {
+  if (reader) {
+    return new Dataset{reader->readSamples()};
+  } else if (dataset.getDimension() != 0) {
     return this->getNextSamples(dataset.getNumberInstances());
   } else {
     throw base::file_exception{"No dataset loaded."};
@@ -83,6 +93,7 @@ void ArffFileSampleProvider::readString(const std::string& input,
                                         size_t readinCutoff,
                                         std::vector<size_t> readinColumns,
                                         std::vector<double> readinClasses) {
+  reader.reset();
   try {
     dataset = ARFFTools::readARFFFromString(input, hasTargets, readinCutoff,
         readinColumns, readinClasses);
@@ -120,8 +131,29 @@ Dataset* ArffFileSampleProvider::splitDataset(size_t howMany) {
   return tmpDataset.release();
 }
 
+void ArffFileSampleProvider::streamFile(const std::string& fileName,
+                                        bool hasTargets,
+                                        size_t readinCutoff,
+                                        std::vector<size_t> readinColumns,
+                                        std::vector<double> readinClasses) {
+  dataset = Dataset{};
+  counter = 0;
+  try {
+    reader = std::make_shared<DatasetStreamReader>(fileName, DatasetStreamReader::Format::ARFF,
+        hasTargets, false, readinCutoff, readinColumns, readinClasses);
+    // validates the column selection
+    reader->getDimension();
+  } catch (...) {
+    reader.reset();
+    throw base::data_exception{"Failed to open ARFF File for streaming."};
+  }
+}
+
 void ArffFileSampleProvider::reset() {
   counter = 0;
+  if (reader) {
+    reader->rewind();
+  }
 }
 
 } /* namespace datadriven */
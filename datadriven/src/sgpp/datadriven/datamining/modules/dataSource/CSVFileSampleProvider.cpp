@@ -17,6 +17,7 @@
 #include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/datadriven/tools/CSVTools.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -25,14 +26,16 @@ namespace sgpp {
 namespace datadriven {
 
 CSVFileSampleProvider::CSVFileSampleProvider(DataShufflingFunctor *shuffling)
-    : shuffling{shuffling}, dataset(Dataset{}), counter(0) {}
+    : shuffling{shuffling}, dataset(Dataset{}), counter(0), reader(nullptr) {}
 
 SampleProvider* CSVFileSampleProvider::clone() const {
   return dynamic_cast<SampleProvider*>(new CSVFileSampleProvider{*this});
 }
 
 size_t CSVFileSampleProvider::getDim() const {
-  if (dataset.getDimension() != 0) {
+  if (reader) {
+    return reader->getDimension();
+  } else if (dataset.getDimension() != 0) {
     return dataset.getDimension();
   } else {
     throw base::file_exception{"No dataset loaded."};
@@ -40,7 +43,9 @@ size_t CSVFileSampleProvider::getDim() const {
 }
 
 size_t CSVFileSampleProvider::getNumSamples() const {
-  if (dataset.getDimension() != 0) {
+  if (reader) {
+    throw base::data_exception{"Number of samples is not known while streaming."};
+  } else if (dataset.getDimension() != 0) {
     return dataset.getNumberInstances();
   } else {
     throw base::file_exception{"No dataset loaded."};
@@ -52,6 +57,7 @@ void CSVFileSampleProvider::readFile(const std::string& fileName,
                                      size_t readinCutoff,
                                      std::vector<size_t> readinColumns,
                                      std::vector<double> readinClasses) {
+  reader.reset();
   try {
     // call readCSV with skipfirstline set to true
     dataset = CSVTools::readCSVFromFile(fileName, true, hasTargets, readinCutoff,
@@ -64,7 +70,9 @@ void CSVFileSampleProvider::readFile(const std::string& fileName,
 }
 
 Dataset* CSVFileSampleProvider::getNextSamples(size_t howMany) {
-  if (dataset.getDimension() != 0) {
+  if (reader) {
+    return new Dataset{reader->readSamples(howMany)};
+  } else if (dataset.getDimension() != 0) {
     return splitDataset(howMany);
   } else {
     throw base::file_exception("No dataset loaded.");
@@ -72,7 +80,9 @@ Dataset* CSVFileSampleProvider::getNextSamples(size_t howMany) {
 }
 
 Dataset* CSVFileSampleProvider::getAllSamples() {
-  if (dataset.getDimension() != 0) {
+  if (reader) {
+    return new Dataset{reader->readSamples()};
+  } else if (dataset.getDimension() != 0) {
     return this->getNextSamples(dataset.getNumberInstances());
   } else {
     throw base::file_exception{"No dataset loaded."};
@@ -120,8 +130,29 @@ Dataset* CSVFileSampleProvider::splitDataset(size_t howMany) {
   return tmpDataset.release();
 }
 
+void CSVFileSampleProvider::streamFile(const std::string& fileName,
+                                       bool hasTargets,
+                                       size_t readinCutoff,
+                                       std::vector<size_t> readinColumns,
+                                       std::vector<double> readinClasses) {
+  dataset = Dataset{};
+  counter = 0;
+  try {
+    reader = std::make_shared<DatasetStreamReader>(fileName, DatasetStreamReader::Format::CSV,
+        hasTargets, true, readinCutoff, readinColumns, readinClasses);
+    // validates the column selection
+    reader->getDimension();
+  } catch (...) {
+    reader.reset();
+    throw base::data_exception{"Failed to open CSV File for streaming."};
+  }
+}
+
 void CSVFileSampleProvider::reset() {
   counter = 0;
+  if (reader) {
+    reader->rewind();
+  }
 }
 
 } /* namespace datadriven */
@@ -12,7 +12,9 @@
 #pragma once
 
 #include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/DatasetStreamReader.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -80,6 +82,22 @@ class CSVFileSampleProvider : public FileSampleProvider {
                   std::vector<size_t> readinColumns = std::vector<size_t>(),
                   std::vector<double> readinClasses = std::vector<double>()) override;
 
+  /**
+   * Open an existing CSV file for streaming: samples are parsed from the file in each call of
+   * #getNextSamples instead of storing the whole file inside this class. Throws if the file can
+   * not be opened. Copies of the provider share the underlying file.
+   * @param filePath Path to an existing file.
+   * @param hasTargets whether the file has targest (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void streamFile(const std::string &filePath,
+                  bool hasTargets,
+                  size_t readinCutoff = -1,
+                  std::vector<size_t> readinColumns = std::vector<size_t>(),
+                  std::vector<double> readinClasses = std::vector<double>()) override;
+
   /**
    * Resets the state of the sample provider (e.g. to start a new epoch)
    */
@@ -103,6 +121,11 @@ class CSVFileSampleProvider : public FileSampleProvider {
    */
   size_t counter;
 
+  /**
+   * Reader of the file if it is streamed, nullptr otherwise
+   */
+  std::shared_ptr<DatasetStreamReader> reader;
+
   /**
    * Helper member function for #getNextSamples. Linearly walks through dataset, beginning at
    * counter and returns a pointer to a new instance of #sgpp::datadriven::Dataset containing the
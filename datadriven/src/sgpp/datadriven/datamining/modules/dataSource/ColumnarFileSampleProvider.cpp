@@ -0,0 +1,136 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/datamining/modules/dataSource/ColumnarFileSampleProvider.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+ColumnarFileSampleProvider::ColumnarFileSampleProvider(DataShufflingFunctor *shuffling)
+    : shuffling{shuffling},
+      file(nullptr),
+      selectedRows(),
+      selectedColumns(),
+      numberSamples(0),
+      counter(0) {}
+
+SampleProvider *ColumnarFileSampleProvider::clone() const {
+  return dynamic_cast<SampleProvider *>(new ColumnarFileSampleProvider{*this});
+}
+
+size_t ColumnarFileSampleProvider::getDim() const {
+  if (file) {
+    return selectedColumns.empty() ? file->getDimension() : selectedColumns.size();
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
+}
+
+size_t ColumnarFileSampleProvider::getNumSamples() const {
+  if (file) {
+    return numberSamples;
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
+}
+
+void ColumnarFileSampleProvider::readFile(const std::string &filePath,
+                                          bool hasTargets,
+                                          size_t readinCutoff,
+                                          std::vector<size_t> readinColumns,
+                                          std::vector<double> readinClasses) {
+  try {
+    file = std::make_shared<ColumnarDatasetFile>(filePath);
+  } catch (...) {
+    file.reset();
+    throw base::data_exception{"Failed to open columnar dataset file."};
+  }
+  if (hasTargets != file->hasTargets()) {
+    file.reset();
+    throw base::file_exception{hasTargets
+                                   ? "Columnar dataset file does not contain targets."
+                                   : "Columnar dataset file contains targets, but none expected."};
+  }
+  if (!readinColumns.empty() &&
+      *std::max_element(readinColumns.begin(), readinColumns.end()) >= file->getDimension()) {
+    file.reset();
+    throw base::data_exception{"Invalid column selection for columnar dataset file."};
+  }
+  selectedColumns = readinColumns;
+  selectedRows.clear();
+  counter = 0;
+
+  if (hasTargets && file->hasTargets() && !readinClasses.empty()) {
+    // scan the target blocks for admissible rows
+    for (size_t chunk = 0; chunk < file->getNumberChunks(); chunk++) {
+      const double *targets = file->getTargets(chunk);
+      size_t firstRow = chunk * file->getChunkRows();
+      for (size_t i = 0; i < file->getRowsInChunk(chunk) && selectedRows.size() < readinCutoff;
+           i++) {
+        for (double selectedClass : readinClasses) {
+          if (std::fabs(targets[i] - selectedClass) < 0.001) {
+            selectedRows.push_back(firstRow + i);
+            break;
+          }
+        }
+      }
+    }
+    numberSamples = selectedRows.size();
+  } else {
+    numberSamples = std::min(file->getNumberRows(), readinCutoff);
+  }
+}
+
+void ColumnarFileSampleProvider::readString(const std::string &input,
+                                            bool hasTargets,
+                                            size_t readinCutoff,
+                                            std::vector<size_t> readinColumns,
+                                            std::vector<double> readinClasses) {
+  throw base::data_exception{"Reading columnar dataset files from a string is not supported."};
+}
+
+Dataset *ColumnarFileSampleProvider::getNextSamples(size_t howMany) {
+  if (!file) {
+    throw base::file_exception("No dataset loaded.");
+  }
+  const size_t size = counter + howMany <= numberSamples ? howMany : numberSamples - counter;
+
+  std::vector<size_t> rows(size);
+  for (size_t i = 0; i < size; ++i) {
+    size_t idx = shuffling != nullptr ? (*shuffling)(counter + i, numberSamples) : counter + i;
+    rows[i] = selectedRows.empty() ? idx : selectedRows[idx];
+  }
+  counter = counter + size;
+
+  base::DataMatrix data;
+  base::DataVector targets;
+  file->gatherRows(rows, selectedColumns, data, targets);
+  return new Dataset{std::move(data), std::move(targets)};
+}
+
+Dataset *ColumnarFileSampleProvider::getAllSamples() {
+  if (file) {
+    return this->getNextSamples(numberSamples);
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
+}
+
+void ColumnarFileSampleProvider::reset() { counter = 0; }
+
+} /* namespace datadriven */
+} /* namespace sgpp */
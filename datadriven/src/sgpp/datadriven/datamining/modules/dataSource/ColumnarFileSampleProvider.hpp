@@ -0,0 +1,114 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/ColumnarDatasetFile.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * ColumnarFileSampleProvider provides samples from a binary columnar dataset file (see
+ * #sgpp::datadriven::ColumnarDatasetFile). The file is memory mapped instead of parsed, batches are
+ * gathered directly from the mapped column blocks. Files can be created from CSV or ARFF files
+ * with #sgpp::datadriven::ColumnarDatasetFile::convert.
+ */
+class ColumnarFileSampleProvider : public FileSampleProvider {
+ public:
+  /**
+   * Default constructor
+   * @param shuffling functor to permute the training data indexes
+   */
+  explicit ColumnarFileSampleProvider(DataShufflingFunctor *shuffling = nullptr);
+
+  /**
+   * Clone Pattern to allow copying of derived classes.
+   * @return a Pointer to a new instance of #sgpp::datadriven::ColumnarFileSampleProvider with
+   * copied state. Copies share the mapped file. Caller owns the new object.
+   */
+  SampleProvider *clone() const override;
+
+  Dataset *getNextSamples(size_t howMany) override;
+
+  Dataset *getAllSamples() override;
+
+  size_t getDim() const override;
+
+  size_t getNumSamples() const override;
+
+  /**
+   * Open and map an existing columnar dataset file. Throws if the file can not be opened or is not
+   * a columnar dataset file.
+   * @param filePath Path to an existing file.
+   * @param hasTargets whether the file has targets (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readFile(const std::string &filePath,
+                bool hasTargets,
+                size_t readinCutoff = -1,
+                std::vector<size_t> readinColumns = std::vector<size_t>(),
+                std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Not supported for binary files, throws.
+   * @param input string containing a columnar dataset file
+   * @param hasTargets whether the file has targest (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readString(const std::string &input,
+                  bool hasTargets,
+                  size_t readinCutoff = -1,
+                  std::vector<size_t> readinColumns = std::vector<size_t>(),
+                  std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Resets the state of the sample provider (e.g. to start a new epoch)
+   */
+  void reset() override;
+
+ private:
+  /**
+   * Functor to shuffle the data (permute the indexes)
+   */
+  DataShufflingFunctor *shuffling;
+
+  /**
+   * The mapped file
+   */
+  std::shared_ptr<ColumnarDatasetFile> file;
+
+  /**
+   * Rows of the file that are admissible w.r.t. the selected classes. Empty if all rows (up to the
+   * cutoff) are admissible.
+   */
+  std::vector<size_t> selectedRows;
+
+  /**
+   * Columns of the file that are used as dimensions, empty for all columns
+   */
+  std::vector<size_t> selectedColumns;
+
+  /**
+   * Number of samples provided
+   */
+  size_t numberSamples;
+
+  /**
+   * Indicates the index where #getNextSamples will start grabbing new samples in its next call.
+   */
+  size_t counter;
+};
+} /* namespace datadriven */
+} /* namespace sgpp */
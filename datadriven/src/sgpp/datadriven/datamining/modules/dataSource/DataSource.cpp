@@ -18,37 +18,90 @@
 #include <sgpp/datadriven/tools/Dataset.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <exception>
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 namespace sgpp {
 namespace datadriven {
 
 DataSource::DataSource(DataSourceConfig conf, SampleProvider* sp)
-    : config(conf), currentIteration(0), sampleProvider(std::unique_ptr<SampleProvider>(sp)) {
+    : config(conf),
+      currentIteration(0),
+      sampleProvider(std::unique_ptr<SampleProvider>(sp)),
+      transformationInitialized(false),
+      prefetchStop(false),
+      prefetchFinished(false) {
   // if a file name was specified, we are reading from a file, so we need to open it.
   if (!this->config.filePath.empty()) {
-    std::cout << "Read file " << config.filePath << std::endl;
-    dynamic_cast<FileSampleProvider*>(sampleProvider.get())
-        ->readFile(this->config.filePath, this->config.hasTargets, this->config.readinCutoff,
-                   this->config.readinColumns, this->config.readinClasses);
+    auto fileSampleProvider = dynamic_cast<FileSampleProvider*>(sampleProvider.get());
+    if (this->config.readinStreaming) {
+      std::cout << "Stream file " << config.filePath << std::endl;
+      fileSampleProvider->streamFile(this->config.filePath, this->config.hasTargets,
+                                     this->config.readinCutoff, this->config.readinColumns,
+                                     this->config.readinClasses);
+    } else {
+      std::cout << "Read file " << config.filePath << std::endl;
+      fileSampleProvider->readFile(this->config.filePath, this->config.hasTargets,
+                                   this->config.readinCutoff, this->config.readinColumns,
+                                   this->config.readinClasses);
+    }
   }
   // Build data transformation
   DataTransformationBuilder dataTrBuilder;
   dataTransformation = dataTrBuilder.buildTransformation(conf.dataTransformationConfig);
 }
 
+DataSource::~DataSource() { stopPrefetching(); }
+
 DataSourceIterator DataSource::begin() { return DataSourceIterator(*this, 0); }
 
 DataSourceIterator DataSource::end() { return DataSourceIterator(*this, config.numBatches); }
 
 Dataset* DataSource::getNextSamples() {
+  // prefetching only pays off if data is requested in batches
+  if (config.prefetchDepth == 0 || (config.numBatches == 1 && config.batchSize == 0)) {
+    currentIteration++;
+    return prepareNextSamples();
+  }
+
+  std::unique_lock<std::mutex> lock(prefetchMutex);
+  if (!prefetchThread.joinable()) {
+    prefetchStop = false;
+    prefetchFinished = false;
+    prefetchThread = std::thread(&DataSource::prefetch, this);
+  }
+  prefetchCondition.wait(lock, [this] { return !prefetchQueue.empty() || prefetchFinished; });
+
+  if (prefetchQueue.empty()) {
+    // the prefetching thread has terminated, so we can access the sample provider directly
+    lock.unlock();
+    prefetchThread.join();
+    if (prefetchException) {
+      std::exception_ptr exception = prefetchException;
+      prefetchException = nullptr;
+      std::rethrow_exception(exception);
+    }
+    currentIteration++;
+    return prepareNextSamples();
+  }
+
+  Dataset* dataset = prefetchQueue.front();
+  prefetchQueue.pop_front();
+  lock.unlock();
+  prefetchCondition.notify_all();
+  currentIteration++;
+  return dataset;
+}
+
+Dataset* DataSource::prepareNextSamples() {
   Dataset* dataset = nullptr;
 
   // only one iteration: we want all samples
   if (config.numBatches == 1 && config.batchSize == 0) {
-    currentIteration++;
     dataset = sampleProvider->getAllSamples();
 
     // Transform dataset if wanted
@@ -61,11 +114,11 @@ Dataset* DataSource::getNextSamples() {
     // several iterations
   } else {
     dataset = sampleProvider->getNextSamples(config.batchSize);
-    currentIteration++;
 
     // If data transformation wanted and first batch -> initialize transformation
-    if (currentIteration == 1 &&
+    if (!transformationInitialized &&
         !(config.dataTransformationConfig.type == DataTransformationType::NONE)) {
+      transformationInitialized = true;
       dataTransformation->initialize(dataset, config.dataTransformationConfig);
       return dataTransformation->doTransformation(dataset);
     }
@@ -78,6 +131,59 @@ Dataset* DataSource::getNextSamples() {
   }
 }
 
+void DataSource::prefetch() {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(prefetchMutex);
+      prefetchCondition.wait(
+          lock, [this] { return prefetchStop || prefetchQueue.size() < config.prefetchDepth; });
+      if (prefetchStop) {
+        return;
+      }
+    }
+
+    Dataset* dataset = nullptr;
+    try {
+      dataset = prepareNextSamples();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(prefetchMutex);
+      prefetchException = std::current_exception();
+      prefetchFinished = true;
+      prefetchCondition.notify_all();
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(prefetchMutex);
+    prefetchQueue.push_back(dataset);
+    // an empty batch signals that the sample provider is exhausted
+    if (dataset->getNumberInstances() == 0) {
+      prefetchFinished = true;
+    }
+    prefetchCondition.notify_all();
+    if (prefetchFinished) {
+      return;
+    }
+  }
+}
+
+void DataSource::stopPrefetching() {
+  {
+    std::lock_guard<std::mutex> lock(prefetchMutex);
+    prefetchStop = true;
+  }
+  prefetchCondition.notify_all();
+  if (prefetchThread.joinable()) {
+    prefetchThread.join();
+  }
+  for (Dataset* dataset : prefetchQueue) {
+    delete dataset;
+  }
+  prefetchQueue.clear();
+  prefetchException = nullptr;
+  prefetchStop = false;
+  prefetchFinished = false;
+}
+
 const DataSourceConfig& DataSource::getConfig() const { return config; }
 
 size_t DataSource::getCurrentIteration() const { return currentIteration; }
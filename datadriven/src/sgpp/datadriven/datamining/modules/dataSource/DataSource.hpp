@@ -17,7 +17,13 @@
 #include <sgpp/datadriven/datamining/modules/dataSource/SampleProvider.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 namespace sgpp {
 namespace datadriven {
@@ -28,6 +34,10 @@ class DataSourceIterator;
 /**
  * DataSource is a high level, easy to use interface for accessing data provided by a all kinds of
  * #sgpp::datadriven::SampleProvider. Should be used by end users.
+ *
+ * If DataSourceConfig::prefetchDepth is positive and data is requested in batches, the batches are
+ * read, shuffled and transformed by a background thread that runs up to prefetchDepth batches
+ * ahead of the consumer, so reading the next batch overlaps with processing the current one.
  */
 class DataSource {
  public:
@@ -38,7 +48,10 @@ class DataSource {
    */
   DataSource(DataSourceConfig config, SampleProvider* sampleProvider);
 
-  virtual ~DataSource() = default;
+  /**
+   * Destructor, stops the prefetching thread
+   */
+  virtual ~DataSource();
 
   /**
    * Read only access to the configuration used by DataSource and underlying SampleProvider.
@@ -48,7 +61,8 @@ class DataSource {
 
   /**
    * Request data from the underlying SampleProvider as specified in the provided configuration
-   * object upon construction.
+   * object upon construction. If prefetching is enabled, the batch is taken from the prefetch queue
+   * (waiting until it is ready) and the preparation of the following batches is started.
    * @return #sgpp::datadriven::Dataset containing requested amount of samples (if available).
    */
   virtual Dataset* getNextSamples();
@@ -82,6 +96,13 @@ class DataSource {
   virtual Dataset *getValidationData() = 0;
 
  protected:
+  /**
+   * Stops the prefetching thread and discards all batches that were prepared but not requested
+   * yet. Has to be called before the state of the sample provider is changed (e.g. reset), the
+   * next call of getNextSamples restarts prefetching from the new state.
+   */
+  void stopPrefetching();
+
   /**
    * Configuration file that determines all relevant properties of the object.
    */
@@ -101,6 +122,58 @@ class DataSource {
    * pointer to DataTransformation to perform transformations on init.
    */
   DataTransformation* dataTransformation;
+
+ private:
+  /**
+   * Reads the next batch from the sample provider and applies the data transformation.
+   * @return the prepared batch
+   */
+  Dataset* prepareNextSamples();
+
+  /**
+   * Main loop of the prefetching thread
+   */
+  void prefetch();
+
+  /**
+   * Whether the data transformation was initialized with the first batch
+   */
+  bool transformationInitialized;
+
+  /**
+   * Thread preparing the next batches
+   */
+  std::thread prefetchThread;
+
+  /**
+   * Batches prepared by the prefetching thread in the order they were read
+   */
+  std::deque<Dataset*> prefetchQueue;
+
+  /**
+   * Protects the prefetch queue and the flags below
+   */
+  std::mutex prefetchMutex;
+
+  /**
+   * Signals changes of the prefetch queue and the flags below
+   */
+  std::condition_variable prefetchCondition;
+
+  /**
+   * Requests the prefetching thread to stop
+   */
+  bool prefetchStop;
+
+  /**
+   * Set by the prefetching thread when the sample provider is exhausted or reading failed
+   */
+  bool prefetchFinished;
+
+  /**
+   * Exception thrown while preparing a batch, rethrown by getNextSamples
+   */
+  std::exception_ptr prefetchException;
 };
 
 } /* namespace datadriven */
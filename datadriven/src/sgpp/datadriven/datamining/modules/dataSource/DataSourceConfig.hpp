@@ -22,7 +22,7 @@ namespace datadriven {
 /**
  * Supported file types for sgpp::datadriven::FileSampleProvider
  */
-enum class DataSourceFileType { NONE, ARFF, CSV };
+enum class DataSourceFileType { NONE, ARFF, CSV, COLUMNAR };
 
 /**
  * Enumeration of all supported shuffling types used to permute samples in a dataset. An entry
@@ -48,6 +48,12 @@ struct DataSourceConfig {
    * The dataset is gzip compressed
    */
   bool isCompressed = false;
+  /**
+   * Parse the file batch by batch while iterating instead of reading it entirely up front (CSV and
+   * ARFF files only). Samples are then provided in file order and the number of samples is unknown,
+   * so this cannot be combined with shuffling or splitting into validation data.
+   */
+  bool readinStreaming = false;
   /**
    * How many batches should the dataset be split into for batch learning - if 1, take the
    * entire dataset
@@ -77,6 +83,12 @@ struct DataSourceConfig {
    * Seed for the shuffling prng
    */
   int64_t randomSeed = -1;
+  /**
+   * Number of batches that are prepared (read, shuffled and transformed) by a background thread
+   * ahead of their request, 0 to prepare each batch synchronously when it is requested. Only used
+   * if data is requested in batches.
+   */
+  size_t prefetchDepth = 0;
   /**
    * The number of epochs to train on
    */
@@ -34,6 +34,7 @@ Dataset* DataSourceCrossValidation::getValidationData() {
 }
 
 void DataSourceCrossValidation::reset() {
+  stopPrefetching();
   sampleProvider->reset();
 
   // Retrieve validation data again
@@ -43,6 +44,7 @@ void DataSourceCrossValidation::reset() {
 }
 
 void DataSourceCrossValidation::setFold(size_t foldIdx) {
+  stopPrefetching();
   shuffling->setFold(foldIdx);
 }
 
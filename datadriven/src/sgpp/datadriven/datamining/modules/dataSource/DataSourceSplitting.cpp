@@ -22,9 +22,15 @@ DataSourceSplitting::DataSourceSplitting(const DataSourceConfig& config,
 Dataset *DataSourceSplitting::getValidationData() { return validationData; }
 
 void DataSourceSplitting::reset() {
+  stopPrefetching();
   sampleProvider->reset();
   // Retrieve new validation data
   delete validationData;
+  if (config.validationPortion <= 0.0) {
+    // the number of samples is not needed (and unknown while streaming)
+    validationData = new Dataset{0, sampleProvider->getDim()};
+    return;
+  }
   size_t validationSize = static_cast<size_t>(config.validationPortion *
       static_cast<double>(sampleProvider->getNumSamples()));
   validationData = sampleProvider->getNextSamples(validationSize);
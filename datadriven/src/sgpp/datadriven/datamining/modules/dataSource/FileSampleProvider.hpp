@@ -60,6 +60,27 @@ class FileSampleProvider : public SampleProvider {
                           size_t readinCutoff = -1,
                           std::vector<size_t> readinColumns = std::vector<size_t>(),
                           std::vector<double> readinClasses = std::vector<double>()) = 0;
+
+  /**
+   * Open the file at the given path for reading it batch by batch: instead of parsing the whole
+   * file up front, each call of #getNextSamples parses only the requested samples. Samples are
+   * returned in file order (no shuffling) and the number of samples is not known in advance.
+   * Providers that do not support streaming read the entire file (default).
+   * @param filePath valid path to an existing file.
+   * @param hasTargets whether the file has targets (i.e. supervised learning)
+   * @param readinCutoff data line number after which to stop reading. Default: MAX_UINT - 1
+   * @param readinColumns specifies a subset of columns (dimensions). Only these columns are read in
+   *        Order sensitive. Default: empty which means all columns are considered
+   * @param readinClasses specifies a subset of classes. Only data lines with one of these classes
+   *        is read in. Default: empty which means all classes are considered
+   */
+  virtual void streamFile(const std::string &filePath,
+                          bool hasTargets,
+                          size_t readinCutoff = -1,
+                          std::vector<size_t> readinColumns = std::vector<size_t>(),
+                          std::vector<double> readinClasses = std::vector<double>()) {
+    readFile(filePath, hasTargets, readinCutoff, readinColumns, readinClasses);
+  }
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -10,8 +10,6 @@
  */
 
 #include <sgpp/datadriven/datamining/modules/dataSource/RosenblattTransformation.hpp>
-#include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformation.hpp>
-#include <sgpp/datadriven/operation/hash/simple/OperationRosenblattTransformation.hpp>
 
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/datadriven/application/LearnerSGDE.hpp>
@@ -22,7 +20,12 @@ namespace sgpp {
 namespace datadriven {
 
 RosenblattTransformation::RosenblattTransformation()
-    : grid(nullptr), alpha(nullptr), datasetTransformed(nullptr), datasetInvTransformed(nullptr) {}
+    : grid(nullptr),
+      alpha(nullptr),
+      opRos(nullptr),
+      opInvRos(nullptr),
+      datasetTransformed(nullptr),
+      datasetInvTransformed(nullptr) {}
 
 void RosenblattTransformation::initialize(Dataset *dataset, DataTransformationConfig config) {
   RosenblattTransformationConfig rbConfig = config.rosenblattConfig;
@@ -50,31 +53,33 @@ void RosenblattTransformation::initialize(Dataset *dataset, DataTransformationCo
   // Get grid and alpha
   grid = learner.getSharedGrid();
   alpha = learner.getSharedSurpluses();
+  opRos.reset(sgpp::op_factory::createOperationRosenblattTransformation(*this->grid));
+  opInvRos.reset(sgpp::op_factory::createOperationInverseRosenblattTransformation(*this->grid));
 
   std::cout << "Rosenblatt transformation initialized" << std::endl;
 }
 
 Dataset *RosenblattTransformation::doTransformation(Dataset *dataset) {
   std::cout << "Performing Rosenblatt transformation" << std::endl;
-  OperationRosenblattTransformation *opRos(
-      sgpp::op_factory::createOperationRosenblattTransformation(*this->grid));
   datasetTransformed = new Dataset{dataset->getNumberInstances(), dataset->getDimension()};
-
-  opRos->doTransformation(this->alpha.get(), &dataset->getData(), &datasetTransformed->getData());
-
+  doTransformation(dataset->getData(), datasetTransformed->getData());
   return datasetTransformed;
 }
 
 Dataset *RosenblattTransformation::doInverseTransformation(Dataset *dataset) {
   std::cout << "Performing Rosenblatt inverse transformation" << std::endl;
-  std::unique_ptr<sgpp::datadriven::OperationInverseRosenblattTransformation> opInvRos(
-      sgpp::op_factory::createOperationInverseRosenblattTransformation(*this->grid));
   datasetInvTransformed = new Dataset{dataset->getNumberInstances(), dataset->getDimension()};
+  doInverseTransformation(dataset->getData(), datasetInvTransformed->getData());
+  return datasetInvTransformed;
+}
 
-  opInvRos->doTransformation(this->alpha.get(), &dataset->getData(),
-                             &datasetInvTransformed->getData());
+void RosenblattTransformation::doTransformation(DataMatrix &points, DataMatrix &pointsCdf) {
+  opRos->doTransformation(this->alpha.get(), &points, &pointsCdf);
+}
 
-  return datasetInvTransformed;
+void RosenblattTransformation::doInverseTransformation(DataMatrix &pointsCdf,
+                                                       DataMatrix &points) {
+  opInvRos->doTransformation(this->alpha.get(), &pointsCdf, &points);
 }
 
 sgpp::datadriven::LearnerSGDE RosenblattTransformation::createSGDELearner(
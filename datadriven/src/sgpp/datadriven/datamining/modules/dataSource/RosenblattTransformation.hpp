@@ -13,12 +13,16 @@
 
 #include <sgpp/datadriven/datamining/modules/dataSource/DataTransformation.hpp>
 #include <sgpp/datadriven/application/LearnerSGDE.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformation.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationRosenblattTransformation.hpp>
 
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
+#include <memory>
+
 namespace sgpp {
 
 using sgpp::base::Grid;
@@ -62,6 +66,23 @@ class RosenblattTransformation : public DataTransformation {
    */
   Dataset *doInverseTransformation(Dataset *dataset) override;
 
+  /**
+   * Rosenblatt transformation of a batch of samples, parallelized over the samples. The
+   * conditional densities are set up once per start dimension and shared by all samples.
+   *
+   * @param points samples to be transformed (rows: # of samples, columns: # of dims)
+   * @param pointsCdf transformed samples, has to be of the same size as points
+   */
+  void doTransformation(DataMatrix &points, DataMatrix &pointsCdf);
+
+  /**
+   * Inverse Rosenblatt transformation of a batch of samples, parallelized over the samples.
+   *
+   * @param pointsCdf samples to be transformed backwards (rows: # of samples, columns: # of dims)
+   * @param points backwards transformed samples, has to be of the same size as pointsCdf
+   */
+  void doInverseTransformation(DataMatrix &pointsCdf, DataMatrix &points);
+
   /**
    * Helper function
    * It configures and creates a SGDE learner with meaningful parameters
@@ -79,6 +100,16 @@ class RosenblattTransformation : public DataTransformation {
    */
   std::shared_ptr<base::DataVector> alpha;
 
+  /**
+   * Rosenblatt transformation operation on #grid, created on initialization
+   */
+  std::unique_ptr<OperationRosenblattTransformation> opRos;
+
+  /**
+   * Inverse Rosenblatt transformation operation on #grid, created on initialization
+   */
+  std::unique_ptr<OperationInverseRosenblattTransformation> opInvRos;
+
   /**
    * Pointer to #sgpp::datadriven::Dataset
    */
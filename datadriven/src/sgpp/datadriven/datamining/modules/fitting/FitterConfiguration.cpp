@@ -124,6 +124,7 @@ void FitterConfiguration::create(sgpp::datadriven::FitterConfiguration &m) {
     solverRefineConfig.eps_ = m.solverRefineConfig.eps_;
     solverRefineConfig.maxIterations_ = m.solverRefineConfig.maxIterations_;
     solverRefineConfig.verbose_ = m.solverRefineConfig.verbose_;
+    solverRefineConfig.preconditioner_ = m.solverRefineConfig.preconditioner_;
 
 
     // Set Solver Final Config
@@ -133,6 +134,7 @@ void FitterConfiguration::create(sgpp::datadriven::FitterConfiguration &m) {
     solverFinalConfig.eps_ = m.solverFinalConfig.eps_;
     solverFinalConfig.threshold_ = m.solverFinalConfig.threshold_;
     solverFinalConfig.type_ = m.solverFinalConfig.type_;
+    solverFinalConfig.preconditioner_ = m.solverFinalConfig.preconditioner_;
 
 
     // Set Regularization Config
@@ -252,12 +254,14 @@ void FitterConfiguration::setupDefaults() {
   solverRefineConfig.maxIterations_ = 100;
   solverRefineConfig.threshold_ = 1e-12;
   solverRefineConfig.verbose_ = false;
+  solverRefineConfig.preconditioner_ = sgpp::solver::SLEPreconditionerType::None;
 
   solverFinalConfig.type_ = sgpp::solver::SLESolverType::CG;
   solverFinalConfig.eps_ = 1e-12;
   solverFinalConfig.maxIterations_ = 100;
   solverFinalConfig.threshold_ = 1e-12;
   solverFinalConfig.verbose_ = false;
+  solverFinalConfig.preconditioner_ = sgpp::solver::SLEPreconditionerType::None;
 
   regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
   regularizationConfig.lambda_ = 0.01;
@@ -17,6 +17,10 @@
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 #include <sgpp/solver/sle/BiCGStab.hpp>
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
+#include <sgpp/solver/sle/preconditioner/JacobiPreconditioner.hpp>
+#include <sgpp/solver/sle/preconditioner/LevelScalingPreconditioner.hpp>
 #include <string>
 #include <vector>
 
@@ -35,6 +39,9 @@ using sgpp::solver::SLESolver;
 using sgpp::solver::SLESolverType;
 using sgpp::solver::ConjugateGradients;
 using sgpp::solver::BiCGStab;
+using sgpp::solver::PipelinedConjugateGradients;
+using sgpp::solver::PreconditionedConjugateGradients;
+using sgpp::solver::SLEPreconditionerType;
 using sgpp::solver::SLESolverConfiguration;
 
 ModelFittingBase::ModelFittingBase()
@@ -127,10 +134,21 @@ std::vector<std::vector<size_t>> ModelFittingBase::getInteractions(
 
 
 SLESolver *ModelFittingBase::buildSolver(const SLESolverConfiguration &sleConfig) const {
+  if (sleConfig.preconditioner_ != SLEPreconditionerType::None &&
+      sleConfig.type_ != SLESolverType::CG && sleConfig.type_ != SLESolverType::PipelinedCG) {
+    throw factory_exception(
+        "ModelFittingBase: Preconditioning is only supported by the CG and PipelinedCG solvers");
+  }
+
   if (sleConfig.type_ == SLESolverType::CG) {
+    if (sleConfig.preconditioner_ != SLEPreconditionerType::None) {
+      return new PreconditionedConjugateGradients(sleConfig.maxIterations_, sleConfig.eps_);
+    }
     return new ConjugateGradients(sleConfig.maxIterations_, sleConfig.eps_);
   } else if (sleConfig.type_ == SLESolverType::BiCGSTAB) {
     return new BiCGStab(sleConfig.maxIterations_, sleConfig.eps_);
+  } else if (sleConfig.type_ == SLESolverType::PipelinedCG) {
+    return new PipelinedConjugateGradients(sleConfig.maxIterations_, sleConfig.eps_);
   } else {
     throw factory_exception(
         "ModelFittingBase: An unsupported SLE solver type was "
@@ -138,6 +156,23 @@ SLESolver *ModelFittingBase::buildSolver(const SLESolverConfiguration &sleConfig
   }
 }
 
+solver::Preconditioner *ModelFittingBase::buildPreconditioner(
+    const SLESolverConfiguration &sleConfig, DMSystemMatrixBase &systemMatrix, Grid &grid) const {
+  switch (sleConfig.preconditioner_) {
+    case SLEPreconditionerType::None:
+      return nullptr;
+    case SLEPreconditionerType::Jacobi: {
+      DataVector diagonal(grid.getSize());
+      systemMatrix.getDiagonal(diagonal);
+      return new solver::JacobiPreconditioner(diagonal);
+    }
+    case SLEPreconditionerType::LevelScaling:
+      return new solver::LevelScalingPreconditioner(grid.getStorage());
+    default:
+      throw factory_exception("ModelFittingBase: An unsupported preconditioner was chosen");
+  }
+}
+
 void ModelFittingBase::reconfigureSolver(SLESolver &solver,
                                          const SLESolverConfiguration &sleConfig) const {
   solver.setMaxIterations(sleConfig.maxIterations_);
@@ -10,11 +10,13 @@
 #include <sgpp/base/exception/not_implemented_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/datadriven/algorithm/DMSystemMatrixBase.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/FitterConfiguration.hpp>
 #include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 #include <sgpp/solver/SLESolver.hpp>
 #include <sgpp/solver/TypesSolver.hpp>
+#include <sgpp/solver/sle/preconditioner/Preconditioner.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashGenerator.hpp>
 #include <sgpp/datadriven/algorithm/GridFactory.hpp>
@@ -198,6 +200,17 @@ class ModelFittingBase {
    */
   SLESolver *buildSolver(const SLESolverConfiguration &config) const;
 
+  /**
+   * Factory member function to build the preconditioner of the conjugate gradient solvers
+   * according to the config. It has to be rebuilt whenever the grid or the data changes.
+   * @param config configuration for the solver object
+   * @param systemMatrix system matrix of the learning problem
+   * @param grid grid of the learning problem
+   * @return new preconditioner object that is owned by the caller (nullptr if none is configured)
+   */
+  solver::Preconditioner *buildPreconditioner(const SLESolverConfiguration &config,
+                                              DMSystemMatrixBase &systemMatrix, Grid &grid) const;
+
   /**
    * Configure solver based on the desired configuration
    * @param solver the solver object to be modified.
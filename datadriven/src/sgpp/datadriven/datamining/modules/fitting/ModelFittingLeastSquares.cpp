@@ -8,6 +8,7 @@
 #include <sgpp/datadriven/algorithm/SystemMatrixLeastSquaresIdentity.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingLeastSquares.hpp>
 #include <sgpp/solver/SLESolver.hpp>
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
 
 #include <sgpp/base/exception/application_exception.hpp>
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
@@ -24,6 +25,9 @@ using sgpp::base::SurplusRefinementFunctor;
 using sgpp::base::application_exception;
 
 using sgpp::solver::SLESolver;
+using sgpp::solver::SLESolverConfiguration;
+using sgpp::solver::SLEPreconditionerType;
+using sgpp::solver::PreconditionedConjugateGradients;
 
 namespace sgpp {
 namespace datadriven {
@@ -32,7 +36,13 @@ ModelFittingLeastSquares::ModelFittingLeastSquares(const FitterConfigurationLeas
     : ModelFittingBaseSingleGrid{}, refinementsPerformed{0} {
   this->config = std::unique_ptr<FitterConfiguration>(
       std::make_unique<FitterConfigurationLeastSquares>(config));
-  solver = std::unique_ptr<SLESolver>{buildSolver(this->config->getSolverFinalConfig())};
+  // the solver is shared by the refinement steps and the final step, so it has to support
+  // preconditioning if either of them uses a preconditioner
+  SLESolverConfiguration solverConfig = this->config->getSolverFinalConfig();
+  if (solverConfig.preconditioner_ == SLEPreconditionerType::None) {
+    solverConfig.preconditioner_ = this->config->getSolverRefineConfig().preconditioner_;
+  }
+  solver = std::unique_ptr<SLESolver>{buildSolver(solverConfig)};
 }
 
 // TODO(lettrich): exceptions have to be thrown if not valid.
@@ -128,7 +138,20 @@ void ModelFittingLeastSquares::assembleSystemAndSolve(const SLESolverConfigurati
   systemMatrix->generateb(dataset->getTargets(), b);
 
   reconfigureSolver(*solver, solverConfig);
+
+  // the preconditioner depends on the grid and the data, so it is built for every solve
+  auto preconditioner = std::unique_ptr<solver::Preconditioner>{
+      buildPreconditioner(solverConfig, *systemMatrix, *grid)};
+  auto preconditionedSolver = dynamic_cast<PreconditionedConjugateGradients *>(solver.get());
+  if (preconditionedSolver != nullptr) {
+    preconditionedSolver->setPreconditioner(preconditioner.get());
+  }
+
   solver->solve(*systemMatrix, alpha, b, true, verboseSolver, DEFAULT_RES_THRESHOLD);
+
+  if (preconditionedSolver != nullptr) {
+    preconditionedSolver->setPreconditioner(nullptr);
+  }
 }
 }  // namespace datadriven
 }  // namespace sgpp
@@ -0,0 +1,61 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/datadriven/functors/MultiGridRefinementFunctor.hpp>
+
+#include <memory>
+#include <vector>
+
+
+namespace sgpp {
+namespace datadriven {
+
+  void MultiGridRefinementFunctor::evaluateAtGridPoints(
+      const std::vector<base::Grid*>& grids,
+      const std::vector<base::DataVector*>& alphas,
+      base::GridStorage& points,
+      base::DataMatrix& evals) {
+    points.clear();
+    if (grids.empty()) {
+      evals.resize(0, 0);
+      return;
+    }
+
+    // Union of the grid points, identified by level and index
+    for (size_t j = 0; j < grids.size(); j++) {
+      base::GridStorage& storage = grids.at(j)->getStorage();
+      for (size_t k = 0; k < storage.getSize(); k++) {
+        if (!points.isContaining(storage.getPoint(k))) {
+          points.insert(storage.getPoint(k));
+        }
+      }
+    }
+
+    // Coordinates of the union
+    size_t numPoints = points.getSize();
+    base::DataMatrix coords(numPoints, points.getDimension());
+    base::DataVector p(points.getDimension());
+    for (size_t k = 0; k < numPoints; k++) {
+      points.getPoint(k).getStandardCoordinates(p);
+      coords.setRow(k, p);
+    }
+
+    // Evaluate every grid at all points at once
+    base::DataVector evalVec(numPoints);
+    evals.resize(numPoints, grids.size());
+    for (size_t i = 0; i < grids.size(); i++) {
+      std::unique_ptr<base::OperationMultipleEval>
+        opEval(op_factory::createOperationMultipleEval(*grids.at(i),
+                                                       coords));
+      opEval->eval(*alphas.at(i), evalVec);
+      evals.setColumn(i, evalVec);
+    }
+  }
+
+}  // namespace datadriven
+}  // namespace sgpp
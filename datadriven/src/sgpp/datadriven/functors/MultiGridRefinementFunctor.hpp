@@ -7,8 +7,14 @@
 #ifndef MULTIGRIDREFINMENTFUNCTOR_HPP
 #define MULTIGRIDREFINMENTFUNCTOR_HPP
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/grid/generation/functors/RefinementFunctor.hpp>
 
+#include <vector>
+
 
 namespace sgpp {
 namespace datadriven {
@@ -39,6 +45,23 @@ class MultiGridRefinementFunctor : public base::RefinementFunctor {
   virtual void preComputeEvaluations() { }
 
   virtual ~MultiGridRefinementFunctor() { }
+
+ protected:
+  /**
+   * Evaluates all grids at the union of the grid points of all grids,
+   * with one multiple evaluation per grid.
+   *
+   * @param grids The grids
+   * @param alphas Surpluses related to the grids
+   * @param[out] points Union of the grid points of all grids, the sequence
+   *             number of a grid point is its row in evals
+   * @param[out] evals Evaluations of the i-th grid at the points in the
+   *             i-th column
+   */
+  static void evaluateAtGridPoints(const std::vector<base::Grid*>& grids,
+                                   const std::vector<base::DataVector*>& alphas,
+                                   base::GridStorage& points,
+                                   base::DataMatrix& evals);
 };
 }  // namespace datadriven
 }  // namespace sgpp
@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdlib>
+#include <memory>
 #include <vector>
 
 
@@ -45,19 +46,36 @@ namespace datadriven {
 
   double DataBasedRefinementFunctor::operator()(base::GridStorage& storage,
                                                 size_t seq) const {
-    size_t accum = 0;
     base::HashGridPoint& gp = storage.getPoint(seq);
-    base::DataVector p(data->getNcols());
+    const base::DataMatrix& hk = h.at(current_grid_index);
+    size_t dim = hk.getNcols();
+
+    // Support of the basis function at seq, computed once instead of once
+    // per data point
+    std::vector<double> lower(dim);
+    std::vector<double> upper(dim);
+    for (size_t d = 0; d < dim; d++) {
+      double coord = gp.getStandardCoordinate(d);
+      size_t level = gp.getLevel(d);
+      double step = 1.0 / pow(2.0, static_cast<double>(level));
+      lower[d] = coord - step;
+      upper[d] = coord + step;
+    }
 
     // How many data points of H lie in the support of seq?
-    for (size_t j = 0; j < h.at(current_grid_index).getNrows(); j++) {
-      h.at(current_grid_index).getRow(j, p);
-      if (isWithinSupport(gp, p)) {
+    size_t accum = 0;
+    const double* point = hk.getPointer();
+    for (size_t j = 0; j < hk.getNrows(); j++, point += dim) {
+      size_t d = 0;
+      while (d < dim && !(point[d] < lower[d] || point[d] > upper[d])) {
+        d++;
+      }
+      if (d == dim) {
         accum++;
       }
     }
     double score = static_cast<double>(accum);
-    double levelSum = storage.getPoint(seq).getLevelSum();
+    double levelSum = gp.getLevelSum();
     double levelW = pow(2.0, -levelSum);
     if (level_penalize) {
       score *= levelW;
@@ -92,24 +110,24 @@ namespace datadriven {
   }
 
   void DataBasedRefinementFunctor::computeH() {
-    // Evaluate all grids at all data points
+    // Evaluate all grids at all data points, one multiple evaluation per grid
     base::DataVector evalVec(data->getNrows());
     evals.resize(data->getNrows(), grids.size());
+    means.assign(grids.size(), 0.0);
     for (size_t i = 0; i < grids.size(); i++) {
       std::unique_ptr<base::OperationMultipleEval>
         opEval(op_factory::createOperationMultipleEval(*grids.at(i),
                                                        *data));
       opEval->eval(*alphas.at(i), evalVec);
       evals.setColumn(i, evalVec);
-      means.push_back(evalVec.sum() *
-                      (1.0 / static_cast<double>(data->getNrows())));
+      means.at(i) = evalVec.sum() *
+                    (1.0 / static_cast<double>(data->getNrows()));
     }
 
     // Compute the sets H_k by pairwise H_kl for all class combiniations
     // of k != l
+    h.assign(grids.size(), base::DataMatrix(0, data->getNcols()));
     for (size_t i = 0; i < grids.size(); i++) {
-      h.push_back(base::DataMatrix());
-      h.at(i).resize(0, data->getNcols());
       for (size_t j = 0; j < grids.size(); j++) {
         if (i == j) {
           continue;
@@ -137,22 +155,6 @@ namespace datadriven {
     }
   }
 
-  bool DataBasedRefinementFunctor::isWithinSupport(base::HashGridPoint& gp,
-                                                   base::DataVector& point)
-    const {
-    for (size_t d = 0; d < point.getSize(); d++) {
-      double coord = gp.getStandardCoordinate(d);
-      size_t level = gp.getLevel(d);
-      double step = 1.0 / pow(2.0, static_cast<double>(level));
-      double lower = coord - step;
-      double upper = coord + step;
-      if (point.get(d) < lower || point.get(d) > upper) {
-        return false;
-      }
-    }
-    return true;
-  }
-
   base::DataMatrix& DataBasedRefinementFunctor::getHk(size_t index) {
     return h.at(index);
   }
@@ -135,12 +135,6 @@ class DataBasedRefinementFunctor : public MultiGridRefinementFunctor {
   void computeHkl(base::DataMatrix& inters,
                   size_t cl_ind1,
                   size_t cl_ind2);
-
-  /**
-   * Is point in support of basis function at gp
-   */
-  bool isWithinSupport(base::HashGridPoint& gp,
-                       base::DataVector& point) const;
 };
 }  // namespace datadriven
 }  // namespace sgpp
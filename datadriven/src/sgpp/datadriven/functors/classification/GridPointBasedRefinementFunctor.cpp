@@ -4,6 +4,7 @@
 // sgpp.sparsegrids.org
 
 
+#include <sgpp/base/exception/application_exception.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/datadriven/functors/classification/GridPointBasedRefinementFunctor.hpp>
@@ -11,10 +12,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdlib>
-#include <utility>
 #include <vector>
-#include <map>
-#include <string>
 
 
 namespace sgpp {
@@ -31,11 +29,8 @@ namespace datadriven {
     refinements_num(r_num), threshold(thresh),
     level_penalize(level_penalize),
     pre_compute(pre_compute),
-    pre_comp_evals() {
-    // Add a map for each grid
-    for (size_t i = 0; i < grids.size(); i++) {
-      pre_comp_evals.push_back(std::map<std::string, double>());
-    }
+    pre_comp_points(grids.empty() ? 0 : grids.at(0)->getDimension()),
+    pre_comp_evals(0, grids.size()) {
   }
 
   double
@@ -49,14 +44,19 @@ namespace datadriven {
     std::vector<double> gridEvals;
 
     // Get the evaluations of seq at all GridSave
-    base::DataVector p(storage.getDimension());
-    storage.getPoint(seq).getStandardCoordinates(p);
     if (pre_compute) {
+      size_t row = pre_comp_points.getSequenceNumber(storage.getPoint(seq));
+      if (row >= pre_comp_points.getSize()) {
+        throw base::application_exception(
+          "GridPointBasedRefinementFunctor: grid point not precomputed, "
+          "call preComputeEvaluations() first");
+      }
       for (size_t i = 0; i < grids.size(); i++) {
-        std::string key = p.toString();
-        gridEvals.push_back(pre_comp_evals.at(i).at(key));
+        gridEvals.push_back(pre_comp_evals.get(row, i));
       }
     } else {
+      base::DataVector p(storage.getDimension());
+      storage.getPoint(seq).getStandardCoordinates(p);
       for (size_t i = 0; i < grids.size(); i++) {
         std::unique_ptr<base::OperationEval>
           opEval(op_factory::createOperationEval(*grids.at(i)));
@@ -85,32 +85,9 @@ namespace datadriven {
   }
 
   void GridPointBasedRefinementFunctor::preComputeEvaluations() {
-    base::DataVector p(grids.at(0)->getDimension());
-    std::string key = "";
-    double v = 0.0;
-    // Evaluated at (!) grid with index i and store in the i-th map
-    // Here grid points are not only evaluated at their own grid but at
-    // all grids
-    for (size_t i = 0; i < grids.size(); i++) {
-      std::unique_ptr<base::OperationEval>
-        opEval(op_factory::createOperationEval(*grids.at(i)));
-      pre_comp_evals.at(i).clear();
-      // Iterate over all possible grid point coordinates of all grids
-      for (size_t j = 0; j < grids.size(); j++) {
-        for (size_t k = 0; k < grids.at(j)->getSize(); k++) {
-          // The coordinates
-          grids.at(j)->getStorage().getPoint(k).getStandardCoordinates(p);
-          // The hash key
-          key = p.toString();
-          // Does the key already exist?
-          if (pre_comp_evals.at(i).count(key) == 0) {
-            v = opEval->eval(*alphas.at(i), p);
-            pre_comp_evals.at(i).insert(std::pair<std::string, double>(key,
-                                                                       v));
-          }
-        }
-      }
-    }
+    // Evaluate all grids at the union of the grid points of all grids,
+    // the grid points are looked up by level and index in operator()
+    evaluateAtGridPoints(grids, alphas, pre_comp_points, pre_comp_evals);
   }
 
   double GridPointBasedRefinementFunctor::start() const {
@@ -7,14 +7,13 @@
 #ifndef GRIDPOINTBASEDREFINEMENTFUNCTOR_HPP
 #define GRIDPOINTBASEDREFINEMENTFUNCTOR_HPP
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/datadriven/functors/MultiGridRefinementFunctor.hpp>
 
 #include <vector>
-#include <map>
-#include <string>
 
 
 namespace sgpp {
@@ -75,11 +74,17 @@ class GridPointBasedRefinementFunctor : public MultiGridRefinementFunctor {
   bool pre_compute;
 
   /**
-   * Stores grid evaluations at all grids (vector) at the union
-   * of grid point coordinates over all grids (hashed by string representation
-   * in the map)
+   * Union of the grid points of all grids. The hash map of the storage
+   * yields the row of a grid point in pre_comp_evals.
    */
-  std::vector<std::map<std::string, double>> pre_comp_evals;
+  base::GridStorage pre_comp_points;
+
+  /**
+   * Stores grid evaluations at all grids (columns) at the union
+   * of grid points over all grids (rows, by sequence number in
+   * pre_comp_points)
+   */
+  base::DataMatrix pre_comp_evals;
 };
 }  // namespace datadriven
 }  // namespace sgpp
@@ -97,6 +97,7 @@ class MultipleClassRefinementFunctor: public ZeroCrossingRefinementFunctor {
 
   // what grid is refined, if false, use current_grid_index
   bool refineMulti = false;
+  // accumulated by operator(), which is therefore not thread-safe (see isThreadSafe())
   mutable double borderSum;
   mutable double borderCnt;
 
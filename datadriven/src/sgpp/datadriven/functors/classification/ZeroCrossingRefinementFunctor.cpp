@@ -4,6 +4,7 @@
 // sgpp.sparsegrids.org
 
 
+#include <sgpp/base/exception/application_exception.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/datadriven/functors/classification/ZeroCrossingRefinementFunctor.hpp>
@@ -11,10 +12,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdlib>
-#include <utility>
 #include <vector>
-#include <map>
-#include <string>
 
 
 namespace sgpp {
@@ -30,10 +28,9 @@ namespace datadriven {
     grids(grids), alphas(alphas), current_grid_index(0),
     refinements_num(refinements_num), threshold(thresh),
     level_penalize(level_penalize),
-    pre_compute(pre_compute), pre_comp_evals() {
-    for (size_t i = 0; i < grids.size(); i++) {
-      this->pre_comp_evals.push_back(std::map<std::string, double>());
-    }
+    pre_compute(pre_compute),
+    pre_comp_points(grids.empty() ? 0 : grids.at(0)->getDimension()),
+    pre_comp_evals(0, grids.size()) {
   }
 
   double ZeroCrossingRefinementFunctor::operator()(base::GridStorage&
@@ -122,15 +119,20 @@ namespace datadriven {
   getEvalVector(size_t ind,
                 size_t seq) const {
     base::HashGridPoint& gp = grids.at(ind)->getStorage().getPoint(seq);
-    base::DataVector coords(grids.at(ind)->getDimension());
-    gp.getStandardCoordinates(coords);
     std::vector<double> evals;
     if (pre_compute) {
+      size_t row = pre_comp_points.getSequenceNumber(gp);
+      if (row >= pre_comp_points.getSize()) {
+        throw base::application_exception(
+          "ZeroCrossingRefinementFunctor: grid point not precomputed, "
+          "call preComputeEvaluations() first");
+      }
       for (size_t i = 0; i < grids.size(); i++) {
-        std::string key = coords.toString();
-        evals.push_back(pre_comp_evals.at(i).at(key));
+        evals.push_back(pre_comp_evals.get(row, i));
       }
     } else {
+      base::DataVector coords(grids.at(ind)->getDimension());
+      gp.getStandardCoordinates(coords);
       for (size_t j = 0; j < grids.size(); j++) {
         std::unique_ptr<base::OperationEval>
           opEval(op_factory::createOperationEval(*grids.at(j)));
@@ -164,26 +166,7 @@ namespace datadriven {
 
   // For comments see GridPointBasedRefinementFunctor.cpp, exactly the same
   void ZeroCrossingRefinementFunctor::preComputeEvaluations() {
-    base::DataVector p(grids.at(0)->getDimension());
-    std::string key = "";
-    double v = 0.0;
-    for (size_t i = 0; i < grids.size(); i++) {
-      std::unique_ptr<base::OperationEval>
-        opEval(op_factory::createOperationEval(*grids.at(i)));
-      pre_comp_evals.at(i).clear();
-
-      for (size_t j = 0; j < grids.size(); j++) {
-        for (size_t k = 0; k < grids.at(j)->getSize(); k++) {
-          grids.at(j)->getStorage().getPoint(k).getStandardCoordinates(p);
-          key = p.toString();
-          if (pre_comp_evals.at(i).count(key) == 0) {
-            v = opEval->eval(*alphas.at(i), p);
-            pre_comp_evals.at(i).insert(std::pair<std::string, double>(key,
-                                                                       v));
-          }
-        }
-      }
-    }
+    evaluateAtGridPoints(grids, alphas, pre_comp_points, pre_comp_evals);
   }
 
   int ZeroCrossingRefinementFunctor::sgn(double d) const {
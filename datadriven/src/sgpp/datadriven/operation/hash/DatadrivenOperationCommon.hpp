@@ -49,6 +49,9 @@ class OperationMultipleEvalConfiguration {
   // optional - can be set for easier reporting
   std::string name;
 
+  // optional - if set, the factory selects the configuration with the autotuner
+  std::string tuningFileName;
+
  public:
   OperationMultipleEvalConfiguration(
       OperationMultipleEvalType type = OperationMultipleEvalType::DEFAULT,
@@ -92,6 +95,20 @@ class OperationMultipleEvalConfiguration {
   std::shared_ptr<base::OperationConfiguration> getParameters() { return this->parameters; }
 
   std::string& getName() { return this->name; }
+
+  /**
+   * Lets op_factory::createOperationMultipleEval select the fastest kernel with a
+   * MultipleEvalAutoTuner instead of using the type, subtype and parameters of this
+   * configuration.
+   *
+   * @param tuningFileName JSON file the autotuner reads and writes its results to,
+   *                       an empty name disables autotuning
+   */
+  void setAutoTuning(const std::string& tuningFileName) { this->tuningFileName = tuningFileName; }
+
+  bool isAutoTuned() { return !this->tuningFileName.empty(); }
+
+  std::string& getTuningFileName() { return this->tuningFileName; }
 };
 }  // namespace datadriven
 }  // namespace sgpp
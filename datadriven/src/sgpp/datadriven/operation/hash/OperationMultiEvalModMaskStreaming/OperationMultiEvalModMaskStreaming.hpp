@@ -20,6 +20,17 @@
 #define STREAMING_MODLINEAR_MIC_AVX512_UNROLLING_WIDTH 96
 #endif
 
+// number of data points the kernels process at once, has to divide getChunkDataPoints()
+#if defined(__MIC__) || defined(__AVX512F__)
+#define STREAMING_MODLINEAR_UNROLLING_WIDTH STREAMING_MODLINEAR_MIC_AVX512_UNROLLING_WIDTH
+#elif defined(__AVX__)
+#define STREAMING_MODLINEAR_UNROLLING_WIDTH 24
+#elif defined(__SSE3__)
+#define STREAMING_MODLINEAR_UNROLLING_WIDTH 12
+#else
+#define STREAMING_MODLINEAR_UNROLLING_WIDTH 8
+#endif
+
 namespace sgpp {
 namespace datadriven {
 
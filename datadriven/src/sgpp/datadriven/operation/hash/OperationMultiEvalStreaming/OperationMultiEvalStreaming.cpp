@@ -11,11 +11,17 @@ namespace sgpp {
 namespace datadriven {
 
 OperationMultiEvalStreaming::OperationMultiEvalStreaming(base::Grid& grid,
-                                                         base::DataMatrix& dataset)
+                                                         base::DataMatrix& dataset,
+                                                         size_t chunkGridPoints)
     : OperationMultipleEval(grid, dataset),
       preparedDataset(dataset),
       myTimer_(sgpp::base::SGppStopwatch()),
+      chunkGridPoints(chunkGridPoints),
       duration(-1.0) {
+  if (chunkGridPoints == 0) {
+    throw sgpp::base::operation_exception("chunkGridPoints must not be zero!");
+  }
+
   this->storage = &grid.getStorage();
   this->padDataset(this->preparedDataset);
   this->preparedDataset.transpose();
@@ -75,7 +81,7 @@ void OperationMultiEvalStreaming::getOpenMPPartitionSegment(size_t start, size_t
 
 size_t OperationMultiEvalStreaming::getChunkGridPoints() {
   // not used by the MIC-implementation
-  return 12;
+  return this->chunkGridPoints;
 }
 size_t OperationMultiEvalStreaming::getChunkDataPoints() {
 #if defined(__MIC__) || defined(__AVX512F__)
@@ -17,6 +17,17 @@
 #define STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH 96
 #endif
 
+// number of data points the kernels process at once, has to divide getChunkDataPoints()
+#if defined(__MIC__) || defined(__AVX512F__)
+#define STREAMING_LINEAR_UNROLLING_WIDTH STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH
+#elif defined(__AVX__)
+#define STREAMING_LINEAR_UNROLLING_WIDTH 24
+#elif defined(__SSE3__)
+#define STREAMING_LINEAR_UNROLLING_WIDTH 12
+#else
+#define STREAMING_LINEAR_UNROLLING_WIDTH 8
+#endif
+
 namespace sgpp {
 namespace datadriven {
 
@@ -32,10 +43,14 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
 
   base::GridStorage* storage;
 
+  /// number of grid points the kernels process at once
+  size_t chunkGridPoints;
+
   double duration;
 
  public:
-  OperationMultiEvalStreaming(base::Grid& grid, base::DataMatrix& dataset);
+  OperationMultiEvalStreaming(base::Grid& grid, base::DataMatrix& dataset,
+                              size_t chunkGridPoints = 12);
 
   ~OperationMultiEvalStreaming();
 
@@ -0,0 +1,201 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingBSpline/OperationMultiEvalStreamingBSpline.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+OperationMultiEvalStreamingBSpline::OperationMultiEvalStreamingBSpline(base::Grid& grid,
+                                                                       size_t degree,
+                                                                       base::DataMatrix& dataset,
+                                                                       size_t chunkGridPoints)
+    : OperationMultipleEval(grid, dataset),
+      preparedDataset(dataset, STREAMING_BSPLINE_UNROLLING_WIDTH),
+      degree(degree),
+      isModified(grid.getType() == base::GridType::ModBspline),
+      chunkGridPoints(chunkGridPoints),
+      myTimer_(sgpp::base::SGppStopwatch()),
+      duration(-1.0) {
+  if ((degree == 0) || (degree % 2 == 0)) {
+    throw sgpp::base::operation_exception("B-spline degree must be odd!");
+  }
+
+  if (chunkGridPoints == 0) {
+    throw sgpp::base::operation_exception("chunkGridPoints must not be zero!");
+  }
+
+  this->storage = &grid.getStorage();
+
+  // B(x) = 1/p! * sum_k (-1)^k * binom(p + 1, k) * max(x - k, 0)^p
+  double coefficient = 1.0;
+
+  for (size_t p = 2; p <= degree; p++) {
+    coefficient /= static_cast<double>(p);
+  }
+
+  for (size_t k = 0; k < (degree + 1) / 2; k++) {
+    this->truncatedPowerCoefficients.push_back(coefficient);
+    coefficient *= -static_cast<double>(degree + 1 - k) / static_cast<double>(k + 1);
+  }
+
+  // create the kernel specific data structures for the current grid
+  this->prepare();
+}
+
+OperationMultiEvalStreamingBSpline::~OperationMultiEvalStreamingBSpline() {}
+
+void OperationMultiEvalStreamingBSpline::getPartitionSegment(size_t start, size_t end,
+                                                             size_t segmentCount,
+                                                             size_t segmentNumber,
+                                                             size_t* segmentStart,
+                                                             size_t* segmentEnd, size_t blockSize) {
+  size_t totalSize = end - start;
+
+  // check for valid input
+  if (blockSize == 0) {
+    throw sgpp::base::operation_exception("blockSize must not be zero!");
+  }
+
+  if (totalSize % blockSize != 0) {
+    throw sgpp::base::operation_exception(
+        "totalSize must be divisible by blockSize without remainder, but it is not!");
+  }
+
+  // do all further calculations with complete blocks
+  size_t blockCount = totalSize / blockSize;
+
+  size_t blockSegmentSize = blockCount / segmentCount;
+  size_t remainder = blockCount - blockSegmentSize * segmentCount;
+  size_t blockSegmentOffset = 0;
+
+  if (segmentNumber < remainder) {
+    blockSegmentSize++;
+    blockSegmentOffset = blockSegmentSize * segmentNumber;
+  } else {
+    blockSegmentOffset =
+        remainder * (blockSegmentSize + 1) + (segmentNumber - remainder) * blockSegmentSize;
+  }
+
+  *segmentStart = start + blockSegmentOffset * blockSize;
+  *segmentEnd = *segmentStart + blockSegmentSize * blockSize;
+}
+
+void OperationMultiEvalStreamingBSpline::getOpenMPPartitionSegment(size_t start, size_t end,
+                                                                   size_t* segmentStart,
+                                                                   size_t* segmentEnd,
+                                                                   size_t blocksize) {
+  size_t threadCount = omp_get_num_threads();
+  size_t myThreadNum = omp_get_thread_num();
+  getPartitionSegment(start, end, threadCount, myThreadNum, segmentStart, segmentEnd, blocksize);
+}
+
+size_t OperationMultiEvalStreamingBSpline::getChunkGridPoints() { return this->chunkGridPoints; }
+
+size_t OperationMultiEvalStreamingBSpline::getChunkDataPoints() {
+  return STREAMING_BSPLINE_UNROLLING_WIDTH;
+}
+
+void OperationMultiEvalStreamingBSpline::mult(sgpp::base::DataVector& alpha,
+                                              sgpp::base::DataVector& result) {
+  this->myTimer_.start();
+
+  size_t originalSize = result.getSize();
+
+  result.resize(this->preparedDataset.getNrowsPadded());
+
+  result.setAll(0.0);
+
+#pragma omp parallel
+  {
+    sgpp::base::DataMatrixTiled::RowPanel panel =
+        this->preparedDataset.getRowPanel(omp_get_thread_num(), omp_get_num_threads());
+
+    this->multImpl(panel, alpha, result, 0, alpha.getSize());
+  }
+  result.resize(originalSize);
+  this->duration = this->myTimer_.stop();
+}
+
+void OperationMultiEvalStreamingBSpline::multTranspose(sgpp::base::DataVector& source,
+                                                       sgpp::base::DataVector& result) {
+  this->myTimer_.start();
+
+  size_t originalSize = source.getSize();
+
+  source.resize(this->preparedDataset.getNrowsPadded());
+
+  // set padding area to zero
+  for (size_t i = originalSize; i < this->preparedDataset.getNrowsPadded(); i++) {
+    source[i] = 0.0;
+  }
+
+  result.setAll(0.0);
+
+#pragma omp parallel
+  {
+    size_t start;
+    size_t end;
+
+    getOpenMPPartitionSegment(0, this->storage->getSize(), &start, &end, 1);
+
+    this->multTransposeImpl(this->preparedDataset, source, result, start, end);
+  }
+  source.resize(originalSize);
+  this->duration = this->myTimer_.stop();
+}
+
+double OperationMultiEvalStreamingBSpline::getDuration() { return this->duration; }
+
+void OperationMultiEvalStreamingBSpline::prepare() { this->recalculateBasisParameters(); }
+
+void OperationMultiEvalStreamingBSpline::recalculateBasisParameters() {
+  size_t gridSize = this->storage->getSize();
+  size_t dims = this->storage->getDimension();
+
+  sgpp::base::HashGridPoint::level_type curLevel;
+  sgpp::base::HashGridPoint::index_type curIndex;
+
+  this->type = std::vector<BasisType>(gridSize * dims);
+  this->scale = std::vector<double>(gridSize * dims);
+  this->offset = std::vector<double>(gridSize * dims);
+
+  // the uniform B-spline of index i is centered at (degree + 1) / 2
+  const double center = static_cast<double>(this->degree + 1) / 2.0;
+
+  for (size_t i = 0; i < gridSize; i++) {
+    for (size_t dim = 0; dim < dims; dim++) {
+      storage->getPoint(i).get(dim, curLevel, curIndex);
+      const double hInv = static_cast<double>(static_cast<uint64_t>(1) << curLevel);
+
+      if (this->isModified && (curLevel == 1)) {
+        this->type[i * dims + dim] = BasisType::CONSTANT;
+        this->scale[i * dims + dim] = 0.0;
+        this->offset[i * dims + dim] = 0.0;
+      } else if (this->isModified && (curIndex == 1)) {
+        this->type[i * dims + dim] = BasisType::BOUNDARY;
+        this->scale[i * dims + dim] = hInv;
+        this->offset[i * dims + dim] = 0.0;
+      } else if (this->isModified && (curIndex == (static_cast<uint64_t>(1) << curLevel) - 1)) {
+        // mirror the left boundary function, i.e., evaluate at (1 - x) * hInv
+        this->type[i * dims + dim] = BasisType::BOUNDARY;
+        this->scale[i * dims + dim] = -hInv;
+        this->offset[i * dims + dim] = -hInv;
+      } else {
+        this->type[i * dims + dim] = BasisType::INTERIOR;
+        this->scale[i * dims + dim] = hInv;
+        this->offset[i * dims + dim] = static_cast<double>(curIndex) - center;
+      }
+    }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
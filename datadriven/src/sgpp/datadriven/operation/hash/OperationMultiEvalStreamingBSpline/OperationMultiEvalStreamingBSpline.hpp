@@ -0,0 +1,170 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <omp.h>
+
+#include <sgpp/base/datatypes/DataMatrixTiled.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/datadriven/operation/hash/simd/SimdDouble.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#ifndef STREAMING_BSPLINE_MIC_AVX512_UNROLLING_WIDTH
+#define STREAMING_BSPLINE_MIC_AVX512_UNROLLING_WIDTH 32
+#endif
+
+// number of data points the kernels process at once, has to divide getChunkDataPoints()
+#if defined(__MIC__) || defined(__AVX512F__)
+#define STREAMING_BSPLINE_UNROLLING_WIDTH STREAMING_BSPLINE_MIC_AVX512_UNROLLING_WIDTH
+#elif defined(__AVX__)
+#define STREAMING_BSPLINE_UNROLLING_WIDTH 16
+#elif defined(__SSE3__)
+#define STREAMING_BSPLINE_UNROLLING_WIDTH 8
+#else
+#define STREAMING_BSPLINE_UNROLLING_WIDTH 4
+#endif
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Streaming multiple evaluation for B-spline and modified B-spline grids on the CPU
+ * (OpenMP and SIMD). The B-splines are evaluated branch-free as truncated power sums, so that
+ * a register of data points can be processed at once, the only branches depend on the grid point.
+ */
+class OperationMultiEvalStreamingBSpline : public base::OperationMultipleEval {
+ protected:
+  /// one-dimensional basis function of a grid point in one dimension
+  enum class BasisType : uint8_t {
+    /// constant one (modified B-splines on level 1)
+    CONSTANT,
+    /// modified B-spline at the boundary, evaluated at (x * scale - offset)
+    BOUNDARY,
+    /// uniform B-spline, evaluated at (x * scale - offset)
+    INTERIOR
+  };
+
+  /// dataset in tiles of getChunkDataPoints() data points, stored dimension by dimension
+  sgpp::base::DataMatrixTiled preparedDataset;
+  /// B-spline degree
+  size_t degree;
+  /// whether the grid uses modified B-splines
+  bool isModified;
+  /// type of the one-dimensional basis functions, stored grid point by grid point
+  std::vector<BasisType> type;
+  /// factors that map the data points to the argument of the uniform B-spline
+  std::vector<double> scale;
+  /// offsets that map the data points to the argument of the uniform B-spline
+  std::vector<double> offset;
+  /// coefficients of the first (degree + 1) / 2 truncated powers of the uniform B-spline
+  std::vector<double> truncatedPowerCoefficients;
+  /// number of grid points the kernels process at once
+  size_t chunkGridPoints;
+  /// Timer object to handle time measurements
+  sgpp::base::SGppStopwatch myTimer_;
+
+  base::GridStorage* storage;
+
+  double duration;
+
+ public:
+  /**
+   * Constructor.
+   *
+   * @param grid      B-spline or modified B-spline grid
+   * @param degree    B-spline degree
+   * @param dataset   data points, one per row
+   * @param chunkGridPoints number of grid points the kernels process at once
+   */
+  OperationMultiEvalStreamingBSpline(base::Grid& grid, size_t degree, base::DataMatrix& dataset,
+                                     size_t chunkGridPoints = 12);
+
+  ~OperationMultiEvalStreamingBSpline();
+
+  size_t getChunkGridPoints();
+
+  size_t getChunkDataPoints();
+
+  void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override;
+
+  void multTranspose(sgpp::base::DataVector& source, sgpp::base::DataVector& result) override;
+
+  void prepare() override;
+
+  double getDuration() override;
+
+ private:
+  void getPartitionSegment(size_t start, size_t end, size_t segmentCount, size_t segmentNumber,
+                           size_t* segmentStart, size_t* segmentEnd, size_t blockSize);
+
+  void getOpenMPPartitionSegment(size_t start, size_t end, size_t* segmentStart, size_t* segmentEnd,
+                                 size_t blocksize);
+
+  void multImpl(const sgpp::base::DataMatrixTiled::RowPanel& panel, sgpp::base::DataVector& alpha,
+                sgpp::base::DataVector& result, const size_t start_index_grid,
+                const size_t end_index_grid);
+
+  void multTransposeImpl(const sgpp::base::DataMatrixTiled& dataset,
+                         sgpp::base::DataVector& source, sgpp::base::DataVector& result,
+                         const size_t start_index_grid, const size_t end_index_grid);
+
+  void recalculateBasisParameters();
+
+  /**
+   * Evaluates the uniform B-spline with the knots 0, 1, ..., degree + 1. Due to the symmetry of
+   * the B-spline, only the truncated powers left of the center contribute.
+   *
+   * @param x   evaluation points
+   * @return    values of the B-spline
+   */
+  inline simd::SimdDouble uniformBSpline(const simd::SimdDouble& x) const {
+    const simd::SimdDouble zero = simd::SimdDouble::set1(0.0);
+    const simd::SimdDouble s =
+        max(zero, min(x, simd::SimdDouble::set1(static_cast<double>(degree + 1)) - x));
+    simd::SimdDouble result = zero;
+
+    for (size_t k = 0; k < truncatedPowerCoefficients.size(); k++) {
+      const simd::SimdDouble y = max(zero, s - simd::SimdDouble::set1(static_cast<double>(k)));
+      simd::SimdDouble power = y;
+
+      for (size_t p = 1; p < degree; p++) {
+        power = power * y;
+      }
+
+      result = result + simd::SimdDouble::broadcast(&truncatedPowerCoefficients[k]) * power;
+    }
+
+    return result;
+  }
+
+  /**
+   * Evaluates the modified B-spline at the left boundary, i.e., the sum of the uniform B-splines
+   * of the indices 1, 0, -1, ... weighted with 1, 2, 3, ... that extrapolates linearly.
+   *
+   * @param x   evaluation points in units of the mesh width
+   * @return    values of the modified B-spline
+   */
+  inline simd::SimdDouble modifiedBSpline(const simd::SimdDouble& x) const {
+    simd::SimdDouble result = simd::SimdDouble::set1(0.0);
+
+    for (size_t k = 0; k <= (degree + 1) / 2; k++) {
+      const double shift = static_cast<double>(k) + static_cast<double>(degree - 1) / 2.0;
+      result = result + simd::SimdDouble::set1(static_cast<double>(k + 1)) *
+                            uniformBSpline(x + simd::SimdDouble::set1(shift));
+    }
+
+    return result;
+  }
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,75 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingBSpline/OperationMultiEvalStreamingBSpline.hpp>
+#include <sgpp/datadriven/operation/hash/simd/SimdDouble.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+
+namespace sgpp {
+namespace datadriven {
+
+using simd::SimdDouble;
+
+void OperationMultiEvalStreamingBSpline::multImpl(
+    const sgpp::base::DataMatrixTiled::RowPanel& panel, sgpp::base::DataVector& alpha,
+    sgpp::base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid) {
+  // number of registers that are processed at once
+  const size_t UNROLL = STREAMING_BSPLINE_UNROLLING_WIDTH / SimdDouble::WIDTH;
+
+  const BasisType* ptrType = this->type.data();
+  const double* ptrScale = this->scale.data();
+  const double* ptrOffset = this->offset.data();
+  double* ptrAlpha = alpha.getPointer();
+  double* ptrResult = result.getPointer();
+  size_t dims = this->preparedDataset.getNcols();
+
+  // each tile holds getChunkDataPoints() data points, i.e., UNROLL registers per dimension
+  for (const sgpp::base::DataMatrixTiled::Tile& tile : panel) {
+    double* ptrResultTile = &(ptrResult[tile.getFirstRow()]);
+
+    for (size_t m = start_index_grid; m < end_index_grid;
+         m += std::min<size_t>(getChunkGridPoints(), (end_index_grid - m))) {
+      size_t grid_end = std::min<size_t>(getChunkGridPoints() + m, end_index_grid);
+
+      for (size_t j = m; j < grid_end; j++) {
+        SimdDouble support[UNROLL];
+
+        for (size_t u = 0; u < UNROLL; u++) {
+          support[u] = SimdDouble::broadcast(&(ptrAlpha[j]));
+        }
+
+        for (size_t d = 0; d < dims; d++) {
+          const BasisType curType = ptrType[(j * dims) + d];
+
+          if (curType == BasisType::CONSTANT) {
+            continue;
+          }
+
+          const SimdDouble curScale = SimdDouble::broadcast(&(ptrScale[(j * dims) + d]));
+          const SimdDouble curOffset = SimdDouble::broadcast(&(ptrOffset[(j * dims) + d]));
+          const double* ptrDataDim = tile.getColumn(d);
+
+          for (size_t u = 0; u < UNROLL; u++) {
+            SimdDouble eval = SimdDouble::load(ptrDataDim + u * SimdDouble::WIDTH);
+            eval = fmsub(eval, curScale, curOffset);
+            eval = (curType == BasisType::INTERIOR) ? uniformBSpline(eval)
+                                                    : modifiedBSpline(eval);
+            support[u] = support[u] * eval;
+          }
+        }
+
+        for (size_t u = 0; u < UNROLL; u++) {
+          double* ptrRes = ptrResultTile + u * SimdDouble::WIDTH;
+          (SimdDouble::load(ptrRes) + support[u]).store(ptrRes);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
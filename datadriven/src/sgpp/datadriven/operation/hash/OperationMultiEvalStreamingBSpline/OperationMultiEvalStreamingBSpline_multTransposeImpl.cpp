@@ -0,0 +1,76 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingBSpline/OperationMultiEvalStreamingBSpline.hpp>
+#include <sgpp/datadriven/operation/hash/simd/SimdDouble.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+
+namespace sgpp {
+namespace datadriven {
+
+using simd::SimdDouble;
+
+void OperationMultiEvalStreamingBSpline::multTransposeImpl(
+    const sgpp::base::DataMatrixTiled& dataset, sgpp::base::DataVector& source,
+    sgpp::base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid) {
+  // number of registers that are processed at once
+  const size_t UNROLL = STREAMING_BSPLINE_UNROLLING_WIDTH / SimdDouble::WIDTH;
+
+  const BasisType* ptrType = this->type.data();
+  const double* ptrScale = this->scale.data();
+  const double* ptrOffset = this->offset.data();
+  double* ptrSource = source.getPointer();
+  double* ptrResult = result.getPointer();
+  size_t dims = dataset.getNcols();
+
+  for (size_t k = start_index_grid; k < end_index_grid;
+       k += std::min<size_t>(getChunkGridPoints(), (end_index_grid - k))) {
+    size_t grid_end = std::min<size_t>(getChunkGridPoints() + k, end_index_grid);
+
+    // each tile holds getChunkDataPoints() data points, i.e., UNROLL registers per dimension
+    for (const sgpp::base::DataMatrixTiled::Tile& tile : dataset) {
+      const double* ptrSourceTile = &(ptrSource[tile.getFirstRow()]);
+
+      for (size_t j = k; j < grid_end; j++) {
+        SimdDouble support[UNROLL];
+
+        for (size_t u = 0; u < UNROLL; u++) {
+          support[u] = SimdDouble::load(ptrSourceTile + u * SimdDouble::WIDTH);
+        }
+
+        for (size_t d = 0; d < dims; d++) {
+          const BasisType curType = ptrType[(j * dims) + d];
+
+          if (curType == BasisType::CONSTANT) {
+            continue;
+          }
+
+          const SimdDouble curScale = SimdDouble::broadcast(&(ptrScale[(j * dims) + d]));
+          const SimdDouble curOffset = SimdDouble::broadcast(&(ptrOffset[(j * dims) + d]));
+          const double* ptrDataDim = tile.getColumn(d);
+
+          for (size_t u = 0; u < UNROLL; u++) {
+            SimdDouble eval = SimdDouble::load(ptrDataDim + u * SimdDouble::WIDTH);
+            eval = fmsub(eval, curScale, curOffset);
+            eval = (curType == BasisType::INTERIOR) ? uniformBSpline(eval)
+                                                    : modifiedBSpline(eval);
+            support[u] = support[u] * eval;
+          }
+        }
+
+        for (size_t u = 1; u < UNROLL; u++) {
+          support[0] = support[0] + support[u];
+        }
+
+        ptrResult[j] += support[0].sum();
+      }
+    }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
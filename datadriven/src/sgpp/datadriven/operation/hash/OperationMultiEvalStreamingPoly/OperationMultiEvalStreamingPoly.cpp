@@ -0,0 +1,210 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingPoly/OperationMultiEvalStreamingPoly.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+OperationMultiEvalStreamingPoly::OperationMultiEvalStreamingPoly(base::Grid& grid, size_t degree,
+                                                                 base::DataMatrix& dataset,
+                                                                 size_t chunkGridPoints)
+    : OperationMultipleEval(grid, dataset),
+      preparedDataset(dataset, STREAMING_POLY_UNROLLING_WIDTH),
+      degree(degree),
+      isModified(grid.getType() == base::GridType::ModPoly),
+      chunkGridPoints(chunkGridPoints),
+      myTimer_(sgpp::base::SGppStopwatch()),
+      duration(-1.0) {
+  if (chunkGridPoints == 0) {
+    throw sgpp::base::operation_exception("chunkGridPoints must not be zero!");
+  }
+
+  this->storage = &grid.getStorage();
+
+  // create the kernel specific data structures for the current grid
+  this->prepare();
+}
+
+OperationMultiEvalStreamingPoly::~OperationMultiEvalStreamingPoly() {}
+
+void OperationMultiEvalStreamingPoly::getPartitionSegment(size_t start, size_t end,
+                                                          size_t segmentCount, size_t segmentNumber,
+                                                          size_t* segmentStart, size_t* segmentEnd,
+                                                          size_t blockSize) {
+  size_t totalSize = end - start;
+
+  // check for valid input
+  if (blockSize == 0) {
+    throw sgpp::base::operation_exception("blockSize must not be zero!");
+  }
+
+  if (totalSize % blockSize != 0) {
+    throw sgpp::base::operation_exception(
+        "totalSize must be divisible by blockSize without remainder, but it is not!");
+  }
+
+  // do all further calculations with complete blocks
+  size_t blockCount = totalSize / blockSize;
+
+  size_t blockSegmentSize = blockCount / segmentCount;
+  size_t remainder = blockCount - blockSegmentSize * segmentCount;
+  size_t blockSegmentOffset = 0;
+
+  if (segmentNumber < remainder) {
+    blockSegmentSize++;
+    blockSegmentOffset = blockSegmentSize * segmentNumber;
+  } else {
+    blockSegmentOffset =
+        remainder * (blockSegmentSize + 1) + (segmentNumber - remainder) * blockSegmentSize;
+  }
+
+  *segmentStart = start + blockSegmentOffset * blockSize;
+  *segmentEnd = *segmentStart + blockSegmentSize * blockSize;
+}
+
+void OperationMultiEvalStreamingPoly::getOpenMPPartitionSegment(size_t start, size_t end,
+                                                                size_t* segmentStart,
+                                                                size_t* segmentEnd,
+                                                                size_t blocksize) {
+  size_t threadCount = omp_get_num_threads();
+  size_t myThreadNum = omp_get_thread_num();
+  getPartitionSegment(start, end, threadCount, myThreadNum, segmentStart, segmentEnd, blocksize);
+}
+
+size_t OperationMultiEvalStreamingPoly::getChunkGridPoints() { return this->chunkGridPoints; }
+
+size_t OperationMultiEvalStreamingPoly::getChunkDataPoints() {
+  return STREAMING_POLY_UNROLLING_WIDTH;
+}
+
+void OperationMultiEvalStreamingPoly::mult(sgpp::base::DataVector& alpha,
+                                           sgpp::base::DataVector& result) {
+  this->myTimer_.start();
+
+  size_t originalSize = result.getSize();
+
+  result.resize(this->preparedDataset.getNrowsPadded());
+
+  result.setAll(0.0);
+
+#pragma omp parallel
+  {
+    sgpp::base::DataMatrixTiled::RowPanel panel =
+        this->preparedDataset.getRowPanel(omp_get_thread_num(), omp_get_num_threads());
+
+    this->multImpl(panel, alpha, result, 0, alpha.getSize());
+  }
+  result.resize(originalSize);
+  this->duration = this->myTimer_.stop();
+}
+
+void OperationMultiEvalStreamingPoly::multTranspose(sgpp::base::DataVector& source,
+                                                    sgpp::base::DataVector& result) {
+  this->myTimer_.start();
+
+  size_t originalSize = source.getSize();
+
+  source.resize(this->preparedDataset.getNrowsPadded());
+
+  // set padding area to zero
+  for (size_t i = originalSize; i < this->preparedDataset.getNrowsPadded(); i++) {
+    source[i] = 0.0;
+  }
+
+  result.setAll(0.0);
+
+#pragma omp parallel
+  {
+    size_t start;
+    size_t end;
+
+    getOpenMPPartitionSegment(0, this->storage->getSize(), &start, &end, 1);
+
+    this->multTransposeImpl(this->preparedDataset, source, result, start, end);
+  }
+  source.resize(originalSize);
+  this->duration = this->myTimer_.stop();
+}
+
+double OperationMultiEvalStreamingPoly::getDuration() { return this->duration; }
+
+void OperationMultiEvalStreamingPoly::prepare() { this->recalculateBasisParameters(); }
+
+void OperationMultiEvalStreamingPoly::recalculateBasisParameters() {
+  size_t gridSize = this->storage->getSize();
+  size_t dims = this->storage->getDimension();
+
+  sgpp::base::HashGridPoint::level_type curLevel;
+  sgpp::base::HashGridPoint::index_type curIndex;
+
+  this->level = std::vector<double>(gridSize * dims);
+  this->lower = std::vector<double>(gridSize * dims);
+  this->upper = std::vector<double>(gridSize * dims);
+  // unused factors are constant one
+  this->slope = std::vector<double>(gridSize * dims * this->degree, 0.0);
+  this->offset = std::vector<double>(gridSize * dims * this->degree, -1.0);
+
+  // distances to the next root in units of the mesh width (see PolyBasis::evalBasis)
+  const int64_t idxtable[4] = {1, 2, -2, -1};
+  std::vector<double> roots;
+
+  for (size_t i = 0; i < gridSize; i++) {
+    for (size_t dim = 0; dim < dims; dim++) {
+      storage->getPoint(i).get(dim, curLevel, curIndex);
+      const size_t pos = i * dims + dim;
+      const uint64_t hInv = static_cast<uint64_t>(1) << curLevel;
+      const double index = static_cast<double>(curIndex);
+
+      this->level[pos] = static_cast<double>(hInv);
+      this->lower[pos] = index - 1.0;
+      this->upper[pos] = index + 1.0;
+      double* ptrSlope = &(this->slope[pos * this->degree]);
+      double* ptrOffset = &(this->offset[pos * this->degree]);
+
+      if (this->isModified && (curLevel == 1)) {
+        // constant one
+        continue;
+      } else if (this->isModified && (curIndex == 1)) {
+        // 2 - x on [0, 2]
+        ptrSlope[0] = -1.0;
+        ptrOffset[0] = -2.0;
+        continue;
+      } else if (this->isModified && (curIndex == hInv - 1)) {
+        // x - (index - 1) on [index - 1, index + 1]
+        ptrSlope[0] = 1.0;
+        ptrOffset[0] = index - 1.0;
+        continue;
+      }
+
+      // roots of the Lagrange polynomial, the first two are the ends of the support
+      const size_t deg = std::min<size_t>(this->degree, curLevel + 1);
+      int64_t root = static_cast<int64_t>(curIndex) - 1;
+      uint64_t id = curIndex;
+      roots.assign(1, index + 1.0);
+
+      for (int64_t j = 2; j < (static_cast<int64_t>(1) << deg); j *= 2) {
+        roots.push_back(static_cast<double>(root));
+        root += idxtable[id & 3] * j;
+        id >>= 1;
+      }
+
+      // (x - root) / (index - root) = x * slope - offset
+      for (size_t k = 0; k < roots.size(); k++) {
+        ptrSlope[k] = 1.0 / (index - roots[k]);
+        ptrOffset[k] = roots[k] / (index - roots[k]);
+      }
+    }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
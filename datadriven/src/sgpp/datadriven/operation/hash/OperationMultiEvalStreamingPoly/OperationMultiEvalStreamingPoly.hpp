@@ -0,0 +1,115 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <omp.h>
+
+#include <sgpp/base/datatypes/DataMatrixTiled.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+#ifndef STREAMING_POLY_MIC_AVX512_UNROLLING_WIDTH
+#define STREAMING_POLY_MIC_AVX512_UNROLLING_WIDTH 32
+#endif
+
+// number of data points the kernels process at once, has to divide getChunkDataPoints()
+#if defined(__MIC__) || defined(__AVX512F__)
+#define STREAMING_POLY_UNROLLING_WIDTH STREAMING_POLY_MIC_AVX512_UNROLLING_WIDTH
+#elif defined(__AVX__)
+#define STREAMING_POLY_UNROLLING_WIDTH 16
+#elif defined(__SSE3__)
+#define STREAMING_POLY_UNROLLING_WIDTH 8
+#else
+#define STREAMING_POLY_UNROLLING_WIDTH 4
+#endif
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Streaming multiple evaluation for polynomial and modified polynomial grids on the CPU
+ * (OpenMP and SIMD). The one-dimensional basis functions are stored as products of linear
+ * factors, the data points are clamped to the support, where the outermost factors vanish.
+ * Therefore, a register of data points can be processed without branches.
+ */
+class OperationMultiEvalStreamingPoly : public base::OperationMultipleEval {
+ protected:
+  /// dataset in tiles of getChunkDataPoints() data points, stored dimension by dimension
+  sgpp::base::DataMatrixTiled preparedDataset;
+  /// maximum polynomial degree, i.e., number of linear factors of each basis function
+  size_t degree;
+  /// whether the grid uses modified polynomials
+  bool isModified;
+  /// 2^level of the grid points, stored grid point by grid point
+  std::vector<double> level;
+  /// left end of the supports in units of the mesh width
+  std::vector<double> lower;
+  /// right end of the supports in units of the mesh width
+  std::vector<double> upper;
+  /// slopes of the linear factors, degree entries per grid point and dimension
+  std::vector<double> slope;
+  /// offsets of the linear factors, i.e., a factor evaluates to (x * slope - offset)
+  std::vector<double> offset;
+  /// number of grid points the kernels process at once
+  size_t chunkGridPoints;
+  /// Timer object to handle time measurements
+  sgpp::base::SGppStopwatch myTimer_;
+
+  base::GridStorage* storage;
+
+  double duration;
+
+ public:
+  /**
+   * Constructor.
+   *
+   * @param grid      polynomial or modified polynomial grid
+   * @param degree    maximum polynomial degree
+   * @param dataset   data points, one per row
+   * @param chunkGridPoints number of grid points the kernels process at once
+   */
+  OperationMultiEvalStreamingPoly(base::Grid& grid, size_t degree, base::DataMatrix& dataset,
+                                  size_t chunkGridPoints = 12);
+
+  ~OperationMultiEvalStreamingPoly();
+
+  size_t getChunkGridPoints();
+
+  size_t getChunkDataPoints();
+
+  void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override;
+
+  void multTranspose(sgpp::base::DataVector& source, sgpp::base::DataVector& result) override;
+
+  void prepare() override;
+
+  double getDuration() override;
+
+ private:
+  void getPartitionSegment(size_t start, size_t end, size_t segmentCount, size_t segmentNumber,
+                           size_t* segmentStart, size_t* segmentEnd, size_t blockSize);
+
+  void getOpenMPPartitionSegment(size_t start, size_t end, size_t* segmentStart, size_t* segmentEnd,
+                                 size_t blocksize);
+
+  void multImpl(const sgpp::base::DataMatrixTiled::RowPanel& panel, sgpp::base::DataVector& alpha,
+                sgpp::base::DataVector& result, const size_t start_index_grid,
+                const size_t end_index_grid);
+
+  void multTransposeImpl(const sgpp::base::DataMatrixTiled& dataset,
+                         sgpp::base::DataVector& source, sgpp::base::DataVector& result,
+                         const size_t start_index_grid, const size_t end_index_grid);
+
+  void recalculateBasisParameters();
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
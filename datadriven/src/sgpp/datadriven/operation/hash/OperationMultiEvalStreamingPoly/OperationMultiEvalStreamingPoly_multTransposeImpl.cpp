@@ -0,0 +1,83 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingPoly/OperationMultiEvalStreamingPoly.hpp>
+#include <sgpp/datadriven/operation/hash/simd/SimdDouble.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+
+namespace sgpp {
+namespace datadriven {
+
+using simd::SimdDouble;
+
+void OperationMultiEvalStreamingPoly::multTransposeImpl(
+    const sgpp::base::DataMatrixTiled& dataset, sgpp::base::DataVector& source,
+    sgpp::base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid) {
+  // number of registers that are processed at once
+  const size_t UNROLL = STREAMING_POLY_UNROLLING_WIDTH / SimdDouble::WIDTH;
+
+  const double* ptrLevel = this->level.data();
+  const double* ptrLower = this->lower.data();
+  const double* ptrUpper = this->upper.data();
+  const double* ptrSlope = this->slope.data();
+  const double* ptrOffset = this->offset.data();
+  const size_t numFactors = this->degree;
+  double* ptrSource = source.getPointer();
+  double* ptrResult = result.getPointer();
+  size_t dims = dataset.getNcols();
+
+  for (size_t k = start_index_grid; k < end_index_grid;
+       k += std::min<size_t>(getChunkGridPoints(), (end_index_grid - k))) {
+    size_t grid_end = std::min<size_t>(getChunkGridPoints() + k, end_index_grid);
+
+    // each tile holds getChunkDataPoints() data points, i.e., UNROLL registers per dimension
+    for (const sgpp::base::DataMatrixTiled::Tile& tile : dataset) {
+      const double* ptrSourceTile = &(ptrSource[tile.getFirstRow()]);
+
+      for (size_t j = k; j < grid_end; j++) {
+        SimdDouble support[UNROLL];
+
+        for (size_t u = 0; u < UNROLL; u++) {
+          support[u] = SimdDouble::load(ptrSourceTile + u * SimdDouble::WIDTH);
+        }
+
+        for (size_t d = 0; d < dims; d++) {
+          const SimdDouble curLevel = SimdDouble::broadcast(&(ptrLevel[(j * dims) + d]));
+          const SimdDouble curLower = SimdDouble::broadcast(&(ptrLower[(j * dims) + d]));
+          const SimdDouble curUpper = SimdDouble::broadcast(&(ptrUpper[(j * dims) + d]));
+          const double* ptrDataDim = tile.getColumn(d);
+          SimdDouble x[UNROLL];
+
+          // outside of the support, one of the first two factors is zero
+          for (size_t u = 0; u < UNROLL; u++) {
+            x[u] = SimdDouble::load(ptrDataDim + u * SimdDouble::WIDTH) * curLevel;
+            x[u] = max(curLower, min(x[u], curUpper));
+          }
+
+          for (size_t f = 0; f < numFactors; f++) {
+            const size_t pos = ((j * dims) + d) * numFactors + f;
+            const SimdDouble curSlope = SimdDouble::broadcast(&(ptrSlope[pos]));
+            const SimdDouble curOffset = SimdDouble::broadcast(&(ptrOffset[pos]));
+
+            for (size_t u = 0; u < UNROLL; u++) {
+              support[u] = support[u] * fmsub(x[u], curSlope, curOffset);
+            }
+          }
+        }
+
+        for (size_t u = 1; u < UNROLL; u++) {
+          support[0] = support[0] + support[u];
+        }
+
+        ptrResult[j] += support[0].sum();
+      }
+    }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
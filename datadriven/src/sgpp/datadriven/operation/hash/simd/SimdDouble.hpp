@@ -0,0 +1,277 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#if defined(__AVX512F__) || defined(__MIC__) || defined(__AVX__)
+#include <immintrin.h>  // NOLINT(build/include)
+#elif defined(__SSE3__)
+#include <pmmintrin.h>
+#endif
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace sgpp {
+namespace datadriven {
+namespace simd {
+
+/**
+ * Thin wrapper around a SIMD register of doubles, used to write the streaming kernels once
+ * for all instruction sets. The widest instruction set the library is compiled for is used
+ * (AVX-512/MIC, AVX with FMA or FMA4, SSE3), otherwise a scalar fallback with a width of one.
+ *
+ * Memory accesses with load() and store() have to be aligned to WIDTH doubles.
+ */
+class SimdDouble {
+ public:
+#if defined(__AVX512F__) || defined(__MIC__)
+  typedef __m512d native_type;
+  /// number of doubles in one register
+  static const size_t WIDTH = 8;
+#elif defined(__AVX__)
+  typedef __m256d native_type;
+  /// number of doubles in one register
+  static const size_t WIDTH = 4;
+#elif defined(__SSE3__)
+  typedef __m128d native_type;
+  /// number of doubles in one register
+  static const size_t WIDTH = 2;
+#else
+  typedef double native_type;
+  /// number of doubles in one register
+  static const size_t WIDTH = 1;
+#endif
+
+  SimdDouble() {}
+
+  explicit SimdDouble(native_type v) : v(v) {}
+
+  /**
+   * @return name of the instruction set the kernels are compiled for
+   */
+  static const char* getInstructionSet() {
+#if defined(__MIC__)
+    return "MIC";
+#elif defined(__AVX512F__)
+    return "AVX-512";
+#elif defined(__AVX__) && (defined(__FMA__) || defined(__FMA4__))
+    return "AVX+FMA";
+#elif defined(__AVX__)
+    return "AVX";
+#elif defined(__SSE3__)
+    return "SSE3";
+#else
+    return "scalar";
+#endif
+  }
+
+  /**
+   * @param ptr aligned address of WIDTH doubles
+   * @return register containing the doubles
+   */
+  static SimdDouble load(const double* ptr) {
+#if defined(__AVX512F__) || defined(__MIC__)
+    return SimdDouble(_mm512_load_pd(ptr));
+#elif defined(__AVX__)
+    return SimdDouble(_mm256_load_pd(ptr));
+#elif defined(__SSE3__)
+    return SimdDouble(_mm_load_pd(ptr));
+#else
+    return SimdDouble(*ptr);
+#endif
+  }
+
+  /**
+   * @param ptr address of one double
+   * @return register with all entries set to *ptr
+   */
+  static SimdDouble broadcast(const double* ptr) {
+#if defined(__MIC__)
+    return SimdDouble(
+        _mm512_extload_pd(ptr, _MM_UPCONV_PD_NONE, _MM_BROADCAST_1X8, _MM_HINT_NONE));
+#elif defined(__AVX512F__)
+    return SimdDouble(_mm512_set1_pd(*ptr));
+#elif defined(__AVX__)
+    return SimdDouble(_mm256_broadcast_sd(ptr));
+#elif defined(__SSE3__)
+    return SimdDouble(_mm_loaddup_pd(ptr));
+#else
+    return SimdDouble(*ptr);
+#endif
+  }
+
+  /**
+   * @param value value of all entries
+   * @return register with all entries set to value
+   */
+  static SimdDouble set1(double value) { return broadcast(&value); }
+
+  /**
+   * @param ptr aligned address to which the WIDTH entries are written
+   */
+  void store(double* ptr) const {
+#if defined(__AVX512F__) || defined(__MIC__)
+    _mm512_store_pd(ptr, v);
+#elif defined(__AVX__)
+    _mm256_store_pd(ptr, v);
+#elif defined(__SSE3__)
+    _mm_store_pd(ptr, v);
+#else
+    *ptr = v;
+#endif
+  }
+
+  /**
+   * @return sum of all entries
+   */
+  double sum() const {
+#if defined(__AVX512F__) || defined(__MIC__)
+    return _mm512_reduce_add_pd(v);
+#elif defined(__AVX__)
+    __m128d pair = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_hadd_pd(pair, pair));
+#elif defined(__SSE3__)
+    return _mm_cvtsd_f64(_mm_hadd_pd(v, v));
+#else
+    return v;
+#endif
+  }
+
+  friend SimdDouble operator+(const SimdDouble& a, const SimdDouble& b) {
+#if defined(__AVX512F__) || defined(__MIC__)
+    return SimdDouble(_mm512_add_pd(a.v, b.v));
+#elif defined(__AVX__)
+    return SimdDouble(_mm256_add_pd(a.v, b.v));
+#elif defined(__SSE3__)
+    return SimdDouble(_mm_add_pd(a.v, b.v));
+#else
+    return SimdDouble(a.v + b.v);
+#endif
+  }
+
+  friend SimdDouble operator-(const SimdDouble& a, const SimdDouble& b) {
+#if defined(__AVX512F__) || defined(__MIC__)
+    return SimdDouble(_mm512_sub_pd(a.v, b.v));
+#elif defined(__AVX__)
+    return SimdDouble(_mm256_sub_pd(a.v, b.v));
+#elif defined(__SSE3__)
+    return SimdDouble(_mm_sub_pd(a.v, b.v));
+#else
+    return SimdDouble(a.v - b.v);
+#endif
+  }
+
+  friend SimdDouble operator*(const SimdDouble& a, const SimdDouble& b) {
+#if defined(__AVX512F__) || defined(__MIC__)
+    return SimdDouble(_mm512_mul_pd(a.v, b.v));
+#elif defined(__AVX__)
+    return SimdDouble(_mm256_mul_pd(a.v, b.v));
+#elif defined(__SSE3__)
+    return SimdDouble(_mm_mul_pd(a.v, b.v));
+#else
+    return SimdDouble(a.v * b.v);
+#endif
+  }
+
+  /**
+   * @return a * b - c, fused if the instruction set supports it
+   */
+  friend SimdDouble fmsub(const SimdDouble& a, const SimdDouble& b, const SimdDouble& c) {
+#if defined(__AVX512F__) || defined(__MIC__)
+    return SimdDouble(_mm512_fmsub_pd(a.v, b.v, c.v));
+#elif defined(__AVX__) && defined(__FMA__)
+    return SimdDouble(_mm256_fmsub_pd(a.v, b.v, c.v));
+#elif defined(__AVX__) && defined(__FMA4__)
+    return SimdDouble(_mm256_msub_pd(a.v, b.v, c.v));
+#elif defined(__SSE3__) && defined(__FMA4__)
+    return SimdDouble(_mm_msub_pd(a.v, b.v, c.v));
+#else
+    return a * b - c;
+#endif
+  }
+
+  friend SimdDouble max(const SimdDouble& a, const SimdDouble& b) {
+#if defined(__MIC__)
+    return SimdDouble(_mm512_gmax_pd(a.v, b.v));
+#elif defined(__AVX512F__)
+    return SimdDouble(_mm512_max_pd(a.v, b.v));
+#elif defined(__AVX__)
+    return SimdDouble(_mm256_max_pd(a.v, b.v));
+#elif defined(__SSE3__)
+    return SimdDouble(_mm_max_pd(a.v, b.v));
+#else
+    return SimdDouble(std::max(a.v, b.v));
+#endif
+  }
+
+  friend SimdDouble min(const SimdDouble& a, const SimdDouble& b) {
+#if defined(__MIC__)
+    return SimdDouble(_mm512_gmin_pd(a.v, b.v));
+#elif defined(__AVX512F__)
+    return SimdDouble(_mm512_min_pd(a.v, b.v));
+#elif defined(__AVX__)
+    return SimdDouble(_mm256_min_pd(a.v, b.v));
+#elif defined(__SSE3__)
+    return SimdDouble(_mm_min_pd(a.v, b.v));
+#else
+    return SimdDouble(std::min(a.v, b.v));
+#endif
+  }
+
+  /**
+   * @return absolute values, computed by clearing the sign bits
+   */
+  friend SimdDouble abs(const SimdDouble& a) {
+#if defined(__MIC__)
+    return SimdDouble(_mm512_castsi512_pd(
+        _mm512_and_epi64(_mm512_set_1to8_epi64(0x7FFFFFFFFFFFFFFF), _mm512_castpd_si512(a.v))));
+#elif defined(__AVX512F__)
+    return SimdDouble(_mm512_castsi512_pd(
+        _mm512_and_epi64(_mm512_set1_epi64(0x7FFFFFFFFFFFFFFF), _mm512_castpd_si512(a.v))));
+#elif defined(__AVX__)
+    return SimdDouble(_mm256_and_pd(_mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFF)),
+                                    a.v));
+#elif defined(__SSE3__)
+    return SimdDouble(_mm_and_pd(_mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFF)), a.v));
+#else
+    return SimdDouble(std::fabs(a.v));
+#endif
+  }
+
+  /**
+   * @return bitwise or of both registers, e.g., to set sign bits given by a mask
+   */
+  friend SimdDouble bitwiseOr(const SimdDouble& a, const SimdDouble& b) {
+#if defined(__AVX512F__) || defined(__MIC__)
+    return SimdDouble(_mm512_castsi512_pd(
+        _mm512_or_epi64(_mm512_castpd_si512(a.v), _mm512_castpd_si512(b.v))));
+#elif defined(__AVX__)
+    return SimdDouble(_mm256_or_pd(a.v, b.v));
+#elif defined(__SSE3__)
+    return SimdDouble(_mm_or_pd(a.v, b.v));
+#else
+    uint64_t bitsA;
+    uint64_t bitsB;
+    std::memcpy(&bitsA, &a.v, sizeof(double));
+    std::memcpy(&bitsB, &b.v, sizeof(double));
+    bitsA |= bitsB;
+    double result;
+    std::memcpy(&result, &bitsA, sizeof(double));
+    return SimdDouble(result);
+#endif
+  }
+
+  /// native register
+  native_type v;
+};
+
+}  // namespace simd
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,263 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/simple/ConditionalDensityChainLinear.hpp>
+#include <sgpp/base/algorithm/GetAffectedBasisFunctions.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+ConditionalDensityChainLinear::ConditionalDensityChainLinear(base::Grid& grid,
+                                                             const base::DataVector& alpha,
+                                                             size_t dimStart)
+    : numDims(grid.getDimension()), dimStart(dimStart), alpha(alpha) {
+  if (numDims < 2) {
+    throw base::operation_exception("Error: # of dimensions = 1. No operation needed!");
+  } else if (dimStart >= numDims) {
+    throw base::operation_exception("Error: dimension out of range. Operation aborted!");
+  }
+
+  // marginal density in the start dimension
+  std::vector<Reduction> startMarginalizations;
+  margTo1D(grid, dimStart, startMarginalizations);
+  base::DataVector alpha1d(alpha);
+  for (const Reduction& reduction : startMarginalizations) {
+    base::DataVector reduced(reduction.grid->getSize(), 0.0);
+    for (size_t seqNr = 0; seqNr < alpha1d.getSize(); seqNr++) {
+      reduced[reduction.map[seqNr]] += alpha1d[seqNr] * reduction.integrals[seqNr];
+    }
+    alpha1d.swap(reduced);
+  }
+  cdfStart.reset(new PiecewiseLinearCDF1D(*startMarginalizations.back().grid, alpha1d));
+
+  // conditional densities of the following dimensions
+  steps.resize(numDims - 1);
+  base::Grid* current = &grid;
+  size_t opDim = dimStart;
+  for (Step& step : steps) {
+    reduce(*current, static_cast<unsigned int>(opDim), true, step.conditional);
+    current = step.conditional.grid.get();
+    opDim = (opDim + 1) % current->getDimension();
+    if (current->getDimension() > 1) {
+      margTo1D(*current, opDim, step.marginalizations);
+      setupEvaluation(*step.marginalizations.back().grid, step.evaluation);
+    } else {
+      setupEvaluation(*current, step.evaluation);
+    }
+  }
+}
+
+void ConditionalDensityChainLinear::transform(const double* x, double* u) const {
+  u[dimStart] = cdfStart->cdf(x[dimStart]);
+
+  base::DataVector alphaCurrent(alpha);
+  size_t currDim = dimStart;
+  for (const Step& step : steps) {
+    double xbar = x[currDim];
+    currDim = (currDim + 1) % numDims;
+    u[currDim] = conditionalCDF(step, xbar, alphaCurrent).cdf(x[currDim]);
+  }
+}
+
+void ConditionalDensityChainLinear::inverseTransform(const double* u, double* x) const {
+  x[dimStart] = cdfStart->inverseCdf(u[dimStart]);
+
+  base::DataVector alphaCurrent(alpha);
+  size_t currDim = dimStart;
+  for (const Step& step : steps) {
+    double xbar = x[currDim];
+    currDim = (currDim + 1) % numDims;
+    x[currDim] = conditionalCDF(step, xbar, alphaCurrent).inverseCdf(u[currDim]);
+  }
+}
+
+size_t ConditionalDensityChainLinear::getDimension() const { return numDims; }
+
+PiecewiseLinearCDF1D ConditionalDensityChainLinear::conditionalCDF(const Step& step, double xbar,
+                                                                   base::DataVector& alpha) const {
+  // condition on xbar, see OperationDensityConditionalLinear
+  const Reduction& conditional = step.conditional;
+  size_t size = alpha.getSize();
+  base::DataVector zeta(size);
+  double theta = 0;
+  for (size_t seqNr = 0; seqNr < size; seqNr++) {
+    zeta[seqNr] = std::max(
+        1. - std::fabs(xbar * conditional.levelFactors[seqNr] - conditional.indices[seqNr]), 0.);
+    theta += alpha[seqNr] * zeta[seqNr] * conditional.integrals[seqNr];
+  }
+
+  base::DataVector conditioned(conditional.grid->getSize(), 0.0);
+  for (size_t seqNr = 0; seqNr < size; seqNr++) {
+    conditioned[conditional.map[seqNr]] += alpha[seqNr] * zeta[seqNr];
+  }
+  if (theta != 0) conditioned.mult(1. / theta);
+  alpha.swap(conditioned);
+
+  // marginalize to the next dimension, see OperationDensityMarginalizeLinear
+  base::DataVector alpha1d(alpha);
+  for (const Reduction& reduction : step.marginalizations) {
+    base::DataVector reduced(reduction.grid->getSize(), 0.0);
+    for (size_t seqNr = 0; seqNr < alpha1d.getSize(); seqNr++) {
+      reduced[reduction.map[seqNr]] += alpha1d[seqNr] * reduction.integrals[seqNr];
+    }
+    alpha1d.swap(reduced);
+  }
+
+  // evaluate the density at the grid points
+  const Evaluation1D& evaluation = step.evaluation;
+  std::vector<std::pair<double, double>> coordPdf(evaluation.coords.size());
+  for (size_t i = 0; i < coordPdf.size(); i++) {
+    double pdf = 0.0;
+    for (size_t k = evaluation.offsets[i]; k < evaluation.offsets[i + 1]; k++) {
+      pdf += alpha1d[evaluation.seqNrs[k]] * evaluation.values[k];
+    }
+    coordPdf[i] = std::make_pair(evaluation.coords[i], pdf);
+  }
+  return PiecewiseLinearCDF1D(coordPdf);
+}
+
+void ConditionalDensityChainLinear::setupEvaluation(base::Grid& grid1d,
+                                                    Evaluation1D& evaluation) {
+  base::GridStorage& gs = grid1d.getStorage();
+  size_t n = gs.getSize();
+
+  // grid points in the order of their sequence numbers followed by the boundaries, the boundaries
+  // are marked by n
+  std::vector<std::pair<double, size_t>> points(n + 2);
+  for (size_t i = 0; i < n; i++) {
+    points[i] = std::make_pair(gs.getPoint(i).getStandardCoordinate(0), i);
+  }
+  points[n] = std::make_pair(0.0, n);
+  points[n + 1] = std::make_pair(1.0, n);
+  std::stable_sort(points.begin(), points.end(),
+                   [](const std::pair<double, size_t>& a, const std::pair<double, size_t>& b) {
+                     return a.first < b.first;
+                   });
+
+  base::LinearBasis<unsigned int, unsigned int> basis;
+  base::GetAffectedBasisFunctions<base::LinearBasis<unsigned int, unsigned int>> affected(gs);
+  std::vector<std::pair<size_t, double>> basisFunctions;
+  base::DataVector coord(1);
+  evaluation.coords.resize(n + 2);
+  evaluation.offsets.assign(1, 0);
+  evaluation.seqNrs.clear();
+  evaluation.values.clear();
+  for (size_t i = 0; i < points.size(); i++) {
+    evaluation.coords[i] = points[i].first;
+    if (points[i].second < n) {
+      coord[0] = points[i].first;
+      basisFunctions.clear();
+      affected(basis, coord, basisFunctions);
+      for (const std::pair<size_t, double>& basisFunction : basisFunctions) {
+        evaluation.seqNrs.push_back(basisFunction.first);
+        evaluation.values.push_back(basisFunction.second);
+      }
+    }
+    evaluation.offsets.push_back(evaluation.seqNrs.size());
+  }
+}
+
+void ConditionalDensityChainLinear::reduce(base::Grid& grid, unsigned int dim, bool conditional,
+                                           Reduction& reduction) {
+  base::GridStorage& gs = grid.getStorage();
+  size_t size = gs.getSize();
+  size_t dims = gs.getDimension();
+
+  // points have to be added one after the other since the grid may be adaptively refined
+  reduction.grid.reset(base::Grid::createLinearGrid(dims - 1));
+  base::GridStorage& mgs = reduction.grid->getStorage();
+  base::GridPoint mgp(mgs.getDimension());
+
+  for (size_t seqNr = 0; seqNr < size; seqNr++) {
+    base::GridPoint& gp = gs.getPoint(seqNr);
+    for (unsigned int d = 0; d < dims; d++) {
+      if (d < dim) {
+        mgp.set(d, gp.getLevel(d), gp.getIndex(d));
+      } else if (d > dim) {
+        mgp.set(d - 1, gp.getLevel(d), gp.getIndex(d));
+      }
+    }
+    if (!mgs.isContaining(mgp)) mgs.insert(mgp);
+  }
+  mgs.recalcLeafProperty();
+
+  reduction.map.resize(size);
+  reduction.levelFactors.resize(size);
+  reduction.indices.resize(size);
+  reduction.integrals.resize(size);
+  for (size_t seqNr = 0; seqNr < size; seqNr++) {
+    base::GridPoint& gp = gs.getPoint(seqNr);
+    double integral = 1;
+    for (unsigned int d = 0; d < dims; d++) {
+      if (d < dim) {
+        mgp.set(d, gp.getLevel(d), gp.getIndex(d));
+      } else if (d > dim) {
+        mgp.set(d - 1, gp.getLevel(d), gp.getIndex(d));
+      }
+      if (conditional && d != dim) integral *= std::pow(2.0, -static_cast<double>(gp.getLevel(d)));
+    }
+    if (!conditional) integral = std::pow(2.0, -static_cast<double>(gp.getLevel(dim)));
+
+    reduction.map[seqNr] = mgs.getSequenceNumber(mgp);
+    reduction.levelFactors[seqNr] = std::pow(2.0, static_cast<double>(gp.getLevel(dim)));
+    reduction.indices[seqNr] = static_cast<double>(gp.getIndex(dim));
+    reduction.integrals[seqNr] = integral;
+  }
+}
+
+void ConditionalDensityChainLinear::margTo1D(base::Grid& grid, size_t dim,
+                                             std::vector<Reduction>& reductions) {
+  // the dimensions to marginalize, shifted by the ones already removed (as in
+  // OperationDensityMargTo1D)
+  size_t dims = grid.getDimension();
+  std::vector<unsigned int> margDims;
+  for (size_t idim = 0; idim < dims; idim++) {
+    if (idim != dim) {
+      margDims.push_back(static_cast<unsigned int>(idim - margDims.size()));
+    }
+  }
+
+  reductions.resize(margDims.size());
+  base::Grid* current = &grid;
+  for (size_t i = 0; i < margDims.size(); i++) {
+    reduce(*current, margDims[i], false, reductions[i]);
+    current = reductions[i].grid.get();
+  }
+}
+
+ConditionalDensityChainLinearCache::ConditionalDensityChainLinearCache(base::Grid& grid)
+    : grid(grid), alpha(0), modificationCount(0), chains(grid.getDimension()) {}
+
+const ConditionalDensityChainLinear& ConditionalDensityChainLinearCache::getChain(
+    const base::DataVector& alpha, size_t dimStart) {
+  // the coefficients are compared by value, so that updates in place are detected as well
+  if ((this->alpha != alpha) || (modificationCount != grid.getStorage().getModificationCount())) {
+    for (auto& chain : chains) {
+      chain.reset();
+    }
+    this->alpha = alpha;
+    modificationCount = grid.getStorage().getModificationCount();
+  }
+
+  if (dimStart >= chains.size()) {
+    throw base::operation_exception("Error: dimension out of range. Operation aborted!");
+  }
+  if (!chains[dimStart]) {
+    chains[dimStart].reset(new ConditionalDensityChainLinear(grid, alpha, dimStart));
+  }
+  return *chains[dimStart];
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
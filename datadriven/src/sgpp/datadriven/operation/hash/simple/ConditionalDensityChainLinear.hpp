@@ -0,0 +1,217 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef CONDITIONALDENSITYCHAINLINEAR_HPP
+#define CONDITIONALDENSITYCHAINLINEAR_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/operation/hash/simple/PiecewiseLinearCDF1D.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Precomputed sequence of conditionals and marginalizations of a density on a linear grid, as
+ * used by the Rosenblatt transformation and its inverse for a fixed start dimension.
+ *
+ * Starting in dimension dimStart, the transformation of a sample computes the CDF of the marginal
+ * density in dimStart and then repeatedly conditions the density on the coordinate of the current
+ * dimension, marginalizes it to the next dimension (cyclically) and computes the CDF there. The
+ * grids of all conditionals and marginals and the mapping of the coefficients between them only
+ * depend on the grid and the start dimension, so they are set up once here; per sample only the
+ * coefficients are recomputed. The results equal the ones of OperationDensityConditionalLinear and
+ * OperationDensityMargTo1D applied sample by sample.
+ *
+ * The transformation methods are const and can be called concurrently.
+ */
+class ConditionalDensityChainLinear {
+ public:
+  /**
+   * @param grid linear grid of dimension at least 2
+   * @param alpha coefficients of the density on grid
+   * @param dimStart start dimension
+   */
+  ConditionalDensityChainLinear(base::Grid& grid, const base::DataVector& alpha, size_t dimStart);
+
+  /**
+   * Rosenblatt transformation of one sample.
+   * @param x coordinates of the sample (getDimension() values)
+   * @param[out] u transformed sample (getDimension() values)
+   */
+  void transform(const double* x, double* u) const;
+
+  /**
+   * Inverse Rosenblatt transformation of one sample.
+   * @param u transformed sample (getDimension() values)
+   * @param[out] x coordinates of the sample (getDimension() values)
+   */
+  void inverseTransform(const double* u, double* x) const;
+
+  /**
+   * @return dimension of the samples
+   */
+  size_t getDimension() const;
+
+ private:
+  /**
+   * Mapping of the coefficients of a grid to the grid with one dimension less
+   */
+  struct Reduction {
+    /**
+     * grid without the removed dimension
+     */
+    std::unique_ptr<base::Grid> grid;
+    /**
+     * sequence number in grid for every point of the original grid
+     */
+    std::vector<size_t> map;
+    /**
+     * 2^level in the removed dimension for every point of the original grid
+     */
+    std::vector<double> levelFactors;
+    /**
+     * index in the removed dimension for every point of the original grid
+     */
+    std::vector<double> indices;
+    /**
+     * integral over the remaining dimensions (conditional) or over the removed dimension
+     * (marginalization) of the basis function of every point of the original grid
+     */
+    std::vector<double> integrals;
+  };
+
+  /**
+   * Evaluation of a density on a one dimensional grid at its grid points
+   */
+  struct Evaluation1D {
+    /**
+     * coordinates of the grid points and of the boundaries, sorted
+     */
+    std::vector<double> coords;
+    /**
+     * the basis functions that do not vanish at coords[i] are stored at offsets[i] to
+     * offsets[i + 1] - 1 of seqNrs and values
+     */
+    std::vector<size_t> offsets;
+    /**
+     * sequence numbers of the basis functions
+     */
+    std::vector<size_t> seqNrs;
+    /**
+     * values of the basis functions
+     */
+    std::vector<double> values;
+  };
+
+  /**
+   * Conditioning on one dimension followed by the marginalization to the next dimension
+   */
+  struct Step {
+    Reduction conditional;
+    std::vector<Reduction> marginalizations;
+    Evaluation1D evaluation;
+  };
+
+  /**
+   * Removes a dimension of a grid in the same way as the linear conditional and marginalization
+   * operations do.
+   */
+  static void reduce(base::Grid& grid, unsigned int dim, bool conditional, Reduction& reduction);
+
+  /**
+   * Appends the marginalizations of grid to the one dimensional grid in dimension dim.
+   */
+  static void margTo1D(base::Grid& grid, size_t dim, std::vector<Reduction>& reductions);
+
+  /**
+   * Determines the sorted coordinates and the basis functions to evaluate on a one dimensional
+   * grid, in the same order as OperationEvalLinear.
+   */
+  static void setupEvaluation(base::Grid& grid1d, Evaluation1D& evaluation);
+
+  /**
+   * Computes the one dimensional CDF of step after conditioning on xbar.
+   * @param step the step
+   * @param xbar coordinate of the conditioned dimension
+   * @param[in,out] alpha coefficients before the step, on return after conditioning
+   * @return the CDF of the conditional density marginalized to the next dimension
+   */
+  PiecewiseLinearCDF1D conditionalCDF(const Step& step, double xbar,
+                                      base::DataVector& alpha) const;
+
+  /**
+   * dimension of the samples
+   */
+  size_t numDims;
+  /**
+   * start dimension
+   */
+  size_t dimStart;
+  /**
+   * coefficients of the density
+   */
+  base::DataVector alpha;
+  /**
+   * CDF of the marginal density in the start dimension
+   */
+  std::unique_ptr<PiecewiseLinearCDF1D> cdfStart;
+  /**
+   * steps for the dimensions following dimStart
+   */
+  std::vector<Step> steps;
+};
+
+/**
+ * Chains of a density for every start dimension, kept across calls of the Rosenblatt
+ * transformations. A chain is set up when a start dimension is requested for the first time. All
+ * chains are discarded when the grid points were modified or the coefficients differ from the ones
+ * the chains were set up with.
+ *
+ * Requesting chains is not thread safe, the returned chains can be used concurrently.
+ */
+class ConditionalDensityChainLinearCache {
+ public:
+  /**
+   * @param grid linear grid of the density
+   */
+  explicit ConditionalDensityChainLinearCache(base::Grid& grid);
+
+  /**
+   * @param alpha coefficients of the density on the grid
+   * @param dimStart start dimension
+   * @return chain for alpha and dimStart, valid until the next call
+   */
+  const ConditionalDensityChainLinear& getChain(const base::DataVector& alpha, size_t dimStart);
+
+ private:
+  /**
+   * the grid of the density
+   */
+  base::Grid& grid;
+  /**
+   * coefficients the chains were set up with
+   */
+  base::DataVector alpha;
+  /**
+   * modification count of the grid storage when the chains were set up
+   */
+  uint64_t modificationCount;
+  /**
+   * chain for every start dimension, empty if not requested yet
+   */
+  std::vector<std::unique_ptr<ConditionalDensityChainLinear>> chains;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* CONDITIONALDENSITYCHAINLINEAR_HPP */
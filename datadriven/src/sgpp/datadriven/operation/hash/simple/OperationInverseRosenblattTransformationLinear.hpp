@@ -7,6 +7,7 @@
 #define OPERATIONINVERSEROSENBLATTTRANSFORMATIONLINEAR_HPP
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/operation/hash/simple/ConditionalDensityChainLinear.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformation.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -21,7 +22,8 @@ namespace datadriven {
 class OperationInverseRosenblattTransformationLinear
     : public OperationInverseRosenblattTransformation {
  public:
-  explicit OperationInverseRosenblattTransformationLinear(base::Grid* grid) : grid(grid) {}
+  explicit OperationInverseRosenblattTransformationLinear(base::Grid* grid)
+      : grid(grid), chains(*grid) {}
   virtual ~OperationInverseRosenblattTransformationLinear() {}
   /**
    * Transformation with mixed starting dimensions
@@ -46,12 +48,10 @@ class OperationInverseRosenblattTransformationLinear
 
  protected:
   base::Grid* grid;
-  void doTransformation_start_dimX(base::Grid* g_in, base::DataVector* a_in, size_t dim_start,
-                                   base::DataVector* cdfs1d, base::DataVector* coords1d);
-  void doTransformation_in_next_dim(base::Grid* g_in, base::DataVector* a_in, size_t op_dim,
-                                    base::DataVector* cdfs1d, base::DataVector* coords1d,
-                                    size_t& curr_dim);
-  double doTransformation1D(base::Grid* grid1d, base::DataVector* alpha1d, double coord1d);
+  /**
+   * conditionals and marginals for every start dimension, kept across calls
+   */
+  ConditionalDensityChainLinearCache chains;
 };
 }  // namespace datadriven
 }  // namespace sgpp
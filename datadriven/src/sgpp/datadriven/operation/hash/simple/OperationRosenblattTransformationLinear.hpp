@@ -7,6 +7,7 @@
 #define OPERATIONROSENBLATTTRANSFORMATIONLINEAR_HPP
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/operation/hash/simple/ConditionalDensityChainLinear.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationRosenblattTransformation.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -20,7 +21,8 @@ namespace datadriven {
 
 class OperationRosenblattTransformationLinear : public OperationRosenblattTransformation {
  public:
-  explicit OperationRosenblattTransformationLinear(base::Grid* grid) : grid(grid) {}
+  explicit OperationRosenblattTransformationLinear(base::Grid* grid)
+      : grid(grid), chains(*grid) {}
   virtual ~OperationRosenblattTransformationLinear() {}
 
   /**
@@ -46,12 +48,10 @@ class OperationRosenblattTransformationLinear : public OperationRosenblattTransf
 
  protected:
   base::Grid* grid;
-  void doTransformation_start_dimX(base::Grid* g_in, base::DataVector* a_in, size_t dim_start,
-                                   base::DataVector* coords1d, base::DataVector* cdfs1d);
-  void doTransformation_in_next_dim(base::Grid* g_in, base::DataVector* a_in, size_t dim_x,
-                                    base::DataVector* coords1d, base::DataVector* cdfs1d,
-                                    size_t& curr_dim);
-  virtual double doTransformation1D(base::Grid* grid1d, base::DataVector* alpha1d, double coord1d);
+  /**
+   * conditionals and marginals for every start dimension, kept across calls
+   */
+  ConditionalDensityChainLinearCache chains;
 };
 
 }  // namespace datadriven
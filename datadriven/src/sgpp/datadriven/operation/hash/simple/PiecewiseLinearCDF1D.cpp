@@ -0,0 +1,121 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/simple/PiecewiseLinearCDF1D.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+PiecewiseLinearCDF1D::PiecewiseLinearCDF1D(base::Grid& grid1d, const base::DataVector& alpha1d) {
+  // evaluate the density at the grid points and add the boundaries
+  base::GridStorage& gs = grid1d.getStorage();
+  size_t n = gs.getSize();
+  std::vector<std::pair<double, double>> coordPdf(n + 2);
+  std::unique_ptr<base::OperationEval> opEval(op_factory::createOperationEval(grid1d));
+  base::DataVector coord(1);
+  for (size_t i = 0; i < n; i++) {
+    coord[0] = gs.getPoint(i).getStandardCoordinate(0);
+    coordPdf[i] = std::make_pair(coord[0], opEval->eval(alpha1d, coord));
+  }
+  coordPdf[n] = std::make_pair(0.0, 0.0);
+  coordPdf[n + 1] = std::make_pair(1.0, 0.0);
+
+  // sort by coordinates, points with equal coordinates keep their order
+  std::stable_sort(
+      coordPdf.begin(), coordPdf.end(),
+      [](const std::pair<double, double>& a, const std::pair<double, double>& b) {
+        return a.first < b.first;
+      });
+  initialize(coordPdf);
+}
+
+PiecewiseLinearCDF1D::PiecewiseLinearCDF1D(std::vector<std::pair<double, double>>& coordPdf) {
+  initialize(coordPdf);
+}
+
+void PiecewiseLinearCDF1D::initialize(std::vector<std::pair<double, double>>& coordPdf) {
+  // make sure that all the pdf values are positive
+  // if not, interpolate between the left neighbor and the closest positive right neighbor
+  coordPdf[0].second = std::max(coordPdf[0].second, 0.0);
+  for (size_t i = 1; i < coordPdf.size(); i++) {
+    if (coordPdf[i].second < 0.0) {
+      size_t j = i;
+      while (j < coordPdf.size() && coordPdf[j].second <= 0.0) {
+        j++;
+      }
+      double right = (j < coordPdf.size()) ? coordPdf[j].second : 0.0;
+      coordPdf[i].second = (coordPdf[i - 1].second + right) / 2.0;
+    }
+  }
+
+  // composite trapezoidal rule, accumulated to the (unnormalized) cdf
+  coords.resize(coordPdf.size());
+  cdfs.resize(coordPdf.size());
+  coords[0] = coordPdf[0].first;
+  cdfs[0] = 0.0;
+  double sum = 0.0;
+  for (size_t i = 1; i < coordPdf.size(); i++) {
+    double area = (coordPdf[i].first - coordPdf[i - 1].first) / 2 *
+                  (coordPdf[i - 1].second + coordPdf[i].second);
+
+    // make sure that the cdf is monotonically increasing
+    // WARNING: THIS IS A HACK THAT OVERCOMES THE PROBLEM
+    // OF NON POSITIVE DENSITY
+    if (area < 0) {
+      std::cerr << "warning: negative area encountered " << coordPdf[i - 1].second << ", "
+                << coordPdf[i].second << std::endl;
+      area = 0;
+    }
+
+    sum += area;
+    coords[i] = coordPdf[i].first;
+    cdfs[i] = sum;
+  }
+
+  for (size_t i = 0; i < cdfs.size(); i++) {
+    cdfs[i] /= sum;
+  }
+}
+
+double PiecewiseLinearCDF1D::cdf(double x) const {
+  // first interval [x1, x2] with x2 >= x
+  size_t i = std::lower_bound(coords.begin(), coords.end(), x) - coords.begin();
+  i = std::min(std::max(i, static_cast<size_t>(1)), coords.size() - 1);
+  double x1 = coords[i - 1], x2 = coords[i];
+  double y1 = cdfs[i - 1], y2 = cdfs[i];
+  if (x2 == x1) {
+    // points with equal coordinates, only reached for x at the left or right end
+    return y2;
+  }
+  // linear interpolation: (y-y1)/(x-x1) = (y2-y1)/(x2-x1)
+  return (y2 - y1) / (x2 - x1) * (x - x1) + y1;
+}
+
+double PiecewiseLinearCDF1D::inverseCdf(double y) const {
+  // first interval [y1, y2] with y2 >= y, the cdf is monotonically increasing
+  size_t i = std::lower_bound(cdfs.begin(), cdfs.end(), y) - cdfs.begin();
+  i = std::min(std::max(i, static_cast<size_t>(1)), cdfs.size() - 1);
+  double x1 = coords[i - 1], x2 = coords[i];
+  double y1 = cdfs[i - 1], y2 = cdfs[i];
+  if (y2 == y1) {
+    // flat cdf (vanishing density), only reached for y at the left or right end
+    return x1;
+  }
+  // linear interpolation: (y-y1)/(x-x1) = (y2-y1)/(x2-x1)
+  return (x2 - x1) / (y2 - y1) * (y - y1) + x1;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,80 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PIECEWISELINEARCDF1D_HPP
+#define PIECEWISELINEARCDF1D_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Cumulative distribution function of a one dimensional sparse grid density, integrated with the
+ * trapezoidal rule between the grid points and the boundaries 0 and 1 (as in the linear Rosenblatt
+ * transformations). Negative density values are replaced by the mean of their left neighbor and
+ * the next positive value to the right.
+ *
+ * The table is built once with a single sorted pass over the grid points, afterwards the CDF and
+ * its inverse are evaluated by binary search and linear interpolation. Evaluation is const and
+ * thus safe to share between threads.
+ */
+class PiecewiseLinearCDF1D {
+ public:
+  /**
+   * Builds the CDF table.
+   * @param grid1d one dimensional grid
+   * @param alpha1d coefficients of the density on grid1d
+   */
+  PiecewiseLinearCDF1D(base::Grid& grid1d, const base::DataVector& alpha1d);
+
+  /**
+   * Builds the CDF table from density values that are already sorted.
+   * @param coordPdf coordinates and density values of the grid points and of the boundaries 0
+   *        and 1 (with density 0), sorted by coordinates. Points with equal coordinates have to be
+   *        in the order of their sequence numbers, followed by the boundary. Negative density
+   *        values are replaced in place.
+   */
+  explicit PiecewiseLinearCDF1D(std::vector<std::pair<double, double>>& coordPdf);
+
+  /**
+   * @param x coordinate in [0, 1]
+   * @return value of the CDF at x
+   */
+  double cdf(double x) const;
+
+  /**
+   * @param y value in [0, 1]
+   * @return coordinate x with cdf(x) = y, the smallest such coordinate if the CDF is constant
+   *         around x (vanishing density)
+   */
+  double inverseCdf(double y) const;
+
+ private:
+  /**
+   * Integrates the density, see the constructor for the arguments
+   */
+  void initialize(std::vector<std::pair<double, double>>& coordPdf);
+
+  /**
+   * Sorted coordinates of the grid points and the boundaries
+   */
+  std::vector<double> coords;
+  /**
+   * Values of the CDF at coords
+   */
+  std::vector<double> cdfs;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* PIECEWISELINEARCDF1D_HPP */
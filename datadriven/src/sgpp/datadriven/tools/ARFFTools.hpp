@@ -46,11 +46,11 @@ class ARFFTools {
                            std::vector<double> selectedTargets);
 
   /**
-   * Sequentially reads a ARFF file.
+   * Reads a ARFF file in a single pass using #sgpp::datadriven::DatasetStreamReader.
    *
    * @param stream contains the raw data. Note: After this function exists,
-   *        stream will be at eof. For further use it should be cleared and 
-   *        reset
+   *        stream will be at eof (or somewhere behind the last instance read if
+   *        instanceCutoff is reached). For further use it should be cleared and reset
    * @param hasTargets whether the csv has columns for targets
    *        (supervised learning)
    * @param instanceCutoff maximal number of instances to include in the
@@ -115,13 +115,6 @@ class ARFFTools {
                                     size_t instanceCutoff = -1,
                                     std::vector<size_t> selectedCols = std::vector<size_t>(),
                                     std::vector<double> selectedTargets = std::vector<double>());
-
-
- private:
-  /**
-  * Take a comma-sererated line and return its values as double values
-  */
-  static std::vector<double> tokenizeLine(const std::string& line);
 };
 
 }  // namespace datadriven
@@ -27,11 +27,11 @@ namespace datadriven {
 class CSVTools {
  public:
   /**
-   * Sequentially reads a CSV file.
+   * Reads a CSV file in a single pass using #sgpp::datadriven::DatasetStreamReader.
    *
    * @param stream constains the raw data. Note: After this function exists,
-   *        stream will be at eof. For further use it should be cleared and 
-   *        reset
+   *        stream will be at eof (or somewhere behind the last instance read if
+   *        instanceCutoff is reached). For further use it should be cleared and reset
    * @param skipFirstLine whether to skip the first line while parsing
    *        This accomodates for a comment line with the data layout
    * @param hasTargets whether the csv has columns for targets
@@ -106,12 +106,6 @@ class CSVTools {
                                   bool skipFirstLine = false,
                                   bool hasTargets = true,
                                   std::vector<double> selectedTargets = std::vector<double>());
-
- private:
-  /**
-   * Take a comma-sererated line and return its values as double values
-   */
-  static std::vector<double> tokenizeLine(const std::string& line);
 };
 
 }  // namespace datadriven
@@ -0,0 +1,396 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/ColumnarDatasetFile.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::file_exception;
+
+namespace {
+const char magicNumber[8] = {'S', 'G', 'P', 'P', 'C', 'O', 'L', 'D'};
+const uint32_t byteOrderMark = 0x01020304;
+
+void writePadding(std::ofstream& file) {
+  const char padding[ColumnarDatasetFile::ALIGNMENT] = {};
+  size_t offset = static_cast<size_t>(file.tellp());
+  size_t misalignment = offset % ColumnarDatasetFile::ALIGNMENT;
+  if (misalignment != 0) {
+    file.write(padding, ColumnarDatasetFile::ALIGNMENT - misalignment);
+  }
+}
+}  // namespace
+
+struct ColumnarDatasetFile::FileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrder;
+  uint64_t numberRows;
+  uint64_t dimension;
+  uint32_t hasTargets;
+  uint32_t hasStatistics;
+  uint64_t chunkRows;
+  uint64_t numberChunks;
+  // chunk offsets (uint64 each), then minimum and maximum of each column of each chunk
+  uint64_t chunkTableOffset;
+};
+
+/**
+ * Appends chunks to a columnar dataset file and finally writes the chunk table and the header
+ */
+class ColumnarDatasetFile::Writer {
+ public:
+  Writer(const std::string& fileName, bool hasTargets, size_t chunkRows, bool statistics)
+      : file(fileName, std::ios::out | std::ios::binary | std::ios::trunc),
+        hasTargets(hasTargets),
+        chunkRows(chunkRows),
+        statistics(statistics),
+        numberRows(0),
+        dimension(0) {
+    if (!file) {
+      throw file_exception("ColumnarDatasetFile: cannot open file for writing");
+    }
+    if (chunkRows == 0) {
+      throw file_exception("ColumnarDatasetFile: number of rows per chunk must be positive");
+    }
+    // placeholder, the header is written when all chunks are known
+    FileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  }
+
+  // appends rows [first, first + rows) of a dataset as a chunk
+  void appendChunk(const Dataset& dataset, size_t first, size_t rows) {
+    const sgpp::base::DataMatrix& data = dataset.getData();
+    if (chunkOffsets.empty()) {
+      dimension = data.getNcols();
+    } else if (data.getNcols() != dimension) {
+      throw file_exception("ColumnarDatasetFile: all chunks must have the same dimension");
+    }
+    writePadding(file);
+    chunkOffsets.push_back(static_cast<uint64_t>(file.tellp()));
+    column.resize(rows);
+    for (size_t j = 0; j < dimension; j++) {
+      double min = std::numeric_limits<double>::infinity();
+      double max = -std::numeric_limits<double>::infinity();
+      for (size_t i = 0; i < rows; i++) {
+        column[i] = data.get(first + i, j);
+        min = std::min(min, column[i]);
+        max = std::max(max, column[i]);
+      }
+      file.write(reinterpret_cast<const char*>(column.data()), rows * sizeof(double));
+      writePadding(file);
+      chunkStatistics.push_back(min);
+      chunkStatistics.push_back(max);
+    }
+    if (hasTargets) {
+      file.write(reinterpret_cast<const char*>(dataset.getTargets().data() + first),
+                 rows * sizeof(double));
+    }
+    numberRows += rows;
+  }
+
+  void finish() {
+    writePadding(file);
+    FileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, magicNumber, sizeof(magicNumber));
+    header.version = ColumnarDatasetFile::VERSION;
+    header.byteOrder = byteOrderMark;
+    header.numberRows = numberRows;
+    header.dimension = dimension;
+    header.hasTargets = hasTargets;
+    header.hasStatistics = statistics;
+    header.chunkRows = chunkRows;
+    header.numberChunks = chunkOffsets.size();
+    header.chunkTableOffset = static_cast<uint64_t>(file.tellp());
+
+    file.write(reinterpret_cast<const char*>(chunkOffsets.data()),
+               chunkOffsets.size() * sizeof(uint64_t));
+    if (statistics) {
+      file.write(reinterpret_cast<const char*>(chunkStatistics.data()),
+                 chunkStatistics.size() * sizeof(double));
+    }
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!file) {
+      throw file_exception("ColumnarDatasetFile: writing file failed");
+    }
+  }
+
+ private:
+  std::ofstream file;
+  bool hasTargets;
+  size_t chunkRows;
+  bool statistics;
+  size_t numberRows;
+  size_t dimension;
+  std::vector<uint64_t> chunkOffsets;
+  std::vector<double> chunkStatistics;
+  std::vector<double> column;
+};
+
+ColumnarDatasetFile::ColumnarDatasetFile(const std::string& fileName)
+    : contents(nullptr), contentSize(0), mapped(false), buffer() {
+#ifndef _WIN32
+  int fd = open(fileName.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw file_exception("ColumnarDatasetFile: cannot open file");
+  }
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0) {
+    close(fd);
+    throw file_exception("ColumnarDatasetFile: cannot stat file");
+  }
+  contentSize = static_cast<size_t>(fileStat.st_size);
+  if (contentSize > 0) {
+    void* mapping = mmap(nullptr, contentSize, PROT_READ, MAP_SHARED, fd, 0);
+    if (mapping != MAP_FAILED) {
+      contents = static_cast<const char*>(mapping);
+      mapped = true;
+    }
+  }
+  close(fd);
+#endif
+  if (!mapped) {
+    std::ifstream file(fileName, std::ios::in | std::ios::binary);
+    if (!file) {
+      throw file_exception("ColumnarDatasetFile: cannot open file");
+    }
+    buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    contents = buffer.data();
+    contentSize = buffer.size();
+  }
+
+  // validate header, chunk table and chunks
+  if (contentSize < sizeof(FileHeader) ||
+      std::memcmp(header().magic, magicNumber, sizeof(magicNumber)) != 0) {
+    unmap();
+    throw file_exception("ColumnarDatasetFile: not a columnar dataset file");
+  }
+  if (header().version != VERSION || header().byteOrder != byteOrderMark) {
+    unmap();
+    throw file_exception("ColumnarDatasetFile: unsupported version or byte order");
+  }
+  const FileHeader& h = header();
+  size_t tableSize = h.numberChunks * sizeof(uint64_t) +
+                     (h.hasStatistics ? h.numberChunks * h.dimension * 2 * sizeof(double) : 0);
+  bool valid = h.chunkRows > 0 && h.chunkTableOffset % sizeof(uint64_t) == 0 &&
+               h.chunkTableOffset + tableSize <= contentSize &&
+               h.numberChunks == (h.numberRows + h.chunkRows - 1) / h.chunkRows;
+  for (size_t c = 0; valid && c < h.numberChunks; c++) {
+    size_t offset = reinterpret_cast<const uint64_t*>(contents + h.chunkTableOffset)[c];
+    size_t rows = getRowsInChunk(c);
+    size_t blockSize = (rows * sizeof(double) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    size_t end = offset + h.dimension * blockSize + (h.hasTargets ? rows * sizeof(double) : 0);
+    valid = offset % ALIGNMENT == 0 && offset >= sizeof(FileHeader) && end <= h.chunkTableOffset;
+  }
+  if (!valid) {
+    unmap();
+    throw file_exception("ColumnarDatasetFile: file is truncated or corrupt");
+  }
+}
+
+ColumnarDatasetFile::~ColumnarDatasetFile() { unmap(); }
+
+void ColumnarDatasetFile::unmap() {
+#ifndef _WIN32
+  if (mapped) {
+    munmap(const_cast<char*>(contents), contentSize);
+    mapped = false;
+  }
+#endif
+  contents = nullptr;
+}
+
+bool ColumnarDatasetFile::isColumnarDatasetFile(const std::string& fileName) {
+  std::ifstream file(fileName, std::ios::in | std::ios::binary);
+  char magic[sizeof(magicNumber)];
+  if (!file.read(magic, sizeof(magic))) {
+    return false;
+  }
+  return std::memcmp(magic, magicNumber, sizeof(magicNumber)) == 0;
+}
+
+void ColumnarDatasetFile::write(const std::string& fileName, const Dataset& dataset,
+                                bool hasTargets, size_t chunkRows, bool statistics) {
+  Writer writer(fileName, hasTargets, chunkRows, statistics);
+  size_t numberRows = dataset.getData().getNrows();
+  for (size_t first = 0; first < numberRows; first += chunkRows) {
+    writer.appendChunk(dataset, first, std::min(chunkRows, numberRows - first));
+  }
+  writer.finish();
+}
+
+void ColumnarDatasetFile::write(const std::string& fileName, DatasetStreamReader& reader,
+                                bool hasTargets, size_t chunkRows, bool statistics) {
+  Writer writer(fileName, hasTargets, chunkRows, statistics);
+  while (true) {
+    Dataset chunk = reader.readSamples(chunkRows);
+    if (chunk.getNumberInstances() == 0) {
+      break;
+    }
+    writer.appendChunk(chunk, 0, chunk.getNumberInstances());
+  }
+  writer.finish();
+}
+
+void ColumnarDatasetFile::convert(const std::string& inputFileName,
+                                  const std::string& outputFileName, bool hasTargets,
+                                  size_t chunkRows, bool statistics) {
+  std::string extension = inputFileName.substr(std::min(inputFileName.rfind('.') + 1,
+                                                        inputFileName.size()));
+  std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+  bool isArff = extension == "arff";
+  DatasetStreamReader reader(inputFileName,
+                             isArff ? DatasetStreamReader::Format::ARFF
+                                    : DatasetStreamReader::Format::CSV,
+                             hasTargets, !isArff);
+  write(outputFileName, reader, hasTargets, chunkRows, statistics);
+}
+
+size_t ColumnarDatasetFile::getNumberRows() const { return header().numberRows; }
+
+size_t ColumnarDatasetFile::getDimension() const { return header().dimension; }
+
+bool ColumnarDatasetFile::hasTargets() const { return header().hasTargets != 0; }
+
+bool ColumnarDatasetFile::hasStatistics() const { return header().hasStatistics != 0; }
+
+size_t ColumnarDatasetFile::getChunkRows() const { return header().chunkRows; }
+
+size_t ColumnarDatasetFile::getNumberChunks() const { return header().numberChunks; }
+
+size_t ColumnarDatasetFile::getRowsInChunk(size_t chunk) const {
+  if (chunk >= header().numberChunks) {
+    throw file_exception("ColumnarDatasetFile: chunk index out of range");
+  }
+  return std::min<size_t>(header().chunkRows, header().numberRows - chunk * header().chunkRows);
+}
+
+const double* ColumnarDatasetFile::getColumn(size_t chunk, size_t column) const {
+  if (chunk >= header().numberChunks || column >= header().dimension) {
+    throw file_exception("ColumnarDatasetFile: chunk or column index out of range");
+  }
+  return block(chunk, column);
+}
+
+const double* ColumnarDatasetFile::getTargets(size_t chunk) const {
+  if (!hasTargets()) {
+    throw file_exception("ColumnarDatasetFile: file does not contain targets");
+  }
+  if (chunk >= header().numberChunks) {
+    throw file_exception("ColumnarDatasetFile: chunk index out of range");
+  }
+  return block(chunk, header().dimension);
+}
+
+double ColumnarDatasetFile::getChunkMin(size_t chunk, size_t column) const {
+  return statistics(chunk, column)[0];
+}
+
+double ColumnarDatasetFile::getChunkMax(size_t chunk, size_t column) const {
+  return statistics(chunk, column)[1];
+}
+
+void ColumnarDatasetFile::gatherRows(const std::vector<size_t>& rows,
+                                     const std::vector<size_t>& columns,
+                                     sgpp::base::DataMatrix& data,
+                                     sgpp::base::DataVector& targets) const {
+  const size_t chunkRows = header().chunkRows;
+  const size_t numberColumns = columns.empty() ? header().dimension : columns.size();
+  for (size_t row : rows) {
+    if (row >= header().numberRows) {
+      throw file_exception("ColumnarDatasetFile: row index out of range");
+    }
+  }
+  for (size_t column : columns) {
+    if (column >= header().dimension) {
+      throw file_exception("ColumnarDatasetFile: column index out of range");
+    }
+  }
+  data.resizeRowsCols(rows.size(), numberColumns);
+  targets.resizeZero(rows.size());
+
+  // group the requested rows by chunk, so that each column block is looked up once per chunk
+  std::vector<size_t> order(rows.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&rows, chunkRows](size_t a, size_t b) {
+    return rows[a] / chunkRows < rows[b] / chunkRows;
+  });
+  std::vector<size_t> groupStarts;
+  for (size_t p = 0; p < order.size(); p++) {
+    if (p == 0 || rows[order[p]] / chunkRows != rows[order[p - 1]] / chunkRows) {
+      groupStarts.push_back(p);
+    }
+  }
+  groupStarts.push_back(order.size());
+
+  // copies column (or the targets as column dimension) of all requested rows into result, where
+  // the value of the i-th row is stored at result[i * resultStride]
+  auto gatherColumn = [&](size_t column, double* result, size_t resultStride) {
+    for (size_t g = 0; g + 1 < groupStarts.size(); g++) {
+      const double* values = block(rows[order[groupStarts[g]]] / chunkRows, column);
+      for (size_t p = groupStarts[g]; p < groupStarts[g + 1]; p++) {
+        result[order[p] * resultStride] = values[rows[order[p]] % chunkRows];
+      }
+    }
+  };
+
+  // column by column, so that the rows of a chunk are read from contiguous memory
+  for (size_t k = 0; k < numberColumns; k++) {
+    gatherColumn(columns.empty() ? k : columns[k], data.getPointer() + k, numberColumns);
+  }
+  if (hasTargets()) {
+    gatherColumn(header().dimension, targets.getPointer(), 1);
+  }
+}
+
+const ColumnarDatasetFile::FileHeader& ColumnarDatasetFile::header() const {
+  return *reinterpret_cast<const FileHeader*>(contents);
+}
+
+const double* ColumnarDatasetFile::block(size_t chunk, size_t column) const {
+  // column blocks (and the targets as column dimension) are padded to the alignment
+  size_t offset = reinterpret_cast<const uint64_t*>(contents + header().chunkTableOffset)[chunk];
+  size_t blockSize = (getRowsInChunk(chunk) * sizeof(double) + ALIGNMENT - 1) / ALIGNMENT *
+                     ALIGNMENT;
+  return reinterpret_cast<const double*>(contents + offset + column * blockSize);
+}
+
+const double* ColumnarDatasetFile::statistics(size_t chunk, size_t column) const {
+  if (!hasStatistics()) {
+    throw file_exception("ColumnarDatasetFile: file does not contain statistics");
+  }
+  if (chunk >= header().numberChunks || column >= header().dimension) {
+    throw file_exception("ColumnarDatasetFile: chunk or column index out of range");
+  }
+  const double* table = reinterpret_cast<const double*>(
+      contents + header().chunkTableOffset + header().numberChunks * sizeof(uint64_t));
+  return table + 2 * (chunk * header().dimension + column);
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,219 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/datadriven/tools/DatasetStreamReader.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Binary columnar dataset file.
+ *
+ * The file starts with a fixed header (magic number, format version, byte order mark, number of
+ * rows, dimension, whether targets and statistics are stored, rows per chunk, number of chunks and
+ * the offset of the chunk table). The samples are stored in chunks of chunkRows rows (the last
+ * chunk may be smaller). A chunk contains one contiguous block per column followed by a block of
+ * targets, each starting at a multiple of ALIGNMENT bytes. The chunk table at the end holds the
+ * offsets of the chunks, optionally followed by the minimum and maximum of every column in every
+ * chunk.
+ *
+ * Files are opened read-only and, on POSIX systems, memory mapped, so the column blocks can be
+ * used in place without any parsing and processes working on the same file (e.g. cross validation
+ * folds) share its pages. On other systems the file is read into memory once.
+ */
+class ColumnarDatasetFile {
+ public:
+  /**
+   * Alignment of every column block in bytes
+   */
+  static const size_t ALIGNMENT = 64;
+
+  /**
+   * Current version of the file format
+   */
+  static const uint32_t VERSION = 1;
+
+  /**
+   * Default number of rows per chunk
+   */
+  static const size_t DEFAULT_CHUNK_ROWS = 1 << 16;
+
+  /**
+   * Opens and maps a columnar dataset file. Throws a file_exception if the file cannot be opened
+   * or is not a valid columnar dataset file.
+   * @param fileName path of the file
+   */
+  explicit ColumnarDatasetFile(const std::string& fileName);
+
+  /**
+   * Unmaps the file
+   */
+  ~ColumnarDatasetFile();
+
+  ColumnarDatasetFile(const ColumnarDatasetFile&) = delete;
+  ColumnarDatasetFile& operator=(const ColumnarDatasetFile&) = delete;
+
+  /**
+   * Checks whether a file starts with the magic number of the columnar format.
+   * @param fileName path of the file
+   * @return whether the file is a columnar dataset file
+   */
+  static bool isColumnarDatasetFile(const std::string& fileName);
+
+  /**
+   * Writes a dataset into a columnar dataset file.
+   * @param fileName path of the file, existing files are overwritten
+   * @param dataset the samples and targets to write
+   * @param hasTargets whether the targets of the dataset are stored
+   * @param chunkRows number of rows per chunk
+   * @param statistics whether the minimum and maximum of each column in each chunk are stored
+   */
+  static void write(const std::string& fileName, const Dataset& dataset, bool hasTargets,
+                    size_t chunkRows = DEFAULT_CHUNK_ROWS, bool statistics = true);
+
+  /**
+   * Writes all remaining samples of a reader into a columnar dataset file, reading one chunk at a
+   * time. This allows converting files that do not fit into memory.
+   * @param fileName path of the file, existing files are overwritten
+   * @param reader reader of the samples
+   * @param hasTargets whether the reader provides targets that are stored
+   * @param chunkRows number of rows per chunk
+   * @param statistics whether the minimum and maximum of each column in each chunk are stored
+   */
+  static void write(const std::string& fileName, DatasetStreamReader& reader, bool hasTargets,
+                    size_t chunkRows = DEFAULT_CHUNK_ROWS, bool statistics = true);
+
+  /**
+   * Converts a CSV or ARFF file (detected by the extension .arff) into a columnar dataset file.
+   * As in #sgpp::datadriven::CSVFileSampleProvider, the first line of a CSV file is skipped.
+   * @param inputFileName path of the CSV or ARFF file
+   * @param outputFileName path of the columnar dataset file, existing files are overwritten
+   * @param hasTargets whether the last column of the input contains targets
+   * @param chunkRows number of rows per chunk
+   * @param statistics whether the minimum and maximum of each column in each chunk are stored
+   */
+  static void convert(const std::string& inputFileName, const std::string& outputFileName,
+                      bool hasTargets, size_t chunkRows = DEFAULT_CHUNK_ROWS,
+                      bool statistics = true);
+
+  /**
+   * @return total number of rows (samples)
+   */
+  size_t getNumberRows() const;
+
+  /**
+   * @return number of columns (dimension of the samples)
+   */
+  size_t getDimension() const;
+
+  /**
+   * @return whether targets are stored
+   */
+  bool hasTargets() const;
+
+  /**
+   * @return whether per chunk minima and maxima are stored
+   */
+  bool hasStatistics() const;
+
+  /**
+   * @return number of rows per chunk (except for the last one)
+   */
+  size_t getChunkRows() const;
+
+  /**
+   * @return number of chunks
+   */
+  size_t getNumberChunks() const;
+
+  /**
+   * @param chunk index of the chunk
+   * @return number of rows in the chunk
+   */
+  size_t getRowsInChunk(size_t chunk) const;
+
+  /**
+   * Read-only pointer to a column block of a chunk inside the mapping, valid as long as this
+   * object lives.
+   * @param chunk index of the chunk
+   * @param column index of the column
+   * @return pointer to the first of getRowsInChunk(chunk) values
+   */
+  const double* getColumn(size_t chunk, size_t column) const;
+
+  /**
+   * Read-only pointer to the targets of a chunk inside the mapping. Throws if no targets are
+   * stored.
+   * @param chunk index of the chunk
+   * @return pointer to the first of getRowsInChunk(chunk) targets
+   */
+  const double* getTargets(size_t chunk) const;
+
+  /**
+   * @param chunk index of the chunk
+   * @param column index of the column
+   * @return minimum of the column in the chunk. Throws if no statistics are stored.
+   */
+  double getChunkMin(size_t chunk, size_t column) const;
+
+  /**
+   * @param chunk index of the chunk
+   * @param column index of the column
+   * @return maximum of the column in the chunk. Throws if no statistics are stored.
+   */
+  double getChunkMax(size_t chunk, size_t column) const;
+
+  /**
+   * Copies selected rows and columns into a (row major) matrix and the targets into a vector.
+   * @param rows indices of the rows to copy, in the order of the result
+   * @param columns indices of the columns to copy, in the order of the result. If empty, all
+   *        columns are copied.
+   * @param[out] data matrix of size rows.size() x columns.size(), resized accordingly
+   * @param[out] targets vector of size rows.size(), zero if no targets are stored
+   */
+  void gatherRows(const std::vector<size_t>& rows, const std::vector<size_t>& columns,
+                  sgpp::base::DataMatrix& data, sgpp::base::DataVector& targets) const;
+
+ private:
+  struct FileHeader;
+  class Writer;
+
+  const FileHeader& header() const;
+  const double* block(size_t chunk, size_t column) const;
+  const double* statistics(size_t chunk, size_t column) const;
+  void unmap();
+
+  /**
+   * Start of the file contents (mapping or buffer)
+   */
+  const char* contents;
+  /**
+   * Size of the file in bytes
+   */
+  size_t contentSize;
+  /**
+   * Whether contents is a memory mapping (otherwise it is owned by buffer)
+   */
+  bool mapped;
+  /**
+   * Fallback storage if the file could not be mapped
+   */
+  std::vector<char> buffer;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
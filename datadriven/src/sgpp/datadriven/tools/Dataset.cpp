@@ -7,6 +7,8 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <utility>
+
 namespace sgpp {
 namespace datadriven {
 
@@ -18,6 +20,12 @@ Dataset::Dataset(size_t numberInstances, size_t dimension)
       targets(numberInstances),
       data(numberInstances, dimension) {}
 
+Dataset::Dataset(sgpp::base::DataMatrix&& data, sgpp::base::DataVector&& targets)
+    : numberInstances(data.getNrows()),
+      dimension(data.getNcols()),
+      targets(std::move(targets)),
+      data(std::move(data)) {}
+
 size_t Dataset::getNumberInstances() const { return numberInstances; }
 
 size_t Dataset::getDimension() const { return dimension; }
@@ -31,6 +31,14 @@ class Dataset {
    */
   Dataset(size_t numberInstances, size_t dimension);
 
+  /**
+   * Constructs a dataset from existing samples and targets, which are moved into the dataset.
+   *
+   * @param data samples, one per row
+   * @param targets targets of the samples
+   */
+  Dataset(sgpp::base::DataMatrix&& data, sgpp::base::DataVector&& targets);
+
   /**
    * @return number of instances in the dataset
    */
@@ -0,0 +1,389 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/DatasetStreamReader.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::file_exception;
+
+namespace {
+
+// powers of ten that are exactly representable as doubles
+const double exactPowersOfTen[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                   1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                   1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+inline bool isBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+inline bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+// atof on the field [begin, end) that is terminated by a comma or end
+double parseDoubleFallback(const char* begin, const char*& pos, const char* end) {
+  const char* fieldEnd = begin;
+  while (fieldEnd != end && *fieldEnd != ',') ++fieldEnd;
+  pos = fieldEnd;
+  size_t length = static_cast<size_t>(fieldEnd - begin);
+  char field[64];
+  if (length < sizeof(field)) {
+    std::memcpy(field, begin, length);
+    field[length] = '\0';
+    return std::strtod(field, nullptr);
+  }
+  return std::strtod(std::string(begin, fieldEnd).c_str(), nullptr);
+}
+
+std::unique_ptr<std::istream> openFile(const std::string& fileName) {
+  std::unique_ptr<std::ifstream> file{
+      new std::ifstream(fileName, std::ios::in | std::ios::binary)};
+  if (!file->is_open()) {
+    throw file_exception("DatasetStreamReader: Unable to open file");
+  }
+  return std::unique_ptr<std::istream>(file.release());
+}
+
+}  // namespace
+
+DatasetStreamReader::DatasetStreamReader(std::istream& stream, Format format, bool hasTargets,
+                                         bool skipFirstLine, size_t instanceCutoff,
+                                         std::vector<size_t> selectedCols,
+                                         std::vector<double> selectedTargets, size_t chunkSize)
+    : ownedStream(),
+      stream(&stream),
+      format(format),
+      hasTargets(hasTargets),
+      skipFirstLine(skipFirstLine),
+      instanceCutoff(instanceCutoff),
+      selectedCols(selectedCols),
+      selectedTargets(hasTargets ? selectedTargets : std::vector<double>()),
+      buffer(std::max(chunkSize, static_cast<size_t>(1))),
+      skipNextLine(skipFirstLine) {}
+
+DatasetStreamReader::DatasetStreamReader(const std::string& fileName, Format format,
+                                         bool hasTargets, bool skipFirstLine,
+                                         size_t instanceCutoff, std::vector<size_t> selectedCols,
+                                         std::vector<double> selectedTargets, size_t chunkSize)
+    : ownedStream(openFile(fileName)),
+      stream(ownedStream.get()),
+      format(format),
+      hasTargets(hasTargets),
+      skipFirstLine(skipFirstLine),
+      instanceCutoff(instanceCutoff),
+      selectedCols(selectedCols),
+      selectedTargets(hasTargets ? selectedTargets : std::vector<double>()),
+      buffer(std::max(chunkSize, static_cast<size_t>(1))),
+      skipNextLine(skipFirstLine) {}
+
+double DatasetStreamReader::parseDouble(const char*& pos, const char* end) {
+  const char* begin = pos;
+  const char* p = pos;
+  while (p != end && isBlank(*p)) ++p;
+
+  bool negative = false;
+  if (p != end && (*p == '-' || *p == '+')) {
+    negative = *p == '-';
+    ++p;
+  }
+
+  // significand and decimal exponent, exact as long as at most 19 significant digits occur
+  uint64_t significand = 0;
+  int significantDigits = 0;
+  int64_t exponent = 0;
+  bool anyDigits = false;
+  bool exact = true;
+  for (; p != end && isDigit(*p); ++p) {
+    anyDigits = true;
+    if (significand != 0 || *p != '0') {
+      if (significantDigits < 19) {
+        significand = significand * 10 + static_cast<uint64_t>(*p - '0');
+        significantDigits++;
+      } else {
+        exact = false;
+      }
+    }
+  }
+  if (p != end && *p == '.') {
+    for (++p; p != end && isDigit(*p); ++p) {
+      anyDigits = true;
+      if (significand != 0 || *p != '0') {
+        if (significantDigits < 19) {
+          significand = significand * 10 + static_cast<uint64_t>(*p - '0');
+          significantDigits++;
+        } else {
+          exact = false;
+        }
+      }
+      exponent--;
+    }
+  }
+  if (anyDigits && p != end && (*p == 'e' || *p == 'E')) {
+    const char* q = p + 1;
+    bool negativeExponent = false;
+    if (q != end && (*q == '-' || *q == '+')) {
+      negativeExponent = *q == '-';
+      ++q;
+    }
+    if (q != end && isDigit(*q)) {
+      int64_t explicitExponent = 0;
+      for (; q != end && isDigit(*q); ++q) {
+        if (explicitExponent < 100000) explicitExponent = explicitExponent * 10 + (*q - '0');
+      }
+      exponent += negativeExponent ? -explicitExponent : explicitExponent;
+      p = q;
+    }
+  }
+
+  const char* fieldEnd = p;
+  while (fieldEnd != end && isBlank(*fieldEnd)) ++fieldEnd;
+
+  // Clinger's fast path: significand and power of ten are exact doubles, so a single
+  // multiplication or division is correctly rounded
+  if (!anyDigits || !exact || (fieldEnd != end && *fieldEnd != ',') ||
+      significand > (static_cast<uint64_t>(1) << 53) || exponent < -22 || exponent > 22) {
+    return parseDoubleFallback(begin, pos, end);
+  }
+  pos = fieldEnd;
+  double value = static_cast<double>(significand);
+  value = exponent < 0 ? value / exactPowersOfTen[-exponent] : value * exactPowersOfTen[exponent];
+  return negative ? -value : value;
+}
+
+bool DatasetStreamReader::isDataLine(const char* begin, const char* end) const {
+  while (begin != end && isBlank(*begin)) ++begin;
+  if (begin == end) {
+    return false;
+  }
+  return format != Format::ARFF || (*begin != '%' && *begin != '@');
+}
+
+void DatasetStreamReader::refill() {
+  if (bufferPos > 0) {
+    std::memmove(buffer.data(), buffer.data() + bufferPos, bufferEnd - bufferPos);
+    bufferEnd -= bufferPos;
+    bufferPos = 0;
+  }
+  // a single line does not fit into the buffer
+  if (bufferEnd == buffer.size()) {
+    buffer.resize(2 * buffer.size());
+  }
+  stream->read(buffer.data() + bufferEnd, static_cast<std::streamsize>(buffer.size() - bufferEnd));
+  bufferEnd += static_cast<size_t>(stream->gcount());
+  if (!*stream) {
+    streamExhausted = true;
+  }
+}
+
+size_t DatasetStreamReader::collectLines(size_t maxLines,
+                                         std::vector<std::pair<const char*, const char*>>& lines) {
+  lines.clear();
+  size_t lineStart = bufferPos;
+  while (lines.size() < maxLines) {
+    const char* data = buffer.data();
+    const char* newline = static_cast<const char*>(
+        std::memchr(data + lineStart, '\n', bufferEnd - lineStart));
+    const char* lineEnd = newline;
+    if (newline == nullptr) {
+      if (!streamExhausted) {
+        if (!lines.empty()) {
+          break;
+        }
+        // no complete line available, the skipped lines in front can be dropped
+        bufferPos = lineStart;
+        refill();
+        lineStart = bufferPos;
+        continue;
+      }
+      // last line without line break
+      if (lineStart == bufferEnd) {
+        break;
+      }
+      lineEnd = data + bufferEnd;
+    }
+    const char* lineBegin = data + lineStart;
+    lineStart = static_cast<size_t>(lineEnd - data) + (newline != nullptr ? 1 : 0);
+    while (lineEnd != lineBegin && *(lineEnd - 1) == '\r') --lineEnd;
+
+    if (skipNextLine) {
+      skipNextLine = false;
+    } else if (isDataLine(lineBegin, lineEnd)) {
+      lines.emplace_back(lineBegin, lineEnd);
+    }
+    if (lines.empty()) {
+      bufferPos = lineStart;
+    }
+  }
+  return lineStart;
+}
+
+void DatasetStreamReader::readHeader() {
+  if (headerRead) {
+    return;
+  }
+  std::vector<std::pair<const char*, const char*>> lines;
+  collectLines(1, lines);
+  headerRead = true;
+  if (lines.empty()) {
+    numberColumns = 0;
+    dimension = 0;
+    return;
+  }
+  // the first data line determines the number of columns, it is not consumed
+  size_t fields = std::count(lines[0].first, lines[0].second, ',') + 1;
+  numberColumns = hasTargets ? fields - 1 : fields;
+  if (!selectedCols.empty()) {
+    if (*std::max_element(selectedCols.begin(), selectedCols.end()) >= numberColumns) {
+      throw file_exception("DatasetStreamReader: invalid column selection");
+    }
+    dimension = selectedCols.size();
+  } else {
+    dimension = numberColumns;
+  }
+}
+
+size_t DatasetStreamReader::getDimension() {
+  readHeader();
+  return dimension;
+}
+
+size_t DatasetStreamReader::getNumberSamplesRead() const { return samplesRead; }
+
+void DatasetStreamReader::rewind() {
+  stream->clear();
+  stream->seekg(0, std::ios::beg);
+  bufferPos = 0;
+  bufferEnd = 0;
+  streamExhausted = false;
+  skipNextLine = skipFirstLine;
+  samplesRead = 0;
+}
+
+Dataset DatasetStreamReader::readSamples(size_t howMany) {
+  readHeader();
+  howMany = std::min(howMany, instanceCutoff - std::min(instanceCutoff, samplesRead));
+
+  // target of each field of a line in the row (-1: ignored, dimension: target), columns selected
+  // more than once are copied afterwards
+  const int64_t ignored = -1;
+  const int64_t targetField = static_cast<int64_t>(dimension);
+  std::vector<int64_t> fieldDestination(numberColumns + 1, ignored);
+  std::vector<std::pair<size_t, size_t>> duplicateColumns;
+  if (selectedCols.empty()) {
+    for (size_t i = 0; i < numberColumns; i++) fieldDestination[i] = static_cast<int64_t>(i);
+  } else {
+    for (size_t i = 0; i < selectedCols.size(); i++) {
+      if (fieldDestination[selectedCols[i]] == ignored) {
+        fieldDestination[selectedCols[i]] = static_cast<int64_t>(i);
+      } else {
+        duplicateColumns.emplace_back(i, static_cast<size_t>(fieldDestination[selectedCols[i]]));
+      }
+    }
+  }
+  if (hasTargets) {
+    fieldDestination[numberColumns] = targetField;
+  }
+  const size_t expectedFields = hasTargets ? numberColumns + 1 : numberColumns;
+
+  sgpp::base::DataMatrix data(0, dimension);
+  sgpp::base::DataVector targets(0);
+  size_t rows = 0;
+  std::vector<std::pair<const char*, const char*>> lines;
+  std::vector<char> accepted;
+
+  while (rows < howMany && dimension > 0) {
+    size_t next = collectLines(howMany - rows, lines);
+    if (lines.empty()) {
+      break;
+    }
+    const size_t numberLines = lines.size();
+    data.resizeRows(rows + numberLines);
+    targets.resize(rows + numberLines);
+    accepted.assign(numberLines, 0);
+    bool invalidLine = false;
+
+#pragma omp parallel for schedule(static) reduction(|| : invalidLine)
+    for (size_t i = 0; i < numberLines; i++) {
+      double* row = data.getPointer() + (rows + i) * dimension;
+      double target = 0.0;
+      const char* pos = lines[i].first;
+      const char* end = lines[i].second;
+      size_t field = 0;
+      while (true) {
+        double value = parseDouble(pos, end);
+        if (field <= numberColumns) {
+          int64_t destination = fieldDestination[field];
+          if (destination == targetField) {
+            target = value;
+          } else if (destination != ignored) {
+            row[destination] = value;
+          }
+        }
+        field++;
+        if (pos == end) {
+          break;
+        }
+        ++pos;
+      }
+      if (field != expectedFields) {
+        invalidLine = true;
+        continue;
+      }
+      for (const std::pair<size_t, size_t>& duplicate : duplicateColumns) {
+        row[duplicate.first] = row[duplicate.second];
+      }
+      targets[rows + i] = target;
+
+      bool isSelectedTarget = selectedTargets.empty();
+      for (size_t t = 0; t < selectedTargets.size() && !isSelectedTarget; t++) {
+        isSelectedTarget = std::fabs(target - selectedTargets[t]) < 0.001;
+      }
+      accepted[i] = isSelectedTarget;
+    }
+
+    if (invalidLine) {
+      throw file_exception("DatasetStreamReader: wrong number of columns in data line");
+    }
+    bufferPos = next;
+
+    // remove rows with unselected targets
+    size_t kept = rows;
+    for (size_t i = 0; i < numberLines; i++) {
+      if (!accepted[i]) {
+        continue;
+      }
+      if (kept != rows + i) {
+        std::copy(data.getPointer() + (rows + i) * dimension,
+                  data.getPointer() + (rows + i + 1) * dimension,
+                  data.getPointer() + kept * dimension);
+        targets[kept] = targets[rows + i];
+      }
+      kept++;
+    }
+    rows = kept;
+    data.resizeRows(rows);
+    targets.resize(rows);
+  }
+
+  samplesRead += rows;
+  return Dataset(std::move(data), std::move(targets));
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,190 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <istream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Single pass reader for comma separated numerical data (CSV files and the data section of ARFF
+ * files).
+ *
+ * The input is read in large chunks into a buffer. The complete lines of a chunk are located
+ * sequentially and then parsed in parallel (OpenMP) directly into the rows of the resulting
+ * #sgpp::base::DataMatrix, without tokenizing into intermediate strings. Numbers are converted
+ * with a fast path that is exact for up to 19 significant digits and decimal exponents up to 22
+ * (which covers virtually all data files) and falls back to strtod otherwise, so the result is
+ * identical to atof.
+ *
+ * Samples can be requested in batches, which allows streaming through files that do not fit into
+ * memory.
+ */
+class DatasetStreamReader {
+ public:
+  /**
+   * Supported input formats
+   */
+  enum class Format { CSV, ARFF };
+
+  /**
+   * Default size of the chunks read from the stream in bytes
+   */
+  static const size_t DEFAULT_CHUNK_SIZE = 1 << 22;
+
+  /**
+   * Reader for a stream owned by the caller, which has to outlive the reader.
+   *
+   * @param stream the raw data
+   * @param format CSV or ARFF. In ARFF mode lines starting with '%' or '@' are skipped.
+   * @param hasTargets whether the last column contains targets (supervised learning)
+   * @param skipFirstLine whether to skip the first line (e.g. column titles of a CSV file)
+   * @param instanceCutoff maximal number of instances to read in total, -1 for all
+   * @param selectedCols which columns are written to the DataMatrix as dimensions, see
+   *        CSVTools::readCSV. If empty, all columns except the target column are used.
+   * @param selectedTargets only rows with one of these targets are read (0.001 precision). If
+   *        empty all rows are read.
+   * @param chunkSize size of the chunks read from the stream in bytes
+   */
+  DatasetStreamReader(std::istream& stream, Format format, bool hasTargets,
+                      bool skipFirstLine = false, size_t instanceCutoff = -1,
+                      std::vector<size_t> selectedCols = std::vector<size_t>(),
+                      std::vector<double> selectedTargets = std::vector<double>(),
+                      size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+  /**
+   * Reader for a file, which is opened in binary mode and owned by the reader. Throws a
+   * file_exception if the file cannot be opened. See the constructor above for the parameters.
+   */
+  DatasetStreamReader(const std::string& fileName, Format format, bool hasTargets,
+                      bool skipFirstLine = false, size_t instanceCutoff = -1,
+                      std::vector<size_t> selectedCols = std::vector<size_t>(),
+                      std::vector<double> selectedTargets = std::vector<double>(),
+                      size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+  DatasetStreamReader(const DatasetStreamReader&) = delete;
+  DatasetStreamReader& operator=(const DatasetStreamReader&) = delete;
+
+  /**
+   * Returns the dimension of the samples, determined from the first data line (which is not
+   * consumed). Throws a file_exception if the column selection does not fit the data.
+   * @return dimension of the samples, 0 if the input does not contain any data
+   */
+  size_t getDimension();
+
+  /**
+   * Reads the next samples.
+   * @param howMany maximal number of samples to read, -1 for all remaining samples
+   * @return dataset containing at most howMany samples, less only if the input (or the instance
+   *         cutoff) is exhausted. Throws a file_exception if a line has the wrong number of
+   *         columns.
+   */
+  Dataset readSamples(size_t howMany = -1);
+
+  /**
+   * @return number of samples read since construction or the last rewind
+   */
+  size_t getNumberSamplesRead() const;
+
+  /**
+   * Restarts reading at the beginning of the stream, which has to be seekable.
+   */
+  void rewind();
+
+  /**
+   * Parses a floating point number in [pos, end), where the number is terminated by a comma or
+   * end. Leading and trailing blanks are skipped. The result equals the one of atof applied to
+   * the field, in particular unparsable fields (e.g. ARFF's missing value '?') yield 0.
+   * @param[in,out] pos start of the field, on return points to the terminating comma or end
+   * @param end end of the line
+   * @return the parsed number
+   */
+  static double parseDouble(const char*& pos, const char* end);
+
+ private:
+  /**
+   * Finds up to maxLines complete data lines in the buffer, refilling it from the stream if it
+   * does not contain any. Non-data lines in front of the first data line are consumed.
+   * @param maxLines maximal number of lines
+   * @param[out] lines begin and end of the lines found, valid until the next refill
+   * @return buffer position behind the last line found
+   */
+  size_t collectLines(size_t maxLines, std::vector<std::pair<const char*, const char*>>& lines);
+
+  /**
+   * Moves the unconsumed part of the buffer to its front and appends the next chunk of the stream
+   */
+  void refill();
+
+  /**
+   * Whether a line (without line break) contains data
+   */
+  bool isDataLine(const char* begin, const char* end) const;
+
+  /**
+   * Determines the number of columns from the first data line
+   */
+  void readHeader();
+
+  /**
+   * Stream owned by the reader (only if constructed from a file name)
+   */
+  std::unique_ptr<std::istream> ownedStream;
+  /**
+   * The stream to read from
+   */
+  std::istream* stream;
+  Format format;
+  bool hasTargets;
+  bool skipFirstLine;
+  size_t instanceCutoff;
+  std::vector<size_t> selectedCols;
+  std::vector<double> selectedTargets;
+
+  /**
+   * Read buffer, [bufferPos, bufferEnd) is the unconsumed input
+   */
+  std::vector<char> buffer;
+  size_t bufferPos = 0;
+  size_t bufferEnd = 0;
+  /**
+   * Whether the whole stream has been read into the buffer
+   */
+  bool streamExhausted = false;
+  /**
+   * Whether the next line has to be skipped (skipFirstLine)
+   */
+  bool skipNextLine;
+
+  /**
+   * Whether the number of columns has been determined
+   */
+  bool headerRead = false;
+  /**
+   * Number of columns of the file except the target column
+   */
+  size_t numberColumns = 0;
+  /**
+   * Dimension of the returned samples
+   */
+  size_t dimension = 0;
+  /**
+   * Number of samples returned since the last rewind
+   */
+  size_t samplesRead = 0;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -41,6 +41,7 @@ using sgpp::datadriven::RegularizationConfiguration;
 using sgpp::datadriven::RegularizationType;
 using sgpp::datadriven::ScorerConfiguration;
 using sgpp::datadriven::ScorerMetricType;
+using sgpp::solver::SLEPreconditionerType;
 using sgpp::solver::SLESolverConfiguration;
 using sgpp::solver::SLESolverType;
 
@@ -171,6 +172,7 @@ BOOST_AUTO_TEST_CASE(testFitterSolverRefineConfig) {
   defaults.eps_ = 10e-5;
   defaults.maxIterations_ = 42;
   defaults.threshold_ = 1;
+  defaults.preconditioner_ = SLEPreconditionerType::LevelScaling;
   SLESolverConfiguration config;
   bool hasConfig;
   double tolerance = 1E-5;
@@ -182,6 +184,8 @@ BOOST_AUTO_TEST_CASE(testFitterSolverRefineConfig) {
   BOOST_CHECK_CLOSE(config.eps_, 10e-15, tolerance);
   BOOST_CHECK_EQUAL(config.maxIterations_, 100);
   BOOST_CHECK_EQUAL(config.threshold_, 1);
+  BOOST_CHECK_EQUAL(static_cast<int>(config.preconditioner_),
+                    static_cast<int>(SLEPreconditionerType::LevelScaling));
 }
 
 BOOST_AUTO_TEST_CASE(testFitterSolverFinalConfig) {
@@ -203,6 +207,8 @@ BOOST_AUTO_TEST_CASE(testFitterSolverFinalConfig) {
   BOOST_CHECK_CLOSE(config.eps_, 10e-15, tolerance);
   BOOST_CHECK_EQUAL(config.maxIterations_, 100);
   BOOST_CHECK_EQUAL(config.threshold_, 1);
+  BOOST_CHECK_EQUAL(static_cast<int>(config.preconditioner_),
+                    static_cast<int>(SLEPreconditionerType::Jacobi));
 }
 
 BOOST_AUTO_TEST_CASE(testFitterRegularizationConfig) {
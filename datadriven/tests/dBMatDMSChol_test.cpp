@@ -0,0 +1,160 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef USE_GSL
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDMSChol.hpp>
+
+#include <cmath>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+
+namespace {
+
+// Random symmetric positive definite matrix
+DataMatrix createSPDMatrix(size_t n, std::mt19937& gen) {
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  DataMatrix B(n, n);
+  for (size_t i = 0; i < B.getSize(); i++) B[i] = dist(gen);
+  DataMatrix A(n, n, 0.0);
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      double sum = 0.0;
+      for (size_t l = 0; l < n; l++) sum += B.get(i, l) * B.get(j, l);
+      A.set(i, j, sum + (i == j ? static_cast<double>(n) : 0.0));
+    }
+  }
+  return A;
+}
+
+// Lower triangular cholesky factor
+DataMatrix cholesky(const DataMatrix& A) {
+  size_t n = A.getNrows();
+  DataMatrix L(n, n, 0.0);
+  for (size_t j = 0; j < n; j++) {
+    double d = A.get(j, j);
+    for (size_t l = 0; l < j; l++) d -= L.get(j, l) * L.get(j, l);
+    L.set(j, j, std::sqrt(d));
+    for (size_t i = j + 1; i < n; i++) {
+      double e = A.get(i, j);
+      for (size_t l = 0; l < j; l++) e -= L.get(i, l) * L.get(j, l);
+      L.set(i, j, e / L.get(j, j));
+    }
+  }
+  return L;
+}
+
+DataMatrix randomVectors(size_t n, size_t k, double scale, std::mt19937& gen) {
+  std::uniform_real_distribution<double> dist(-scale, scale);
+  DataMatrix V(n, k);
+  for (size_t i = 0; i < V.getSize(); i++) V[i] = dist(gen);
+  return V;
+}
+
+// A +- VV'
+DataMatrix addOuterProducts(const DataMatrix& A, const DataMatrix& V, double sign) {
+  DataMatrix result(A);
+  for (size_t i = 0; i < A.getNrows(); i++) {
+    for (size_t j = 0; j < A.getNcols(); j++) {
+      double sum = 0.0;
+      for (size_t l = 0; l < V.getNcols(); l++) sum += V.get(i, l) * V.get(j, l);
+      result.set(i, j, A.get(i, j) + sign * sum);
+    }
+  }
+  return result;
+}
+
+void checkFactorsClose(const DataMatrix& L, const DataMatrix& expected) {
+  BOOST_CHECK_EQUAL(L.getNrows(), expected.getNrows());
+  for (size_t i = 0; i < L.getSize(); i++) {
+    BOOST_CHECK_SMALL(L[i] - expected[i], 1e-10);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(dBMatDMSChol_test)
+
+BOOST_AUTO_TEST_CASE(testBlockUpdate) {
+  std::mt19937 gen(42);
+  sgpp::datadriven::DBMatDMSChol solver;
+  // rank below, equal to and above the panel size, matrix size not a multiple of it
+  for (size_t k : {3, 16, 40}) {
+    size_t n = 53;
+    DataMatrix A = createSPDMatrix(n, gen);
+    DataMatrix V = randomVectors(n, k, 1.0, gen);
+
+    DataMatrix L = cholesky(A);
+    solver.choleskyBlockUpdate(L, V);
+    checkFactorsClose(L, cholesky(addOuterProducts(A, V, 1.0)));
+
+    // same result as k rank one updates
+    DataMatrix LRankOne = cholesky(A);
+    DataVector column(n);
+    for (size_t l = 0; l < k; l++) {
+      V.getColumn(l, column);
+      solver.choleskyUpdate(LRankOne, column);
+    }
+    checkFactorsClose(L, LRankOne);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testBlockDowndate) {
+  std::mt19937 gen(7);
+  sgpp::datadriven::DBMatDMSChol solver;
+  for (size_t k : {1, 20}) {
+    size_t n = 37;
+    DataMatrix A = createSPDMatrix(n, gen);
+    DataMatrix V = randomVectors(n, k, 0.2, gen);
+
+    DataMatrix L = cholesky(A);
+    solver.choleskyBlockDowndate(L, V);
+    checkFactorsClose(L, cholesky(addOuterProducts(A, V, -1.0)));
+
+    // downdate reverts the update
+    solver.choleskyBlockUpdate(L, V);
+    checkFactorsClose(L, cholesky(A));
+  }
+
+  // downdating to an indefinite matrix fails
+  DataMatrix L = cholesky(createSPDMatrix(10, gen));
+  DataMatrix V = randomVectors(10, 2, 100.0, gen);
+  BOOST_CHECK_THROW(solver.choleskyBlockDowndate(L, V), sgpp::base::data_exception);
+}
+
+BOOST_AUTO_TEST_CASE(testBlockAddPoints) {
+  std::mt19937 gen(3);
+  sgpp::datadriven::DBMatDMSChol solver;
+  size_t size = 30;
+  size_t k = 12;
+  DataMatrix A = createSPDMatrix(size + k, gen);
+
+  // factor of the leading block, resized to the full size
+  DataMatrix A11(size, size);
+  for (size_t i = 0; i < size; i++) {
+    for (size_t j = 0; j < size; j++) A11.set(i, j, A.get(i, j));
+  }
+  DataMatrix L = cholesky(A11);
+  L.resizeQuadratic(size + k);
+
+  DataMatrix newColumns(size + k, k);
+  for (size_t i = 0; i < size + k; i++) {
+    for (size_t j = 0; j < k; j++) newColumns.set(i, j, A.get(i, size + j));
+  }
+  solver.choleskyBlockAddPoints(L, newColumns, size);
+  checkFactorsClose(L, cholesky(A));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif /* USE_GSL */
@@ -13,7 +13,11 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDatabase.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDecompositionFile.hpp>
+#include <sgpp/datadriven/algorithm/DBMatMatrixView.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineEigen.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
@@ -24,6 +28,9 @@
 #include <sgpp/datadriven/algorithm/GridFactory.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <string>
 #include <vector>
 
@@ -159,6 +166,64 @@ BOOST_AUTO_TEST_CASE(testReadWriteCholesky) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testMappedDecompositionIsShared) {
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = 2;
+  gridConfig.level_ = 3;
+  gridConfig.type_ = sgpp::base::GridType::Linear;
+
+  sgpp::base::AdaptivityConfiguration adaptivityConfig;
+
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+  regularizationConfig.lambda_ = 0.1;
+
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::Chol;
+
+  sgpp::datadriven::GridFactory gridFactory;
+  std::unique_ptr<sgpp::base::Grid> grid = std::unique_ptr<sgpp::base::Grid>{
+      gridFactory.createGrid(gridConfig, std::vector<std::vector<size_t>>())};
+
+  auto offline = std::unique_ptr<sgpp::datadriven::DBMatOffline>{
+      sgpp::datadriven::DBMatOfflineFactory::buildOfflineObject(
+          gridConfig, adaptivityConfig, regularizationConfig, densityEstimationConfig)};
+  offline->buildMatrix(grid.get(), regularizationConfig);
+  offline->decomposeMatrix(regularizationConfig, densityEstimationConfig);
+  const sgpp::base::DataMatrix& oldMatrix = offline->getDecomposedMatrix();
+
+  std::string filename = "test_mapped.dbmat";
+  offline->store(filename);
+  auto newOffline = std::unique_ptr<sgpp::datadriven::DBMatOffline>{
+      sgpp::datadriven::DBMatOfflineFactory::buildFromFile(filename)};
+
+  // clones read the same mapped pages instead of holding a copy
+  auto clonedOffline = std::unique_ptr<sgpp::datadriven::DBMatOffline>{newOffline->clone()};
+  sgpp::datadriven::DBMatMatrixView view = newOffline->getDecomposedMatrixView();
+  BOOST_CHECK_EQUAL(clonedOffline->getDecomposedMatrixView().getPointer(), view.getPointer());
+  BOOST_CHECK_EQUAL(view.getNrows(), oldMatrix.getNrows());
+  BOOST_CHECK_EQUAL(view.getNcols(), oldMatrix.getNcols());
+  BOOST_CHECK_EQUAL(newOffline->getGridSize(), oldMatrix.getNrows());
+
+  // overwriting the file does not invalidate the mapping
+  newOffline->store(filename);
+
+  for (size_t i = 0; i < view.getNrows(); i++) {
+    for (size_t j = 0; j < view.getNcols(); j++) {
+      BOOST_CHECK_EQUAL(view.get(i, j), oldMatrix.get(i, j));
+    }
+  }
+
+  // modifying a clone copies the decomposition without affecting the mapping
+  sgpp::base::DataMatrix& clonedMatrix = clonedOffline->getDecomposedMatrix();
+  BOOST_CHECK(clonedMatrix.getPointer() != view.getPointer());
+  clonedMatrix.set(0, 0, clonedMatrix.get(0, 0) + 1.0);
+  BOOST_CHECK_EQUAL(view.get(0, 0), oldMatrix.get(0, 0));
+  BOOST_CHECK_EQUAL(clonedOffline->getDecomposedMatrixView().get(0, 0), oldMatrix.get(0, 0) + 1.0);
+
+  std::remove(filename.c_str());
+}
+
 BOOST_AUTO_TEST_CASE(testReadWriteEigen) {
   sgpp::base::RegularGridConfiguration gridConfig;
   gridConfig.dim_ = 2;
@@ -253,6 +318,116 @@ BOOST_AUTO_TEST_CASE(testReadWriteLU) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testDecompositionFileLayout) {
+  sgpp::base::DataMatrix lhs(5, 4);
+  sgpp::base::DataMatrix extra(3, 3);
+  for (size_t i = 0; i < lhs.getSize(); i++) lhs[i] = 0.5 * static_cast<double>(i) - 1.0;
+  for (size_t i = 0; i < extra.getSize(); i++) extra[i] = static_cast<double>(i * i);
+  std::vector<size_t> indices{3, 0, 4, 1, 2};
+  std::vector<std::vector<size_t>> interactions{{0}, {1}, {0, 1}};
+
+  std::string filename = "test_layout.dbmat";
+  sgpp::datadriven::DBMatDecompositionFile::write(
+      filename, sgpp::datadriven::MatrixDecompositionType::LU, interactions,
+      {{lhs.getPointer(), lhs.getNrows(), lhs.getNcols(), sizeof(double)},
+       {indices.data(), indices.size(), 1, sizeof(size_t)},
+       {extra.getPointer(), extra.getNrows(), extra.getNcols(), sizeof(double)}});
+  BOOST_CHECK(sgpp::datadriven::DBMatDecompositionFile::isDecompositionFile(filename));
+
+  {
+    sgpp::datadriven::DBMatDecompositionFile file(filename);
+    BOOST_CHECK(file.getDecompositionType() == sgpp::datadriven::MatrixDecompositionType::LU);
+    BOOST_CHECK(file.getInteractions() == interactions);
+    BOOST_CHECK_EQUAL(file.getNumberOfSections(), 3);
+    BOOST_CHECK_EQUAL(file.getRows(0), 5);
+    BOOST_CHECK_EQUAL(file.getCols(0), 4);
+
+    // sections can be used in place
+    for (size_t s : {size_t{0}, size_t{2}}) {
+      BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(file.getMatrixData(s)) %
+                            sgpp::datadriven::DBMatDecompositionFile::ALIGNMENT,
+                        0);
+    }
+    sgpp::base::DataMatrix newLhs;
+    sgpp::base::DataMatrix newExtra;
+    file.copyMatrix(0, newLhs);
+    file.copyMatrix(2, newExtra);
+    std::vector<size_t> newIndices(indices.size());
+    file.copyIndices(1, newIndices.data());
+    BOOST_CHECK_EQUAL(newLhs.getNrows(), 5);
+    BOOST_CHECK_EQUAL(newExtra.getNcols(), 3);
+    for (size_t i = 0; i < lhs.getSize(); i++) BOOST_CHECK_EQUAL(newLhs[i], lhs[i]);
+    for (size_t i = 0; i < extra.getSize(); i++) BOOST_CHECK_EQUAL(newExtra[i], extra[i]);
+    BOOST_CHECK(newIndices == indices);
+    BOOST_CHECK_THROW(file.getRows(3), sgpp::base::data_exception);
+  }
+  std::remove(filename.c_str());
+
+  // files in the legacy text header format are not mistaken for the binary format
+  std::ofstream legacy(filename);
+  legacy << "5,4,0,0\n";
+  legacy.close();
+  BOOST_CHECK(!sgpp::datadriven::DBMatDecompositionFile::isDecompositionFile(filename));
+  BOOST_CHECK_THROW(sgpp::datadriven::DBMatDecompositionFile file(filename),
+                    sgpp::base::data_exception);
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testDatabaseLookup) {
+  std::string filename = "test_database.json";
+  std::ofstream databaseFile(filename);
+  databaseFile << "{\"database\": []}";
+  databaseFile.close();
+
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = 2;
+  gridConfig.level_ = 3;
+  gridConfig.type_ = sgpp::base::GridType::Linear;
+  sgpp::base::AdaptivityConfiguration adaptivityConfig;
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  regularizationConfig.lambda_ = 0.1 / 3.0;
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::Chol;
+
+  std::string hash = sgpp::datadriven::DBMatDatabase::configurationHash(
+      gridConfig, regularizationConfig, densityEstimationConfig);
+  BOOST_CHECK_EQUAL(hash.size(), 16);
+  {
+    sgpp::datadriven::DBMatDatabase database(filename);
+    BOOST_CHECK(!database.hasDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+                                        densityEstimationConfig));
+    database.putDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+                           densityEstimationConfig, hash + ".dbmat");
+  }
+
+  // a fresh database finds the entry through its index
+  sgpp::datadriven::DBMatDatabase database(filename);
+  BOOST_CHECK(database.hasDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+                                     densityEstimationConfig));
+  BOOST_CHECK_EQUAL(database.getDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+                                           densityEstimationConfig),
+                    hash + ".dbmat");
+
+  // all parts of the configuration are part of the key
+  regularizationConfig.lambda_ = 0.1 / 3.0 + 1e-15;
+  BOOST_CHECK(!database.hasDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+                                      densityEstimationConfig));
+  BOOST_CHECK_NE(hash, sgpp::datadriven::DBMatDatabase::configurationHash(
+                           gridConfig, regularizationConfig, densityEstimationConfig));
+  regularizationConfig.lambda_ = 0.1 / 3.0;
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::LU;
+  BOOST_CHECK(!database.hasDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+                                      densityEstimationConfig));
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::Chol;
+  gridConfig.level_ = 4;
+  BOOST_CHECK(!database.hasDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+                                      densityEstimationConfig));
+  BOOST_CHECK_THROW(database.getDataMatrix(gridConfig, adaptivityConfig, regularizationConfig,
+                                           densityEstimationConfig),
+                    sgpp::base::data_exception);
+  std::remove(filename.c_str());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif /* USE_GSL */
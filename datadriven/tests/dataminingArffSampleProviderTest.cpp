@@ -14,13 +14,24 @@
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/datadriven/configuration/CrossvalidationConfiguration.hpp>
+#include <sgpp/datadriven/datamining/builder/DataSourceBuilder.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceSplitting.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
 #include <string>
 
 using sgpp::datadriven::ArffFileSampleProvider;
+using sgpp::datadriven::CrossvalidationConfiguration;
+using sgpp::datadriven::DataSourceBuilder;
+using sgpp::datadriven::DataSourceConfig;
+using sgpp::datadriven::DataSourceShufflingType;
+using sgpp::datadriven::DataSourceSplitting;
 using sgpp::base::DataVector;
 using sgpp::base::DataMatrix;
 using sgpp::datadriven::Dataset;
@@ -135,4 +146,67 @@ BOOST_AUTO_TEST_CASE(arffTestGetNextSamples) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(arffTestStreamFile) {
+  auto sampleProvider = ArffFileSampleProvider();
+  sampleProvider.streamFile(datasetPath, true);
+  BOOST_CHECK_EQUAL(datasetDim, sampleProvider.getDim());
+  BOOST_CHECK_THROW(sampleProvider.getNumSamples(), sgpp::base::data_exception);
+
+  // read in batches of 4, the last one is incomplete
+  for (size_t epoch = 0; epoch < 2; epoch++) {
+    size_t offset = 0;
+    for (size_t expectedSize : {4, 4, 2, 0}) {
+      auto dataset = std::unique_ptr<Dataset>(sampleProvider.getNextSamples(4));
+      BOOST_CHECK_EQUAL(expectedSize, dataset->getNumberInstances());
+      BOOST_CHECK_EQUAL(expectedSize, dataset->getTargets().getSize());
+      for (size_t rowIdx = 0; rowIdx < dataset->getNumberInstances(); rowIdx++) {
+        for (size_t colIdx = 0; colIdx < datasetDim; colIdx++) {
+          BOOST_CHECK_CLOSE(dataset->getData().get(rowIdx, colIdx),
+                            testPoints[offset + rowIdx][colIdx], tolerance);
+        }
+        BOOST_CHECK_CLOSE(dataset->getTargets().get(rowIdx), testValues[offset + rowIdx],
+                          tolerance);
+      }
+      offset += dataset->getNumberInstances();
+    }
+    sampleProvider.reset();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(arffTestStreamingDataSource) {
+  DataSourceConfig config;
+  config.filePath = datasetPath;
+  config.readinStreaming = true;
+  config.batchSize = 4;
+  config.numBatches = 3;
+
+  // the number of samples is unknown while streaming, so no validation data can be split off
+  DataSourceBuilder builder;
+  config.validationPortion = 0.3;
+  BOOST_CHECK_THROW(builder.splittingFromConfig(config), sgpp::base::data_exception);
+  BOOST_CHECK_THROW(builder.crossValidationFromConfig(config, CrossvalidationConfiguration{}),
+                    sgpp::base::data_exception);
+  config.validationPortion = 0.0;
+  config.shuffling = DataSourceShufflingType::random;
+  BOOST_CHECK_THROW(builder.splittingFromConfig(config), sgpp::base::data_exception);
+  BOOST_CHECK_THROW(builder.crossValidationFromConfig(config, CrossvalidationConfiguration{}),
+                    sgpp::base::data_exception);
+
+  config.shuffling = DataSourceShufflingType::sequential;
+  auto dataSource = std::unique_ptr<DataSourceSplitting>(builder.splittingFromConfig(config));
+  dataSource->reset();
+  BOOST_CHECK_EQUAL(0, dataSource->getValidationData()->getNumberInstances());
+  size_t offset = 0;
+  for (size_t expectedSize : {4, 4, 2}) {
+    auto dataset = std::unique_ptr<Dataset>(dataSource->getNextSamples());
+    BOOST_CHECK_EQUAL(expectedSize, dataset->getNumberInstances());
+    for (size_t rowIdx = 0; rowIdx < dataset->getNumberInstances(); rowIdx++) {
+      BOOST_CHECK_CLOSE(dataset->getTargets().get(rowIdx), testValues[offset + rowIdx],
+                        tolerance);
+    }
+    offset += dataset->getNumberInstances();
+  }
+  BOOST_CHECK_EQUAL(datasetSize, offset);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,139 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/ColumnarFileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/datadriven/tools/ColumnarDatasetFile.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+using sgpp::datadriven::ColumnarDatasetFile;
+using sgpp::datadriven::ColumnarFileSampleProvider;
+using sgpp::datadriven::Dataset;
+
+BOOST_AUTO_TEST_SUITE(dataminingColumnarSampleProviderTest)
+
+const std::string arffPath = "datadriven/datasets/liver/liver-disorders_normalized_small.arff";
+
+BOOST_AUTO_TEST_CASE(testConvertAndRead) {
+  // small chunks so that the samples span several chunks
+  const std::string columnarPath = "dataminingColumnarSampleProviderTest.columnar";
+  const size_t chunkRows = 3;
+  ColumnarDatasetFile::convert(arffPath, columnarPath, true, chunkRows);
+  Dataset reference = sgpp::datadriven::ARFFTools::readARFFFromFile(arffPath);
+  const size_t numberSamples = reference.getNumberInstances();
+  const size_t dim = reference.getDimension();
+
+  {
+    ColumnarDatasetFile file(columnarPath);
+    BOOST_CHECK(ColumnarDatasetFile::isColumnarDatasetFile(columnarPath));
+    BOOST_CHECK(!ColumnarDatasetFile::isColumnarDatasetFile(arffPath));
+    BOOST_CHECK_EQUAL(file.getNumberRows(), numberSamples);
+    BOOST_CHECK_EQUAL(file.getDimension(), dim);
+    BOOST_CHECK_EQUAL(file.getNumberChunks(), (numberSamples + chunkRows - 1) / chunkRows);
+    BOOST_CHECK(file.hasTargets());
+    for (size_t chunk = 0; chunk < file.getNumberChunks(); chunk++) {
+      const double* targets = file.getTargets(chunk);
+      for (size_t j = 0; j < dim; j++) {
+        const double* column = file.getColumn(chunk, j);
+        double min = *std::min_element(column, column + file.getRowsInChunk(chunk));
+        double max = *std::max_element(column, column + file.getRowsInChunk(chunk));
+        BOOST_CHECK_EQUAL(file.getChunkMin(chunk, j), min);
+        BOOST_CHECK_EQUAL(file.getChunkMax(chunk, j), max);
+        for (size_t i = 0; i < file.getRowsInChunk(chunk); i++) {
+          BOOST_CHECK_EQUAL(column[i], reference.getData().get(chunk * chunkRows + i, j));
+        }
+      }
+      for (size_t i = 0; i < file.getRowsInChunk(chunk); i++) {
+        BOOST_CHECK_EQUAL(targets[i], reference.getTargets().get(chunk * chunkRows + i));
+      }
+    }
+
+    // unsorted rows from several chunks, with repetitions
+    std::vector<size_t> rows = {7, 1, numberSamples - 1, 8, 1, 0, 6};
+    std::vector<size_t> columns = {dim - 1, 0};
+    sgpp::base::DataMatrix gathered;
+    sgpp::base::DataVector gatheredTargets;
+    file.gatherRows(rows, columns, gathered, gatheredTargets);
+    BOOST_CHECK_EQUAL(gathered.getNrows(), rows.size());
+    BOOST_CHECK_EQUAL(gathered.getNcols(), columns.size());
+    for (size_t i = 0; i < rows.size(); i++) {
+      for (size_t k = 0; k < columns.size(); k++) {
+        BOOST_CHECK_EQUAL(gathered.get(i, k), reference.getData().get(rows[i], columns[k]));
+      }
+      BOOST_CHECK_EQUAL(gatheredTargets[i], reference.getTargets().get(rows[i]));
+    }
+  }
+
+  // batches through the sample provider
+  ColumnarFileSampleProvider sampleProvider;
+  sampleProvider.readFile(columnarPath, true);
+  BOOST_CHECK_EQUAL(sampleProvider.getNumSamples(), numberSamples);
+  BOOST_CHECK_EQUAL(sampleProvider.getDim(), dim);
+  size_t offset = 0;
+  for (size_t batchSize : {4, 4, 4}) {
+    auto batch = std::unique_ptr<Dataset>(sampleProvider.getNextSamples(batchSize));
+    BOOST_CHECK_EQUAL(batch->getNumberInstances(), std::min(batchSize, numberSamples - offset));
+    for (size_t i = 0; i < batch->getNumberInstances(); i++) {
+      for (size_t j = 0; j < dim; j++) {
+        BOOST_CHECK_EQUAL(batch->getData().get(i, j), reference.getData().get(offset + i, j));
+      }
+      BOOST_CHECK_EQUAL(batch->getTargets().get(i), reference.getTargets().get(offset + i));
+    }
+    offset += batch->getNumberInstances();
+  }
+  BOOST_CHECK_EQUAL(offset, numberSamples);
+
+  // column and class selection
+  sampleProvider.readFile(columnarPath, true, -1, {2, 0}, {1.0});
+  auto selected = std::unique_ptr<Dataset>(sampleProvider.getAllSamples());
+  BOOST_CHECK_EQUAL(selected->getDimension(), 2);
+  size_t row = 0;
+  for (size_t i = 0; i < numberSamples; i++) {
+    if (reference.getTargets().get(i) != 1.0) {
+      continue;
+    }
+    BOOST_CHECK_EQUAL(selected->getData().get(row, 0), reference.getData().get(i, 2));
+    BOOST_CHECK_EQUAL(selected->getData().get(row, 1), reference.getData().get(i, 0));
+    BOOST_CHECK_EQUAL(selected->getTargets().get(row), 1.0);
+    row++;
+  }
+  BOOST_CHECK_EQUAL(selected->getNumberInstances(), row);
+
+  std::remove(columnarPath.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testTargetsMismatch) {
+  const std::string withTargetsPath = "dataminingColumnarSampleProviderTestTargets.columnar";
+  const std::string withoutTargetsPath = "dataminingColumnarSampleProviderTestNoTargets.columnar";
+  ColumnarDatasetFile::convert(arffPath, withTargetsPath, true);
+  ColumnarDatasetFile::convert(arffPath, withoutTargetsPath, false);
+
+  ColumnarFileSampleProvider sampleProvider;
+  BOOST_CHECK_THROW(sampleProvider.readFile(withTargetsPath, false),
+                    sgpp::base::file_exception);
+  BOOST_CHECK_THROW(sampleProvider.readFile(withoutTargetsPath, true),
+                    sgpp::base::file_exception);
+  BOOST_CHECK_NO_THROW(sampleProvider.readFile(withoutTargetsPath, false));
+  BOOST_CHECK_EQUAL(sampleProvider.getDim(),
+                    sgpp::datadriven::ARFFTools::readARFFFromFile(arffPath).getDimension() + 1);
+
+  std::remove(withTargetsPath.c_str());
+  std::remove(withoutTargetsPath.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
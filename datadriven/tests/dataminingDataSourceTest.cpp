@@ -117,5 +117,44 @@ BOOST_AUTO_TEST_CASE(dataSourceGetAllIteratorTest) {
   delete dataSource;
 }
 
+BOOST_AUTO_TEST_CASE(dataSourcePrefetchingTest) {
+  DataSourceConfig config;
+  config.filePath = "datadriven/datasets/liver/liver-disorders_normalized_small.arff";
+  config.batchSize = 3;
+  config.prefetchDepth = 2;
+
+  DataSourceSplitting dataSource(config, new ArffFileSampleProvider());
+  config.prefetchDepth = 0;
+  DataSourceSplitting reference(config, new ArffFileSampleProvider());
+
+  // two epochs to check that prefetching restarts after a reset
+  for (size_t epoch = 0; epoch < 2; epoch++) {
+    dataSource.reset();
+    reference.reset();
+    BOOST_CHECK_EQUAL(reference.getValidationData()->getNumberInstances(),
+                      dataSource.getValidationData()->getNumberInstances());
+    size_t numSamples = 0;
+    while (true) {
+      std::unique_ptr<Dataset> dataset(dataSource.getNextSamples());
+      std::unique_ptr<Dataset> expected(reference.getNextSamples());
+      BOOST_CHECK_EQUAL(expected->getNumberInstances(), dataset->getNumberInstances());
+      if (dataset->getNumberInstances() == 0) {
+        break;
+      }
+      for (size_t i = 0; i < dataset->getNumberInstances(); i++) {
+        for (size_t j = 0; j < dataset->getDimension(); j++) {
+          BOOST_CHECK_EQUAL(expected->getData().get(i, j), dataset->getData().get(i, j));
+        }
+        BOOST_CHECK_EQUAL(expected->getTargets()[i], dataset->getTargets()[i]);
+      }
+      numSamples += dataset->getNumberInstances();
+    }
+    BOOST_CHECK_EQUAL(7, numSamples);
+  }
+  // requesting beyond the end keeps returning empty batches
+  std::unique_ptr<Dataset> dataset(dataSource.getNextSamples());
+  BOOST_CHECK_EQUAL(0, dataset->getNumberInstances());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 #endif
@@ -0,0 +1,147 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/datadriven/algorithm/DMSystemMatrix.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationLeastSquares.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/ModelFittingLeastSquares.hpp>
+#include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/globaldef.hpp>
+#include <sgpp/solver/SLESolver.hpp>
+#include <sgpp/solver/TypesSolver.hpp>
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
+#include <sgpp/solver/sle/preconditioner/Preconditioner.hpp>
+
+#include <memory>
+#include <string>
+
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::OperationMatrix;
+using sgpp::datadriven::Dataset;
+using sgpp::datadriven::DMSystemMatrix;
+using sgpp::datadriven::FitterConfigurationLeastSquares;
+using sgpp::datadriven::ModelFittingLeastSquares;
+using sgpp::solver::PreconditionedConjugateGradients;
+using sgpp::solver::Preconditioner;
+using sgpp::solver::SLEPreconditionerType;
+using sgpp::solver::SLESolver;
+using sgpp::solver::SLESolverConfiguration;
+using sgpp::solver::SLESolverType;
+
+namespace {
+
+const std::string datasetPath = "datadriven/datasets/liver/liver-disorders_normalized.arff";
+
+/**
+ * Exposes the solver and preconditioner factories and the number of solver iterations.
+ */
+class ModelFittingLeastSquaresTest : public ModelFittingLeastSquares {
+ public:
+  explicit ModelFittingLeastSquaresTest(const FitterConfigurationLeastSquares& config)
+      : ModelFittingLeastSquares(config) {}
+
+  using ModelFittingLeastSquares::buildPreconditioner;
+  using ModelFittingLeastSquares::buildSolver;
+
+  size_t getNumberIterations() const { return solver->getNumberIterations(); }
+};
+
+FitterConfigurationLeastSquares createConfig(SLESolverType solverType,
+                                             SLEPreconditionerType preconditioner) {
+  FitterConfigurationLeastSquares config;
+  config.setupDefaults();
+  config.getGridConfig().type_ = sgpp::base::GridType::Linear;
+  config.getGridConfig().level_ = 3;
+  config.getRegularizationConfig().lambda_ = 1e-4;
+  config.getSolverFinalConfig().type_ = solverType;
+  config.getSolverFinalConfig().eps_ = 1e-10;
+  config.getSolverFinalConfig().maxIterations_ = 1000;
+  config.getSolverFinalConfig().preconditioner_ = preconditioner;
+  return config;
+}
+
+double relativeDifference(const DataVector& x, const DataVector& reference) {
+  DataVector difference(x);
+  difference.sub(reference);
+  return difference.l2Norm() / reference.l2Norm();
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(dataminingLeastSquaresPreconditionerTest)
+
+BOOST_AUTO_TEST_CASE(testJacobiReducesIterations) {
+  // regression on the liver disorders data with the level-dependent diagonal regularization,
+  // whose entries vary over orders of magnitude
+  Dataset dataset = sgpp::datadriven::ARFFTools::readARFFFromFile(datasetPath);
+  std::unique_ptr<Grid> grid{Grid::createLinearGrid(dataset.getDimension())};
+  grid->getGenerator().regular(4);
+  std::shared_ptr<OperationMatrix> C{sgpp::op_factory::createOperationDiagonal(*grid, 0.25)};
+  DMSystemMatrix systemMatrix(*grid, dataset.getData(), C, 1e-2);
+  DataVector b(grid->getSize());
+  systemMatrix.generateb(dataset.getTargets(), b);
+
+  ModelFittingLeastSquaresTest fitter{
+      createConfig(SLESolverType::CG, SLEPreconditionerType::None)};
+  SLESolverConfiguration solverConfig =
+      createConfig(SLESolverType::CG, SLEPreconditionerType::None).getSolverFinalConfig();
+
+  std::unique_ptr<SLESolver> plainSolver{fitter.buildSolver(solverConfig)};
+  DataVector alphaPlain(grid->getSize(), 0.0);
+  plainSolver->solve(systemMatrix, alphaPlain, b, false, false, -1.0);
+
+  for (SLESolverType solverType : {SLESolverType::CG, SLESolverType::PipelinedCG}) {
+    solverConfig.type_ = solverType;
+    solverConfig.preconditioner_ = SLEPreconditionerType::Jacobi;
+    std::unique_ptr<SLESolver> preconditionedSolver{fitter.buildSolver(solverConfig)};
+    std::unique_ptr<Preconditioner> preconditioner{
+        fitter.buildPreconditioner(solverConfig, systemMatrix, *grid)};
+    BOOST_REQUIRE(preconditioner != nullptr);
+    dynamic_cast<PreconditionedConjugateGradients&>(*preconditionedSolver)
+        .setPreconditioner(preconditioner.get());
+
+    DataVector alpha(grid->getSize(), 0.0);
+    preconditionedSolver->solve(systemMatrix, alpha, b, false, false, -1.0);
+
+    BOOST_CHECK_LT(2 * preconditionedSolver->getNumberIterations(),
+                   plainSolver->getNumberIterations());
+    BOOST_CHECK_SMALL(relativeDifference(alpha, alphaPlain), 1e-6);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testPreconditionedFit) {
+  Dataset dataset = sgpp::datadriven::ARFFTools::readARFFFromFile(datasetPath);
+
+  ModelFittingLeastSquaresTest plain{
+      createConfig(SLESolverType::CG, SLEPreconditionerType::None)};
+  plain.fit(dataset);
+
+  for (SLEPreconditionerType preconditionerType :
+       {SLEPreconditionerType::Jacobi, SLEPreconditionerType::LevelScaling}) {
+    ModelFittingLeastSquaresTest preconditioned{
+        createConfig(SLESolverType::CG, preconditionerType)};
+    preconditioned.fit(dataset);
+
+    BOOST_REQUIRE_EQUAL(preconditioned.getSurpluses().getSize(), plain.getSurpluses().getSize());
+    BOOST_CHECK_SMALL(relativeDifference(preconditioned.getSurpluses(), plain.getSurpluses()),
+                      1e-6);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testUnsupportedSolver) {
+  BOOST_CHECK_THROW(ModelFittingLeastSquares(
+                        createConfig(SLESolverType::BiCGSTAB, SLEPreconditionerType::Jacobi)),
+                    sgpp::base::factory_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
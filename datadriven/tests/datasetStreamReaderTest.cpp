@@ -0,0 +1,123 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/datadriven/tools/DatasetStreamReader.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using sgpp::datadriven::Dataset;
+using sgpp::datadriven::DatasetStreamReader;
+
+BOOST_AUTO_TEST_SUITE(datasetStreamReaderTest)
+
+BOOST_AUTO_TEST_CASE(testParseDouble) {
+  std::vector<std::string> fields = {"0",       "-0",        "1",          "+2.5",
+                                     "  3.25 ", "1e5",       "1.5E-3",     "0.000123",
+                                     ".5",      "5.",        "-7.125e+02", "123456789012345678",
+                                     "1e-300",  "1.7e308",   "1e400",      "nan",
+                                     "inf",     "?",         "",           "0x10",
+                                     "12abc",   "1e",        "9007199254740993",
+                                     "0.1234567890123456789012345"};
+  std::mt19937 gen(17);
+  std::uniform_real_distribution<double> dist(-1e3, 1e3);
+  for (size_t i = 0; i < 1000; i++) {
+    char field[32];
+    snprintf(field, sizeof(field), i % 2 == 0 ? "%.6f" : "%.17g", dist(gen));
+    fields.push_back(field);
+  }
+
+  for (const std::string& field : fields) {
+    std::string line = field + ",1";
+    const char* pos = line.data();
+    double value = DatasetStreamReader::parseDouble(pos, line.data() + line.size());
+    double expected = std::atof(field.c_str());
+    if (expected != expected) {
+      BOOST_CHECK(value != value);
+    } else {
+      BOOST_CHECK_EQUAL(value, expected);
+    }
+    BOOST_CHECK_EQUAL(*pos, ',');
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testReadCSV) {
+  std::string content = "x0,x1,x2,class\n1,2,3,0\r\n4,5,6,1\n\n7,8,9,0\n10,11,12,1";
+  std::istringstream stream(content);
+  Dataset dataset = sgpp::datadriven::CSVTools::readCSV(stream, true, true);
+  BOOST_CHECK_EQUAL(dataset.getNumberInstances(), 4);
+  BOOST_CHECK_EQUAL(dataset.getDimension(), 3);
+  for (size_t i = 0; i < 4; i++) {
+    for (size_t j = 0; j < 3; j++) {
+      BOOST_CHECK_EQUAL(dataset.getData().get(i, j), static_cast<double>(3 * i + j + 1));
+    }
+    BOOST_CHECK_EQUAL(dataset.getTargets().get(i), static_cast<double>(i % 2));
+  }
+
+  // column selection, target filter and cutoff
+  stream.clear();
+  stream.str(content);
+  dataset = sgpp::datadriven::CSVTools::readCSV(stream, true, true, 1, {2, 0, 2}, {1.0});
+  BOOST_CHECK_EQUAL(dataset.getNumberInstances(), 1);
+  BOOST_CHECK_EQUAL(dataset.getDimension(), 3);
+  BOOST_CHECK_EQUAL(dataset.getData().get(0, 0), 6.0);
+  BOOST_CHECK_EQUAL(dataset.getData().get(0, 1), 4.0);
+  BOOST_CHECK_EQUAL(dataset.getData().get(0, 2), 6.0);
+  BOOST_CHECK_EQUAL(dataset.getTargets().get(0), 1.0);
+
+  // invalid column selection and missing columns
+  stream.clear();
+  stream.str(content);
+  BOOST_CHECK_THROW(sgpp::datadriven::CSVTools::readCSV(stream, true, true, -1, {3}),
+                    sgpp::base::file_exception);
+  std::istringstream invalid("1,2,3\n4,5\n");
+  BOOST_CHECK_THROW(sgpp::datadriven::CSVTools::readCSV(invalid, false, true),
+                    sgpp::base::file_exception);
+}
+
+BOOST_AUTO_TEST_CASE(testStreamingBatches) {
+  // tiny chunks, so lines cross chunk boundaries and the buffer has to grow for long lines
+  std::ostringstream content;
+  content << "% comment\n@relation test\n@data\n";
+  const size_t numberLines = 1000;
+  for (size_t i = 0; i < numberLines; i++) {
+    content << i << "," << 0.5 * static_cast<double>(i) << ",";
+    for (size_t j = 0; j < i % 7; j++) content << "0";
+    content << (i % 3) << "\n";
+  }
+  std::istringstream stream(content.str());
+  DatasetStreamReader reader(stream, DatasetStreamReader::Format::ARFF, true, false, -1, {}, {},
+                             16);
+  BOOST_CHECK_EQUAL(reader.getDimension(), 2);
+
+  for (size_t epoch = 0; epoch < 2; epoch++) {
+    size_t row = 0;
+    for (size_t batchSize : {1, 17, 300, 1000}) {
+      Dataset batch = reader.readSamples(batchSize);
+      BOOST_CHECK_EQUAL(batch.getNumberInstances(),
+                        std::min(batchSize, numberLines - row));
+      for (size_t i = 0; i < batch.getNumberInstances(); i++, row++) {
+        BOOST_CHECK_EQUAL(batch.getData().get(i, 0), static_cast<double>(row));
+        BOOST_CHECK_EQUAL(batch.getData().get(i, 1), 0.5 * static_cast<double>(row));
+        BOOST_CHECK_EQUAL(batch.getTargets().get(i), static_cast<double>(row % 3));
+      }
+    }
+    BOOST_CHECK_EQUAL(row, numberLines);
+    BOOST_CHECK_EQUAL(reader.getNumberSamplesRead(), numberLines);
+    BOOST_CHECK_EQUAL(reader.readSamples(10).getNumberInstances(), 0);
+    reader.rewind();
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,200 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "sgpp/base/datatypes/DataMatrix.hpp"
+#include "sgpp/base/datatypes/DataVector.hpp"
+#include "sgpp/base/grid/Grid.hpp"
+#include "sgpp/base/operation/BaseOpFactory.hpp"
+#include "sgpp/base/operation/hash/OperationMultipleEval.hpp"
+#include "sgpp/base/tools/OperationConfiguration.hpp"
+#include "sgpp/base/tools/json/JSON.hpp"
+#include "sgpp/datadriven/DatadrivenOpFactory.hpp"
+#include "sgpp/datadriven/application/MultipleEvalAutoTuner.hpp"
+#include "sgpp/globaldef.hpp"
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::OperationMultipleEval;
+using sgpp::datadriven::MultipleEvalAutoTuner;
+using sgpp::datadriven::OperationMultipleEvalConfiguration;
+using sgpp::datadriven::OperationMultipleEvalSubType;
+using sgpp::datadriven::OperationMultipleEvalType;
+
+namespace {
+
+const char* tuningFileName = "multipleEvalAutoTunerTest.json";
+
+DataMatrix createDataset(size_t numberOfPoints, size_t dim) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  DataMatrix dataset(numberOfPoints, dim);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      dataset.set(i, d, distribution(generator));
+    }
+  }
+
+  return dataset;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestMultipleEvalAutoTuner)
+
+BOOST_AUTO_TEST_CASE(TuneAndReuse) {
+  std::remove(tuningFileName);
+
+  const size_t dim = 3;
+  std::unique_ptr<Grid> grid(Grid::createModLinearGrid(dim));
+  grid->getGenerator().regular(4);
+  DataMatrix dataset = createDataset(300, dim);
+
+  DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = static_cast<double>(i % 7) - 3.0;
+  }
+
+  DataVector expected(dataset.getNrows());
+  std::unique_ptr<OperationMultipleEval> reference(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+  reference->mult(alpha, expected);
+
+  std::string key;
+  {
+    MultipleEvalAutoTuner tuner(tuningFileName);
+    key = tuner.getTuningKey(*grid, dataset);
+    BOOST_CHECK(!tuner.isTuned(*grid, dataset));
+
+    std::unique_ptr<OperationMultipleEval> op(tuner.createOperationMultipleEval(*grid, dataset));
+    BOOST_CHECK(tuner.isTuned(*grid, dataset));
+
+    DataVector result(dataset.getNrows());
+    op->mult(alpha, result);
+
+    for (size_t i = 0; i < result.getSize(); i++) {
+      BOOST_CHECK_SMALL(result[i] - expected[i], 1E-10);
+    }
+  }
+
+  // the default candidates for modified linear grids are the default and the streaming kernel
+  json::JSON database(tuningFileName);
+  BOOST_CHECK(database.contains(key));
+  BOOST_CHECK_EQUAL(database[key]["durations"].size(), 2);
+  std::string winner = database[key]["name"].get();
+
+  // a new tuner reuses the stored winner, also for slightly larger problems
+  MultipleEvalAutoTuner tuner(tuningFileName);
+  BOOST_CHECK(tuner.isTuned(*grid, dataset));
+  DataMatrix largerDataset = createDataset(310, dim);
+  BOOST_CHECK_EQUAL(tuner.getTuningKey(*grid, largerDataset), key);
+  BOOST_CHECK_EQUAL(tuner.getConfiguration(*grid, largerDataset).getName(), winner);
+
+  std::remove(tuningFileName);
+}
+
+BOOST_AUTO_TEST_CASE(UnknownWinnerIsRetuned) {
+  std::remove(tuningFileName);
+
+  const size_t dim = 2;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(3);
+  DataMatrix dataset = createDataset(100, dim);
+
+  {
+    MultipleEvalAutoTuner tuner(tuningFileName);
+    tuner.addCandidate(OperationMultipleEvalConfiguration(
+        OperationMultipleEvalType::DEFAULT, OperationMultipleEvalSubType::DEFAULT,
+        sgpp::datadriven::OperationMultipleEvalMPIType::NONE, "reference"));
+    BOOST_CHECK_EQUAL(tuner.getConfiguration(*grid, dataset).getName(), "reference");
+  }
+
+  // the stored winner is not a candidate of this tuner, therefore it has to tune again
+  MultipleEvalAutoTuner tuner(tuningFileName);
+  tuner.addCandidate(OperationMultipleEvalConfiguration(
+      OperationMultipleEvalType::STREAMING, OperationMultipleEvalSubType::DEFAULT,
+      sgpp::datadriven::OperationMultipleEvalMPIType::NONE, "streaming"));
+  BOOST_CHECK_EQUAL(tuner.getConfiguration(*grid, dataset).getName(), "streaming");
+
+  json::JSON database(tuningFileName);
+  BOOST_CHECK_EQUAL(database[tuner.getTuningKey(*grid, dataset)]["name"].get(), "streaming");
+
+  std::remove(tuningFileName);
+}
+
+BOOST_AUTO_TEST_CASE(TuneGridBlockSizeInFactory) {
+  std::remove(tuningFileName);
+
+  const size_t dim = 2;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+  DataMatrix dataset = createDataset(200, dim);
+
+  DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = static_cast<double>(i % 5) - 2.0;
+  }
+
+  DataVector expected(dataset.getNrows());
+  std::unique_ptr<OperationMultipleEval> reference(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+  reference->mult(alpha, expected);
+
+  // all grid block sizes give the same result
+  for (uint64_t gridBlockSize : {UINT64_C(1), UINT64_C(4), UINT64_C(48), UINT64_C(1000)}) {
+    sgpp::base::OperationConfiguration parameters;
+    parameters.addIDAttr("KERNEL_GRID_BLOCK_SIZE", gridBlockSize);
+    OperationMultipleEvalConfiguration configuration(OperationMultipleEvalType::STREAMING,
+                                                     OperationMultipleEvalSubType::DEFAULT,
+                                                     parameters);
+    std::unique_ptr<OperationMultipleEval> op(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset, configuration));
+
+    DataVector result(dataset.getNrows());
+    op->mult(alpha, result);
+
+    for (size_t i = 0; i < result.getSize(); i++) {
+      BOOST_CHECK_SMALL(result[i] - expected[i], 1E-10);
+    }
+  }
+
+  // the factory selects the kernel if autotuning is enabled in the configuration
+  OperationMultipleEvalConfiguration configuration;
+  configuration.setAutoTuning(tuningFileName);
+  std::unique_ptr<OperationMultipleEval> op(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset, configuration));
+
+  DataVector result(dataset.getNrows());
+  op->mult(alpha, result);
+
+  for (size_t i = 0; i < result.getSize(); i++) {
+    BOOST_CHECK_SMALL(result[i] - expected[i], 1E-10);
+  }
+
+  // the streaming kernel is tuned with several grid block sizes
+  MultipleEvalAutoTuner tuner(tuningFileName);
+  BOOST_CHECK(tuner.isTuned(*grid, dataset));
+  json::JSON database(tuningFileName);
+  json::Node& durations = database[tuner.getTuningKey(*grid, dataset)]["durations"];
+  BOOST_CHECK(durations.contains("STREAMING_DEFAULT"));
+  BOOST_CHECK(durations.contains("STREAMING_DEFAULT_GRID_BLOCK_4"));
+  BOOST_CHECK(durations.contains("STREAMING_DEFAULT_GRID_BLOCK_48"));
+
+  std::remove(tuningFileName);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
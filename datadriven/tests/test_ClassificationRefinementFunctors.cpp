@@ -0,0 +1,139 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/datadriven/functors/classification/DataBasedRefinementFunctor.hpp>
+#include <sgpp/datadriven/functors/classification/GridPointBasedRefinementFunctor.hpp>
+#include <sgpp/datadriven/functors/classification/ZeroCrossingRefinementFunctor.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::GridStorage;
+
+namespace {
+
+/**
+ * Two linear grids with different adaptive refinements (so that the union of their grid points
+ * differs from both) and smooth coefficients.
+ */
+struct TwoClassFixture {
+  TwoClassFixture() {
+    for (size_t k = 0; k < 2; k++) {
+      gridPtrs.emplace_back(Grid::createLinearGrid(dim));
+      gridPtrs[k]->getGenerator().regular(3);
+      alphaVecs.emplace_back(gridPtrs[k]->getSize());
+      for (size_t i = 0; i < gridPtrs[k]->getSize(); i++) {
+        alphaVecs[k][i] = std::sin(static_cast<double>(i + 7 * k + 1));
+      }
+      sgpp::base::SurplusRefinementFunctor refine(alphaVecs[k], 2 + k);
+      gridPtrs[k]->getGenerator().refine(refine);
+      alphaVecs[k].resize(gridPtrs[k]->getSize());
+      for (size_t i = 0; i < gridPtrs[k]->getSize(); i++) {
+        alphaVecs[k][i] = std::cos(static_cast<double>(3 * i + k));
+      }
+    }
+    for (size_t k = 0; k < 2; k++) {
+      grids.push_back(gridPtrs[k].get());
+      alphas.push_back(&alphaVecs[k]);
+    }
+  }
+
+  const size_t dim = 2;
+  std::vector<std::unique_ptr<Grid>> gridPtrs;
+  std::vector<DataVector> alphaVecs;
+  std::vector<Grid*> grids;
+  std::vector<DataVector*> alphas;
+};
+
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(ClassificationRefinementFunctors, TwoClassFixture)
+
+BOOST_AUTO_TEST_CASE(testGridPointBasedPreCompute) {
+  sgpp::datadriven::GridPointBasedRefinementFunctor direct(grids, alphas, 1, true, false);
+  sgpp::datadriven::GridPointBasedRefinementFunctor cached(grids, alphas, 1, true, true);
+  cached.preComputeEvaluations();
+
+  for (size_t k = 0; k < grids.size(); k++) {
+    direct.setGridIndex(k);
+    cached.setGridIndex(k);
+    GridStorage& storage = grids[k]->getStorage();
+    for (size_t seq = 0; seq < storage.getSize(); seq++) {
+      BOOST_CHECK_SMALL(direct(storage, seq) - cached(storage, seq), 1e-12);
+    }
+  }
+
+  // grid points added after the precomputation are reported
+  std::unique_ptr<Grid> other(Grid::createLinearGrid(dim));
+  other->getGenerator().regular(6);
+  BOOST_CHECK_THROW(cached(other->getStorage(), other->getSize() - 1),
+                    sgpp::base::application_exception);
+}
+
+BOOST_AUTO_TEST_CASE(testZeroCrossingPreCompute) {
+  sgpp::datadriven::ZeroCrossingRefinementFunctor direct(grids, alphas, 1, false, false);
+  sgpp::datadriven::ZeroCrossingRefinementFunctor cached(grids, alphas, 1, false, true);
+  cached.preComputeEvaluations();
+
+  for (size_t k = 0; k < grids.size(); k++) {
+    direct.setGridIndex(k);
+    cached.setGridIndex(k);
+    GridStorage& storage = grids[k]->getStorage();
+    for (size_t seq = 0; seq < storage.getSize(); seq++) {
+      BOOST_CHECK_SMALL(direct(storage, seq) - cached(storage, seq), 1e-12);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testDataBasedScores) {
+  const size_t numData = 200;
+  DataMatrix data(numData, dim);
+  DataVector targets(numData);
+  for (size_t j = 0; j < numData; j++) {
+    for (size_t t = 0; t < dim; t++) {
+      data(j, t) = std::abs(std::sin(static_cast<double>(j * dim + t + 1)));
+    }
+    targets[j] = (j % 2 == 0) ? -1.0 : 1.0;
+  }
+
+  sgpp::datadriven::DataBasedRefinementFunctor functor(grids, alphas, &data, &targets, 1, false);
+  // recomputing H must not change the result
+  functor.computeH();
+
+  for (size_t k = 0; k < grids.size(); k++) {
+    functor.setGridIndex(k);
+    DataMatrix& hk = functor.getHk(k);
+    GridStorage& storage = grids[k]->getStorage();
+
+    for (size_t seq = 0; seq < storage.getSize(); seq++) {
+      // count the points of H_k in the support of the basis function
+      size_t count = 0;
+      for (size_t j = 0; j < hk.getNrows(); j++) {
+        bool inside = true;
+        for (size_t t = 0; t < dim; t++) {
+          double h = std::pow(2.0, -static_cast<double>(storage[seq].getLevel(t)));
+          double x = storage[seq].getStandardCoordinate(t);
+          inside = inside && (hk(j, t) >= x - h) && (hk(j, t) <= x + h);
+        }
+        count += inside ? 1 : 0;
+      }
+      BOOST_CHECK_EQUAL(functor(storage, seq), static_cast<double>(count));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
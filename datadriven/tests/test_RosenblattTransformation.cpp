@@ -15,12 +15,16 @@
 #include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
 #include <sgpp/datadriven/application/KernelDensityEstimator.hpp>
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/simple/PiecewiseLinearCDF1D.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/optimization/operation/OptimizationOpFactory.hpp>
 
 #include <vector>
 #include <random>
 #include <iostream>
+#include <list>
+#include <memory>
+#include <utility>
 
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
@@ -242,6 +246,91 @@ BOOST_AUTO_TEST_CASE(testRosenblattLinearDD) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testRosenblattLinearReuse) {
+  // the operations keep their conditionals across calls, results have to match new operations
+  // after the grid or the coefficients have been modified
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+  GridStorage& gs = grid->getStorage();
+  DataVector alpha;
+  hierarchize(grid.get(), 3, alpha, &parabola);
+  std::unique_ptr<sgpp::datadriven::OperationInverseRosenblattTransformation> opInvRos(
+      sgpp::op_factory::createOperationInverseRosenblattTransformation(*grid));
+  std::unique_ptr<sgpp::datadriven::OperationRosenblattTransformation> opRos(
+      sgpp::op_factory::createOperationRosenblattTransformation(*grid));
+
+  const size_t numSamples = 50;
+  DataMatrix u_vars(numSamples, 2);
+  randu(u_vars);
+  DataMatrix x_vars(numSamples, 2), x_vars_ref(numSamples, 2);
+  DataMatrix u_vars_transformed(numSamples, 2), u_vars_ref(numSamples, 2);
+
+  for (size_t run = 0; run < 4; run++) {
+    if (run == 1) {
+      // new grid and coefficients
+      hierarchize(grid.get(), 4, alpha, &parabola);
+    } else if (run == 2) {
+      // coefficients modified in place
+      for (size_t i = 0; i < alpha.getSize(); i += 2) {
+        alpha[i] *= 1.5;
+      }
+    } else if (run == 3) {
+      // grid of the same size: replace the last point by one of its children
+      const size_t m = grid->getSize();
+      sgpp::base::GridPoint child(gs.getPoint(m - 1));
+      child.set(0, child.getLevel(0) + 1, 2 * child.getIndex(0) + 1);
+      std::list<size_t> removedPoints{m - 1};
+      gs.deletePoints(removedPoints);
+      gs.insert(child);
+      BOOST_REQUIRE_EQUAL(grid->getSize(), m);
+    }
+
+    std::unique_ptr<sgpp::datadriven::OperationInverseRosenblattTransformation> opInvRosRef(
+        sgpp::op_factory::createOperationInverseRosenblattTransformation(*grid));
+    std::unique_ptr<sgpp::datadriven::OperationRosenblattTransformation> opRosRef(
+        sgpp::op_factory::createOperationRosenblattTransformation(*grid));
+
+    opInvRos->doTransformation(&alpha, &u_vars, &x_vars);
+    opInvRosRef->doTransformation(&alpha, &u_vars, &x_vars_ref);
+    opRos->doTransformation(&alpha, &x_vars, &u_vars_transformed, 1);
+    opRosRef->doTransformation(&alpha, &x_vars, &u_vars_ref, 1);
+
+    for (size_t i = 0; i < numSamples; i++) {
+      for (size_t j = 0; j < 2; j++) {
+        BOOST_CHECK_EQUAL(x_vars.get(i, j), x_vars_ref.get(i, j));
+        BOOST_CHECK_EQUAL(u_vars_transformed.get(i, j), u_vars_ref.get(i, j));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testPiecewiseLinearCDF1D) {
+  // density vanishing on [0, 0.2] and [0.6, 1], with a grid point at the left boundary
+  std::vector<std::pair<double, double>> coordPdf = {
+      {0.0, 0.0}, {0.0, 0.0}, {0.2, 0.0}, {0.4, 1.0}, {0.6, 0.0}, {0.8, 0.0}, {1.0, 0.0}};
+  sgpp::datadriven::PiecewiseLinearCDF1D cdf(coordPdf);
+
+  BOOST_CHECK_EQUAL(cdf.cdf(0.0), 0.0);
+  BOOST_CHECK_EQUAL(cdf.cdf(0.1), 0.0);
+  BOOST_CHECK_CLOSE(cdf.cdf(0.4), 0.5, 1e-12);
+  BOOST_CHECK_EQUAL(cdf.cdf(0.9), 1.0);
+  BOOST_CHECK_EQUAL(cdf.cdf(1.0), 1.0);
+
+  // the flat regions map to their smallest coordinate
+  BOOST_CHECK_EQUAL(cdf.inverseCdf(0.0), 0.0);
+  BOOST_CHECK_CLOSE(cdf.inverseCdf(1.0), 0.6, 1e-12);
+
+  for (size_t k = 0; k <= 100; k++) {
+    double y = static_cast<double>(k) / 100.0;
+    double x = cdf.inverseCdf(y);
+    BOOST_CHECK(x >= 0.0 && x <= 1.0);
+    BOOST_CHECK_SMALL(cdf.cdf(x) - y, 1e-12);
+    // where the density does not vanish the cdf is invertible
+    if (x > 0.2 && x < 0.6) {
+      BOOST_CHECK_SMALL(cdf.inverseCdf(cdf.cdf(x)) - x, 1e-12);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(testRosenblattPoly1D) {
   Grid* grid = Grid::createPolyGrid(1, 3);
   DataVector alpha(20);
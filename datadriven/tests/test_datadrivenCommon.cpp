@@ -190,6 +190,44 @@ double compareVectors(sgpp::base::DataVector& results, sgpp::base::DataVector& r
   return mse;
 }
 
+namespace {
+/// degree of the B-spline and polynomial grids
+const size_t testDegree = 3;
+
+std::shared_ptr<sgpp::base::Grid> createGrid(sgpp::base::GridType gridType, size_t dim) {
+  if (gridType == sgpp::base::GridType::Linear) {
+    return std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearGrid(dim));
+  } else if (gridType == sgpp::base::GridType::ModLinear) {
+    return std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModLinearGrid(dim));
+  } else if (gridType == sgpp::base::GridType::Bspline) {
+    return std::shared_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createBsplineGrid(dim, testDegree));
+  } else if (gridType == sgpp::base::GridType::ModBspline) {
+    return std::shared_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createModBsplineGrid(dim, testDegree));
+  } else if (gridType == sgpp::base::GridType::Poly) {
+    return std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createPolyGrid(dim, testDegree));
+  } else if (gridType == sgpp::base::GridType::ModPoly) {
+    return std::shared_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createModPolyGrid(dim, testDegree));
+  }
+
+  return nullptr;
+}
+
+/// naive evaluation if the grid type supports it, otherwise the default evaluation
+sgpp::base::OperationMultipleEval* createReferenceOperation(sgpp::base::Grid& grid,
+                                                           sgpp::base::DataMatrix& dataset) {
+  if ((grid.getType() == sgpp::base::GridType::Bspline) ||
+      (grid.getType() == sgpp::base::GridType::ModBspline) ||
+      (grid.getType() == sgpp::base::GridType::Poly)) {
+    return sgpp::op_factory::createOperationMultipleEvalNaive(grid, dataset);
+  }
+
+  return sgpp::op_factory::createOperationMultipleEval(grid, dataset);
+}
+}  // namespace
+
 void compareDatasets(const std::vector<std::tuple<std::string, double>>& fileNamesError,
                      sgpp::base::GridType gridType, size_t level,
                      sgpp::datadriven::OperationMultipleEvalConfiguration configuration) {
@@ -219,13 +257,7 @@ double compareToReference(sgpp::base::GridType gridType, const std::string& file
 
   size_t dim = dataset.getDimension();
 
-  std::shared_ptr<sgpp::base::Grid> grid;
-
-  if (gridType == sgpp::base::GridType::Linear) {
-    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearGrid(dim));
-  } else if (gridType == sgpp::base::GridType::ModLinear) {
-    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModLinearGrid(dim));
-  }
+  std::shared_ptr<sgpp::base::Grid> grid = createGrid(gridType, dim);
 
   sgpp::base::GridStorage& gridStorage = grid->getStorage();
 
@@ -253,7 +285,7 @@ double compareToReference(sgpp::base::GridType gridType, const std::string& file
   eval->mult(alpha, dataSizeVectorResult);
 
   auto evalCompare = std::shared_ptr<sgpp::base::OperationMultipleEval>(
-      sgpp::op_factory::createOperationMultipleEval(*grid, trainingData));
+      createReferenceOperation(*grid, trainingData));
 
   sgpp::base::DataVector dataSizeVectorResultCompare(dataset.getNumberInstances());
   dataSizeVectorResultCompare.setAll(0.0);
@@ -297,13 +329,7 @@ double compareToReferenceTranspose(
 
   size_t dim = dataset.getDimension();
 
-  std::shared_ptr<sgpp::base::Grid> grid;
-
-  if (gridType == sgpp::base::GridType::Linear) {
-    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearGrid(dim));
-  } else if (gridType == sgpp::base::GridType::ModLinear) {
-    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModLinearGrid(dim));
-  }
+  std::shared_ptr<sgpp::base::Grid> grid = createGrid(gridType, dim);
 
   sgpp::base::GridStorage& gridStorage = grid->getStorage();
 
@@ -331,7 +357,7 @@ double compareToReferenceTranspose(
   eval->multTranspose(dataSizeVector, alphaResult);
 
   auto evalCompare = std::shared_ptr<sgpp::base::OperationMultipleEval>(
-      sgpp::op_factory::createOperationMultipleEval(*grid, trainingData));
+      createReferenceOperation(*grid, trainingData));
 
   sgpp::base::DataVector alphaResultCompare(gridStorage.getSize());
   alphaResultCompare.setAll(0.0);
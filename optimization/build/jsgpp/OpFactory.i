@@ -7,3 +7,5 @@
 
 %newobject sgpp::op_factory::createOperationMultipleHierarchisation(
     sgpp::base::Grid& grid);
+%newobject sgpp::op_factory::createOperationMultipleHierarchisationMatrixFree(
+    sgpp::base::Grid& grid);
@@ -137,6 +137,28 @@ class HashRefinementMultiple : public base::HashRefinement {
       addElementToCollection(iter, current_value_list, refinements_num, collection);
     }
   }
+
+  /**
+   * Extends the grid adding elements defined in collection.
+   * The points are refined one after another by refineGridpoint(), as the
+   * customized refinement in one dimension cannot be staged.
+   *
+   * @param storage hashmap that stores the grid points
+   * @param functor a RefinementFunctor specifying the refinement criteria
+   * @param collection container that contains elements to refine
+   */
+  void refineGridpointsCollection(
+      base::GridStorage& storage,
+      base::RefinementFunctor& functor,
+      base::AbstractRefinement::refinement_container_type& collection) override {
+    double threshold = functor.getRefinementThreshold();
+
+    for (AbstractRefinement::refinement_pair_type& pair : collection) {
+      if (pair.second >= threshold) {
+        refineGridpoint(storage, pair.first->getSeq());
+      }
+    }
+  }
 };
 }  // namespace optimization
 }  // namespace sgpp
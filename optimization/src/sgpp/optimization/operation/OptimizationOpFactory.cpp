@@ -28,6 +28,7 @@
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationModBspline.hpp>
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationModBsplineClenshawCurtis.hpp>
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationBspline.hpp>
+#include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationBsplineMatrixFree.hpp>
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationLinearBoundary.hpp>
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationLinearClenshawCurtis.hpp>
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationModLinear.hpp>
@@ -92,5 +93,17 @@ optimization::OperationMultipleHierarchisation* createOperationMultipleHierarchi
         "OperationMultipleHierarchisation is not implemented for this grid type.");
   }
 }
+
+optimization::OperationMultipleHierarchisation* createOperationMultipleHierarchisationMatrixFree(
+    base::Grid& grid) {
+  if ((grid.getType() == base::GridType::Bspline) ||
+      (grid.getType() == base::GridType::BsplineBoundary) ||
+      (grid.getType() == base::GridType::ModBspline)) {
+    return new optimization::OperationMultipleHierarchisationBsplineMatrixFree(grid);
+  } else {
+    throw base::factory_exception(
+        "Matrix-free OperationMultipleHierarchisation is not implemented for this grid type.");
+  }
+}
 }  // namespace op_factory
 }  // namespace sgpp
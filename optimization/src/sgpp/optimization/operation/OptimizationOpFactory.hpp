@@ -25,6 +25,20 @@ namespace op_factory {
  */
 optimization::OperationMultipleHierarchisation*
 createOperationMultipleHierarchisation(base::Grid& grid);
+
+/**
+ * Creates a matrix-free OperationMultipleHierarchisation for the given
+ * sgpp::optimization grid, which never assembles the interpolation matrix
+ * (see OperationMultipleHierarchisationBsplineMatrixFree).
+ * Only B-spline grids (Bspline, BsplineBoundary, ModBspline) are supported.
+ * Don't forget to delete the object after use.
+ *
+ * @param grid  sparse grid
+ * @return      pointer to a OperationMultipleHierarchisation object
+ *              for the grid
+ */
+optimization::OperationMultipleHierarchisation*
+createOperationMultipleHierarchisationMatrixFree(base::Grid& grid);
 }  // namespace op_factory
 }  // namespace sgpp
 
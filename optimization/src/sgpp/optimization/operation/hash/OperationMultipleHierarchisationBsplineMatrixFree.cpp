@@ -0,0 +1,587 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationBsplineMatrixFree.hpp>
+#include <sgpp/base/algorithm/sweep.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/common/basis/Basis.hpp>
+#include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
+#include <sgpp/optimization/tools/MutexType.hpp>
+#include <sgpp/optimization/tools/Printer.hpp>
+#include <sgpp/optimization/tools/ScopedLock.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace optimization {
+
+namespace {
+/**
+ * Levels and indices of the points of a pole in the direction of the sweep,
+ * in the order of the depth-first traversal of the pole.
+ */
+typedef std::vector<std::pair<base::level_t, base::index_t>> PoleStructure;
+}  // namespace
+
+class OperationMultipleHierarchisationBsplineMatrixFree::PoleFactorizationCache {
+ public:
+  /**
+   * LU factorization with partial pivoting of the matrix of a 1D interpolation problem.
+   */
+  class Factorization {
+   public:
+    /**
+     * Assembles and factorizes the matrix
+     * \f$(\varphi_{l_k,i_k}(x_{l_j,i_j}))_{j,k}\f$ of a pole.
+     *
+     * @param pole      levels and indices of the pole points
+     * @param basis     1D basis
+     */
+    Factorization(const PoleStructure& pole, base::SBasis& basis)
+        : m(pole.size()), lu(m * m), pivots(m), regular(true) {
+      for (size_t j = 0; j < m; j++) {
+        const double x = static_cast<double>(pole[j].second) /
+                         static_cast<double>(static_cast<base::index_t>(1) << pole[j].first);
+
+        for (size_t k = 0; k < m; k++) {
+          lu[j * m + k] = basis.eval(pole[k].first, pole[k].second, x);
+        }
+      }
+
+      for (size_t k = 0; k < m; k++) {
+        size_t pivot = k;
+
+        for (size_t j = k + 1; j < m; j++) {
+          if (std::abs(lu[j * m + k]) > std::abs(lu[pivot * m + k])) {
+            pivot = j;
+          }
+        }
+
+        pivots[k] = pivot;
+
+        if (lu[pivot * m + k] == 0.0) {
+          regular = false;
+          return;
+        }
+
+        if (pivot != k) {
+          std::swap_ranges(lu.begin() + k * m, lu.begin() + (k + 1) * m, lu.begin() + pivot * m);
+        }
+
+        for (size_t j = k + 1; j < m; j++) {
+          const double factor = lu[j * m + k] / lu[k * m + k];
+          lu[j * m + k] = factor;
+
+          if (factor != 0.0) {
+            for (size_t q = k + 1; q < m; q++) {
+              lu[j * m + q] -= factor * lu[k * m + q];
+            }
+          }
+        }
+      }
+    }
+
+    /**
+     * @param[in,out] b     before: right-hand side, after: solution
+     */
+    void solve(std::vector<double>& b) const {
+      for (size_t k = 0; k < m; k++) {
+        std::swap(b[k], b[pivots[k]]);
+      }
+
+      for (size_t j = 1; j < m; j++) {
+        for (size_t k = 0; k < j; k++) {
+          b[j] -= lu[j * m + k] * b[k];
+        }
+      }
+
+      for (size_t j = m; j-- > 0;) {
+        for (size_t k = j + 1; k < m; k++) {
+          b[j] -= lu[j * m + k] * b[k];
+        }
+
+        b[j] /= lu[j * m + j];
+      }
+    }
+
+    /**
+     * @return whether the matrix is regular
+     */
+    bool isRegular() const { return regular; }
+
+   protected:
+    /// number of pole points
+    size_t m;
+    /// row-major LU factors (L with unit diagonal)
+    std::vector<double> lu;
+    /// row interchanges
+    std::vector<size_t> pivots;
+    /// whether the matrix is regular
+    bool regular;
+  };
+
+  /**
+   * @param basis   1D basis
+   */
+  explicit PoleFactorizationCache(base::SBasis& basis) : basis(basis), modificationCount(0) {}
+
+  /**
+   * Removes all factorizations if the grid points have changed since the last call, so that
+   * the cache only contains poles of the current grid.
+   *
+   * @param storage grid storage
+   */
+  void clearIfModified(const base::GridStorage& storage) {
+    ScopedLock lock(mutex);
+
+    if (storage.getModificationCount() != modificationCount) {
+      factorizations.clear();
+      modificationCount = storage.getModificationCount();
+    }
+  }
+
+  /**
+   * Returns the factorization for a pole, which is computed if it is not cached yet.
+   * Multiple threads may compute the same factorization at the same time, but only
+   * the first one is stored.
+   *
+   * @param pole    levels and indices of the pole points
+   * @return        factorization
+   */
+  std::shared_ptr<const Factorization> get(const PoleStructure& pole) {
+    {
+      ScopedLock lock(mutex);
+      auto it = factorizations.find(pole);
+
+      if (it != factorizations.end()) {
+        return it->second;
+      }
+    }
+
+    std::shared_ptr<const Factorization> factorization(new Factorization(pole, basis));
+    ScopedLock lock(mutex);
+    return factorizations.insert(std::make_pair(pole, factorization)).first->second;
+  }
+
+ protected:
+  /// 1D basis
+  base::SBasis& basis;
+  /// cached factorizations
+  std::map<PoleStructure, std::shared_ptr<const Factorization>> factorizations;
+  /// modification count of the grid storage the factorizations belong to
+  uint64_t modificationCount;
+  /// mutex for factorizations
+  MutexType mutex;
+};
+
+namespace {
+
+/**
+ * Sweep functor which solves the 1D interpolation problem along a pole.
+ */
+class PoleSolver {
+ public:
+  typedef base::GridStorage::grid_iterator grid_iterator;
+  typedef OperationMultipleHierarchisationBsplineMatrixFree::PoleFactorizationCache
+      PoleFactorizationCache;
+
+  /**
+   * @param storage         grid storage
+   * @param cache           cache of the factorizations
+   * @param hasBoundary     whether the poles contain boundary points of level zero
+   * @param maxPoleLength   longer poles are not changed
+   */
+  PoleSolver(base::GridStorage& storage, PoleFactorizationCache& cache, bool hasBoundary,
+             size_t maxPoleLength)
+      : storage(storage), cache(cache), hasBoundary(hasBoundary), maxPoleLength(maxPoleLength) {}
+
+  /**
+   * @param source  coefficients before the 1D solves
+   * @param result  coefficients after the 1D solves (may be the same object as source)
+   * @param index   grid iterator at the pole, will be at the same position afterwards
+   * @param dim     direction of the pole
+   */
+  void operator()(base::DataVector& source, base::DataVector& result, grid_iterator& index,
+                  size_t dim) {
+    pole.clear();
+    seqs.clear();
+
+    if (hasBoundary) {
+      index.resetToLeftLevelZero(dim);
+      collectPole(index, dim);
+      index.resetToRightLevelZero(dim);
+      collectPole(index, dim);
+    }
+
+    index.resetToLevelOne(dim);
+    collectPole(index, dim);
+
+    if (hasBoundary) {
+      index.resetToLeftLevelZero(dim);
+    }
+
+    if (pole.empty() || (pole.size() > maxPoleLength)) {
+      return;
+    }
+
+    std::shared_ptr<const PoleFactorizationCache::Factorization> factorization = cache.get(pole);
+
+    if (!factorization->isRegular()) {
+      return;
+    }
+
+    values.resize(seqs.size());
+
+    for (size_t k = 0; k < seqs.size(); k++) {
+      values[k] = source[seqs[k]];
+    }
+
+    factorization->solve(values);
+
+    for (size_t k = 0; k < seqs.size(); k++) {
+      result[seqs[k]] = values[k];
+    }
+  }
+
+ protected:
+  /// grid storage
+  base::GridStorage& storage;
+  /// cache of the factorizations
+  PoleFactorizationCache& cache;
+  /// whether the poles contain boundary points of level zero
+  bool hasBoundary;
+  /// maximal length of poles
+  size_t maxPoleLength;
+  /// levels and indices of the current pole
+  PoleStructure pole;
+  /// sequence numbers of the current pole
+  std::vector<size_t> seqs;
+  /// right-hand side/solution of the current pole
+  std::vector<double> values;
+
+  /**
+   * Depth-first traversal of the pole, starting at the current position of the iterator.
+   *
+   * @param index   grid iterator, will be at the same position afterwards
+   * @param dim     direction of the pole
+   */
+  void collectPole(grid_iterator& index, size_t dim) {
+    const size_t seq = index.seq();
+
+    if (storage.isInvalidSequenceNumber(seq)) {
+      return;
+    }
+
+    base::level_t level;
+    base::index_t idx;
+    index.get(dim, level, idx);
+    pole.push_back(std::make_pair(level, idx));
+    seqs.push_back(seq);
+
+    // the boundary points of level zero have no children
+    if (level > 0) {
+      index.leftChild(dim);
+      collectPole(index, dim);
+      index.up(dim);
+      index.rightChild(dim);
+      collectPole(index, dim);
+      index.up(dim);
+    }
+  }
+};
+
+/**
+ * Preconditioner based on the unidirectional principle, i.e., the 1D interpolation
+ * problems along all poles are solved for one dimension after another.
+ * The roots of the poles are cached by the sweep objects.
+ */
+class UnidirectionalPreconditioner {
+ public:
+  /**
+   * @param storage         grid storage
+   * @param cache           cache of the factorizations
+   * @param hasBoundary     whether the grid contains boundary points
+   * @param maxPoleLength   longer poles are not changed
+   */
+  UnidirectionalPreconditioner(base::GridStorage& storage,
+                               PoleSolver::PoleFactorizationCache& cache, bool hasBoundary,
+                               size_t maxPoleLength)
+      : storage(storage),
+        hasBoundary(hasBoundary),
+        functor(storage, cache, hasBoundary, maxPoleLength),
+        sweeper(functor, storage) {}
+
+  /**
+   * @param[in,out] v   vector to be preconditioned
+   */
+  void apply(base::DataVector& v) {
+    for (size_t t = 0; t < storage.getDimension(); t++) {
+      if (hasBoundary) {
+        sweeper.sweep1D_Boundary_parallel(v, v, t);
+      } else {
+        sweeper.sweep1D_parallel(v, v, t);
+      }
+    }
+  }
+
+ protected:
+  /// grid storage
+  base::GridStorage& storage;
+  /// whether the grid contains boundary points
+  bool hasBoundary;
+  /// pole solver
+  PoleSolver functor;
+  /// sweep object
+  base::sweep<PoleSolver> sweeper;
+};
+
+/**
+ * Right-preconditioned BiCGStab method.
+ *
+ * @param         system      linear system (with matrix-free multiplication)
+ * @param         precond     preconditioner
+ * @param         b           right-hand side
+ * @param[out]    x           solution
+ * @param         maxItCount  maximal number of iterations
+ * @param         tol         tolerance for the relative residual norm
+ * @param[out]    itCount     number of iterations
+ * @return                    whether the method converged
+ */
+bool solveBiCGStab(HierarchisationSLE& system, UnidirectionalPreconditioner& precond,
+                   const base::DataVector& b, base::DataVector& x, size_t maxItCount, double tol,
+                   size_t& itCount) {
+  const size_t n = b.getSize();
+  const double bNorm = b.l2Norm();
+  itCount = 0;
+  x.resize(n);
+
+  if (bNorm == 0.0) {
+    x.setAll(0.0);
+    return true;
+  }
+
+  // the preconditioned right-hand side is a good starting point
+  x = b;
+  precond.apply(x);
+
+  base::DataVector r(n);
+  system.matrixVectorMultiplication(x, r);
+
+  for (size_t i = 0; i < n; i++) {
+    r[i] = b[i] - r[i];
+  }
+
+  double rNorm = r.l2Norm();
+
+  if (rNorm <= tol * bNorm) {
+    return true;
+  }
+
+  base::DataVector r0Hat(r);
+  base::DataVector p(n, 0.0);
+  base::DataVector v(n, 0.0);
+  base::DataVector y(n);
+  base::DataVector s(n);
+  base::DataVector z(n);
+  base::DataVector t(n);
+  double rho = 1.0;
+  double alpha = 1.0;
+  double omega = 1.0;
+
+  for (itCount = 1; itCount <= maxItCount; itCount++) {
+    const double lastRho = rho;
+    rho = r0Hat.dotProduct(r);
+
+    if (rho == 0.0) {
+      return false;
+    }
+
+    const double beta = (rho / lastRho) * (alpha / omega);
+
+    for (size_t i = 0; i < n; i++) {
+      p[i] = r[i] + beta * (p[i] - omega * v[i]);
+    }
+
+    y = p;
+    precond.apply(y);
+    system.matrixVectorMultiplication(y, v);
+    alpha = rho / r0Hat.dotProduct(v);
+
+    for (size_t i = 0; i < n; i++) {
+      x[i] += alpha * y[i];
+      s[i] = r[i] - alpha * v[i];
+    }
+
+    rNorm = s.l2Norm();
+
+    if (rNorm <= tol * bNorm) {
+      break;
+    }
+
+    z = s;
+    precond.apply(z);
+    system.matrixVectorMultiplication(z, t);
+    const double tNormSquared = t.dotProduct(t);
+
+    if (tNormSquared == 0.0) {
+      return false;
+    }
+
+    omega = t.dotProduct(s) / tNormSquared;
+
+    for (size_t i = 0; i < n; i++) {
+      x[i] += omega * z[i];
+      r[i] = s[i] - omega * t[i];
+    }
+
+    rNorm = r.l2Norm();
+
+    Printer::getInstance().printStatusUpdate("k = " + std::to_string(itCount) +
+                                             ", relative residual norm = " +
+                                             std::to_string(rNorm / bNorm));
+
+    if ((rNorm <= tol * bNorm) || std::isnan(rNorm) || (omega == 0.0)) {
+      break;
+    }
+  }
+
+  itCount = std::min(itCount, maxItCount);
+  return (rNorm <= tol * bNorm);
+}
+
+}  // namespace
+
+OperationMultipleHierarchisationBsplineMatrixFree::
+    OperationMultipleHierarchisationBsplineMatrixFree(base::Grid& grid)
+    : grid(grid),
+      hasBoundary(false),
+      maxItCount(DEFAULT_MAX_IT_COUNT),
+      tol(DEFAULT_TOLERANCE),
+      maxPoleLength(DEFAULT_MAX_POLE_LENGTH),
+      lastItCount(0) {
+  if (grid.getType() == base::GridType::BsplineBoundary) {
+    hasBoundary = true;
+  } else if ((grid.getType() != base::GridType::Bspline) &&
+             (grid.getType() != base::GridType::ModBspline)) {
+    throw base::operation_exception(
+        "OperationMultipleHierarchisationBsplineMatrixFree: Grid type not supported.");
+  }
+
+  poleFactorizations =
+      std::shared_ptr<PoleFactorizationCache>(new PoleFactorizationCache(grid.getBasis()));
+}
+
+OperationMultipleHierarchisationBsplineMatrixFree::
+    ~OperationMultipleHierarchisationBsplineMatrixFree() {}
+
+bool OperationMultipleHierarchisationBsplineMatrixFree::doHierarchisation(
+    base::DataVector& nodeValues) {
+  Printer::getInstance().printStatusBegin("Hierarchising (matrix-free BiCGStab)...");
+
+  HierarchisationSLE system(grid);
+  poleFactorizations->clearIfModified(grid.getStorage());
+  UnidirectionalPreconditioner precond(grid.getStorage(), *poleFactorizations, hasBoundary,
+                                       maxPoleLength);
+  base::DataVector b(nodeValues);
+  const bool result = solveBiCGStab(system, precond, b, nodeValues, maxItCount, tol, lastItCount);
+
+  if (result) {
+    Printer::getInstance().printStatusEnd();
+  } else {
+    Printer::getInstance().printStatusEnd("error: Could not solve linear system!");
+  }
+
+  return result;
+}
+
+void OperationMultipleHierarchisationBsplineMatrixFree::doDehierarchisation(
+    base::DataVector& alpha) {
+  HierarchisationSLE system(grid);
+  base::DataVector nodeValues(alpha.getSize());
+  system.matrixVectorMultiplication(alpha, nodeValues);
+  alpha = nodeValues;
+}
+
+bool OperationMultipleHierarchisationBsplineMatrixFree::doHierarchisation(
+    base::DataMatrix& nodeValues) {
+  Printer::getInstance().printStatusBegin("Hierarchising (matrix-free BiCGStab)...");
+
+  // the system and the preconditioner (including the cached poles) are shared by all columns
+  HierarchisationSLE system(grid);
+  poleFactorizations->clearIfModified(grid.getStorage());
+  UnidirectionalPreconditioner precond(grid.getStorage(), *poleFactorizations, hasBoundary,
+                                       maxPoleLength);
+  base::DataVector b(nodeValues.getNrows());
+  base::DataVector x(nodeValues.getNrows());
+  bool result = true;
+  lastItCount = 0;
+
+  for (size_t i = 0; i < nodeValues.getNcols(); i++) {
+    size_t itCount;
+    nodeValues.getColumn(i, b);
+    result = solveBiCGStab(system, precond, b, x, maxItCount, tol, itCount) && result;
+    nodeValues.setColumn(i, x);
+    lastItCount += itCount;
+  }
+
+  if (result) {
+    Printer::getInstance().printStatusEnd();
+  } else {
+    Printer::getInstance().printStatusEnd("error: Could not solve linear system!");
+  }
+
+  return result;
+}
+
+void OperationMultipleHierarchisationBsplineMatrixFree::doDehierarchisation(
+    base::DataMatrix& alpha) {
+  HierarchisationSLE system(grid);
+  base::DataVector alpha1(alpha.getNrows());
+  base::DataVector nodeValues(alpha.getNrows());
+
+  for (size_t i = 0; i < alpha.getNcols(); i++) {
+    alpha.getColumn(i, alpha1);
+    system.matrixVectorMultiplication(alpha1, nodeValues);
+    alpha.setColumn(i, nodeValues);
+  }
+}
+
+size_t OperationMultipleHierarchisationBsplineMatrixFree::getMaxItCount() const {
+  return maxItCount;
+}
+
+void OperationMultipleHierarchisationBsplineMatrixFree::setMaxItCount(size_t maxItCount) {
+  this->maxItCount = maxItCount;
+}
+
+double OperationMultipleHierarchisationBsplineMatrixFree::getTolerance() const { return tol; }
+
+void OperationMultipleHierarchisationBsplineMatrixFree::setTolerance(double tolerance) {
+  tol = tolerance;
+}
+
+size_t OperationMultipleHierarchisationBsplineMatrixFree::getMaxPoleLength() const {
+  return maxPoleLength;
+}
+
+void OperationMultipleHierarchisationBsplineMatrixFree::setMaxPoleLength(size_t maxPoleLength) {
+  this->maxPoleLength = maxPoleLength;
+}
+
+size_t OperationMultipleHierarchisationBsplineMatrixFree::getLastItCount() const {
+  return lastItCount;
+}
+}  // namespace optimization
+}  // namespace sgpp
@@ -0,0 +1,162 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SGPP_OPTIMIZATION_OPERATION_HASH_OPMULTHIERBSPLINEMATRIXFREE_HPP
+#define SGPP_OPTIMIZATION_OPERATION_HASH_OPMULTHIERBSPLINEMATRIXFREE_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/optimization/operation/hash/OperationMultipleHierarchisation.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace sgpp {
+namespace optimization {
+
+/**
+ * Matrix-free hierarchisation operation for B-spline basis functions on
+ * Noboundary, Boundary, and modified grids.
+ *
+ * In contrast to OperationMultipleHierarchisationBspline and its relatives, the
+ * interpolation matrix \f$A\f$ is never assembled. The linear system is solved with a
+ * right-preconditioned BiCGStab method, in which
+ * - the products with \f$A\f$ are evaluated matrix-free by
+ *   HierarchisationSLE::matrixVectorMultiplication, i.e., by enumerating the B-splines
+ *   that do not vanish at each grid point via a descent in the grid hierarchy, and
+ * - the preconditioner is the unidirectional principle: for every dimension, the
+ *   one-dimensional interpolation problems along all poles are solved, one after another.
+ *
+ * As the supports of B-splines of different levels overlap, the unidirectional principle
+ * is only an approximation to \f$A^{-1}\f$ (in contrast to the piecewise linear case),
+ * which is why it is used as a preconditioner. The matrices of the one-dimensional
+ * problems depend only on the levels and indices of the pole points. Their
+ * LU factorizations are cached and reused for all poles with the same structure,
+ * also for later calls. The cache is cleared when the grid points change.
+ *
+ * The memory consumption is linear in the number of grid points (plus the cached
+ * factorizations, which are quadratic in the pole lengths), which enables the
+ * hierarchisation on grids with millions of points.
+ */
+class OperationMultipleHierarchisationBsplineMatrixFree : public OperationMultipleHierarchisation {
+ public:
+  /// default maximal number of iterations
+  static const size_t DEFAULT_MAX_IT_COUNT = 1000;
+  /// default tolerance (relative residual norm)
+  static constexpr double DEFAULT_TOLERANCE = 1e-10;
+  /// default maximal number of points of poles for which the 1D problems are solved
+  static const size_t DEFAULT_MAX_POLE_LENGTH = 2047;
+
+  /**
+   * Thread-safe cache of the LU factorizations of the 1D problems
+   * (defined in the source file).
+   */
+  class PoleFactorizationCache;
+
+  /**
+   * Constructor.
+   *
+   * @param grid      grid (of type Bspline, BsplineBoundary, or ModBspline)
+   */
+  explicit OperationMultipleHierarchisationBsplineMatrixFree(base::Grid& grid);
+
+  /**
+   * Destructor.
+   */
+  ~OperationMultipleHierarchisationBsplineMatrixFree() override;
+
+  /**
+   * @param[in,out] nodeValues before: vector of function values at
+   *                           the grid points,
+   *                           after: vector of hierarchical coefficients
+   * @return                   whether hierarchisation was successful
+   */
+  bool doHierarchisation(base::DataVector& nodeValues) override;
+
+  /**
+   * @param[in,out] alpha before: vector of hierarchical coefficients,
+   *                      after: vector of function values at
+   *                      the grid points
+   */
+  void doDehierarchisation(base::DataVector& alpha) override;
+
+  /**
+   * @param[in,out] nodeValues before: matrix of function values at
+   *                           the grid points,
+   *                           after: matrix of hierarchical coefficients
+   * @return                   whether hierarchisation was successful
+   */
+  bool doHierarchisation(base::DataMatrix& nodeValues) override;
+
+  /**
+   * @param[in,out] alpha before: matrix of hierarchical coefficients,
+   *                      after: matrix of function values at
+   *                      the grid points
+   */
+  void doDehierarchisation(base::DataMatrix& alpha) override;
+
+  /**
+   * @return              maximal number of iterations
+   */
+  size_t getMaxItCount() const;
+
+  /**
+   * @param maxItCount    maximal number of iterations
+   */
+  void setMaxItCount(size_t maxItCount);
+
+  /**
+   * @return              tolerance for the residual norm relative to the norm of the
+   *                      function values
+   */
+  double getTolerance() const;
+
+  /**
+   * @param tolerance     tolerance for the residual norm relative to the norm of the
+   *                      function values
+   */
+  void setTolerance(double tolerance);
+
+  /**
+   * @return              maximal number of points of poles for which the 1D problems
+   *                      are solved in the preconditioner (longer poles are skipped)
+   */
+  size_t getMaxPoleLength() const;
+
+  /**
+   * @param maxPoleLength maximal number of points of poles for which the 1D problems
+   *                      are solved in the preconditioner (longer poles are skipped)
+   */
+  void setMaxPoleLength(size_t maxPoleLength);
+
+  /**
+   * @return              number of BiCGStab iterations of the last hierarchisation
+   *                      (summed over all columns for matrices)
+   */
+  size_t getLastItCount() const;
+
+ protected:
+  /// sparse grid
+  base::Grid& grid;
+  /// whether the grid contains boundary points
+  bool hasBoundary;
+  /// maximal number of iterations
+  size_t maxItCount;
+  /// tolerance
+  double tol;
+  /// maximal length of poles
+  size_t maxPoleLength;
+  /// number of iterations of the last hierarchisation
+  size_t lastItCount;
+  /// cached factorizations of the 1D problems, shared by all threads
+  std::shared_ptr<PoleFactorizationCache> poleFactorizations;
+};
+}  // namespace optimization
+}  // namespace sgpp
+
+#endif /* SGPP_OPTIMIZATION_OPERATION_HASH_OPMULTHIERBSPLINEMATRIXFREE_HPP */
@@ -134,22 +134,23 @@ bool Gmmpp::solve(SLE& system, base::DataVector& b, base::DataVector& x) const {
 
 #endif /* _OPENMP */
 
+      std::vector<size_t> columns;
+      std::vector<double> values;
+
 // copy system matrix to Gmm++ matrix object
 #pragma omp for ordered schedule(dynamic)
 
       for (size_t i = 0; i < n; i++) {
-        for (size_t j = 0; j < n; j++) {
-          double entry = system2->getMatrixEntry(i, j);
-
-          if (entry != 0) {
-#pragma omp critical
-            {
-              A(i, j) = entry;
-              nnz++;
-            }
-          }
+        system2->getNonZeroEntries(i, columns, values);
+
+        // different threads write different rows
+        for (size_t k = 0; k < columns.size(); k++) {
+          A(i, columns[k]) = values[k];
         }
 
+#pragma omp atomic
+        nnz += columns.size();
+
         // status message
         if (i % 100 == 0) {
 #pragma omp ordered
@@ -74,13 +74,12 @@ bool UMFPACK::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const
 
   const size_t n = system.getDimension();
 
-  size_t nnz = 0;
-  std::vector<uint32_t> Ti;
-  std::vector<uint32_t> Tj;
-  std::vector<double> Tx;
+  // non-zero entries of each row, rows are written by different threads
+  std::vector<std::vector<size_t>> rowColumns(n);
+  std::vector<std::vector<double>> rowValues(n);
 
 // parallelize only if the system is cloneable
-#pragma omp parallel if (system.isCloneable()) shared(system, Ti, Tj, Tx, nnz) default(none)
+#pragma omp parallel if (system.isCloneable()) shared(system, rowColumns, rowValues) default(none)
   {
     SLE* system2 = &system;
 #ifdef _OPENMP
@@ -96,20 +95,8 @@ bool UMFPACK::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const
 // get indices and values of nonzero entries
 #pragma omp for ordered schedule(dynamic)
 
-    for (uint32_t i = 0; i < n; i++) {
-      for (uint32_t j = 0; j < n; j++) {
-        double entry = system2->getMatrixEntry(i, j);
-
-        if (entry != 0) {
-#pragma omp critical
-          {
-            Ti.push_back(i);
-            Tj.push_back(j);
-            Tx.push_back(entry);
-            nnz++;
-          }
-        }
-      }
+    for (size_t i = 0; i < n; i++) {
+      system2->getNonZeroEntries(i, rowColumns[i], rowValues[i]);
 
       // status message
       if (i % 100 == 0) {
@@ -126,6 +113,12 @@ bool UMFPACK::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const
     }
   }
 
+  size_t nnz = 0;
+
+  for (size_t i = 0; i < n; i++) {
+    nnz += rowColumns[i].size();
+  }
+
   Printer::getInstance().printStatusUpdate("constructing sparse matrix (100.0%)");
   Printer::getInstance().printStatusNewLine();
 
@@ -148,10 +141,19 @@ bool UMFPACK::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const
   {
     std::vector<sslong> TiArray(nnz, 0);
     std::vector<sslong> TjArray(nnz, 0);
+    std::vector<double> Tx(nnz, 0.0);
+    size_t k = 0;
+
+    for (size_t i = 0; i < n; i++) {
+      for (size_t r = 0; r < rowColumns[i].size(); r++) {
+        TiArray[k] = static_cast<sslong>(i);
+        TjArray[k] = static_cast<sslong>(rowColumns[i][r]);
+        Tx[k] = rowValues[i][r];
+        k++;
+      }
 
-    for (size_t k = 0; k < nnz; k++) {
-      TiArray[k] = static_cast<sslong>(Ti[k]);
-      TjArray[k] = static_cast<sslong>(Tj[k]);
+      std::vector<size_t>().swap(rowColumns[i]);
+      std::vector<double>().swap(rowValues[i]);
     }
 
     Printer::getInstance().printStatusUpdate("step 1: umfpack_dl_triplet_to_col");
@@ -41,9 +41,11 @@
 #include <sgpp/base/grid/type/NakBsplineBoundaryCombigridGrid.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 namespace sgpp {
 namespace optimization {
@@ -71,7 +73,12 @@ class HierarchisationSLE : public CloneableSLE {
    *                          grid points according to gridStorage)
    */
   HierarchisationSLE(base::Grid& grid, base::GridStorage& gridStorage)
-      : CloneableSLE(), grid(grid), gridStorage(gridStorage), basisType(INVALID) {
+      : CloneableSLE(),
+        grid(grid),
+        gridStorage(gridStorage),
+        basisType(INVALID),
+        nestedSupports(false),
+        boundaryBasis(false) {
     // initialize the correct basis (according to the grid)
     if (grid.getType() == base::GridType::Bspline) {
       bsplineBasis = std::unique_ptr<base::SBsplineBase>(
@@ -143,6 +150,13 @@ class HierarchisationSLE : public CloneableSLE {
     } else {
       throw std::invalid_argument("Grid type not supported.");
     }
+
+    // the basis functions of these bases are non-zero exactly in their supports,
+    // which contain the supports of their hierarchical descendants
+    nestedSupports = ((basisType == BSPLINE) || (basisType == BSPLINE_BOUNDARY) ||
+                      (basisType == BSPLINE_MODIFIED) || (basisType == LINEAR) ||
+                      (basisType == LINEAR_BOUNDARY) || (basisType == LINEAR_MODIFIED));
+    boundaryBasis = ((basisType == BSPLINE_BOUNDARY) || (basisType == LINEAR_BOUNDARY));
   }
 
   /**
@@ -164,6 +178,98 @@ class HierarchisationSLE : public CloneableSLE {
     return evalBasisFunctionAtGridPoint(j, i);
   }
 
+  /**
+   * For bases with nested supports (B-splines and piecewise linear functions, also the
+   * boundary and modified variants), the basis functions whose supports contain the i-th grid
+   * point are enumerated by a recursive descent in the hierarchy of the grid, similar to
+   * base::GetAffectedBasisFunctions, which reuses the values of the one-dimensional basis
+   * functions of the ancestors. This requires that all hierarchical ancestors of the
+   * grid points are contained in the grid, which is checked once per grid size. Otherwise,
+   * all \f$n\f$ entries of the row are checked.
+   * The hierarchical neighbors of the grid points are looked up in tables
+   * (see GridHierarchy), which avoids hashing grid points during the descent.
+   *
+   * @param       i         row index
+   * @param[out]  columns   indices of the basis functions that do not vanish at the
+   *                        i-th grid point (not necessarily sorted)
+   * @param[out]  values    values of these basis functions at the i-th grid point
+   */
+  void getNonZeroEntries(size_t i, std::vector<size_t>& columns,
+                         std::vector<double>& values) override {
+    if (!isTraversable()) {
+      SLE::getNonZeroEntries(i, columns, values);
+      return;
+    }
+
+    const base::GridPoint& gpPoint = gridStorage[i];
+    const size_t d = gridStorage.getDimension();
+    std::vector<double> x(d);
+
+    for (size_t t = 0; t < d; t++) {
+      x[t] = gridStorage.getUnitCoordinate(gpPoint, t);
+    }
+
+    columns.clear();
+    values.clear();
+    findBasisFunctions(x.data(), 0, 1.0, GridHierarchy::INVALID, columns, values);
+  }
+
+  /**
+   * Matrix-free multiplication with the interpolation matrix, i.e., evaluation of the
+   * interpolant with coefficients x at all grid points. For bases with nested supports, the
+   * non-zero entries of every row are enumerated with getNonZeroEntries, which needs
+   * \f$\mathcal{O}(\mathrm{nnz})\f$ evaluations of one-dimensional basis functions instead of
+   * \f$\mathcal{O}(n^2)\f$. The rows are distributed among OpenMP threads (these bases are
+   * stateless, hence evaluating them concurrently is safe).
+   *
+   * @param       x   vector to be multiplied
+   * @param[out]  y   \f$y = Ax\f$
+   */
+  void matrixVectorMultiplication(const base::DataVector& x, base::DataVector& y) override {
+    if (!isTraversable()) {
+      SLE::matrixVectorMultiplication(x, y);
+      return;
+    }
+
+    const int64_t n = static_cast<int64_t>(getDimension());
+    y.resize(n);
+
+#pragma omp parallel
+    {
+      std::vector<size_t> columns;
+      std::vector<double> values;
+
+#pragma omp for schedule(dynamic, 64)
+      for (int64_t i = 0; i < n; i++) {
+        getNonZeroEntries(i, columns, values);
+        double result = 0.0;
+
+        for (size_t k = 0; k < columns.size(); k++) {
+          result += values[k] * x[columns[k]];
+        }
+
+        y[i] = result;
+      }
+    }
+  }
+
+  /**
+   * @return number of non-zero entries
+   */
+  size_t countNNZ() override {
+    const size_t n = getDimension();
+    std::vector<size_t> columns;
+    std::vector<double> values;
+    size_t nnz = 0;
+
+    for (size_t i = 0; i < n; i++) {
+      getNonZeroEntries(i, columns, values);
+      nnz += columns.size();
+    }
+
+    return nnz;
+  }
+
   /**
    * @return          sparse grid
    */
@@ -180,7 +286,10 @@ class HierarchisationSLE : public CloneableSLE {
    * @param[out] clone pointer to cloned object
    */
   void clone(std::unique_ptr<CloneableSLE>& clone) const override {
-    clone = std::unique_ptr<CloneableSLE>(new HierarchisationSLE(grid, gridStorage));
+    HierarchisationSLE* system = new HierarchisationSLE(grid, gridStorage);
+    // the hierarchy tables are read-only and can be shared
+    system->hierarchy = hierarchy;
+    clone = std::unique_ptr<CloneableSLE>(system);
   }
 
  protected:
@@ -243,6 +352,265 @@ class HierarchisationSLE : public CloneableSLE {
     NAK_BSPLINEBOUNDARY_COMBIGRID
   } basisType;
 
+  /**
+   * Sequence numbers of the hierarchical neighbors of all grid points, used for the descent
+   * in the hierarchy. For every grid point and dimension, the table contains the left and
+   * the right child and, for bases with boundary functions, the grid points with left and
+   * right boundary level zero in this dimension (INVALID if not contained in the grid).
+   */
+  struct GridHierarchy {
+    /// marker for neighbors that are not contained in the grid
+    static const size_t INVALID = static_cast<size_t>(-1);
+    /// position of the left child in the table
+    static const size_t LEFT_CHILD = 0;
+    /// position of the right child in the table
+    static const size_t RIGHT_CHILD = 1;
+    /// position of the left level-zero point in the table (boundary bases only)
+    static const size_t LEFT_LEVEL_ZERO = 2;
+    /// position of the right level-zero point in the table (boundary bases only)
+    static const size_t RIGHT_LEVEL_ZERO = 3;
+
+    /// modification count of the grid storage when the tables were created
+    uint64_t modificationCount;
+    /// number of table entries per grid point and dimension
+    size_t stride;
+    /// neighbors (number of grid points * dimension * stride entries)
+    std::vector<size_t> neighbors;
+    /// roots of the first dimension (level one, left and right level zero,
+    /// level one in all other dimensions)
+    size_t rootLevelOne, rootLeftLevelZero, rootRightLevelZero;
+    /// whether the descent reaches every grid point
+    bool traversable;
+  };
+
+  /// whether the supports of the basis functions are nested
+  bool nestedSupports;
+  /// whether the basis has boundary functions of level zero
+  bool boundaryBasis;
+  /// hierarchical neighbors (shared with clones)
+  std::shared_ptr<const GridHierarchy> hierarchy;
+
+  /**
+   * @return      whether getNonZeroEntries can use the recursive descent in the hierarchy,
+   *              i.e., whether the supports are nested and the descent reaches every
+   *              grid point
+   */
+  bool isTraversable() {
+    if (!nestedSupports || (gridStorage.getSize() == 0)) {
+      return false;
+    }
+
+    // rebuild the tables after every change of the grid points, also if the number of
+    // grid points is the same (e.g., after coarsening and refining)
+    if (!hierarchy || (hierarchy->modificationCount != gridStorage.getModificationCount())) {
+      std::shared_ptr<GridHierarchy> newHierarchy = createGridHierarchy();
+      hierarchy = newHierarchy;
+      std::vector<size_t> points;
+      std::vector<double> values;
+      findBasisFunctions(nullptr, 0, 1.0, GridHierarchy::INVALID, points, values);
+      newHierarchy->traversable = (points.size() == gridStorage.getSize());
+    }
+
+    return hierarchy->traversable;
+  }
+
+  /**
+   * Looks up the hierarchical neighbors of all grid points with a grid iterator.
+   *
+   * @return      new tables of hierarchical neighbors
+   */
+  std::shared_ptr<GridHierarchy> createGridHierarchy() {
+    std::shared_ptr<GridHierarchy> result(new GridHierarchy());
+    const size_t n = gridStorage.getSize();
+    const size_t d = gridStorage.getDimension();
+    result->modificationCount = gridStorage.getModificationCount();
+    result->stride = (boundaryBasis ? 4 : 2);
+    result->neighbors.assign(n * d * result->stride, size_t(GridHierarchy::INVALID));
+    result->traversable = false;
+
+    {
+      // iterator at level one in all dimensions
+      base::GridStorage::grid_iterator iterator(gridStorage);
+      result->rootLevelOne = getIteratorSeq(iterator);
+      iterator.resetToLeftLevelZero(0);
+      result->rootLeftLevelZero = getIteratorSeq(iterator);
+      iterator.resetToRightLevelZero(0);
+      result->rootRightLevelZero = getIteratorSeq(iterator);
+    }
+
+    const int64_t nSigned = static_cast<int64_t>(n);
+
+#pragma omp parallel
+    {
+      base::GridStorage::grid_iterator iterator(gridStorage);
+
+#pragma omp for schedule(static)
+      for (int64_t i = 0; i < nSigned; i++) {
+        iterator.set(gridStorage[i]);
+        size_t* neighbors = &result->neighbors[i * d * result->stride];
+
+        for (size_t t = 0; t < d; t++) {
+          base::level_t level;
+          base::index_t index;
+          iterator.get(t, level, index);
+
+          if (level > 0) {
+            iterator.leftChild(t);
+            neighbors[GridHierarchy::LEFT_CHILD] = getIteratorSeq(iterator);
+            iterator.up(t);
+            iterator.rightChild(t);
+            neighbors[GridHierarchy::RIGHT_CHILD] = getIteratorSeq(iterator);
+            iterator.up(t);
+          }
+
+          if (boundaryBasis) {
+            iterator.resetToLeftLevelZero(t);
+            neighbors[GridHierarchy::LEFT_LEVEL_ZERO] = getIteratorSeq(iterator);
+            iterator.resetToRightLevelZero(t);
+            neighbors[GridHierarchy::RIGHT_LEVEL_ZERO] = getIteratorSeq(iterator);
+            iterator.set(t, level, index);
+          }
+
+          neighbors += result->stride;
+        }
+      }
+    }
+
+    return result;
+  }
+
+  /**
+   * @param iterator  grid iterator
+   * @return          sequence number of the current position of the iterator
+   *                  (GridHierarchy::INVALID if not contained in the grid)
+   */
+  inline size_t getIteratorSeq(base::GridStorage::grid_iterator& iterator) {
+    const size_t seq = iterator.seq();
+    return (gridStorage.isInvalidSequenceNumber(seq) ? GridHierarchy::INVALID : seq);
+  }
+
+  /**
+   * Recursive descent in the t-th dimension, starting at the roots (level zero and one).
+   *
+   * @param       x         unit coordinates of the point
+   *                        (nullptr to find all basis functions)
+   * @param       t         current dimension
+   * @param       value     product of the values of the one-dimensional basis functions
+   *                        in the dimensions 0, ..., t-1
+   * @param       seq       grid point with level one in the dimensions t, ..., d-1
+   *                        (ignored for t = 0)
+   * @param[out]  columns   indices of the basis functions that do not vanish at x
+   * @param[out]  values    values of these basis functions at x (if x is not nullptr)
+   */
+  void findBasisFunctions(const double* x, size_t t, double value, size_t seq,
+                          std::vector<size_t>& columns, std::vector<double>& values) {
+    if (t == 0) {
+      if (boundaryBasis) {
+        findBasisFunctionsInSubtree(x, t, value, hierarchy->rootLeftLevelZero, columns, values);
+        findBasisFunctionsInSubtree(x, t, value, hierarchy->rootRightLevelZero, columns, values);
+      }
+
+      findBasisFunctionsInSubtree(x, t, value, hierarchy->rootLevelOne, columns, values);
+    } else {
+      if (boundaryBasis) {
+        const size_t* neighbors = getNeighbors(seq, t);
+        findBasisFunctionsInSubtree(x, t, value, neighbors[GridHierarchy::LEFT_LEVEL_ZERO],
+                                    columns, values);
+        findBasisFunctionsInSubtree(x, t, value, neighbors[GridHierarchy::RIGHT_LEVEL_ZERO],
+                                    columns, values);
+      }
+
+      findBasisFunctionsInSubtree(x, t, value, seq, columns, values);
+    }
+  }
+
+  /**
+   * Recursive descent in the t-th dimension, starting at the grid point seq.
+   * Subtrees are pruned if the basis function of their root vanishes at x,
+   * as the supports are nested.
+   *
+   * @param       x         unit coordinates of the point
+   *                        (nullptr to find all basis functions)
+   * @param       t         current dimension
+   * @param       value     product of the values of the one-dimensional basis functions
+   *                        in the dimensions 0, ..., t-1
+   * @param       seq       root of the subtree with level one in the dimensions
+   *                        t+1, ..., d-1 (GridHierarchy::INVALID if not contained in the grid)
+   * @param[out]  columns   indices of the basis functions that do not vanish at x
+   * @param[out]  values    values of these basis functions at x (if x is not nullptr)
+   */
+  void findBasisFunctionsInSubtree(const double* x, size_t t, double value, size_t seq,
+                                   std::vector<size_t>& columns, std::vector<double>& values) {
+    if (seq == GridHierarchy::INVALID) {
+      return;
+    }
+
+    const base::GridPoint& gp = gridStorage[seq];
+    const base::level_t level = gp.getLevel(t);
+    double newValue = 1.0;
+
+    if (x != nullptr) {
+      newValue = evalBasisFunction1D(level, gp.getIndex(t), x[t]);
+
+      if (newValue == 0.0) {
+        return;
+      }
+    }
+
+    if (t == gridStorage.getDimension() - 1) {
+      columns.push_back(seq);
+
+      if (x != nullptr) {
+        values.push_back(value * newValue);
+      }
+    } else {
+      findBasisFunctions(x, t + 1, value * newValue, seq, columns, values);
+    }
+
+    // the boundary basis functions of level zero have no children
+    if (level > 0) {
+      const size_t* neighbors = getNeighbors(seq, t);
+      findBasisFunctionsInSubtree(x, t, value, neighbors[GridHierarchy::LEFT_CHILD], columns,
+                                  values);
+      findBasisFunctionsInSubtree(x, t, value, neighbors[GridHierarchy::RIGHT_CHILD], columns,
+                                  values);
+    }
+  }
+
+  /**
+   * @param seq   grid point
+   * @param t     dimension
+   * @return      hierarchical neighbors of the grid point in the t-th dimension
+   */
+  inline const size_t* getNeighbors(size_t seq, size_t t) const {
+    return &hierarchy->neighbors[(seq * gridStorage.getDimension() + t) * hierarchy->stride];
+  }
+
+  /**
+   * @param l     level of the one-dimensional basis function
+   * @param i     index of the one-dimensional basis function
+   * @param x     unit coordinate
+   * @return      value of the one-dimensional basis function at x
+   *              (only for bases with nested supports)
+   */
+  inline double evalBasisFunction1D(base::level_t l, base::index_t i, double x) {
+    if (basisType == BSPLINE) {
+      return bsplineBasis->eval(l, i, x);
+    } else if (basisType == BSPLINE_BOUNDARY) {
+      return bsplineBoundaryBasis->eval(l, i, x);
+    } else if (basisType == BSPLINE_MODIFIED) {
+      return modBsplineBasis->eval(l, i, x);
+    } else if (basisType == LINEAR) {
+      return linearBasis->eval(l, i, x);
+    } else if (basisType == LINEAR_BOUNDARY) {
+      return linearL0BoundaryBasis->eval(l, i, x);
+    } else if (basisType == LINEAR_MODIFIED) {
+      return modLinearBasis->eval(l, i, x);
+    } else {
+      return 0.0;
+    }
+  }
+
   /**
    * @param basisI    basis function index
    * @param pointJ    grid point index
@@ -10,6 +10,7 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <cstddef>
+#include <vector>
 
 namespace sgpp {
 namespace optimization {
@@ -48,6 +49,31 @@ class SLE {
    */
   virtual double getMatrixEntry(size_t i, size_t j) = 0;
 
+  /**
+   * Retrieve the non-zero entries of a row of the matrix.
+   * Standard implementation with \f$\mathcal{O}(n)\f$ calls of getMatrixEntry.
+   *
+   * @param       i         row index
+   * @param[out]  columns   column indices of the non-zero entries of the
+   *                        i-th row (not necessarily sorted)
+   * @param[out]  values    values of the non-zero entries
+   */
+  virtual void getNonZeroEntries(size_t i, std::vector<size_t>& columns,
+                                 std::vector<double>& values) {
+    const size_t n = getDimension();
+    columns.clear();
+    values.clear();
+
+    for (size_t j = 0; j < n; j++) {
+      const double entry = getMatrixEntry(i, j);
+
+      if (entry != 0.0) {
+        columns.push_back(j);
+        values.push_back(entry);
+      }
+    }
+  }
+
   /**
    * Multiply the matrix with a vector.
    * Standard implementation with \f$\mathcal{O}(n^2)\f$ scalar
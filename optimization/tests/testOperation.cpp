@@ -7,7 +7,9 @@
 #include <boost/test/unit_test.hpp>
 
 #include <sgpp/optimization/test_problems/unconstrained/Sphere.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
 #include <sgpp/optimization/operation/OptimizationOpFactory.hpp>
+#include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationBsplineMatrixFree.hpp>
 #include <sgpp/optimization/tools/Printer.hpp>
 #include <sgpp/optimization/tools/RandomNumberGenerator.hpp>
 
@@ -16,6 +18,7 @@
 #include "GridCreator.hpp"
 
 using sgpp::optimization::OperationMultipleHierarchisation;
+using sgpp::optimization::OperationMultipleHierarchisationBsplineMatrixFree;
 using sgpp::optimization::Printer;
 using sgpp::optimization::RandomNumberGenerator;
 using sgpp::optimization::ScalarFunction;
@@ -75,3 +78,79 @@ BOOST_AUTO_TEST_CASE(TestOperationMultipleHierarchisation) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestOperationMultipleHierarchisationMatrixFree) {
+  Printer::getInstance().setVerbosity(-1);
+  RandomNumberGenerator::getInstance().setSeed(42);
+
+  const size_t d = 3;
+  const size_t p = 3;
+  const size_t l = 4;
+  const size_t m = 3;
+  const double tol = 1e-6;
+
+  Sphere testProblem(d);
+  ScalarFunction& f = testProblem.getObjectiveFunction();
+
+  std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+  grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createBsplineGrid(d, p)));
+  grids.push_back(
+      std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createBsplineBoundaryGrid(d, p)));
+  grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModBsplineGrid(d, p)));
+
+  for (auto& grid : grids) {
+    sgpp::base::DataVector functionValues(0);
+    testProblem.generateDisplacement();
+    createSampleGrid(*grid, l, f, functionValues);
+
+    sgpp::base::DataMatrix functionValuesMatrix(grid->getSize(), m);
+
+    for (size_t j = 0; j < m; j++) {
+      sgpp::base::DataVector column(0);
+      testProblem.generateDisplacement();
+      createSampleGrid(*grid, l, f, column);
+      functionValuesMatrix.setColumn(j, column);
+    }
+
+    std::unique_ptr<OperationMultipleHierarchisation> op(
+        sgpp::op_factory::createOperationMultipleHierarchisationMatrixFree(*grid));
+    std::unique_ptr<OperationMultipleHierarchisation> opAssembled(
+        sgpp::op_factory::createOperationMultipleHierarchisation(*grid));
+
+    // the coefficients coincide with the ones of the assembled system
+    sgpp::base::DataVector alpha(functionValues);
+    sgpp::base::DataVector alphaAssembled(functionValues);
+    BOOST_CHECK(op->doHierarchisation(alpha));
+    BOOST_CHECK(opAssembled->doHierarchisation(alphaAssembled));
+
+    // the preconditioner is a good approximation of the inverse
+    BOOST_CHECK_LT(
+        dynamic_cast<OperationMultipleHierarchisationBsplineMatrixFree&>(*op).getLastItCount(), 30);
+
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      BOOST_CHECK_SMALL(alpha[i] - alphaAssembled[i], tol);
+    }
+
+    op->doDehierarchisation(alpha);
+
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      BOOST_CHECK_SMALL(functionValues[i] - alpha[i], tol);
+    }
+
+    sgpp::base::DataMatrix functionValuesMatrix2(functionValuesMatrix);
+    BOOST_CHECK(op->doHierarchisation(functionValuesMatrix2));
+    op->doDehierarchisation(functionValuesMatrix2);
+
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      for (size_t j = 0; j < m; j++) {
+        BOOST_CHECK_SMALL(functionValuesMatrix(i, j) - functionValuesMatrix2(i, j), tol);
+      }
+    }
+  }
+
+  // only B-spline grids are supported
+  std::unique_ptr<sgpp::base::Grid> linearGrid(sgpp::base::Grid::createLinearGrid(d));
+  BOOST_CHECK_THROW(
+      sgpp::op_factory::createOperationMultipleHierarchisationMatrixFree(*linearGrid),
+      sgpp::base::factory_exception);
+}
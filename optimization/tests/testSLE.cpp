@@ -6,6 +6,7 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/optimization/function/scalar/InterpolantScalarFunction.hpp>
 #include <sgpp/optimization/sle/solver/Armadillo.hpp>
 #include <sgpp/optimization/sle/solver/Auto.hpp>
@@ -19,6 +20,8 @@
 #include <sgpp/optimization/tools/Printer.hpp>
 #include <sgpp/optimization/tools/RandomNumberGenerator.hpp>
 
+#include <cmath>
+#include <list>
 #include <vector>
 
 #include "ObjectiveFunctions.hpp"
@@ -41,6 +44,7 @@ void testSLESystem(SLE& system, const sgpp::base::DataVector& x,
   BOOST_CHECK_EQUAL(system.getDimension(), n);
   A.resize(n, n);
   sgpp::base::DataVector Ax(n, 0.0);
+  sgpp::base::DataVector AxAbs(n, 0.0);
 
   // A*x calculated directly
   for (size_t i = 0; i < n; i++) {
@@ -48,18 +52,46 @@ void testSLESystem(SLE& system, const sgpp::base::DataVector& x,
       const double Aij = system.getMatrixEntry(i, j);
       A(i, j) = Aij;
       Ax[i] += Aij * x[j];
+      AxAbs[i] += std::abs(Aij * x[j]);
 
       // test isMatrixEntryNonZero
       BOOST_CHECK_EQUAL(system.isMatrixEntryNonZero(i, j), Aij != 0);
     }
   }
 
+  // test getNonZeroEntries and countNNZ
+  std::vector<size_t> columns;
+  std::vector<double> values;
+  size_t nnz = 0;
+
+  for (size_t i = 0; i < n; i++) {
+    system.getNonZeroEntries(i, columns, values);
+    BOOST_CHECK_EQUAL(columns.size(), values.size());
+    sgpp::base::DataVector row(n, 0.0);
+
+    for (size_t k = 0; k < columns.size(); k++) {
+      BOOST_CHECK_EQUAL(row[columns[k]], 0.0);
+      row[columns[k]] = values[k];
+    }
+
+    for (size_t j = 0; j < n; j++) {
+      BOOST_CHECK_EQUAL(row[j], A(i, j));
+
+      if (A(i, j) != 0.0) {
+        nnz++;
+      }
+    }
+  }
+
+  BOOST_CHECK_EQUAL(system.countNNZ(), nnz);
+
   // A*x calculated by sgpp::optimization
   sgpp::base::DataVector Ax2(0);
   system.matrixVectorMultiplication(x, Ax2);
 
+  // the summation order may differ, hence the tolerance is relative to sum_j |A(i,j) * x[j]|
   for (size_t i = 0; i < n; i++) {
-    BOOST_CHECK_CLOSE(Ax[i], Ax2[i], 1e-10);
+    BOOST_CHECK_SMALL(Ax[i] - Ax2[i], 1e-12 * AxAbs[i]);
   }
 }
 
@@ -272,3 +304,96 @@ BOOST_AUTO_TEST_CASE(TestHierarchisationSLE) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestHierarchisationSLENonZeroEntries) {
+  // Test sgpp::optimization::HierarchisationSLE::getNonZeroEntries on adaptive grids
+  // and on grids without the hierarchical ancestors of the grid points.
+  RandomNumberGenerator::getInstance().setSeed(42);
+
+  const size_t d = 3;
+  const size_t p = 3;
+
+  std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+  grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createBsplineGrid(d, p)));
+  grids.push_back(
+      std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createBsplineBoundaryGrid(d, p)));
+  grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModBsplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearGrid(d)));
+  grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearBoundaryGrid(d)));
+  grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModLinearGrid(d)));
+
+  auto checkNonZeroEntries = [](HierarchisationSLE& system) {
+    const size_t n = system.getDimension();
+    std::vector<size_t> columns;
+    std::vector<double> values;
+
+    for (size_t i = 0; i < n; i++) {
+      system.getNonZeroEntries(i, columns, values);
+      std::vector<double> row(n, 0.0);
+
+      for (size_t k = 0; k < columns.size(); k++) {
+        row[columns[k]] = values[k];
+      }
+
+      for (size_t j = 0; j < n; j++) {
+        BOOST_CHECK_EQUAL(row[j], system.getMatrixEntry(i, j));
+      }
+    }
+  };
+
+  for (auto& grid : grids) {
+    // spatially adaptive grid
+    grid->getGenerator().regular(2);
+
+    for (size_t k = 0; k < 3; k++) {
+      sgpp::base::DataVector alpha(grid->getSize());
+
+      for (size_t i = 0; i < alpha.getSize(); i++) {
+        alpha[i] = RandomNumberGenerator::getInstance().getUniformRN(-1.0, 1.0);
+      }
+
+      sgpp::base::SurplusRefinementFunctor functor(alpha, 3);
+      grid->getGenerator().refine(functor);
+    }
+
+    HierarchisationSLE system(*grid);
+    checkNonZeroEntries(system);
+
+    // replace the last grid point, the system has to notice the change although the
+    // number of grid points stays the same
+    sgpp::base::GridStorage& storage = grid->getStorage();
+    const size_t n = storage.getSize();
+    sgpp::base::GridPoint deletedPoint(storage[n - 1]);
+    std::list<size_t> removePoints{n - 1};
+    storage.deletePoints(removePoints);
+
+    for (size_t i = 0; storage.getSize() < n; i++) {
+      sgpp::base::GridPoint child(storage[i]);
+      child.getLeftChild(0);
+
+      if (!storage.isContaining(child) && !child.equals(deletedPoint)) {
+        storage.insert(child);
+      }
+    }
+
+    checkNonZeroEntries(system);
+
+    // the parents of these grid points are missing
+    sgpp::base::GridStorage gridStorage(d);
+    sgpp::base::GridPoint gp(d);
+
+    for (size_t t = 0; t < d; t++) {
+      gp.set(t, 1, 1);
+    }
+
+    gp.set(0, 3, 5);
+    gridStorage.insert(gp);
+    gp.set(1, 2, 1);
+    gridStorage.insert(gp);
+    gp.set(0, 1, 1);
+    gridStorage.insert(gp);
+
+    HierarchisationSLE system2(*grid, gridStorage);
+    checkNonZeroEntries(system2);
+  }
+}
@@ -10,6 +10,13 @@
 %feature("director") ConjugateGradients;
 %include "solver/src/sgpp/solver/sle/ConjugateGradients.hpp"
 %include "solver/src/sgpp/solver/sle/BiCGStab.hpp"
+%include "solver/src/sgpp/solver/sle/PreconditionedConjugateGradients.hpp"
+%include "solver/src/sgpp/solver/sle/PipelinedConjugateGradients.hpp"
+%include "solver/src/sgpp/solver/sle/BlockConjugateGradients.hpp"
+%include "solver/src/sgpp/solver/sle/preconditioner/Preconditioner.hpp"
+%include "solver/src/sgpp/solver/sle/preconditioner/JacobiPreconditioner.hpp"
+%include "solver/src/sgpp/solver/sle/preconditioner/LevelScalingPreconditioner.hpp"
+%include "solver/src/sgpp/solver/sle/preconditioner/BlockJacobiPreconditioner.hpp"
 %include "solver/src/sgpp/solver/ode/Euler.hpp"
 %include "solver/src/sgpp/solver/ode/CrankNicolson.hpp"
 %include "solver/src/sgpp/solver/TypesSolver.hpp"
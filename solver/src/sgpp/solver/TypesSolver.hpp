@@ -14,7 +14,12 @@ namespace solver {
 /**
  * enum to address different SLE solvers in a standardized way
  */
-enum class SLESolverType { CG, BiCGSTAB, FISTA };
+enum class SLESolverType { CG, BiCGSTAB, FISTA, PipelinedCG };
+
+/**
+ * enum to address different preconditioners of the conjugate gradient solvers
+ */
+enum class SLEPreconditionerType { None, Jacobi, LevelScaling };
 
 struct SLESolverConfiguration {
   sgpp::solver::SLESolverType type_;
@@ -22,6 +27,7 @@ struct SLESolverConfiguration {
   size_t maxIterations_;
   double threshold_;
   bool verbose_;
+  sgpp::solver::SLEPreconditionerType preconditioner_ = SLEPreconditionerType::None;
 };
 
 struct SLESolverSPConfiguration {
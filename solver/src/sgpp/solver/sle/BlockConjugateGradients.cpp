@@ -0,0 +1,276 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/BlockConjugateGradients.hpp>
+#include <sgpp/base/tools/ThreadPrivateReduction.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+namespace {
+
+/**
+ * Computes the dot products of the columns activeU[c] of U with the columns activeV[c]
+ * of V in one pass over the rows.
+ */
+std::vector<double> columnDotProducts(const sgpp::base::DataMatrix& U,
+                                      const std::vector<size_t>& activeU,
+                                      const sgpp::base::DataMatrix& V,
+                                      const std::vector<size_t>& activeV) {
+  const size_t n = U.getNrows();
+  const size_t a = activeU.size();
+  sgpp::base::DataVector result(a, 0.0);
+  sgpp::base::ThreadPrivateReduction reduction(result);
+
+#pragma omp parallel
+  {
+    sgpp::base::DataVector privateResult(a, 0.0);
+
+#pragma omp for schedule(static)
+    for (size_t i = 0; i < n; i++) {
+      for (size_t c = 0; c < a; c++) {
+        privateResult[c] += U(i, activeU[c]) * V(i, activeV[c]);
+      }
+    }
+
+    reduction.reduce(privateResult);
+  }
+
+  return std::vector<double>(result.getPointer(), result.getPointer() + a);
+}
+
+/**
+ * Copies the given columns of a matrix into a new matrix.
+ */
+void gatherColumns(const sgpp::base::DataMatrix& source, const std::vector<size_t>& columns,
+                   sgpp::base::DataMatrix& result) {
+  const size_t n = source.getNrows();
+  const size_t a = columns.size();
+  result.resizeRowsCols(n, a);
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < n; i++) {
+    for (size_t c = 0; c < a; c++) {
+      result(i, c) = source(i, columns[c]);
+    }
+  }
+}
+
+}  // namespace
+
+const size_t BlockConjugateGradients::DEFAULT_REPLACEMENT_PERIOD;
+
+BlockConjugateGradients::BlockConjugateGradients(size_t imax, double epsilon)
+    : SLESolver(imax, epsilon), replacementPeriod(DEFAULT_REPLACEMENT_PERIOD) {}
+
+BlockConjugateGradients::~BlockConjugateGradients() {}
+
+void BlockConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                                    sgpp::base::DataVector& alpha, sgpp::base::DataVector& b,
+                                    bool reuse, bool verbose, double max_threshold) {
+  alpha.resize(b.getSize());
+  sgpp::base::DataMatrix alphaMatrix(alpha.getPointer(), alpha.getSize(), 1);
+  sgpp::base::DataMatrix bMatrix(b.getPointer(), b.getSize(), 1);
+  solve(SystemMatrix, alphaMatrix, bMatrix, reuse, verbose, max_threshold);
+  alphaMatrix.getColumn(0, alpha);
+}
+
+void BlockConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                                    sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& b,
+                                    bool reuse, bool verbose, double max_threshold) {
+  if (verbose == true) {
+    std::cout << "Starting Block Conjugated Gradients" << std::endl;
+  }
+
+  const size_t n = b.getNrows();
+  const size_t k = b.getNcols();
+  const double epsilonSquared = this->myEpsilon * this->myEpsilon;
+
+  this->nIterations = 0;
+  columnIterations.assign(k, 0);
+  brokenDownColumns.clear();
+
+  if ((reuse == false) || (alpha.getNrows() != n) || (alpha.getNcols() != k)) {
+    alpha.resizeRowsCols(n, k);
+    alpha.setAll(0.0);
+  }
+
+  std::vector<size_t> allColumns(k);
+
+  for (size_t j = 0; j < k; j++) {
+    allColumns[j] = j;
+  }
+
+  // R = B - A*X, D = R
+  sgpp::base::DataMatrix temp(n, k);
+  SystemMatrix.mult(alpha, temp);
+  sgpp::base::DataMatrix r(b);
+  r.sub(temp);
+  sgpp::base::DataMatrix d(r);
+
+  const std::vector<double> bb = columnDotProducts(b, allColumns, b, allColumns);
+  std::vector<double> deltaNew = columnDotProducts(r, allColumns, r, allColumns);
+  std::vector<double> delta0(k);
+  residuals = sgpp::base::DataVector(k);
+
+  // active columns (not converged yet) and their current squared residual norms
+  std::vector<size_t> active;
+  std::vector<double> activeDelta;
+
+  for (size_t j = 0; j < k; j++) {
+    delta0[j] = bb[j] * epsilonSquared;
+    residuals[j] = deltaNew[j];
+
+    if ((deltaNew[j] > delta0[j]) && (deltaNew[j] > max_threshold)) {
+      active.push_back(j);
+      activeDelta.push_back(deltaNew[j]);
+    }
+  }
+
+  if (verbose == true) {
+    std::cout << "Number of right-hand sides: " << k << ", not converged: " << active.size()
+              << std::endl;
+  }
+
+  sgpp::base::DataMatrix dActive;
+  sgpp::base::DataMatrix q;
+
+  while ((this->nIterations < this->nMaxIterations) && !active.empty()) {
+    const size_t a = active.size();
+    std::vector<size_t> activeCompact(a);
+
+    for (size_t c = 0; c < a; c++) {
+      activeCompact[c] = c;
+    }
+
+    // Q = A*D for the active columns only
+    sgpp::base::DataMatrix* dMult = &d;
+
+    if (a < k) {
+      gatherColumns(d, active, dActive);
+      dMult = &dActive;
+    }
+
+    SystemMatrix.mult(*dMult, q);
+
+    const std::vector<double> dq = columnDotProducts(d, active, q, activeCompact);
+    std::vector<double> step(a, 0.0);
+
+    for (size_t c = 0; c < a; c++) {
+      step[c] = ((dq[c] == 0.0) ? 0.0 : activeDelta[c] / dq[c]);
+    }
+
+    // X = X + a*D, R = R - a*Q
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < n; i++) {
+      for (size_t c = 0; c < a; c++) {
+        const size_t j = active[c];
+        alpha(i, j) += step[c] * d(i, j);
+        r(i, j) -= step[c] * q(i, c);
+      }
+    }
+
+    this->nIterations++;
+
+    if ((replacementPeriod > 0) && ((this->nIterations % replacementPeriod) == 0)) {
+      // recompute the residuals to avoid the accumulation of rounding errors
+      sgpp::base::DataMatrix xActive;
+      gatherColumns(alpha, active, xActive);
+      SystemMatrix.mult(xActive, q);
+
+#pragma omp parallel for schedule(static)
+      for (size_t i = 0; i < n; i++) {
+        for (size_t c = 0; c < a; c++) {
+          const size_t j = active[c];
+          r(i, j) = b(i, j) - q(i, c);
+        }
+      }
+    }
+
+    const std::vector<double> rr = columnDotProducts(r, active, r, active);
+    std::vector<double> beta(a);
+
+    for (size_t c = 0; c < a; c++) {
+      beta[c] = rr[c] / activeDelta[c];
+    }
+
+    // D = R + beta*D
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < n; i++) {
+      for (size_t c = 0; c < a; c++) {
+        const size_t j = active[c];
+        d(i, j) = r(i, j) + beta[c] * d(i, j);
+      }
+    }
+
+    // remove converged (or broken down) columns from the block
+    std::vector<size_t> stillActive;
+    std::vector<double> stillActiveDelta;
+
+    for (size_t c = 0; c < a; c++) {
+      const size_t j = active[c];
+      residuals[j] = rr[c];
+      columnIterations[j] = this->nIterations;
+
+      if ((rr[c] <= delta0[j]) || (rr[c] <= max_threshold)) {
+        continue;
+      }
+
+      if (dq[c] == 0.0) {
+        brokenDownColumns.push_back(j);
+
+        if (verbose == true) {
+          std::cout << "Warning: breakdown in column " << j << " (d^T A d = 0), residuum: "
+                    << rr[c] << std::endl;
+        }
+      } else {
+        stillActive.push_back(j);
+        stillActiveDelta.push_back(rr[c]);
+      }
+    }
+
+    active.swap(stillActive);
+    activeDelta.swap(stillActiveDelta);
+
+    if (verbose == true) {
+      std::cout << "iteration " << this->nIterations << ", not converged: " << active.size()
+                << std::endl;
+    }
+  }
+
+  std::sort(brokenDownColumns.begin(), brokenDownColumns.end());
+  this->residuum = (k > 0) ? residuals.max() : 0.0;
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final maximal norm of residuum: " << this->residuum << std::endl;
+  }
+}
+
+const sgpp::base::DataVector& BlockConjugateGradients::getResiduals() const { return residuals; }
+
+const std::vector<size_t>& BlockConjugateGradients::getColumnIterations() const {
+  return columnIterations;
+}
+
+const std::vector<size_t>& BlockConjugateGradients::getBrokenDownColumns() const {
+  return brokenDownColumns;
+}
+
+void BlockConjugateGradients::setReplacementPeriod(size_t replacementPeriod) {
+  this->replacementPeriod = replacementPeriod;
+}
+
+size_t BlockConjugateGradients::getReplacementPeriod() const { return replacementPeriod; }
+
+}  // namespace solver
+}  // namespace sgpp
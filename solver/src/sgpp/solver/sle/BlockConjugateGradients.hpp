@@ -0,0 +1,132 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef BLOCKCONJUGATEGRADIENTS_HPP
+#define BLOCKCONJUGATEGRADIENTS_HPP
+
+#include <sgpp/solver/SLESolver.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Conjugate gradients for systems with multiple right-hand sides \f$A X = B\f$.
+ * The columns are iterated simultaneously: in every iteration, the system matrix is
+ * applied to the search directions of all columns with one call of
+ * sgpp::base::OperationMatrix::mult(DataMatrix&, DataMatrix&), which lets operations such
+ * as the data mining system matrices stream over the data set only once for all
+ * right-hand sides. The step sizes are computed per column, which is why every column
+ * converges exactly like ConjugateGradients (and not like the block CG method of O'Leary,
+ * which breaks down if the columns converge at different rates).
+ * Columns whose squared residual norm falls below
+ * \f$\varepsilon^2 \lVert b_j \rVert_2^2\f$ are removed from the block, i.e., later
+ * products only involve the remaining columns.
+ * Columns whose search direction \f$d_j\f$ satisfies \f$d_j^T A d_j = 0\f$ before they
+ * converge (breakdown, e.g., for singular matrices) are removed as well; they are reported
+ * by getBrokenDownColumns().
+ * As in PreconditionedConjugateGradients, the residuals are recomputed from their definition
+ * every replacementPeriod iterations (residual replacement).
+ */
+class BlockConjugateGradients : public SLESolver {
+ public:
+  /// default number of iterations between two residual replacements
+  static const size_t DEFAULT_REPLACEMENT_PERIOD = 50;
+
+  /**
+   * Constructor.
+   *
+   * @param imax      maximal number of iterations
+   * @param epsilon   relative tolerance for the Euclidean norm of the residual of
+   *                  every column
+   */
+  BlockConjugateGradients(size_t imax, double epsilon);
+
+  /**
+   * Std-Destructor
+   */
+  ~BlockConjugateGradients() override;
+
+  /**
+   * Solves a system with one right-hand side (block of one column).
+   *
+   * @param SystemMatrix  system matrix
+   * @param alpha         solution (initial guess if reuse is true)
+   * @param b             right-hand side
+   * @param reuse         whether alpha is used as initial guess
+   * @param verbose       whether information is printed during the execution
+   * @param max_threshold additional absolute threshold for the squared residual norm
+   */
+  void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+             sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
+             double max_threshold = DEFAULT_RES_THRESHOLD) override;
+
+  /**
+   * Solves a system with multiple right-hand sides.
+   *
+   * @param SystemMatrix  system matrix
+   * @param alpha         solutions, one column per right-hand side
+   *                      (initial guesses if reuse is true, resized otherwise)
+   * @param b             right-hand sides (columns)
+   * @param reuse         whether alpha is used as initial guess
+   * @param verbose       whether information is printed during the execution
+   * @param max_threshold additional absolute threshold for the squared residual norms
+   */
+  void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataMatrix& alpha,
+             sgpp::base::DataMatrix& b, bool reuse = false, bool verbose = false,
+             double max_threshold = DEFAULT_RES_THRESHOLD);
+
+  /**
+   * @return squared residual norms of the columns after the last solve
+   *         (getResiduum() returns their maximum)
+   */
+  const sgpp::base::DataVector& getResiduals() const;
+
+  /**
+   * @return number of iterations of the columns in the last solve
+   *         (getNumberIterations() returns their maximum)
+   */
+  const std::vector<size_t>& getColumnIterations() const;
+
+  /**
+   * @return indices of the columns that broke down in the last solve, i.e., that were
+   *         removed from the block without having converged because of
+   *         \f$d_j^T A d_j = 0\f$ (in ascending order)
+   */
+  const std::vector<size_t>& getBrokenDownColumns() const;
+
+  /**
+   * @param replacementPeriod number of iterations between two residual replacements
+   *                          (0 to disable the replacement)
+   */
+  void setReplacementPeriod(size_t replacementPeriod);
+
+  /**
+   * @return number of iterations between two residual replacements
+   */
+  size_t getReplacementPeriod() const;
+
+ protected:
+  /// squared residual norms of the columns
+  sgpp::base::DataVector residuals;
+  /// numbers of iterations of the columns
+  std::vector<size_t> columnIterations;
+  /// columns that broke down
+  std::vector<size_t> brokenDownColumns;
+  /// number of iterations between two residual replacements
+  size_t replacementPeriod;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* BLOCKCONJUGATEGRADIENTS_HPP */
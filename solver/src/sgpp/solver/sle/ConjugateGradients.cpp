@@ -102,7 +102,7 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
     }
 
     // a = d_new / d.q
-    a = delta_new / d.dotProduct(q);
+    a = delta_new / dq;
 
     // x = x + a*d
     alpha.axpy(a, d);
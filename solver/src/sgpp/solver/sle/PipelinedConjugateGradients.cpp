@@ -0,0 +1,195 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <iostream>
+
+namespace sgpp {
+namespace solver {
+
+PipelinedConjugateGradients::PipelinedConjugateGradients(
+    size_t imax, double epsilon, sgpp::base::OperationMatrix* preconditioner)
+    : PreconditionedConjugateGradients(imax, epsilon, preconditioner) {}
+
+PipelinedConjugateGradients::~PipelinedConjugateGradients() {}
+
+void PipelinedConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                                        sgpp::base::DataVector& alpha, sgpp::base::DataVector& b,
+                                        bool reuse, bool verbose, double max_threshold) {
+  this->starting();
+
+  if (verbose == true) {
+    std::cout << "Starting Pipelined Conjugated Gradients" << std::endl;
+  }
+
+  const size_t n = alpha.getSize();
+  const double epsilonSquared = this->myEpsilon * this->myEpsilon;
+  this->nIterations = 0;
+
+  // notation of Ghysels and Vanroose: u = M^{-1} r, w = A u, m = M^{-1} w, n = A m,
+  // p: search direction, s = A p, q = M^{-1} s, z = A q
+  sgpp::base::DataVector temp(n);
+  sgpp::base::DataVector r(n);
+  sgpp::base::DataVector u(n);
+  sgpp::base::DataVector w(n);
+  sgpp::base::DataVector m(n);
+  sgpp::base::DataVector nn(n);
+  sgpp::base::DataVector p(n, 0.0);
+  sgpp::base::DataVector s(n, 0.0);
+  sgpp::base::DataVector q(n, 0.0);
+  sgpp::base::DataVector z(n, 0.0);
+
+  if (reuse == false) {
+    alpha.setAll(0.0);
+  }
+
+  // r = b - A*x, u = M^{-1}*r, w = A*u
+  SystemMatrix.mult(alpha, temp);
+  r.copyFrom(b);
+  r.sub(temp);
+  applyPreconditioner(r, u);
+  SystemMatrix.mult(u, w);
+
+  const double* bPtr = b.getPointer();
+  double bb = 0.0;
+
+#pragma omp parallel for reduction(+ : bb)
+  for (size_t i = 0; i < n; i++) {
+    bb += bPtr[i] * bPtr[i];
+  }
+
+  const double delta_0 = bb * epsilonSquared;
+
+  this->residuum = bb;
+  this->calcStarting();
+
+  double rr = 0.0;
+  double gammaOld = 0.0;
+
+  while (true) {
+    const double* rPtr = r.getPointer();
+    const double* uPtr = u.getPointer();
+    const double* wPtr = w.getPointer();
+    const double* pOldPtr = p.getPointer();
+    const double* sOldPtr = s.getPointer();
+
+    // the only global reduction of the iteration; (u, s), (p, w), and (p, s) with the
+    // previous p and s yield the denominator (p, A p) of the step size
+    double gamma = 0.0;
+    double delta = 0.0;
+    double us = 0.0;
+    double pw = 0.0;
+    double ps = 0.0;
+    rr = 0.0;
+
+#pragma omp parallel for reduction(+ : gamma, delta, us, pw, ps, rr)
+    for (size_t i = 0; i < n; i++) {
+      gamma += rPtr[i] * uPtr[i];
+      delta += wPtr[i] * uPtr[i];
+      us += uPtr[i] * sOldPtr[i];
+      pw += pOldPtr[i] * wPtr[i];
+      ps += pOldPtr[i] * sOldPtr[i];
+      rr += rPtr[i] * rPtr[i];
+    }
+
+    if (this->nIterations == 0) {
+      if (verbose == true) {
+        std::cout << "Starting norm of residuum: " << rr << std::endl;
+        std::cout << "Target norm:               " << delta_0 << std::endl;
+      }
+    } else {
+      this->residuum = rr;
+      this->iterationComplete();
+
+      if (verbose == true) {
+        std::cout << "delta: " << rr << std::endl;
+      }
+    }
+
+    if ((this->nIterations >= this->nMaxIterations) || (rr <= delta_0) ||
+        (rr <= max_threshold)) {
+      break;
+    }
+
+    // m = M^{-1}*w, n = A*m (independent of the reduction above)
+    applyPreconditioner(w, m);
+    SystemMatrix.mult(m, nn);
+
+    double beta = 0.0;
+    double a = 0.0;
+
+    if (this->nIterations > 0) {
+      beta = gamma / gammaOld;
+      const double denominator = delta + beta * (us + pw) + beta * beta * ps;
+
+      if (denominator == 0.0) {
+        break;
+      }
+
+      a = gamma / denominator;
+    } else {
+      if (delta == 0.0) {
+        break;
+      }
+
+      a = gamma / delta;
+    }
+
+    gammaOld = gamma;
+
+    double* xPtr = alpha.getPointer();
+    double* rMutPtr = r.getPointer();
+    double* uMutPtr = u.getPointer();
+    double* wMutPtr = w.getPointer();
+    const double* mPtr = m.getPointer();
+    const double* nPtr = nn.getPointer();
+    double* pPtr = p.getPointer();
+    double* sPtr = s.getPointer();
+    double* qPtr = q.getPointer();
+    double* zPtr = z.getPointer();
+
+#pragma omp parallel for
+    for (size_t i = 0; i < n; i++) {
+      zPtr[i] = nPtr[i] + beta * zPtr[i];
+      qPtr[i] = mPtr[i] + beta * qPtr[i];
+      sPtr[i] = wMutPtr[i] + beta * sPtr[i];
+      pPtr[i] = uMutPtr[i] + beta * pPtr[i];
+      xPtr[i] += a * pPtr[i];
+      rMutPtr[i] -= a * sPtr[i];
+      uMutPtr[i] -= a * qPtr[i];
+      wMutPtr[i] -= a * zPtr[i];
+    }
+
+    this->nIterations++;
+
+    if ((replacementPeriod > 0) && ((this->nIterations % replacementPeriod) == 0)) {
+      // recompute the recursively updated vectors to avoid the accumulation of
+      // rounding errors
+      SystemMatrix.mult(alpha, temp);
+      r.copyFrom(b);
+      r.sub(temp);
+      applyPreconditioner(r, u);
+      SystemMatrix.mult(u, w);
+      SystemMatrix.mult(p, s);
+      applyPreconditioner(s, q);
+      SystemMatrix.mult(q, z);
+    }
+  }
+
+  this->residuum = rr;
+  this->complete();
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final norm of residuum: " << rr << std::endl;
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
@@ -0,0 +1,62 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PIPELINEDCONJUGATEGRADIENTS_HPP
+#define PIPELINEDCONJUGATEGRADIENTS_HPP
+
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Pipelined (preconditioned) conjugate gradients by Ghysels and Vanroose.
+ * The recurrences are rearranged such that each iteration needs only one global
+ * reduction (all dot products of the iteration are computed in one fused pass), which
+ * does not depend on the matrix-vector product of the same iteration. In contrast to the
+ * original formulation, the step size uses \f$(p, s)\f$ expanded in terms of the dot
+ * products of the previous search directions, which is considerably more robust for
+ * badly conditioned systems. All vector updates of an iteration are fused into one parallel
+ * loop, too. This reduces the number of synchronizations and of passes over the vectors,
+ * which improves the multithreaded scaling, at the price of four additional vectors
+ * and slightly worse numerical stability. To counter the latter, the recursively
+ * updated vectors are recomputed every replacementPeriod iterations
+ * (residual replacement).
+ * The iterates and the stopping criterion are the same as for
+ * PreconditionedConjugateGradients (in exact arithmetic).
+ */
+class PipelinedConjugateGradients : public PreconditionedConjugateGradients {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param imax            maximal number of iterations
+   * @param epsilon         relative tolerance for the Euclidean norm of the residual
+   * @param preconditioner  pointer to the preconditioner (not owned,
+   *                        nullptr for no preconditioning)
+   */
+  PipelinedConjugateGradients(size_t imax, double epsilon,
+                              sgpp::base::OperationMatrix* preconditioner = nullptr);
+
+  /**
+   * Std-Destructor
+   */
+  ~PipelinedConjugateGradients() override;
+
+  void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+             sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
+             double max_threshold = -1.0) override;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* PIPELINEDCONJUGATEGRADIENTS_HPP */
@@ -0,0 +1,185 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <iostream>
+
+namespace sgpp {
+namespace solver {
+
+const size_t PreconditionedConjugateGradients::DEFAULT_REPLACEMENT_PERIOD;
+
+PreconditionedConjugateGradients::PreconditionedConjugateGradients(
+    size_t imax, double epsilon, sgpp::base::OperationMatrix* preconditioner)
+    : ConjugateGradients(imax, epsilon),
+      preconditioner(preconditioner),
+      replacementPeriod(DEFAULT_REPLACEMENT_PERIOD) {}
+
+PreconditionedConjugateGradients::~PreconditionedConjugateGradients() {}
+
+void PreconditionedConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                                             sgpp::base::DataVector& alpha,
+                                             sgpp::base::DataVector& b, bool reuse, bool verbose,
+                                             double max_threshold) {
+  this->starting();
+
+  if (verbose == true) {
+    std::cout << "Starting Preconditioned Conjugated Gradients" << std::endl;
+  }
+
+  const size_t n = alpha.getSize();
+  const double epsilonSquared = this->myEpsilon * this->myEpsilon;
+  this->nIterations = 0;
+
+  sgpp::base::DataVector temp(n);
+  sgpp::base::DataVector q(n);
+  sgpp::base::DataVector r(n);
+  sgpp::base::DataVector z(n);
+
+  if (reuse == false) {
+    alpha.setAll(0.0);
+  }
+
+  // r = b - A*x, z = M^{-1}*r
+  SystemMatrix.mult(alpha, temp);
+  r.copyFrom(b);
+  r.sub(temp);
+  applyPreconditioner(r, z);
+
+  sgpp::base::DataVector d(z);
+
+  const double* bPtr = b.getPointer();
+  double* xPtr = alpha.getPointer();
+  double* rPtr = r.getPointer();
+  double* zPtr = z.getPointer();
+  double* dPtr = d.getPointer();
+  double* qPtr = q.getPointer();
+
+  double bb = 0.0;
+  double rr = 0.0;
+  double rz = 0.0;
+
+#pragma omp parallel for reduction(+ : bb, rr, rz)
+  for (size_t i = 0; i < n; i++) {
+    bb += bPtr[i] * bPtr[i];
+    rr += rPtr[i] * rPtr[i];
+    rz += rPtr[i] * zPtr[i];
+  }
+
+  const double delta_0 = bb * epsilonSquared;
+
+  this->residuum = bb;
+  this->calcStarting();
+
+  if (verbose == true) {
+    std::cout << "Starting norm of residuum: " << rr << std::endl;
+    std::cout << "Target norm:               " << delta_0 << std::endl;
+  }
+
+  while ((this->nIterations < this->nMaxIterations) && (rr > delta_0) && (rr > max_threshold)) {
+    // q = A*d
+    SystemMatrix.mult(d, q);
+
+    double dq = 0.0;
+
+#pragma omp parallel for reduction(+ : dq)
+    for (size_t i = 0; i < n; i++) {
+      dq += dPtr[i] * qPtr[i];
+    }
+
+    if (dq == 0.0) {
+      break;
+    }
+
+    const double a = rz / dq;
+
+    if ((replacementPeriod > 0) && (this->nIterations > 0) &&
+        ((this->nIterations % replacementPeriod) == 0)) {
+      // recompute the residual to avoid the accumulation of rounding errors
+      alpha.axpy(a, d);
+      SystemMatrix.mult(alpha, temp);
+      r.copyFrom(b);
+      r.sub(temp);
+    } else {
+      // x = x + a*d, r = r - a*q
+#pragma omp parallel for
+      for (size_t i = 0; i < n; i++) {
+        xPtr[i] += a * dPtr[i];
+        rPtr[i] -= a * qPtr[i];
+      }
+    }
+
+    applyPreconditioner(r, z);
+    zPtr = z.getPointer();
+
+    double rzNew = 0.0;
+    rr = 0.0;
+
+#pragma omp parallel for reduction(+ : rr, rzNew)
+    for (size_t i = 0; i < n; i++) {
+      rr += rPtr[i] * rPtr[i];
+      rzNew += rPtr[i] * zPtr[i];
+    }
+
+    const double beta = rzNew / rz;
+    rz = rzNew;
+
+    this->residuum = rr;
+    this->iterationComplete();
+
+    if (verbose == true) {
+      std::cout << "delta: " << rr << std::endl;
+    }
+
+    // d = z + beta*d
+#pragma omp parallel for
+    for (size_t i = 0; i < n; i++) {
+      dPtr[i] = zPtr[i] + beta * dPtr[i];
+    }
+
+    this->nIterations++;
+  }
+
+  this->residuum = rr;
+  this->complete();
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final norm of residuum: " << rr << std::endl;
+  }
+}
+
+void PreconditionedConjugateGradients::setPreconditioner(
+    sgpp::base::OperationMatrix* preconditioner) {
+  this->preconditioner = preconditioner;
+}
+
+sgpp::base::OperationMatrix* PreconditionedConjugateGradients::getPreconditioner() const {
+  return preconditioner;
+}
+
+void PreconditionedConjugateGradients::setReplacementPeriod(size_t replacementPeriod) {
+  this->replacementPeriod = replacementPeriod;
+}
+
+size_t PreconditionedConjugateGradients::getReplacementPeriod() const {
+  return replacementPeriod;
+}
+
+void PreconditionedConjugateGradients::applyPreconditioner(sgpp::base::DataVector& r,
+                                                           sgpp::base::DataVector& z) {
+  if (preconditioner == nullptr) {
+    z.copyFrom(r);
+  } else {
+    preconditioner->mult(r, z);
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
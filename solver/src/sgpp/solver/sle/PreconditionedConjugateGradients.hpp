@@ -0,0 +1,95 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PRECONDITIONEDCONJUGATEGRADIENTS_HPP
+#define PRECONDITIONEDCONJUGATEGRADIENTS_HPP
+
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Preconditioned conjugate gradients.
+ * The preconditioner is an sgpp::base::OperationMatrix whose mult method applies
+ * \f$M^{-1}\f$ (see Preconditioner and its subclasses); without a preconditioner, the
+ * method is equivalent to ConjugateGradients.
+ * As in ConjugateGradients, the solver stops if the squared Euclidean norm of the
+ * residual (which is also reported as residuum) falls below
+ * \f$\varepsilon^2 \lVert b \rVert_2^2\f$. Both dot products of an iteration are
+ * computed in one fused pass over the vectors. To avoid the accumulation of rounding errors,
+ * the residual is recomputed from its definition every replacementPeriod iterations
+ * (residual replacement).
+ */
+class PreconditionedConjugateGradients : public ConjugateGradients {
+ public:
+  /// default number of iterations between two residual replacements
+  static const size_t DEFAULT_REPLACEMENT_PERIOD = 50;
+
+  /**
+   * Constructor.
+   *
+   * @param imax            maximal number of iterations
+   * @param epsilon         relative tolerance for the Euclidean norm of the residual
+   * @param preconditioner  pointer to the preconditioner (not owned,
+   *                        nullptr for no preconditioning)
+   */
+  PreconditionedConjugateGradients(size_t imax, double epsilon,
+                                   sgpp::base::OperationMatrix* preconditioner = nullptr);
+
+  /**
+   * Std-Destructor
+   */
+  ~PreconditionedConjugateGradients() override;
+
+  void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+             sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
+             double max_threshold = -1.0) override;
+
+  /**
+   * @param preconditioner  pointer to the preconditioner (not owned,
+   *                        nullptr for no preconditioning)
+   */
+  void setPreconditioner(sgpp::base::OperationMatrix* preconditioner);
+
+  /**
+   * @return pointer to the preconditioner (nullptr for no preconditioning)
+   */
+  sgpp::base::OperationMatrix* getPreconditioner() const;
+
+  /**
+   * @param replacementPeriod number of iterations between two residual replacements
+   *                          (0 to disable the replacement)
+   */
+  void setReplacementPeriod(size_t replacementPeriod);
+
+  /**
+   * @return number of iterations between two residual replacements
+   */
+  size_t getReplacementPeriod() const;
+
+ protected:
+  /// preconditioner (nullptr for no preconditioning)
+  sgpp::base::OperationMatrix* preconditioner;
+  /// number of iterations between two residual replacements
+  size_t replacementPeriod;
+
+  /**
+   * Applies the preconditioner, or copies the vector if there is none.
+   *
+   * @param r vector to which the preconditioner is applied
+   * @param z result \f$M^{-1} r\f$
+   */
+  void applyPreconditioner(sgpp::base::DataVector& r, sgpp::base::DataVector& z);
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* PRECONDITIONEDCONJUGATEGRADIENTS_HPP */
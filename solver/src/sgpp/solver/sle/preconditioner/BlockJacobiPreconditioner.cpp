@@ -0,0 +1,212 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/preconditioner/BlockJacobiPreconditioner.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+BlockJacobiPreconditioner::BlockJacobiPreconditioner(
+    size_t size, const std::vector<std::vector<size_t>>& blockIndices,
+    const std::vector<sgpp::base::DataMatrix>& blocks)
+    : size(size), blockIndices(blockIndices) {
+  factorize(blocks);
+}
+
+BlockJacobiPreconditioner::BlockJacobiPreconditioner(const sgpp::base::DataMatrix& systemMatrix,
+                                                     size_t blockSize)
+    : size(systemMatrix.getNrows()) {
+  if ((blockSize == 0) || (systemMatrix.getNcols() != size)) {
+    throw sgpp::base::operation_exception(
+        "BlockJacobiPreconditioner: block size has to be positive and the matrix square");
+  }
+
+  std::vector<sgpp::base::DataMatrix> blocks;
+
+  for (size_t start = 0; start < size; start += blockSize) {
+    const size_t end = std::min(start + blockSize, size);
+    std::vector<size_t> indices;
+    sgpp::base::DataMatrix block(end - start, end - start);
+
+    for (size_t i = start; i < end; i++) {
+      indices.push_back(i);
+
+      for (size_t j = start; j < end; j++) {
+        block(i - start, j - start) = systemMatrix(i, j);
+      }
+    }
+
+    blockIndices.push_back(indices);
+    blocks.push_back(block);
+  }
+
+  factorize(blocks);
+}
+
+BlockJacobiPreconditioner::BlockJacobiPreconditioner(
+    sgpp::base::OperationMatrix& systemMatrix, size_t size,
+    const std::vector<std::vector<size_t>>& blockIndices)
+    : size(size), blockIndices(blockIndices) {
+  std::vector<sgpp::base::DataMatrix> blocks;
+  sgpp::base::DataVector unitVector(size, 0.0);
+  sgpp::base::DataVector column(size);
+
+  for (const std::vector<size_t>& indices : blockIndices) {
+    sgpp::base::DataMatrix block(indices.size(), indices.size());
+
+    for (size_t j = 0; j < indices.size(); j++) {
+      if (indices[j] >= size) {
+        throw sgpp::base::operation_exception(
+            "BlockJacobiPreconditioner: block index out of range");
+      }
+
+      unitVector[indices[j]] = 1.0;
+      systemMatrix.mult(unitVector, column);
+      unitVector[indices[j]] = 0.0;
+
+      for (size_t i = 0; i < indices.size(); i++) {
+        block(i, j) = column[indices[i]];
+      }
+    }
+
+    blocks.push_back(block);
+  }
+
+  factorize(blocks);
+}
+
+BlockJacobiPreconditioner::~BlockJacobiPreconditioner() {}
+
+void BlockJacobiPreconditioner::mult(sgpp::base::DataVector& r, sgpp::base::DataVector& z) {
+  if (r.getSize() != size) {
+    throw sgpp::base::operation_exception(
+        "BlockJacobiPreconditioner::mult: vector size does not match the system size");
+  }
+
+  z = r;
+  const double* rPtr = r.getPointer();
+  double* zPtr = z.getPointer();
+  const size_t numberOfBlocks = blockIndices.size();
+
+#pragma omp parallel
+  {
+    std::vector<double> y;
+
+#pragma omp for schedule(dynamic)
+    for (size_t k = 0; k < numberOfBlocks; k++) {
+      const std::vector<size_t>& indices = blockIndices[k];
+      const sgpp::base::DataMatrix& L = factors[k];
+      const size_t n = indices.size();
+      y.resize(n);
+
+      // forward substitution L*y = r_I
+      for (size_t i = 0; i < n; i++) {
+        double sum = rPtr[indices[i]];
+
+        for (size_t j = 0; j < i; j++) {
+          sum -= L(i, j) * y[j];
+        }
+
+        y[i] = sum / L(i, i);
+      }
+
+      // backward substitution L^T*z_I = y
+      for (size_t i = n; i-- > 0;) {
+        double sum = y[i];
+
+        for (size_t j = i + 1; j < n; j++) {
+          sum -= L(j, i) * y[j];
+        }
+
+        y[i] = sum / L(i, i);
+      }
+
+      for (size_t i = 0; i < n; i++) {
+        zPtr[indices[i]] = y[i];
+      }
+    }
+  }
+}
+
+size_t BlockJacobiPreconditioner::getNumberOfBlocks() const { return blockIndices.size(); }
+
+void BlockJacobiPreconditioner::factorize(const std::vector<sgpp::base::DataMatrix>& blocks) {
+  if (blocks.size() != blockIndices.size()) {
+    throw sgpp::base::operation_exception(
+        "BlockJacobiPreconditioner: number of blocks does not match number of index sets");
+  }
+
+  std::vector<bool> covered(size, false);
+
+  for (const std::vector<size_t>& indices : blockIndices) {
+    for (size_t i : indices) {
+      if ((i >= size) || covered[i]) {
+        throw sgpp::base::operation_exception(
+            "BlockJacobiPreconditioner: block indices are out of range or not disjoint");
+      }
+
+      covered[i] = true;
+    }
+  }
+
+  factors.assign(blocks.size(), sgpp::base::DataMatrix());
+  bool positiveDefinite = true;
+
+#pragma omp parallel for schedule(dynamic) reduction(&& : positiveDefinite)
+  for (size_t k = 0; k < blocks.size(); k++) {
+    const sgpp::base::DataMatrix& A = blocks[k];
+    const size_t n = blockIndices[k].size();
+
+    if ((A.getNrows() != n) || (A.getNcols() != n)) {
+      positiveDefinite = false;
+      continue;
+    }
+
+    sgpp::base::DataMatrix L(n, n, 0.0);
+
+    for (size_t j = 0; j < n; j++) {
+      double sum = A(j, j);
+
+      for (size_t l = 0; l < j; l++) {
+        sum -= L(j, l) * L(j, l);
+      }
+
+      if (!(sum > 0.0)) {
+        positiveDefinite = false;
+        break;
+      }
+
+      L(j, j) = std::sqrt(sum);
+
+      for (size_t i = j + 1; i < n; i++) {
+        double s = A(i, j);
+
+        for (size_t l = 0; l < j; l++) {
+          s -= L(i, l) * L(j, l);
+        }
+
+        L(i, j) = s / L(j, j);
+      }
+    }
+
+    factors[k] = L;
+  }
+
+  if (!positiveDefinite) {
+    throw sgpp::base::operation_exception(
+        "BlockJacobiPreconditioner: blocks have to be symmetric positive definite and "
+        "match the sizes of the index sets");
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
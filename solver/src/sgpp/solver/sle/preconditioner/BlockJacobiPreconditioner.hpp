@@ -0,0 +1,102 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef BLOCKJACOBIPRECONDITIONER_HPP
+#define BLOCKJACOBIPRECONDITIONER_HPP
+
+#include <sgpp/solver/sle/preconditioner/Preconditioner.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Block Jacobi preconditioner \f$M = \operatorname{diag}(A_{I_1,I_1}, \dotsc, A_{I_k,I_k})\f$
+ * for disjoint index sets \f$I_1, \dotsc, I_k\f$.
+ * The diagonal blocks have to be symmetric positive definite; they are factorized
+ * once with a Cholesky decomposition, and the preconditioner solves the small systems
+ * in parallel. Indices that are not contained in any block are left unchanged.
+ *
+ * As sgpp::base::OperationMatrix only provides matrix-vector products, the blocks are
+ * either passed explicitly, taken from an assembled matrix, or extracted by applying the
+ * operation to the unit vectors of the indices in the blocks (one product per index).
+ */
+class BlockJacobiPreconditioner : public Preconditioner {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param size          number of rows of the system matrix
+   * @param blockIndices  disjoint index sets \f$I_1, \dotsc, I_k\f$
+   * @param blocks        diagonal blocks \f$A_{I_j,I_j}\f$
+   *                      (ordered like the indices in blockIndices)
+   */
+  BlockJacobiPreconditioner(size_t size, const std::vector<std::vector<size_t>>& blockIndices,
+                            const std::vector<sgpp::base::DataMatrix>& blocks);
+
+  /**
+   * Constructor that takes the diagonal blocks of consecutive indices from an
+   * assembled system matrix.
+   *
+   * @param systemMatrix  assembled system matrix
+   * @param blockSize     number of rows per block (the last block may be smaller)
+   */
+  BlockJacobiPreconditioner(const sgpp::base::DataMatrix& systemMatrix, size_t blockSize);
+
+  /**
+   * Constructor that extracts the diagonal blocks from a system matrix operation.
+   * This needs one matrix-vector product per index in the blocks, so it pays off only if
+   * the blocks cover few indices or if the preconditioner is reused for many solves.
+   *
+   * @param systemMatrix  system matrix operation
+   * @param size          number of rows of the system matrix
+   * @param blockIndices  disjoint index sets \f$I_1, \dotsc, I_k\f$
+   */
+  BlockJacobiPreconditioner(sgpp::base::OperationMatrix& systemMatrix, size_t size,
+                            const std::vector<std::vector<size_t>>& blockIndices);
+
+  /**
+   * Std-Destructor
+   */
+  ~BlockJacobiPreconditioner() override;
+
+  /**
+   * @param r vector to which the preconditioner is applied
+   * @param z result \f$z_{I_j} = A_{I_j,I_j}^{-1} r_{I_j}\f$
+   */
+  void mult(sgpp::base::DataVector& r, sgpp::base::DataVector& z) override;
+
+  /**
+   * @return number of blocks
+   */
+  size_t getNumberOfBlocks() const;
+
+ protected:
+  /// number of rows of the system matrix
+  size_t size;
+  /// index sets of the blocks
+  std::vector<std::vector<size_t>> blockIndices;
+  /// lower triangular Cholesky factors of the blocks
+  std::vector<sgpp::base::DataMatrix> factors;
+
+  /**
+   * Checks the index sets and computes the Cholesky factors of the blocks.
+   *
+   * @param blocks diagonal blocks
+   */
+  void factorize(const std::vector<sgpp::base::DataMatrix>& blocks);
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* BLOCKJACOBIPRECONDITIONER_HPP */
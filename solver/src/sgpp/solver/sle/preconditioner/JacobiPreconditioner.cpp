@@ -0,0 +1,81 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/preconditioner/JacobiPreconditioner.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+JacobiPreconditioner::JacobiPreconditioner(const sgpp::base::DataVector& diagonal)
+    : inverseDiagonal(diagonal.getSize()), diagonal(diagonal) {
+  invertDiagonal();
+}
+
+JacobiPreconditioner::JacobiPreconditioner(sgpp::base::OperationMatrix& diagonalOperation,
+                                           size_t size, double factor)
+    : inverseDiagonal(size), diagonal(size, 0.0) {
+  addDiagonal(diagonalOperation, factor);
+}
+
+JacobiPreconditioner::~JacobiPreconditioner() {}
+
+void JacobiPreconditioner::mult(sgpp::base::DataVector& r, sgpp::base::DataVector& z) {
+  const size_t n = inverseDiagonal.getSize();
+
+  if (r.getSize() != n) {
+    throw sgpp::base::operation_exception(
+        "JacobiPreconditioner::mult: vector size does not match the diagonal");
+  }
+
+  z.resize(n);
+  const double* rPtr = r.getPointer();
+  const double* dPtr = inverseDiagonal.getPointer();
+  double* zPtr = z.getPointer();
+
+#pragma omp parallel for
+  for (size_t i = 0; i < n; i++) {
+    zPtr[i] = dPtr[i] * rPtr[i];
+  }
+}
+
+void JacobiPreconditioner::addDiagonal(sgpp::base::OperationMatrix& diagonalOperation,
+                                       double factor) {
+  sgpp::base::DataVector ones(diagonal.getSize(), 1.0);
+  sgpp::base::DataVector operationDiagonal(diagonal.getSize());
+  diagonalOperation.mult(ones, operationDiagonal);
+  addDiagonal(operationDiagonal, factor);
+}
+
+void JacobiPreconditioner::addDiagonal(const sgpp::base::DataVector& diagonal, double factor) {
+  if (diagonal.getSize() != this->diagonal.getSize()) {
+    throw sgpp::base::operation_exception(
+        "JacobiPreconditioner::addDiagonal: vector size does not match the diagonal");
+  }
+
+  for (size_t i = 0; i < diagonal.getSize(); i++) {
+    this->diagonal[i] += factor * diagonal[i];
+  }
+
+  invertDiagonal();
+}
+
+const sgpp::base::DataVector& JacobiPreconditioner::getDiagonal() const { return diagonal; }
+
+void JacobiPreconditioner::invertDiagonal() {
+  for (size_t i = 0; i < diagonal.getSize(); i++) {
+    if (diagonal[i] == 0.0) {
+      throw sgpp::base::operation_exception(
+          "JacobiPreconditioner: diagonal of the system matrix contains zeros");
+    }
+
+    inverseDiagonal[i] = 1.0 / diagonal[i];
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
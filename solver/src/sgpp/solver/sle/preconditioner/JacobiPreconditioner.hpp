@@ -0,0 +1,96 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef JACOBIPRECONDITIONER_HPP
+#define JACOBIPRECONDITIONER_HPP
+
+#include <sgpp/solver/sle/preconditioner/Preconditioner.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Jacobi (diagonal) preconditioner \f$M = \operatorname{diag}(A)\f$.
+ * The diagonal is either given explicitly or extracted from an operation that is
+ * known to be diagonal, e.g., sgpp::base::OperationDiagonal or
+ * sgpp::base::OperationIdentity, by applying it to the vector of ones.
+ * Diagonals of several summands (e.g., of \f$B^T B\f$ and \f$\lambda C\f$) can be
+ * accumulated with addDiagonal.
+ */
+class JacobiPreconditioner : public Preconditioner {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param diagonal diagonal of the system matrix (all entries have to be non-zero)
+   */
+  explicit JacobiPreconditioner(const sgpp::base::DataVector& diagonal);
+
+  /**
+   * Constructor.
+   *
+   * @param diagonalOperation operation that is diagonal
+   *                          (e.g., sgpp::base::OperationDiagonal)
+   * @param size              number of rows of the system matrix
+   * @param factor            factor with which the diagonal is scaled
+   *                          (e.g., the regularization parameter)
+   */
+  JacobiPreconditioner(sgpp::base::OperationMatrix& diagonalOperation, size_t size,
+                       double factor = 1.0);
+
+  /**
+   * Std-Destructor
+   */
+  ~JacobiPreconditioner() override;
+
+  /**
+   * @param r vector to which the preconditioner is applied
+   * @param z result \f$z_i = r_i / a_{ii}\f$
+   */
+  void mult(sgpp::base::DataVector& r, sgpp::base::DataVector& z) override;
+
+  /**
+   * Adds the scaled diagonal of another diagonal operation to the diagonal.
+   *
+   * @param diagonalOperation operation that is diagonal
+   * @param factor            factor with which the diagonal is scaled
+   */
+  void addDiagonal(sgpp::base::OperationMatrix& diagonalOperation, double factor = 1.0);
+
+  /**
+   * Adds a scaled vector to the diagonal.
+   *
+   * @param diagonal diagonal to be added
+   * @param factor   factor with which the diagonal is scaled
+   */
+  void addDiagonal(const sgpp::base::DataVector& diagonal, double factor = 1.0);
+
+  /**
+   * @return diagonal of the system matrix
+   */
+  const sgpp::base::DataVector& getDiagonal() const;
+
+ protected:
+  /// reciprocals of the diagonal entries
+  sgpp::base::DataVector inverseDiagonal;
+  /// diagonal entries
+  sgpp::base::DataVector diagonal;
+
+  /**
+   * Recomputes the reciprocals of the diagonal entries.
+   */
+  void invertDiagonal();
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* JACOBIPRECONDITIONER_HPP */
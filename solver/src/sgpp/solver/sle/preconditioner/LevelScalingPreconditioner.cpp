@@ -0,0 +1,61 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/preconditioner/LevelScalingPreconditioner.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+
+namespace sgpp {
+namespace solver {
+
+LevelScalingPreconditioner::LevelScalingPreconditioner(sgpp::base::GridStorage& gridStorage,
+                                                       double levelBase)
+    : gridStorage(gridStorage), levelBase(levelBase), scaling(0), modificationCount(0) {
+  calculateScaling();
+}
+
+LevelScalingPreconditioner::~LevelScalingPreconditioner() {}
+
+void LevelScalingPreconditioner::mult(sgpp::base::DataVector& r, sgpp::base::DataVector& z) {
+  if (modificationCount != gridStorage.getModificationCount()) {
+    calculateScaling();
+  }
+
+  const size_t n = scaling.getSize();
+
+  if (r.getSize() != n) {
+    throw sgpp::base::operation_exception(
+        "LevelScalingPreconditioner::mult: vector size does not match the grid size");
+  }
+
+  z.resize(n);
+  const double* rPtr = r.getPointer();
+  const double* sPtr = scaling.getPointer();
+  double* zPtr = z.getPointer();
+
+#pragma omp parallel for
+  for (size_t i = 0; i < n; i++) {
+    zPtr[i] = sPtr[i] * rPtr[i];
+  }
+}
+
+void LevelScalingPreconditioner::calculateScaling() {
+  const size_t n = gridStorage.getSize();
+  const double dim = static_cast<double>(gridStorage.getDimension());
+  scaling.resize(n);
+
+  for (size_t i = 0; i < n; i++) {
+    const double levelSum = static_cast<double>(gridStorage.getPoint(i).getLevelSum());
+    scaling[i] = std::pow(levelBase, levelSum - dim);
+  }
+
+  modificationCount = gridStorage.getModificationCount();
+}
+
+}  // namespace solver
+}  // namespace sgpp
@@ -0,0 +1,71 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef LEVELSCALINGPRECONDITIONER_HPP
+#define LEVELSCALINGPRECONDITIONER_HPP
+
+#include <sgpp/solver/sle/preconditioner/Preconditioner.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstdint>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Level-based diagonal scaling \f$z_i = c^{\vert \mathbf{l}_i \vert_1 - d} r_i\f$ for
+ * systems of sparse grid basis functions.
+ * The diagonal entries of mass matrices and of \f$B^T B\f$ (for uniformly distributed
+ * data) are proportional to the volume of the supports of the basis functions, i.e.,
+ * to \f$2^{-\vert \mathbf{l} \vert_1}\f$. Hence, for \f$c = 2\f$, this is an approximation
+ * of the Jacobi preconditioner that does not need the diagonal of the system matrix.
+ * The scaling factors are recomputed if the grid points have been modified (e.g., by
+ * refinement or coarsening), as detected by GridStorage::getModificationCount().
+ */
+class LevelScalingPreconditioner : public Preconditioner {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param gridStorage grid storage of the sparse grid
+   * @param levelBase   base \f$c\f$ of the scaling
+   */
+  explicit LevelScalingPreconditioner(sgpp::base::GridStorage& gridStorage,
+                                      double levelBase = 2.0);
+
+  /**
+   * Std-Destructor
+   */
+  ~LevelScalingPreconditioner() override;
+
+  /**
+   * @param r vector to which the preconditioner is applied
+   * @param z result \f$z_i = c^{\vert \mathbf{l}_i \vert_1 - d} r_i\f$
+   */
+  void mult(sgpp::base::DataVector& r, sgpp::base::DataVector& z) override;
+
+ protected:
+  /// grid storage
+  sgpp::base::GridStorage& gridStorage;
+  /// base of the scaling
+  double levelBase;
+  /// scaling factors
+  sgpp::base::DataVector scaling;
+  /// modification count of the grid storage when the scaling factors were computed
+  uint64_t modificationCount;
+
+  /**
+   * Computes the scaling factors for the current grid.
+   */
+  void calculateScaling();
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* LEVELSCALINGPRECONDITIONER_HPP */
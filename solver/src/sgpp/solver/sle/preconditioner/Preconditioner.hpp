@@ -0,0 +1,43 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PRECONDITIONER_HPP
+#define PRECONDITIONER_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Abstract preconditioner for the iterative SLE solvers.
+ * A preconditioner is an sgpp::base::OperationMatrix whose mult method applies the
+ * inverse \f$M^{-1}\f$ of an approximation \f$M \approx A\f$ of the system matrix, i.e.,
+ * mult(r, z) computes \f$z = M^{-1} r\f$.
+ * Preconditioners for conjugate gradient methods have to be symmetric positive definite.
+ */
+class Preconditioner : public sgpp::base::OperationMatrix {
+ public:
+  /**
+   * Std-Destructor
+   */
+  ~Preconditioner() override {}
+
+  /**
+   * Applies the preconditioner.
+   *
+   * @param r vector to which the preconditioner is applied (e.g., the residual)
+   * @param z result \f$M^{-1} r\f$ (resized if necessary)
+   */
+  void mult(sgpp::base::DataVector& r, sgpp::base::DataVector& z) override = 0;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* PRECONDITIONER_HPP */
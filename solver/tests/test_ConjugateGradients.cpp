@@ -0,0 +1,442 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationDiagonal.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/solver/sle/BlockConjugateGradients.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
+#include <sgpp/solver/sle/preconditioner/BlockJacobiPreconditioner.hpp>
+#include <sgpp/solver/sle/preconditioner/JacobiPreconditioner.hpp>
+#include <sgpp/solver/sle/preconditioner/LevelScalingPreconditioner.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::OperationMatrix;
+using sgpp::solver::BlockConjugateGradients;
+using sgpp::solver::BlockJacobiPreconditioner;
+using sgpp::solver::ConjugateGradients;
+using sgpp::solver::JacobiPreconditioner;
+using sgpp::solver::LevelScalingPreconditioner;
+using sgpp::solver::PipelinedConjugateGradients;
+using sgpp::solver::PreconditionedConjugateGradients;
+
+namespace {
+
+class DenseOperationMatrix : public OperationMatrix {
+ public:
+  explicit DenseOperationMatrix(const DataMatrix& A) : A(A) {}
+
+  void mult(DataVector& alpha, DataVector& result) override {
+    numberOfMults++;
+    result.resize(A.getNrows());
+    A.mult(alpha, result);
+  }
+
+  // counts the multiplications with several vectors at once
+  void mult(DataMatrix& alpha, DataMatrix& result) override {
+    numberOfBlockMults++;
+    OperationMatrix::mult(alpha, result);
+  }
+
+  size_t numberOfMults = 0;
+  size_t numberOfBlockMults = 0;
+
+ protected:
+  DataMatrix A;
+};
+
+// SPD matrix diag(s) * K * diag(s) with K = tridiag(-1, 4, -1) plus a weak coupling of
+// blocks of size four, where the scaling factors s_i range from 10^(-e/2) to 10^(e/2)
+DataMatrix createScaledMatrix(size_t n, double e) {
+  DataMatrix A(n, n, 0.0);
+
+  for (size_t i = 0; i < n; i++) {
+    A(i, i) = 4.0;
+
+    if (i + 1 < n) {
+      A(i, i + 1) = -1.0;
+      A(i + 1, i) = -1.0;
+    }
+
+    for (size_t j = (i / 4) * 4; j < std::min((i / 4) * 4 + 4, n); j++) {
+      if (j != i) {
+        A(i, j) += 0.5;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    const double si = std::pow(10.0, static_cast<double>(i % 5) / 4.0 * e - e / 2.0);
+
+    for (size_t j = 0; j < n; j++) {
+      const double sj = std::pow(10.0, static_cast<double>(j % 5) / 4.0 * e - e / 2.0);
+      A(i, j) *= si * sj;
+    }
+  }
+
+  return A;
+}
+
+DataVector createRightHandSide(size_t n) {
+  DataVector b(n);
+
+  for (size_t i = 0; i < n; i++) {
+    b[i] = std::sin(static_cast<double>(i) + 1.0);
+  }
+
+  return b;
+}
+
+double relativeResidual(OperationMatrix& A, DataVector& x, DataVector& b) {
+  DataVector Ax(x.getSize());
+  A.mult(x, Ax);
+  Ax.sub(b);
+  return Ax.l2Norm() / b.l2Norm();
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestConjugateGradients)
+
+BOOST_AUTO_TEST_CASE(TestPreconditionedConjugateGradients) {
+  const size_t n = 200;
+  const double eps = 1e-10;
+  DataMatrix matrix = createScaledMatrix(n, 4.0);
+  DenseOperationMatrix A(matrix);
+  DataVector b = createRightHandSide(n);
+
+  ConjugateGradients cg(10000, eps);
+  DataVector xCG(n);
+  cg.solve(A, xCG, b);
+  BOOST_CHECK_LT(relativeResidual(A, xCG, b), 1e-8);
+
+  // without preconditioner, PCG has to behave like CG
+  PreconditionedConjugateGradients pcg(10000, eps);
+  DataVector xPCG(n);
+  pcg.solve(A, xPCG, b);
+  BOOST_CHECK_LT(relativeResidual(A, xPCG, b), 1e-8);
+  BOOST_CHECK_LE(pcg.getNumberIterations(), cg.getNumberIterations() + 1);
+
+  // Jacobi
+  DataVector diagonal(n);
+
+  for (size_t i = 0; i < n; i++) {
+    diagonal[i] = matrix(i, i);
+  }
+
+  JacobiPreconditioner jacobi(diagonal);
+  pcg.setPreconditioner(&jacobi);
+  DataVector xJacobi(n);
+  pcg.solve(A, xJacobi, b);
+  BOOST_CHECK_LT(relativeResidual(A, xJacobi, b), 1e-8);
+  BOOST_CHECK_LT(2 * pcg.getNumberIterations(), cg.getNumberIterations());
+
+  // block Jacobi with the coupled blocks, once from the assembled matrix and once
+  // extracted from the operation
+  BlockJacobiPreconditioner blockJacobi(matrix, 4);
+  BOOST_CHECK_EQUAL(blockJacobi.getNumberOfBlocks(), n / 4);
+  pcg.setPreconditioner(&blockJacobi);
+  DataVector xBlockJacobi(n);
+  pcg.solve(A, xBlockJacobi, b);
+  BOOST_CHECK_LT(relativeResidual(A, xBlockJacobi, b), 1e-8);
+  BOOST_CHECK_LT(2 * pcg.getNumberIterations(), cg.getNumberIterations());
+
+  std::vector<std::vector<size_t>> blockIndices;
+
+  for (size_t i = 0; i < n; i += 4) {
+    blockIndices.push_back({i, i + 1, i + 2, i + 3});
+  }
+
+  BlockJacobiPreconditioner blockJacobiOperation(A, n, blockIndices);
+  DataVector z1(n);
+  DataVector z2(n);
+  blockJacobi.mult(b, z1);
+  blockJacobiOperation.mult(b, z2);
+
+  for (size_t i = 0; i < n; i++) {
+    BOOST_CHECK_CLOSE(z1[i], z2[i], 1e-10);
+  }
+
+  // one block is the exact inverse
+  BlockJacobiPreconditioner exact(matrix, n);
+  pcg.setPreconditioner(&exact);
+  pcg.solve(A, xBlockJacobi, b);
+  BOOST_CHECK_LE(pcg.getNumberIterations(), 2);
+
+  // one product for the initial residual, one per iteration, plus residual replacements
+  // every replacementPeriod iterations (or none)
+  BOOST_CHECK_EQUAL(pcg.getReplacementPeriod(),
+                    PreconditionedConjugateGradients::DEFAULT_REPLACEMENT_PERIOD);
+  pcg.setPreconditioner(nullptr);
+
+  for (size_t period : {0, 10}) {
+    pcg.setReplacementPeriod(period);
+    A.numberOfMults = 0;
+    DataVector x(n);
+    pcg.solve(A, x, b);
+    const size_t iterations = pcg.getNumberIterations();
+    BOOST_CHECK_EQUAL(A.numberOfMults,
+                      1 + iterations + ((period == 0) ? 0 : (iterations - 1) / period));
+    BOOST_CHECK_LT(relativeResidual(A, x, b), 1e-8);
+  }
+
+  // invalid blocks
+  BOOST_CHECK_THROW(BlockJacobiPreconditioner(n, {{0, 1}, {1, 2}},
+                                              {DataMatrix(2, 2, 1.0), DataMatrix(2, 2, 1.0)}),
+                    sgpp::base::operation_exception);
+  DataMatrix indefinite(2, 2, 1.0);
+  indefinite(0, 0) = -1.0;
+  BOOST_CHECK_THROW(BlockJacobiPreconditioner(n, {{0, 1}}, {indefinite}),
+                    sgpp::base::operation_exception);
+}
+
+BOOST_AUTO_TEST_CASE(TestPipelinedConjugateGradients) {
+  const size_t n = 200;
+  const double eps = 1e-10;
+  DataVector b = createRightHandSide(n);
+
+  // moderately scaled matrix without preconditioner, badly scaled matrix with
+  // (block) Jacobi preconditioner
+  DataMatrix moderateMatrix = createScaledMatrix(n, 1.0);
+  DataMatrix badMatrix = createScaledMatrix(n, 4.0);
+  DataVector badDiagonal(n);
+
+  for (size_t i = 0; i < n; i++) {
+    badDiagonal[i] = badMatrix(i, i);
+  }
+
+  DenseOperationMatrix moderateA(moderateMatrix);
+  DenseOperationMatrix badA(badMatrix);
+  JacobiPreconditioner jacobi(badDiagonal);
+  BlockJacobiPreconditioner blockJacobi(badMatrix, 4);
+
+  std::vector<std::pair<OperationMatrix*, OperationMatrix*>> problems{
+      {&moderateA, nullptr}, {&badA, &jacobi}, {&badA, &blockJacobi}};
+
+  PreconditionedConjugateGradients pcg(10000, eps);
+  PipelinedConjugateGradients pipelinedCG(10000, eps);
+
+  for (auto& problem : problems) {
+    OperationMatrix& A = *problem.first;
+    pcg.setPreconditioner(problem.second);
+    pipelinedCG.setPreconditioner(problem.second);
+
+    DataVector xPCG(n);
+    DataVector xPipelined(n);
+    pcg.solve(A, xPCG, b);
+    pipelinedCG.solve(A, xPipelined, b);
+
+    BOOST_CHECK_LT(relativeResidual(A, xPipelined, b), 1e-8);
+    BOOST_CHECK_LE(pipelinedCG.getNumberIterations(), pcg.getNumberIterations() + 5);
+    BOOST_CHECK_LE(pipelinedCG.getResiduum(), eps * eps * b.dotProduct(b));
+
+    // reuse the solution as initial guess
+    pipelinedCG.solve(A, xPipelined, b, true);
+    BOOST_CHECK_LE(pipelinedCG.getNumberIterations(), 1);
+  }
+
+  // the maximal number of iterations is respected
+  PipelinedConjugateGradients pipelinedCGFewIterations(3, eps);
+  DataVector x(n);
+  pipelinedCGFewIterations.solve(moderateA, x, b);
+  BOOST_CHECK_EQUAL(pipelinedCGFewIterations.getNumberIterations(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(TestBlockConjugateGradients) {
+  const size_t n = 200;
+  const size_t k = 5;
+  const double eps = 1e-10;
+  DataMatrix matrix = createScaledMatrix(n, 1.0);
+  DenseOperationMatrix A(matrix);
+
+  // right-hand sides of different difficulty (the last one is zero)
+  DataMatrix b(n, k, 0.0);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j + 1 < k; j++) {
+      b(i, j) = std::sin(static_cast<double>((j + 1) * i) + 1.0);
+    }
+  }
+
+  BlockConjugateGradients blockCG(1000, eps);
+  DataMatrix x;
+  blockCG.solve(A, x, b);
+
+  BOOST_CHECK_EQUAL(x.getNrows(), n);
+  BOOST_CHECK_EQUAL(x.getNcols(), k);
+  // one product for the initial residual, one per iteration, plus residual replacements
+  BOOST_CHECK_EQUAL(A.numberOfBlockMults,
+                    1 + blockCG.getNumberIterations() + blockCG.getNumberIterations() / 50);
+
+  ConjugateGradients cg(1000, eps);
+
+  for (size_t j = 0; j < k; j++) {
+    DataVector bColumn(n);
+    DataVector xColumn(n);
+    b.getColumn(j, bColumn);
+    x.getColumn(j, xColumn);
+
+    if (j + 1 < k) {
+      BOOST_CHECK_LT(relativeResidual(A, xColumn, bColumn), 1e-8);
+      BOOST_CHECK_LE(blockCG.getResiduals()[j], eps * eps * bColumn.dotProduct(bColumn));
+
+      // every column converges like CG
+      DataVector xCG(n);
+      cg.solve(A, xCG, bColumn);
+      BOOST_CHECK_LE(blockCG.getColumnIterations()[j], cg.getNumberIterations() + 1);
+      BOOST_CHECK_GE(blockCG.getColumnIterations()[j] + 1, cg.getNumberIterations());
+    } else {
+      BOOST_CHECK_EQUAL(xColumn.l2Norm(), 0.0);
+      BOOST_CHECK_EQUAL(blockCG.getColumnIterations()[j], 0);
+    }
+  }
+
+  // configurable residual replacement (0 disables it)
+  for (size_t period : {0, 7}) {
+    blockCG.setReplacementPeriod(period);
+    A.numberOfBlockMults = 0;
+    DataMatrix xPeriod;
+    blockCG.solve(A, xPeriod, b);
+    const size_t iterations = blockCG.getNumberIterations();
+    BOOST_CHECK_EQUAL(A.numberOfBlockMults,
+                      1 + iterations + ((period == 0) ? 0 : iterations / period));
+
+    for (size_t j = 0; j + 1 < k; j++) {
+      DataVector bColumn(n);
+      b.getColumn(j, bColumn);
+      BOOST_CHECK_LE(blockCG.getResiduals()[j], eps * eps * bColumn.dotProduct(bColumn));
+    }
+  }
+
+  blockCG.setReplacementPeriod(BlockConjugateGradients::DEFAULT_REPLACEMENT_PERIOD);
+
+  // reuse the solution as initial guess
+  blockCG.solve(A, x, b, true);
+  BOOST_CHECK_LE(blockCG.getNumberIterations(), 1);
+
+  // one right-hand side
+  DataVector bVector(n);
+  DataVector xVector(n);
+  b.getColumn(0, bVector);
+  blockCG.solve(A, xVector, bVector);
+  BOOST_CHECK_LT(relativeResidual(A, xVector, bVector), 1e-8);
+}
+
+BOOST_AUTO_TEST_CASE(TestBlockConjugateGradientsBreakdown) {
+  // singular diagonal matrix, the second right-hand side lies in its null space
+  const size_t n = 10;
+  DataMatrix matrix(n, n, 0.0);
+  DataMatrix b(n, 2, 0.0);
+
+  for (size_t i = 0; i < n / 2; i++) {
+    matrix.set(i, i, static_cast<double>(i + 1));
+    b(i, 0) = 1.0;
+    b(i + n / 2, 1) = 1.0;
+  }
+
+  DenseOperationMatrix A(matrix);
+  BlockConjugateGradients blockCG(100, 1e-10);
+  DataMatrix x;
+  blockCG.solve(A, x, b);
+
+  BOOST_CHECK_EQUAL(blockCG.getBrokenDownColumns().size(), 1);
+  BOOST_CHECK_EQUAL(blockCG.getBrokenDownColumns()[0], 1);
+  BOOST_CHECK_EQUAL(blockCG.getColumnIterations()[1], 1);
+  BOOST_CHECK_EQUAL(blockCG.getResiduals()[1], static_cast<double>(n / 2));
+  BOOST_CHECK_LE(blockCG.getResiduals()[0], 1e-20 * static_cast<double>(n / 2));
+
+  // the record is reset for the next system, which does not break down
+  DataMatrix regularMatrix = createScaledMatrix(n, 1.0);
+  DenseOperationMatrix regularA(regularMatrix);
+  blockCG.solve(regularA, x, b);
+  BOOST_CHECK(blockCG.getBrokenDownColumns().empty());
+}
+
+BOOST_AUTO_TEST_CASE(TestDiagonalPreconditioners) {
+  const size_t dim = 3;
+  const size_t level = 4;
+  const double eps = 1e-12;
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(level);
+  sgpp::base::GridStorage& gridStorage = grid->getStorage();
+  const size_t n = gridStorage.getSize();
+
+  // system matrix with the entries 2^{-(|l|_1 - d)}
+  sgpp::base::OperationDiagonal A(&gridStorage, 2.0);
+  DataVector b(n, 1.0);
+
+  PreconditionedConjugateGradients pcg(1000, eps);
+  DataVector x(n);
+  pcg.solve(A, x, b);
+  const size_t unpreconditionedIterations = pcg.getNumberIterations();
+  BOOST_CHECK_GE(unpreconditionedIterations, level);
+
+  // both preconditioners are exact for this system
+  LevelScalingPreconditioner levelScaling(gridStorage, 2.0);
+  JacobiPreconditioner jacobi(A, n);
+
+  for (OperationMatrix* preconditioner :
+       std::vector<OperationMatrix*>{&levelScaling, &jacobi}) {
+    pcg.setPreconditioner(preconditioner);
+    pcg.solve(A, x, b);
+    BOOST_CHECK_EQUAL(pcg.getNumberIterations(), 1);
+    BOOST_CHECK_LT(relativeResidual(A, x, b), 1e-12);
+  }
+
+  // accumulation of diagonals
+  sgpp::base::OperationDiagonal C(&gridStorage, 0.25);
+  jacobi.addDiagonal(C, 1e-3);
+
+  for (size_t i = 0; i < n; i++) {
+    const double levelSum = static_cast<double>(gridStorage.getPoint(i).getLevelSum());
+    BOOST_CHECK_CLOSE(jacobi.getDiagonal()[i],
+                      std::pow(0.5, levelSum - dim) + 1e-3 * std::pow(4.0, levelSum - dim),
+                      1e-12);
+  }
+
+  // the level scaling adapts to refined grids
+  gridStorage.clear();
+  grid->getGenerator().regular(level + 1);
+  DataVector r(grid->getSize(), 1.0);
+  DataVector z;
+  levelScaling.mult(r, z);
+  BOOST_CHECK_EQUAL(z.getSize(), grid->getSize());
+  BOOST_CHECK_THROW(jacobi.mult(r, z), sgpp::base::operation_exception);
+
+  // ... and to modified grids of the same size: replace the last point by one of its children
+  const size_t m = grid->getSize();
+  sgpp::base::GridPoint child(gridStorage.getPoint(m - 1));
+  child.set(0, child.getLevel(0) + 1, 2 * child.getIndex(0) + 1);
+  std::list<size_t> removedPoints{m - 1};
+  gridStorage.deletePoints(removedPoints);
+  gridStorage.insert(child);
+  BOOST_REQUIRE_EQUAL(grid->getSize(), m);
+  levelScaling.mult(r, z);
+
+  for (size_t i = 0; i < m; i++) {
+    const double levelSum = static_cast<double>(gridStorage.getPoint(i).getLevelSum());
+    BOOST_CHECK_CLOSE(z[i], std::pow(2.0, levelSum - dim), 1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()